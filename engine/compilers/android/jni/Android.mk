@@ -185,6 +185,7 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/2d/core/ImageFrameProvider.cc \
 					../../../source/2d/core/ImageFrameProviderCore.cc \
 					../../../source/2d/core/ParticleSystem.cc \
+					../../../source/2d/core/ParticleStore.cc \
 					../../../source/2d/core/RenderProxy.cc \
 					../../../source/2d/core/SpriteBase.cc \
 					../../../source/2d/core/SpriteBatch.cc \
@@ -219,6 +220,8 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/assets/assetBase.cc \
 					../../../source/assets/assetFieldTypes.cc \
 					../../../source/assets/assetManager.cc \
+					../../../source/assets/assetManifestCache.cc \
+					../../../source/assets/assetAsyncAcquirer.cc \
 					../../../source/assets/assetQuery.cc \
 					../../../source/assets/assetTagsManifest.cc \
 					../../../source/assets/declaredAssets.cc \
@@ -282,6 +285,7 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/console/ConsoleTypeValidators.cc \
 					../../../source/console/metaScripting_ScriptBinding.cc \
 					../../../source/debug/profiler.cc \
+					../../../source/debug/profilerTrace.cc \
 					../../../source/debug/remote/RemoteDebugger1.cc \
 					../../../source/debug/remote/RemoteDebuggerBase.cc \
 					../../../source/debug/remote/RemoteDebuggerBridge.cc \
@@ -304,6 +308,7 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/graphics/TextureDictionary.cc \
 					../../../source/graphics/TextureHandle.cc \
 					../../../source/graphics/TextureManager.cc \
+					../../../source/graphics/TextureAtlas.cc \
 					../../../source/gui/containers/guiGridCtrl.cc \
 					../../../source/gui/guiArrayCtrl.cc \
 					../../../source/gui/guiBackgroundCtrl.cc \
@@ -366,6 +371,7 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/io/zip/zipTempStream.cc \
 					../../../source/math/rectClipper.cpp \
 					../../../source/memory/dataChunker.cc \
+					../../../source/memory/frameArena.cc \
 					../../../source/memory/frameAllocator_ScriptBinding.cc \
 					../../../source/messaging/dispatcher.cc \
 					../../../source/messaging/eventManager.cc \
@@ -399,6 +405,9 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/persistence/taml/taml.cc \
 					../../../source/persistence/taml/tamlCustom.cc \
 					../../../source/persistence/taml/tamlWriteNode.cc \
+					../../../source/persistence/taml/tamlAsyncReader.cc \
+					../../../source/persistence/taml/tamlReadNodeParser.cc \
+					../../../source/persistence/taml/tamlReadNode.cc \
 					../../../source/persistence/taml/xml/tamlXmlParser.cc \
 					../../../source/persistence/taml/xml/tamlXmlReader.cc \
 					../../../source/persistence/taml/xml/tamlXmlWriter.cc \
@@ -431,6 +440,7 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/console/consoleObject.cc \
 					../../../source/console/consoleParser.cc \
 					../../../source/console/consoleTypes.cc \
+					../../../source/console/scriptCompileService.cc \
 					../../../source/game/gameConnection.cc \
 					../../../source/game/version.cc \
 					../../../source/math/math_ScriptBinding.cc \
@@ -466,6 +476,7 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/platform/menus/popupMenu.cc \
 					../../../source/platform/nativeDialogs/msgBox.cpp \
 					../../../source/platform/Tickable.cc \
+					../../../source/platform/threads/jobSystem.cc \
 					../../../source/platformAndroid/AndroidAlerts.cpp \
 					../../../source/platformAndroid/AndroidAudio.cpp \
 					../../../source/platformAndroid/AndroidConsole.cpp \
@@ -505,6 +516,7 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/sim/simDictionary.cc \
 					../../../source/sim/simFieldDictionary.cc \
 					../../../source/sim/simManager.cc \
+					../../../source/sim/simEventQueue.cc \
 					../../../source/sim/simObject.cc \
 					../../../source/sim/SimObjectList.cc \
 					../../../source/sim/simSerialize.cpp \
@@ -569,7 +581,29 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/gui/editor/guiSeparatorCtrl.cc 
 #					../../../source/testing/tests/platformFileIoTests.cc \
 #					../../../source/testing/tests/platformMemoryTests.cc \
+#					../../../source/testing/tests/platformJobSystemTests.cc \
 #					../../../source/testing/tests/platformStringTests.cc \
+#					../../../source/testing/tests/simEventQueueTests.cc \
+#					../../../source/testing/tests/physicsWorldTests.cc \
+#					../../../source/testing/tests/profilerTraceTests.cc \
+#					../../../source/testing/tests/consoleDSOTests.cc \
+#					../../../source/testing/tests/textureAtlasTests.cc \
+#					../../../source/testing/tests/assetAsyncAcquirerTests.cc \
+#					../../../source/testing/tests/assetManifestCacheTests.cc \
+#					../../../source/testing/tests/skeletonObjectTests.cc \
+#					../../../source/testing/tests/spriteBatchTests.cc \
+#					../../../source/testing/tests/platformNetTests.cc \
+#					../../../source/testing/tests/netGhostTests.cc \
+#					../../../source/testing/tests/tamlReadTests.cc \
+#					../../../source/testing/tests/consoleTypedFieldTests.cc \
+#					../../../source/testing/tests/consoleCallSiteTests.cc \
+#					../../../source/testing/tests/frameArenaTests.cc \
+#					../../../source/testing/tests/particleAssetFieldTests.cc \
+#					../../../source/testing/tests/particleStoreTests.cc \
+#					../../../source/testing/tests/sceneTickTests.cc \
+#					../../../source/testing/tests/sceneVisibilityCacheTests.cc \
+#					../../../source/testing/tests/sceneRenderQueueTests.cc \
+#					../../../source/testing/tests/batchRenderTests.cc \
 #					../../../source/testing/unitTesting.cc
  
 ifeq ($(APP_OPTIM),debug)
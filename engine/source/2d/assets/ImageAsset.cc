@@ -40,6 +40,10 @@
 #include "graphics/gBitmap.h"
 #endif
 
+#ifndef _TEXTURE_ATLAS_H_
+#include "graphics/TextureAtlas.h"
+#endif
+
 #ifndef _UTILITY_H_
 #include "2d/core/Utility.h"
 #endif
@@ -161,6 +165,7 @@ const char* ImageAsset::getFilterModeDescription( ImageAsset::TextureFilterMode
 
 ImageAsset::ImageAsset() :  mImageFile(StringTable->EmptyString),
                             mForce16Bit(false),
+                            mAtlas(true),
                             mLocalFilterMode(FILTER_INVALID),
                             mExplicitMode(false),
                             mCellRowOrder(true),
@@ -173,7 +178,8 @@ ImageAsset::ImageAsset() :  mImageFile(StringTable->EmptyString),
                             mCellWidth(0),
                             mCellHeight(0),
 
-                            mImageTextureHandle(NULL)
+                            mImageTextureHandle(NULL),
+                            mAtlasEntryId(0)
 {
     // Set Vector Associations.
     VECTOR_SET_ASSOCIATION( mFrames );
@@ -196,6 +202,7 @@ void ImageAsset::initPersistFields()
     // Fields.
     addProtectedField("ImageFile", TypeAssetLooseFilePath, Offset(mImageFile, ImageAsset), &setImageFile, &getImageFile, &defaultProtectedWriteFn, "");
     addProtectedField("Force16bit", TypeBool, Offset(mForce16Bit, ImageAsset), &setForce16Bit, &defaultProtectedGetFn, &writeForce16Bit, "");
+    addProtectedField("Atlas", TypeBool, Offset(mAtlas, ImageAsset), &setAtlas, &defaultProtectedGetFn, &writeAtlas, "");
     addProtectedField("FilterMode", TypeEnum, Offset(mLocalFilterMode, ImageAsset), &setFilterMode, &defaultProtectedGetFn, &writeFilterMode, 1, &textureFilterTable);   
     addProtectedField("ExplicitMode", TypeBool, Offset(mExplicitMode, ImageAsset), &setExplicitMode, &defaultProtectedGetFn, &defaultProtectedNotWriteFn, "");
 
@@ -225,6 +232,14 @@ bool ImageAsset::onAdd()
 
 void ImageAsset::onRemove()
 {
+    // Release the texture atlas entry.
+    if ( mAtlasEntryId != 0 )
+    {
+        TextureAtlas::release( mAtlasEntryId );
+        mAtlasEntryId = 0;
+        mImageTextureHandle.clear();
+    }
+
     // Call Parent.
     Parent::onRemove();
 }
@@ -266,6 +281,7 @@ void ImageAsset::copyTo(SimObject* object)
     // Copy state.
     pAsset->setImageFile( getImageFile() );
     pAsset->setForce16Bit( getForce16Bit() );
+    pAsset->setAtlas( getAtlas() );
     pAsset->setFilterMode( getFilterMode() );
     pAsset->setExplicitMode( getExplicitMode() );
     pAsset->setCellRowOrder( getCellRowOrder() );
@@ -318,6 +334,21 @@ void ImageAsset::setForce16Bit( const bool force16Bit )
 
 //------------------------------------------------------------------------------
 
+void ImageAsset::setAtlas( const bool atlas )
+{
+    // Ignore no change,
+    if ( atlas == mAtlas )
+        return;
+
+    // Update.
+    mAtlas = atlas;
+
+    // Refresh the asset.
+    refreshAsset();
+}
+
+//------------------------------------------------------------------------------
+
 void ImageAsset::setFilterMode( const ImageAsset::TextureFilterMode filterMode )
 {
     // Ignore no change,
@@ -1031,33 +1062,30 @@ void ImageAsset::setTextureFilter( const TextureFilterMode filterMode )
     if ( mImageTextureHandle.IsNull() )
         return;
 
-    // Select Hardware Filter Mode.
-    GLint glFilterMode;
+    // Set the texture objects filter mode.
+    mImageTextureHandle.setFilter( getGLFilterMode( filterMode ) );
+}
 
+//------------------------------------------------------------------------------
+
+GLuint ImageAsset::getGLFilterMode( const TextureFilterMode filterMode )
+{
+    // Select Hardware Filter Mode.
     switch( filterMode )
     {
         // Nearest ("none").
         case FILTER_NEAREST:
-        {
-            glFilterMode = GL_NEAREST;
-
-        } break;
+            return GL_NEAREST;
 
         // Bilinear ("smooth").
         case FILTER_BILINEAR:
-        {
-            glFilterMode = GL_LINEAR;
-
-        } break;
+            return GL_LINEAR;
 
         // Huh?
         default:
             // Oh well...
-            glFilterMode = GL_LINEAR;
+            return GL_LINEAR;
     };
-
-    // Set the texture objects filter mode.
-    mImageTextureHandle.setFilter( glFilterMode );
 }
 
 //------------------------------------------------------------------------------
@@ -1121,32 +1149,12 @@ void ImageAsset::calculateImage( void )
     // Clear frames.
     mFrames.clear();
 
-    // If we have an existing texture and we're setting to the same bitmap then force the texture manager
-    // to refresh the texture itself.
-    if ( !mImageTextureHandle.IsNull() && dStricmp(mImageTextureHandle.getTextureKey(), mImageFile) == 0 )
-        TextureManager::refresh( mImageFile );
-
-    // Get image texture.
-    mImageTextureHandle.set( mImageFile, TextureHandle::BitmapTexture, true, getForce16Bit() );
-
-    // Is the texture valid?
-    if ( mImageTextureHandle.IsNull() )
-    {
-        // No, so warn.
-        Con::warnf( "Image '%s' could not load texture '%s'.", getAssetId(), mImageFile );
-        return;
-    }
+    // Fetch the local filter mode.
+    TextureFilterMode filterMode = mLocalFilterMode;
 
     // Is the local filter mode specified?
-    if ( mLocalFilterMode != FILTER_INVALID )
-    {
-        // Yes, so set filter mode.
-        setTextureFilter( mLocalFilterMode );
-    }
-    else
+    if ( filterMode == FILTER_INVALID )
     {
-        TextureFilterMode filterMode = FILTER_NEAREST;
-
         // No, so fetch the global filter.
         const char* pGlobalFilter = Con::getVariable( "$pref::T2D::imageAssetGlobalFilterMode" );
 
@@ -1154,14 +1162,63 @@ void ImageAsset::calculateImage( void )
         if ( pGlobalFilter != NULL && dStrlen(pGlobalFilter) > 0 )
             filterMode = getFilterModeEnum( pGlobalFilter );
 
-        // If global filter mode is invalid then use local filter mode.
+        // If global filter mode is invalid then use nearest.
         if ( filterMode == FILTER_INVALID )
             filterMode = FILTER_NEAREST;
+    }
+
+    // Keep any texture atlas entry until the image is acquired again so an unchanged image isn't packed again.
+    const U32 previousAtlasEntryId = mAtlasEntryId;
+    mAtlasEntryId = 0;
+
+    // If we're packed and setting to the same image then force the texture atlas to reload the image itself.
+    if ( previousAtlasEntryId != 0 && TextureAtlas::getImageFile( previousAtlasEntryId ) == mImageFile )
+        TextureAtlas::refresh( mImageFile );
+
+    // Should the image be packed into a texture atlas page?
+    GBitmap* pUnpackedBitmap = NULL;
+    if ( mAtlas && !mForce16Bit && TextureAtlas::getEnabled() )
+    {
+        // Yes, so acquire it from the texture atlas.
+        mAtlasEntryId = TextureAtlas::acquire( mImageFile, getGLFilterMode( filterMode ), mImageTextureHandle, mAtlasImageArea, pUnpackedBitmap );
+    }
+
+    // Was the image packed?
+    if ( mAtlasEntryId == 0 )
+    {
+        // No, so did the texture atlas load the image?
+        if ( pUnpackedBitmap != NULL )
+        {
+            // Yes, so use it for the image texture.
+            mImageTextureHandle.set( mImageFile, pUnpackedBitmap, TextureHandle::BitmapTexture, true );
+        }
+        else
+        {
+            // No, so if we have an existing texture and we're setting to the same bitmap then force the texture manager
+            // to refresh the texture itself.
+            if ( !mImageTextureHandle.IsNull() && dStricmp(mImageTextureHandle.getTextureKey(), mImageFile) == 0 )
+                TextureManager::refresh( mImageFile );
+
+            // Get image texture.
+            mImageTextureHandle.set( mImageFile, TextureHandle::BitmapTexture, true, getForce16Bit() );
+        }
+    }
 
-        // Set filter mode.
-        setTextureFilter( filterMode );
+    // Release the previous texture atlas entry.
+    if ( previousAtlasEntryId != 0 )
+        TextureAtlas::release( previousAtlasEntryId );
+
+    // Is the texture valid?
+    if ( mImageTextureHandle.IsNull() )
+    {
+        // No, so warn.
+        Con::warnf( "Image '%s' could not load texture '%s'.", getAssetId(), mImageFile );
+        return;
     }
 
+    // Set filter mode.
+    setTextureFilter( filterMode );
+
     // Calculate according to mode.
     if ( mExplicitMode )
     {
@@ -1171,6 +1228,19 @@ void ImageAsset::calculateImage( void )
     {
         calculateImplicitMode();
     }
+
+    // Is the image packed into a texture atlas page?
+    if ( mAtlasEntryId != 0 )
+    {
+        // Yes, so move the frames onto the image in the page.
+        TextureObject* pTextureObject = ((TextureObject*)mImageTextureHandle);
+        const Vector2 texelOffset( (F32)mAtlasImageArea.point.x / (F32)pTextureObject->getTextureWidth(), (F32)mAtlasImageArea.point.y / (F32)pTextureObject->getTextureHeight() );
+        for( typeFrameAreaVector::iterator frameItr = mFrames.begin(); frameItr != mFrames.end(); ++frameItr )
+        {
+            frameItr->mTexelArea.mTexelLower += texelOffset;
+            frameItr->mTexelArea.mTexelUpper += texelOffset;
+        }
+    }
 }
 
 //------------------------------------------------------------------------------
@@ -164,6 +164,7 @@ private:
     /// Configuration.
     StringTableEntry            mImageFile;
     bool                        mForce16Bit;
+    bool                        mAtlas;
     TextureFilterMode           mLocalFilterMode;
     bool                        mExplicitMode;
     bool                        mCellRowOrder;
@@ -180,6 +181,8 @@ private:
     typeFrameAreaVector         mFrames;
     typeExplicitFrameAreaVector mExplicitFrames;
     TextureHandle               mImageTextureHandle;
+    U32                         mAtlasEntryId;
+    RectI                       mAtlasImageArea;
 
 public:
     ImageAsset();
@@ -197,6 +200,10 @@ public:
     void                    setForce16Bit( const bool force16Bit );
     inline bool             getForce16Bit( void ) const                     { return mForce16Bit; }
 
+    void                    setAtlas( const bool atlas );
+    inline bool             getAtlas( void ) const                          { return mAtlas; }
+    inline bool             getAtlasPacked( void ) const                    { return mAtlasEntryId != 0; }
+
     void                    setFilterMode( const TextureFilterMode filterMode );
     TextureFilterMode       getFilterMode( void ) const                     { return mLocalFilterMode; }
 
@@ -239,8 +246,9 @@ public:
     bool                    containsNamedRegion(const char* regionName);
 
     inline TextureHandle&   getImageTexture( void )                         { return mImageTextureHandle; }
-    inline S32              getImageWidth( void ) const                     { return mImageTextureHandle.getWidth(); }
-    inline S32              getImageHeight( void ) const                    { return mImageTextureHandle.getHeight(); }
+    inline S32              getImageWidth( void ) const                     { return mAtlasEntryId != 0 ? mAtlasImageArea.extent.x : mImageTextureHandle.getWidth(); }
+    inline S32              getImageHeight( void ) const                    { return mAtlasEntryId != 0 ? mAtlasImageArea.extent.y : mImageTextureHandle.getHeight(); }
+    inline Point2I          getImageTextureOffset( void ) const             { return mAtlasEntryId != 0 ? mAtlasImageArea.point : Point2I( 0, 0 ); }
     inline U32              getFrameCount( void ) const                     { return (U32)mFrames.size(); };
     inline bool             containsFrame( const char* namedFrame )         { return containsNamedRegion(namedFrame); };
     
@@ -275,6 +283,7 @@ private:
     void calculateImplicitMode( void );
     void calculateExplicitMode( void );
     void setTextureFilter( const TextureFilterMode filterMode );
+    static GLuint getGLFilterMode( const TextureFilterMode filterMode );
 
 protected:
     virtual void initializeAsset( void );
@@ -297,6 +306,9 @@ protected:
     static bool setForce16Bit( void* obj, const char* data )                { static_cast<ImageAsset*>(obj)->setForce16Bit(dAtob(data)); return false; }
     static bool writeForce16Bit( void* obj, StringTableEntry pFieldName )   { return static_cast<ImageAsset*>(obj)->getForce16Bit() == true; }
 
+    static bool setAtlas( void* obj, const char* data )                     { static_cast<ImageAsset*>(obj)->setAtlas(dAtob(data)); return false; }
+    static bool writeAtlas( void* obj, StringTableEntry pFieldName )        { return static_cast<ImageAsset*>(obj)->getAtlas() == false; }
+
     static bool setFilterMode( void* obj, const char* data );
     static bool writeFilterMode( void* obj, StringTableEntry pFieldName )   { return static_cast<ImageAsset*>(obj)->getFilterMode() != FILTER_BILINEAR; }
 
@@ -95,6 +95,37 @@ ConsoleMethodWithDocs(ImageAsset, getForce16Bit, ConsoleBool, 2, 2, ())
 
 //-----------------------------------------------------------------------------
 
+/*! Sets whether the image can be packed into a texture atlas page or not.
+    Images are only packed when $pref::T2D::imageAssetAtlas is set.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(ImageAsset, setAtlas, ConsoleVoid, 3, 3, (atlas?))
+{
+    object->setAtlas( dAtob(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether the image can be packed into a texture atlas page or not.
+    @return Whether the image can be packed into a texture atlas page or not.
+*/
+ConsoleMethodWithDocs(ImageAsset, getAtlas, ConsoleBool, 2, 2, ())
+{
+    return object->getAtlas();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether the image is packed into a texture atlas page or not.
+    @return Whether the image is packed into a texture atlas page or not.
+*/
+ConsoleMethodWithDocs(ImageAsset, getAtlasPacked, ConsoleBool, 2, 2, ())
+{
+    return object->getAtlasPacked();
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Sets whether CELL row order should be used or not.
     @return No return value.
 */
@@ -123,7 +123,8 @@ ConsoleSetType( TypeParticleAssetPtr )
 
 ParticleAsset::ParticleAsset() :
                     mLifetime( 0.0f ),
-                    mLifeMode( INFINITE )
+                    mLifeMode( INFINITE ),
+                    mExactFields( false )
 
 {
     // Set Vector Associations.
@@ -158,6 +159,7 @@ void ParticleAsset::initPersistFields()
 
     addProtectedField("Lifetime", TypeF32, Offset(mLifetime, ParticleAsset), &setLifetime, &defaultProtectedGetFn, &writeLifetime, "");
     addProtectedField("LifeMode", TypeEnum, Offset(mLifeMode, ParticleAsset), &setLifeMode, &defaultProtectedGetFn, &writeLifeMode, 1, &LifeModeTable);
+    addProtectedField("ExactFields", TypeBool, Offset(mExactFields, ParticleAsset), &setExactFields, &defaultProtectedGetFn, &writeExactFields, "Whether the particle fields are evaluated exactly rather than from their baked values.");
 }
 
 //------------------------------------------------------------------------------
@@ -176,6 +178,7 @@ void ParticleAsset::copyTo(SimObject* object)
    // Copy fields.
    pParticleAsset->setLifetime( getLifetime() );
    pParticleAsset->setLifeMode( getLifeMode() );
+   pParticleAsset->setExactFields( getExactFields() );
 
    // Copy particle fields.
    mParticleFields.copyTo( pParticleAsset->mParticleFields );
@@ -274,6 +277,26 @@ void ParticleAsset::setLifeMode( const LifeMode lifemode )
 
 //------------------------------------------------------------------------------
 
+void ParticleAsset::setExactFields( const bool exactFields )
+{
+    // Ignore no change.
+    if ( exactFields == mExactFields )
+        return;
+
+    mExactFields = exactFields;
+
+    // Set the field evaluation for the asset.
+    mParticleFields.setExactEvaluation( mExactFields );
+
+    // Set the field evaluation for the emitters.
+    for ( typeEmitterVector::iterator emitterItr = mEmitters.begin(); emitterItr != mEmitters.end(); ++emitterItr )
+    {
+        (*emitterItr)->getParticleFields().setExactEvaluation( mExactFields );
+    }
+}
+
+//------------------------------------------------------------------------------
+
 void ParticleAsset::initializeAsset( void )
 {
     // Call parent.
@@ -327,6 +350,9 @@ bool ParticleAsset::addEmitter( ParticleAssetEmitter* pParticleAssetEmitter )
     // Set the owner.
     pParticleAssetEmitter->setOwner( this );
 
+    // Use the same field evaluation as the asset.
+    pParticleAssetEmitter->getParticleFields().setExactEvaluation( mExactFields );
+
     // Add the emitter.
     mEmitters.push_back( pParticleAssetEmitter );
 
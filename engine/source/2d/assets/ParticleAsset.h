@@ -65,6 +65,7 @@ private:
 
     F32                                     mLifetime;
     LifeMode                                mLifeMode;
+    bool                                    mExactFields;
 
     /// Particle fields.
     ParticleAssetFieldCollection            mParticleFields;
@@ -94,6 +95,11 @@ public:
     void setLifeMode( const LifeMode lifemode );
     LifeMode getLifeMode( void ) const { return mLifeMode; }
 
+    /// Whether the particle fields are evaluated exactly rather than from their baked values.
+    /// This applies to the fields of the asset and all its emitters.
+    void setExactFields( const bool exactFields );
+    inline bool getExactFields( void ) const { return mExactFields; }
+
     inline ParticleAssetFieldCollection& getParticleFields( void ) { return mParticleFields; }
 
     inline ParticleAssetField& getParticleLifeScaleField( void ) { return mParticleLifeScale.getBase(); }
@@ -170,6 +176,9 @@ protected:
 
     static bool setLifeMode(void* obj, const char* data)                    { static_cast<ParticleAsset*>(obj)->setLifeMode( ParticleAsset::getParticleAssetLifeModeEnum(data) ); return false; }
     static bool writeLifeMode( void* obj, StringTableEntry pFieldName )     { return static_cast<ParticleAsset*>(obj)->getLifeMode() != INFINITE; }
+
+    static bool setExactFields(void* obj, const char* data)                 { static_cast<ParticleAsset*>(obj)->setExactFields(dAtob(data)); return false; }
+    static bool writeExactFields( void* obj, StringTableEntry pFieldName )  { return static_cast<ParticleAsset*>(obj)->getExactFields(); }
 };
 
 #endif // _PARTICLE_ASSET_H_
@@ -64,10 +64,13 @@ ParticleAssetField::ParticleAssetField() :
                         mMaxValue( 0.0f ),
                         mDefaultValue( 1.0f ),
                         mValueScale( 1.0f ),
-                        mValueBoundsDirty( true )
+                        mValueBoundsDirty( true ),
+                        mExactEvaluation( false ),
+                        mBakedTimeScale( 0.0f )
 {
     // Set Vector Associations.
     VECTOR_SET_ASSOCIATION( mDataKeys );
+    VECTOR_SET_ASSOCIATION( mBakedValues );
 }
 
 //-----------------------------------------------------------------------------
@@ -170,6 +173,9 @@ void ParticleAssetField::setValueBounds( F32 maxTime, F32 minValue, F32 maxValue
 
     // Flag the value bounds as dirty.
     mValueBoundsDirty = true;
+
+    // Re-bake the values for the new time bounds.
+    bakeValues();
 }
 
 //-----------------------------------------------------------------------------
@@ -273,6 +279,9 @@ S32 ParticleAssetField::addDataKey( const F32 time, const F32 value )
             // Yes, so set time.
             mDataKeys[index].mValue = value;
 
+            // Re-bake the values.
+            bakeValues();
+
             // Return Index.
             return index;
         }
@@ -289,6 +298,9 @@ S32 ParticleAssetField::addDataKey( const F32 time, const F32 value )
     mDataKeys[index].mTime = time;
     mDataKeys[index].mValue = value;
 
+    // Re-bake the values.
+    bakeValues();
+
     // Return Index.
     return index;
 }
@@ -316,6 +328,9 @@ bool ParticleAssetField::removeDataKey( const U32 index )
     // Remove Index.
     mDataKeys.erase(index);
 
+    // Re-bake the values.
+    bakeValues();
+
     // Return Okay.
     return true;
 }
@@ -343,6 +358,9 @@ bool ParticleAssetField::setDataKeyValue( const U32 index, const F32 value )
     // Set Data Key Value.
     mDataKeys[index].mValue = value;
 
+    // Re-bake the values.
+    bakeValues();
+
     // Return Okay.
     return true;
 }
@@ -407,14 +425,33 @@ F32 ParticleAssetField::getFieldValue( F32 time ) const
     time = getMin(getMax( 0.0f, time ), mMaxTime);
 
     // Repeat Time.
-    time = mFmod( time * mRepeatTime, mMaxTime + FLT_EPSILON );
+    // NOTE:-   The clamped time is already within the field time when not repeating.
+    if ( mRepeatTime != 1.0f )
+        time = mFmod( time * mRepeatTime, mMaxTime + FLT_EPSILON );
+
+    // Finish with an exact value if the values aren't baked.
+    if ( mBakedValues.size() == 0 )
+        return evaluateDataKeys( time ) * mValueScale;
+
+    // Fetch the baked samples either side of the time.
+    const F32 samplePosition = time * mBakedTimeScale;
+    const U32 sampleIndex = getMin( (U32)samplePosition, (U32)PARTICLE_ASSET_FIELD_BAKE_RESOLUTION-1 );
+    const F32 sampleDelta = getMin( samplePosition - (F32)sampleIndex, 1.0f );
+
+    // Return lerped Value.
+    return ((mBakedValues[sampleIndex] * (1.0f-sampleDelta)) + (mBakedValues[sampleIndex+1] * sampleDelta)) * mValueScale;
+}
+
+//-----------------------------------------------------------------------------
 
+F32 ParticleAssetField::evaluateDataKeys( const F32 time ) const
+{
     // Fetch Max Key Index.
     const U32 maxKeyIndex = getDataKeyCount()-1;
 
     // Return Last Value if we're on/past the last time.
     if ( time >= mDataKeys[maxKeyIndex].mTime )
-        return mDataKeys[maxKeyIndex].mValue * mValueScale;
+        return mDataKeys[maxKeyIndex].mValue;
 
     // Find Data-Key Indexes.
     U32 index1;
@@ -425,7 +462,7 @@ F32 ParticleAssetField::getFieldValue( F32 time ) const
 
     // If we're exactly on a Data-Key then return that key.
     if ( mIsEqual( mDataKeys[index1].mTime, time) )
-        return mDataKeys[index1].mValue * mValueScale;
+        return mDataKeys[index1].mValue;
 
     // Set Adjacent Indexes.
     index2 = index1--;
@@ -437,7 +474,48 @@ F32 ParticleAssetField::getFieldValue( F32 time ) const
     const F32 dTime = (time-time1)/(time2-time1);
 
     // Return lerped Value.
-    return ((mDataKeys[index1].mValue * (1.0f-dTime)) + (mDataKeys[index2].mValue * dTime)) * mValueScale;
+    return (mDataKeys[index1].mValue * (1.0f-dTime)) + (mDataKeys[index2].mValue * dTime);
+}
+
+//-----------------------------------------------------------------------------
+
+void ParticleAssetField::setExactEvaluation( const bool exactEvaluation )
+{
+    // Ignore no change.
+    if ( exactEvaluation == mExactEvaluation )
+        return;
+
+    mExactEvaluation = exactEvaluation;
+
+    // Bake or discard the values.
+    bakeValues();
+}
+
+//-----------------------------------------------------------------------------
+
+void ParticleAssetField::bakeValues( void )
+{
+    // Discard the existing values.
+    mBakedValues.clear();
+
+    // Finish if using exact evaluation or the field has a single value.
+    if ( mExactEvaluation || getDataKeyCount() < 2 )
+    {
+        mBakedValues.compact();
+        return;
+    }
+
+    // Sample the data-keys across the field time.
+    // NOTE:-   The values are baked without the value scale so that can change without a re-bake.
+    mBakedValues.setSize( PARTICLE_ASSET_FIELD_BAKE_RESOLUTION + 1 );
+    const F32 sampleTime = mMaxTime / (F32)PARTICLE_ASSET_FIELD_BAKE_RESOLUTION;
+    for ( U32 sampleIndex = 0; sampleIndex <= PARTICLE_ASSET_FIELD_BAKE_RESOLUTION; ++sampleIndex )
+    {
+        mBakedValues[sampleIndex] = evaluateDataKeys( sampleIndex * sampleTime );
+    }
+
+    // Calculate the scale from time to sample position.
+    mBakedTimeScale = (F32)PARTICLE_ASSET_FIELD_BAKE_RESOLUTION / mMaxTime;
 }
 
 //-----------------------------------------------------------------------------
@@ -694,6 +772,9 @@ void ParticleAssetField::onTamlCustomRead( const TamlCustomNode* pCustomNode )
 
     // Set the data keys.
     mDataKeys = keys;
+
+    // Bake the data keys that were read.
+    bakeValues();
 }
 
 //-----------------------------------------------------------------------------
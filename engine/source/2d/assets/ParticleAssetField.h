@@ -33,6 +33,18 @@
 
 ///-----------------------------------------------------------------------------
 
+/// The number of intervals a field is baked into.
+#define PARTICLE_ASSET_FIELD_BAKE_RESOLUTION    256
+
+///-----------------------------------------------------------------------------
+
+/// A time/value graph.
+///
+/// Fields with more than a single data-key are baked into a table of values sampled at a fixed resolution
+/// across the field time so finding the value is a constant-time lookup rather than a search of the data-keys.
+/// The table is re-baked whenever the data-keys or time bounds change.  The baked values are interpolated
+/// linearly so they only differ from the exact value between samples that straddle a data-key.
+/// Exact evaluation can be used instead where that matters.
 class ParticleAssetField
 {
 public:
@@ -68,9 +80,16 @@ private:
     F32 mDefaultValue;
 
     bool mValueBoundsDirty;
+    bool mExactEvaluation;
 
     Vector<DataKey> mDataKeys;
 
+    Vector<F32> mBakedValues;
+    F32 mBakedTimeScale;
+
+    void bakeValues( void );
+    F32 evaluateDataKeys( const F32 time ) const;
+
 public:
     ParticleAssetField();
     virtual ~ParticleAssetField();
@@ -92,6 +111,9 @@ public:
     inline F32 getMaxTime( void ) const { return mMaxTime; };
     inline F32 getValueScale( void ) const { return mValueScale; };
     inline F32 getDefaultValue( void ) const { return mDefaultValue; }
+    void setExactEvaluation( const bool exactEvaluation );
+    inline bool getExactEvaluation( void ) const { return mExactEvaluation; }
+    inline bool getBaked( void ) const { return mBakedValues.size() > 0; }
 
     void resetDataKeys( void );
     S32 setSingleDataKey( const F32 value );
@@ -67,6 +67,18 @@ void ParticleAssetFieldCollection::copyTo( ParticleAssetFieldCollection& fieldCo
 
 //------------------------------------------------------------------------------
 
+void ParticleAssetFieldCollection::setExactEvaluation( const bool exactEvaluation )
+{
+    // Iterate the fields.
+    for( typeFieldHash::iterator fieldItr = mFields.begin(); fieldItr != mFields.end(); ++fieldItr )
+    {
+        // Set the field evaluation.
+        fieldItr->value->setExactEvaluation( exactEvaluation );
+    }
+}
+
+//------------------------------------------------------------------------------
+
 void ParticleAssetFieldCollection::addField( ParticleAssetField& particleAssetField, const char* pFieldName, F32 maxTime, F32 minValue, F32 maxValue, F32 defaultValue )
 {
     // Sanity!
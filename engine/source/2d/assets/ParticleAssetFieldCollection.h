@@ -61,6 +61,8 @@ public:
     inline const typeFieldHash& getFields( void ) const { return mFields; }
     ParticleAssetField* findField( const char* pFieldName );
 
+    void setExactEvaluation( const bool exactEvaluation );
+
     S32 setSingleDataKey( const F32 value );
     S32 addDataKey( F32 time, F32 value );
     bool removeDataKey( S32 index );
@@ -70,6 +70,29 @@ ConsoleMethodWithDocs(ParticleAsset, getLifetime, ConsoleFloat, 2, 2, ())
     return object->getLifetime();
 }
 
+//-----------------------------------------------------------------------------
+
+/*! Sets whether the particle fields are evaluated exactly.
+    By default each field with more than a single data-key is baked into a table of sampled values which is faster to evaluate.
+    Exact evaluation searches the data-keys every time a field value is needed.  This applies to the fields of the asset and all its emitters.
+    @param exactFields Whether the particle fields are evaluated exactly or not.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(ParticleAsset, setExactFields, ConsoleVoid, 3, 3, (bool exactFields))
+{
+    object->setExactFields( dAtob(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether the particle fields are evaluated exactly.
+    @return Whether the particle fields are evaluated exactly or not.
+*/
+ConsoleMethodWithDocs(ParticleAsset, getExactFields, ConsoleBool, 2, 2, ())
+{
+    return object->getExactFields();
+}
+
 //-----------------------------------------------------------------------------
 /// Particle asset fields.
 //-----------------------------------------------------------------------------
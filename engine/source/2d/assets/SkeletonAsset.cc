@@ -44,6 +44,8 @@
 #include "2d/assets/SkeletonAsset.h"
 #endif
 
+#include "spine/extension.h"
+
 // Script bindings.
 #include "SkeletonAsset_ScriptBinding.h"
 
@@ -94,12 +96,146 @@ ConsoleSetType( TypeSkeletonAssetPtr )
     Con::warnf( "(TypeSkeletonAssetPtr) - Cannot set multiple args to a single asset." );
 }
 
+//------------------------------------------------------------------------------
+
+SkeletonAnimationCache::SkeletonAnimationCache( spSkeletonData* pSkeletonData, spAnimation* pAnimation, spSkin* pSkin, const F32 frameRate ) :
+    mpAnimation( pAnimation ),
+    mpSkin( pSkin ),
+    mFrameRate( frameRate ),
+    mLookupCount( 0 )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SkeletonAnimationCache_Build);
+
+    // Sanity!
+    AssertFatal( pSkeletonData != NULL && pAnimation != NULL, "SkeletonAnimationCache() - Invalid skeleton data or animation." );
+    AssertFatal( frameRate > 0.0f, "SkeletonAnimationCache() - Invalid frame rate." );
+
+    const U32 startTime = Platform::getRealMilliseconds();
+
+    // Sample the whole animation including its end.
+    mBoneCount = (U32)pSkeletonData->boneCount;
+    mSlotCount = (U32)pSkeletonData->slotCount;
+    mFrameCount = (U32)mCeil( pAnimation->duration * frameRate ) + 1;
+    mBoneSamples.setSize( mFrameCount * mBoneCount );
+    mSlotSamples.setSize( mFrameCount * mSlotCount );
+
+    // Evaluate the animation with a skeleton of its own.
+    spSkeleton* pSkeleton = spSkeleton_create( pSkeletonData );
+    if ( pSkin != NULL )
+        spSkeleton_setSkin( pSkeleton, pSkin );
+
+    BoneSample* pBoneSample = mBoneSamples.address();
+    SlotSample* pSlotSample = mSlotSamples.address();
+
+    for ( U32 frame = 0; frame < mFrameCount; ++frame )
+    {
+        const F32 time = getMin( (F32)frame / frameRate, pAnimation->duration );
+
+        // Pose the skeleton as the animation state would.
+        spSkeleton_setToSetupPose( pSkeleton );
+        spAnimation_apply( pAnimation, pSkeleton, time, time, false, NULL, NULL );
+        spSkeleton_updateWorldTransform( pSkeleton );
+
+        // Sample the bones.
+        for ( U32 i = 0; i < mBoneCount; ++i, ++pBoneSample )
+        {
+            const spBone* pBone = pSkeleton->bones[i];
+            pBoneSample->mWorldX = pBone->worldX;
+            pBoneSample->mWorldY = pBone->worldY;
+            pBoneSample->m00 = pBone->m00;
+            pBoneSample->m01 = pBone->m01;
+            pBoneSample->m10 = pBone->m10;
+            pBoneSample->m11 = pBone->m11;
+        }
+
+        // Sample the slots.
+        for ( U32 i = 0; i < mSlotCount; ++i, ++pSlotSample )
+        {
+            const spSlot* pSlot = pSkeleton->slots[i];
+            pSlotSample->mpAttachment = pSlot->attachment;
+            pSlotSample->mRed = pSlot->r;
+            pSlotSample->mGreen = pSlot->g;
+            pSlotSample->mBlue = pSlot->b;
+            pSlotSample->mAlpha = pSlot->a;
+        }
+    }
+
+    spSkeleton_dispose( pSkeleton );
+
+    mBuildTime = Platform::getRealMilliseconds() - startTime;
+}
+
+//------------------------------------------------------------------------------
+
+void SkeletonAnimationCache::apply( spSkeleton* pSkeleton, const F32 time, const bool loop )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SkeletonAnimationCache_Apply);
+
+    // Sanity!
+    AssertFatal( (U32)pSkeleton->boneCount == mBoneCount && (U32)pSkeleton->slotCount == mSlotCount, "SkeletonAnimationCache::apply() - The skeleton does not match the cache." );
+
+    // Wrap or clamp the time as the animation would.
+    const F32 duration = mpAnimation->duration;
+    F32 animationTime = time;
+    if ( loop && duration > 0.0f )
+        animationTime = mFmod( animationTime, duration );
+    else if ( animationTime > duration )
+        animationTime = duration;
+
+    // Fetch the nearest frame.
+    const U32 frame = getMin( (U32)mFloor( getMax( animationTime, 0.0f ) * mFrameRate + 0.5f ), mFrameCount - 1 );
+    const BoneSample* pBoneSample = mBoneSamples.address() + frame * mBoneCount;
+    const SlotSample* pSlotSample = mSlotSamples.address() + frame * mSlotCount;
+
+    // The root transform is the skeleton's root bone relative to its setup pose plus the flip.
+    // The root scale is applied about the root bone's position in skeleton space.
+    const spBone* pRootBone = pSkeleton->root;
+    const spBoneData* pRootData = pRootBone->data;
+    const F32 scaleX = mNotZero( pRootData->scaleX ) ? pRootBone->scaleX / pRootData->scaleX : 1.0f;
+    const F32 scaleY = mNotZero( pRootData->scaleY ) ? pRootBone->scaleY / pRootData->scaleY : 1.0f;
+    const F32 flipX = pSkeleton->flipX ? -1.0f : 1.0f;
+    const F32 flipY = pSkeleton->flipY ? -1.0f : 1.0f;
+    const F32 originX = pBoneSample->mWorldX;
+    const F32 originY = pBoneSample->mWorldY;
+    const F32 offsetX = originX + (pRootBone->x - pRootData->x);
+    const F32 offsetY = originY + (pRootBone->y - pRootData->y);
+
+    // Set the bone world transforms.
+    for ( U32 i = 0; i < mBoneCount; ++i, ++pBoneSample )
+    {
+        spBone* pBone = pSkeleton->bones[i];
+        CONST_CAST(float, pBone->worldX) = flipX * ((pBoneSample->mWorldX - originX) * scaleX + offsetX);
+        CONST_CAST(float, pBone->worldY) = flipY * ((pBoneSample->mWorldY - originY) * scaleY + offsetY);
+        CONST_CAST(float, pBone->m00) = flipX * scaleX * pBoneSample->m00;
+        CONST_CAST(float, pBone->m01) = flipX * scaleX * pBoneSample->m01;
+        CONST_CAST(float, pBone->m10) = flipY * scaleY * pBoneSample->m10;
+        CONST_CAST(float, pBone->m11) = flipY * scaleY * pBoneSample->m11;
+    }
+
+    // Set the slot states.
+    for ( U32 i = 0; i < mSlotCount; ++i, ++pSlotSample )
+    {
+        spSlot* pSlot = pSkeleton->slots[i];
+        pSlot->r = pSlotSample->mRed;
+        pSlot->g = pSlotSample->mGreen;
+        pSlot->b = pSlotSample->mBlue;
+        pSlot->a = pSlotSample->mAlpha;
+
+        if ( pSlot->attachment != pSlotSample->mpAttachment )
+            spSlot_setAttachment( pSlot, pSlotSample->mpAttachment );
+    }
+
+    mLookupCount++;
+}
 
 //------------------------------------------------------------------------------
 
 SkeletonAsset::SkeletonAsset() :    mSkeletonFile(StringTable->EmptyString),
                                     mAtlasFile(StringTable->EmptyString),
                                     mAtlasDirty(true),
+                                    mAnimationCacheRate(0.0f),
                                     mAtlas(NULL),
                                     mSkeletonData(NULL),
                                     mStateData(NULL)
@@ -110,6 +246,7 @@ SkeletonAsset::SkeletonAsset() :    mSkeletonFile(StringTable->EmptyString),
 
 SkeletonAsset::~SkeletonAsset()
 {
+    clearAnimationCaches();
     spAnimationStateData_dispose(mStateData);
     spSkeletonData_dispose(mSkeletonData);
     spAtlas_dispose(mAtlas);
@@ -125,6 +262,7 @@ void SkeletonAsset::initPersistFields()
     // Fields.
     addProtectedField("AtlasFile", TypeAssetLooseFilePath, Offset(mAtlasFile, SkeletonAsset), &setAtlasFile, &defaultProtectedGetFn, &writeAtlasFile, "The loose file pointing to the .atlas file used for skinning");
     addProtectedField("SkeletonFile", TypeAssetLooseFilePath, Offset(mSkeletonFile, SkeletonAsset), &setSkeletonFile, &defaultProtectedGetFn, &writeSkeletonFile, "The loose file produced by the editor, which is fed into this asset");
+    addProtectedField("AnimationCacheRate", TypeF32, Offset(mAnimationCacheRate, SkeletonAsset), &setAnimationCacheRate, &defaultProtectedGetFn, &writeAnimationCacheRate, "The frame rate the animations are pre-sampled at so skeleton objects can share them.  Zero disables the animation caches.");
 }
 
 //------------------------------------------------------------------------------
@@ -205,6 +343,91 @@ void SkeletonAsset::copyTo(SimObject* object)
     // Copy state.
     pAsset->setAtlasFile( getAtlasFile() );
     pAsset->setSkeletonFile( getSkeletonFile() );
+    pAsset->setAnimationCacheRate( getAnimationCacheRate() );
+}
+
+//------------------------------------------------------------------------------
+
+void SkeletonAsset::setAnimationCacheRate( const F32 frameRate )
+{
+    // Clamp the frame rate.
+    const F32 animationCacheRate = getMax( frameRate, 0.0f );
+
+    // Ignore no change.
+    if ( mIsEqual( animationCacheRate, mAnimationCacheRate ) )
+        return;
+
+    // Update.
+    mAnimationCacheRate = animationCacheRate;
+
+    // The caches were sampled at the old frame rate.
+    clearAnimationCaches();
+}
+
+//------------------------------------------------------------------------------
+
+SkeletonAnimationCache* SkeletonAsset::getAnimationCache( spAnimation* pAnimation, spSkin* pSkin )
+{
+    // Finish if the animations aren't cached.
+    if ( mAnimationCacheRate <= 0.0f || mSkeletonData == NULL || pAnimation == NULL )
+        return NULL;
+
+    // Find the cache.
+    for ( S32 i = 0; i < mAnimationCaches.size(); ++i )
+    {
+        SkeletonAnimationCache* pCache = mAnimationCaches[i];
+        if ( pCache->getAnimation() == pAnimation && pCache->getSkin() == pSkin )
+            return pCache;
+    }
+
+    // Build the cache.
+    SkeletonAnimationCache* pCache = new SkeletonAnimationCache( mSkeletonData, pAnimation, pSkin, mAnimationCacheRate );
+    mAnimationCaches.push_back( pCache );
+
+    return pCache;
+}
+
+//------------------------------------------------------------------------------
+
+void SkeletonAsset::clearAnimationCaches( void )
+{
+    for ( S32 i = 0; i < mAnimationCaches.size(); ++i )
+        delete mAnimationCaches[i];
+
+    mAnimationCaches.clear();
+}
+
+//------------------------------------------------------------------------------
+
+void SkeletonAsset::dumpAnimationCaches( void ) const
+{
+    Con::printf( "SkeletonAsset '%s' animation caches at %g fps:", getAssetId(), mAnimationCacheRate );
+
+    U32 totalMemory = 0;
+    F32 totalSaved = 0.0f;
+
+    for ( S32 i = 0; i < mAnimationCaches.size(); ++i )
+    {
+        const SkeletonAnimationCache* pCache = mAnimationCaches[i];
+
+        // Each lookup saves roughly the cost of evaluating a single frame.
+        const F32 frameTime = (F32)pCache->getBuildTime() / (F32)pCache->getFrameCount();
+        const F32 savedTime = frameTime * (F32)pCache->getLookupCount();
+
+        Con::printf( "  Animation '%s' (skin '%s'): %d frames, %.1f KB, built in %dms, %d lookups, ~%.1fms evaluation saved.",
+            pCache->getAnimation()->name,
+            pCache->getSkin() == NULL ? "default" : pCache->getSkin()->name,
+            pCache->getFrameCount(),
+            (F32)pCache->getMemoryUsage() / 1024.0f,
+            pCache->getBuildTime(),
+            pCache->getLookupCount(),
+            savedTime );
+
+        totalMemory += pCache->getMemoryUsage();
+        totalSaved += savedTime;
+    }
+
+    Con::printf( "  %d caches, %.1f KB, ~%.1fms evaluation saved.", mAnimationCaches.size(), (F32)totalMemory / 1024.0f, totalSaved );
 }
 
 //------------------------------------------------------------------------------
@@ -303,6 +526,9 @@ void SkeletonAsset::buildSkeletonData( void )
     // Atlas load failure
     AssertFatal(mAtlas != NULL, "SkeletonAsset::buildSkeletonData() - Atlas was not loaded.");
     
+    // Clear the animation caches
+    clearAnimationCaches();
+
     // Clear state data
     if (mStateData)
         spAnimationStateData_dispose(mStateData);
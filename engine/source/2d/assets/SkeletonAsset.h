@@ -41,11 +41,71 @@ DefineConsoleType( TypeSkeletonAssetPtr )
 
 //-----------------------------------------------------------------------------
 
+/// An animation of a skeleton pre-sampled at a fixed frame rate.
+///
+/// The cache holds the world transform of every bone and the attachment and color of every
+/// slot for each frame so the skeletons playing the animation can share a single evaluation.
+/// Applying a frame to a skeleton replaces the animation state apply and the world transform
+/// update with a lookup plus the skeleton's root transform.
+class SkeletonAnimationCache
+{
+private:
+    /// The world transform of a bone.
+    struct BoneSample
+    {
+        F32 mWorldX;
+        F32 mWorldY;
+        F32 m00;
+        F32 m01;
+        F32 m10;
+        F32 m11;
+    };
+
+    /// The state of a slot.
+    struct SlotSample
+    {
+        spAttachment* mpAttachment;
+        F32 mRed;
+        F32 mGreen;
+        F32 mBlue;
+        F32 mAlpha;
+    };
+
+    spAnimation*            mpAnimation;
+    spSkin*                 mpSkin;
+    F32                     mFrameRate;
+    U32                     mFrameCount;
+    U32                     mBoneCount;
+    U32                     mSlotCount;
+    Vector<BoneSample>      mBoneSamples;
+    Vector<SlotSample>      mSlotSamples;
+    U32                     mBuildTime;
+    U32                     mLookupCount;
+
+public:
+    SkeletonAnimationCache( spSkeletonData* pSkeletonData, spAnimation* pAnimation, spSkin* pSkin, const F32 frameRate );
+
+    /// Apply the frame nearest the specified animation time to the skeleton.
+    void apply( spSkeleton* pSkeleton, const F32 time, const bool loop );
+
+    inline spAnimation*     getAnimation( void ) const                      { return mpAnimation; }
+    inline spSkin*          getSkin( void ) const                           { return mpSkin; }
+    inline F32              getFrameRate( void ) const                      { return mFrameRate; }
+    inline U32              getFrameCount( void ) const                     { return mFrameCount; }
+    inline U32              getMemoryUsage( void ) const                    { return (U32)(mBoneSamples.memSize() + mSlotSamples.memSize()); }
+    inline U32              getBuildTime( void ) const                      { return mBuildTime; }
+    inline U32              getLookupCount( void ) const                    { return mLookupCount; }
+};
+
+//-----------------------------------------------------------------------------
+
 class SkeletonAsset : public AssetBase
 {
 private:
     typedef AssetBase Parent;
     bool                            mAtlasDirty;
+    F32                             mAnimationCacheRate;
+    Vector<SkeletonAnimationCache*> mAnimationCaches;
 
 public:
     StringTableEntry                mSkeletonFile;
@@ -70,6 +130,12 @@ public:
 
     void                    setAtlasFile( const char* pAtlasFile );
     inline StringTableEntry getAtlasFile( void ) const                      { return mAtlasFile; }
+
+    void                    setAnimationCacheRate( const F32 frameRate );
+    inline F32              getAnimationCacheRate( void ) const             { return mAnimationCacheRate; }
+    SkeletonAnimationCache* getAnimationCache( spAnimation* pAnimation, spSkin* pSkin );
+    void                    clearAnimationCaches( void );
+    void                    dumpAnimationCaches( void ) const;
     
     virtual bool            isAssetValid( void ) const;
 
@@ -96,6 +162,8 @@ protected:
     static bool writeSkeletonFile( void* obj, StringTableEntry pFieldName ) { return static_cast<SkeletonAsset*>(obj)->getSkeletonFile() != StringTable->EmptyString; }
     static bool setAtlasFile( void* obj, const char* data )                 { static_cast<SkeletonAsset*>(obj)->setAtlasFile(data); return false; }
     static bool writeAtlasFile( void* obj, StringTableEntry pFieldName )    { return static_cast<SkeletonAsset*>(obj)->getAtlasFile() != StringTable->EmptyString; }
+    static bool setAnimationCacheRate( void* obj, const char* data )        { static_cast<SkeletonAsset*>(obj)->setAnimationCacheRate(dAtof(data)); return false; }
+    static bool writeAnimationCacheRate( void* obj, StringTableEntry pFieldName ) { return static_cast<SkeletonAsset*>(obj)->getAnimationCacheRate() > 0.0f; }
 };
 
 #endif // _SKELETON_ASSET_H_
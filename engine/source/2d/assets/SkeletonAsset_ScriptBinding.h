@@ -62,4 +62,45 @@ ConsoleMethodWithDocs(SkeletonAsset, getSkeletonFile, ConsoleString, 2, 2, ())
 
 //------------------------------------------------------------------------------
 
+/*! Sets the frame rate the animations are pre-sampled at so skeleton objects playing them can share a single evaluation.
+    @param frameRate The frame rate of the animation caches.  Zero disables them.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(SkeletonAsset, setAnimationCacheRate, ConsoleVoid, 3, 3, (frameRate))
+{
+    object->setAnimationCacheRate( dAtof(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the frame rate the animations are pre-sampled at.
+    @return Returns the frame rate of the animation caches (zero if they are disabled).
+*/
+ConsoleMethodWithDocs(SkeletonAsset, getAnimationCacheRate, ConsoleFloat, 2, 2, ())
+{
+    return object->getAnimationCacheRate();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Releases the animation caches.  They are rebuilt as they are used.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(SkeletonAsset, clearAnimationCaches, ConsoleVoid, 2, 2, ())
+{
+    object->clearAnimationCaches();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Dumps the memory used by each animation cache and the evaluation time it has saved to the console.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(SkeletonAsset, dumpAnimationCaches, ConsoleVoid, 2, 2, ())
+{
+    object->dumpAnimationCaches();
+}
+
+//------------------------------------------------------------------------------
+
 ConsoleMethodGroupEndWithDocs(SkeletonAsset)
@@ -31,6 +31,17 @@
 
 //-----------------------------------------------------------------------------
 
+static inline void packStreamColor( const ColorF& color, U8* pColor )
+{
+    // NOTE: Clamp as the fixed-function pipeline would for the floating-point colors.
+    pColor[0] = (U8)(mClampF( color.red, 0.0f, 1.0f ) * 255.0f + 0.5f);
+    pColor[1] = (U8)(mClampF( color.green, 0.0f, 1.0f ) * 255.0f + 0.5f);
+    pColor[2] = (U8)(mClampF( color.blue, 0.0f, 1.0f ) * 255.0f + 0.5f);
+    pColor[3] = (U8)(mClampF( color.alpha, 0.0f, 1.0f ) * 255.0f + 0.5f);
+}
+
+//-----------------------------------------------------------------------------
+
 BatchRender::BatchRender() :
     mTriangleCount( 0 ),
     mVertexCount( 0 ),
@@ -46,8 +57,13 @@ BatchRender::BatchRender() :
     mBlendColor( ColorF(1.0f,1.0f,1.0f,1.0f) ),
     mAlphaTestMode( -1.0f ),
     mWireframeMode( false ),
-    mBatchEnabled( true )
+    mBatchEnabled( true ),
+    mStreamingMode( false ),
+    mStreamBufferName( 0 ),
+    mStreamBufferOffset( 0 ),
+    mTextureEventKey( -1 )
 {
+    VECTOR_SET_ASSOCIATION( mStreamVertices );
 }
 
 //-----------------------------------------------------------------------------
@@ -67,6 +83,35 @@ BatchRender::~BatchRender()
         delete (*itr);
     }
     mIndexVectorPool.clear();
+
+    // Destroy the stream buffer.
+    destroyStreamBuffer();
+
+    // Stop receiving texture events.
+    if ( mTextureEventKey != -1 )
+        TextureManager::unregisterEventCallback( (U32)mTextureEventKey );
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::setStreamingMode( const bool enabled )
+{
+    // Ignore no change.
+    if ( mStreamingMode == enabled )
+        return;
+
+    // Flush.
+    flushInternal();
+
+    mStreamingMode = enabled;
+
+    // Release the stream buffer if we no longer need it.
+    if ( !mStreamingMode )
+    {
+        destroyStreamBuffer();
+        mStreamVertices.clear();
+        mStreamVertices.compact();
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -332,6 +377,146 @@ void BatchRender::SubmitQuad(
 
 //-----------------------------------------------------------------------------
 
+void BatchRender::SubmitStaticBatch( StaticBatch& staticBatch )
+{
+    // Sanity!
+    AssertFatal( mpDebugStats != NULL, "Debug stats have not been configured." );
+
+    // Debug Profiling.
+    PROFILE_SCOPE(BatchRender_SubmitStaticBatch);
+
+    // Finish if no quads to draw.
+    if ( staticBatch.mQuadCount == 0 )
+        return;
+
+    // Flush anything already batched so it's drawn first.
+    flushInternal();
+
+    // Build the quad indices shared by all static batches if needed.
+    if ( mStaticQuadIndices.size() == 0 )
+    {
+        mStaticQuadIndices.setSize( BATCHRENDER_STATICQUADS * 6 );
+        U16* pIndex = mStaticQuadIndices.address();
+        for ( U32 quad = 0; quad < BATCHRENDER_STATICQUADS; ++quad )
+        {
+            // NOTE: The vertices are stored with #2/#3 swapped as they are for SubmitQuad().
+            const U16 baseIndex = (U16)(quad * 4);
+            *pIndex++ = baseIndex;
+            *pIndex++ = baseIndex + 1;
+            *pIndex++ = baseIndex + 2;
+            *pIndex++ = baseIndex + 3;
+            *pIndex++ = baseIndex + 2;
+            *pIndex++ = baseIndex + 1;
+        }
+    }
+
+    if ( mWireframeMode )
+    {
+        // Disable texturing.    
+        glDisable( GL_TEXTURE_2D );
+
+        // Set the polygon mode to line.
+        glPolygonMode( GL_FRONT_AND_BACK, GL_LINE );
+    }
+    else
+    {
+        // Enable texturing.    
+        glEnable( GL_TEXTURE_2D );
+        glTexEnvi( GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE );
+
+        // Set the polygon mode to fill.
+        glPolygonMode( GL_FRONT_AND_BACK, GL_FILL );
+    }
+
+    // Enable vertex, color and texture arrays.
+    glEnableClientState( GL_VERTEX_ARRAY );
+    glEnableClientState( GL_COLOR_ARRAY );
+
+    // Use the texture coordinates if not in wireframe mode.
+    if ( !mWireframeMode )
+        glEnableClientState( GL_TEXTURE_COORD_ARRAY );
+
+    // Bind the vertex buffer (uploading it if needed) or use the client-side arrays if we can't.
+    const bool buffered = staticBatch.bindBuffer( mpDebugStats );
+
+    // Iterate the runs.
+    for ( U32 runIndex = 0; runIndex < staticBatch.mRunCount; ++runIndex )
+    {
+        // Fetch the run.
+        StaticBatch::Run* pRun = staticBatch.mRuns[runIndex];
+
+        // Set blend mode.
+        if ( pRun->mBlendMode )
+        {
+            glEnable( GL_BLEND );
+            glBlendFunc( pRun->mSrcBlendFactor, pRun->mDstBlendFactor );
+        }
+        else
+        {
+            glDisable( GL_BLEND );
+        }
+
+        // Set alpha-blend mode.
+        if ( pRun->mAlphaTestMode >= 0.0f )
+        {
+            glEnable( GL_ALPHA_TEST );
+            glAlphaFunc( GL_GREATER, pRun->mAlphaTestMode );
+        }
+        else
+        {
+            glDisable( GL_ALPHA_TEST );
+        }
+
+        // Bind the texture if not in wireframe mode.
+        if ( !mWireframeMode )
+            glBindTexture( GL_TEXTURE_2D, pRun->mTexture.getGLName() );
+
+        // Fetch the start of the run vertices.
+        const U8* pRunBase = buffered ? (const U8*)NULL + pRun->mBufferOffset * sizeof(StreamVertex) : (const U8*)pRun->mVertices.address();
+
+        // Draw the run in as many draw calls as the 16-bit indices allow.
+        const U32 runQuadCount = pRun->mVertices.size() / 4;
+        for ( U32 quadStart = 0; quadStart < runQuadCount; quadStart += BATCHRENDER_STATICQUADS )
+        {
+            const U32 quadCount = getMin( runQuadCount - quadStart, (U32)BATCHRENDER_STATICQUADS );
+
+            // Point the arrays at the quads.
+            const U8* pBase = pRunBase + quadStart * 4 * sizeof(StreamVertex);
+            glVertexPointer( 2, GL_FLOAT, sizeof(StreamVertex), pBase + Offset(mPosition, StreamVertex) );
+            glTexCoordPointer( 2, GL_FLOAT, sizeof(StreamVertex), pBase + Offset(mTextureCoord, StreamVertex) );
+            glColorPointer( 4, GL_UNSIGNED_BYTE, sizeof(StreamVertex), pBase + Offset(mColor, StreamVertex) );
+
+            // Draw the triangles.
+            glDrawElements( GL_TRIANGLES, quadCount * 6, GL_UNSIGNED_SHORT, mStaticQuadIndices.address() );
+
+            // Stats.
+            mpDebugStats->batchDrawCallsStatic++;
+            mpDebugStats->batchTrianglesSubmitted += quadCount * 2;
+            if ( !buffered )
+                mpDebugStats->batchBytesUploaded += quadCount * 4 * sizeof(StreamVertex);
+
+            // Stats.
+            if ( quadCount * 2 > mpDebugStats->batchMaxTriangleDrawn )
+                mpDebugStats->batchMaxTriangleDrawn = quadCount * 2;
+        }
+    }
+
+    // Unbind the vertex buffer.
+    if ( buffered )
+        glBindBuffer( GL_ARRAY_BUFFER, 0 );
+
+    // Reset common render state.
+    glDisableClientState( GL_VERTEX_ARRAY );
+    glDisableClientState( GL_TEXTURE_COORD_ARRAY );
+    glDisableClientState( GL_COLOR_ARRAY );
+    glDisable( GL_ALPHA_TEST );
+    glDisable( GL_BLEND );
+    glDisable( GL_TEXTURE_2D );
+    glPolygonMode( GL_FRONT_AND_BACK, GL_FILL );
+}
+
+//-----------------------------------------------------------------------------
+
 void BatchRender::flush( U32& reasonMetric )
 {
     // Finish if no triangles to flush.
@@ -418,8 +603,6 @@ void BatchRender::flushInternal( void )
 
     // Enable vertex and texture arrays.
     glEnableClientState( GL_VERTEX_ARRAY );
-    glVertexPointer( 2, GL_FLOAT, 0, mVertexBuffer );
-    glTexCoordPointer( 2, GL_FLOAT, 0, mTextureBuffer );
 
     // Use the texture coordinates if not in wireframe mode.
     if ( !mWireframeMode )
@@ -430,9 +613,23 @@ void BatchRender::flushInternal( void )
     {
         // Yes, so enable color array.
         glEnableClientState( GL_COLOR_ARRAY );
-        glColorPointer( 4, GL_FLOAT, 0, mColorBuffer );
     }
 
+    // Are we streaming the vertices?
+    const bool streaming = mStreamingMode && bindStreamVertices();
+    if ( !streaming )
+    {
+        // No, so use the client-side arrays.
+        glVertexPointer( 2, GL_FLOAT, 0, mVertexBuffer );
+        glTexCoordPointer( 2, GL_FLOAT, 0, mTextureBuffer );
+
+        if ( mColorCount > 0 )
+            glColorPointer( 4, GL_FLOAT, 0, mColorBuffer );
+    }
+
+    // Calculate the vertex bytes read for each draw call when using the client-side arrays.
+    const U32 clientBytesPerDraw = mVertexCount * (sizeof(Vector2) * 2) + mColorCount * sizeof(ColorF);
+
     // Strict order mode?
     if ( mStrictOrderMode )
     {
@@ -445,6 +642,8 @@ void BatchRender::flushInternal( void )
 
         // Stats.
         mpDebugStats->batchDrawCallsStrict++;
+        if ( !streaming )
+            mpDebugStats->batchBytesUploaded += clientBytesPerDraw;
 
         // Stats.
         const U32 trianglesDrawn = mIndexCount / 3;
@@ -526,6 +725,8 @@ void BatchRender::flushInternal( void )
 
             // Stats.
             mpDebugStats->batchDrawCallsSorted++;
+            if ( !streaming )
+                mpDebugStats->batchBytesUploaded += clientBytesPerDraw;
 
             // Stats.
             if ( mVertexCount > mpDebugStats->batchMaxVertexBuffer )
@@ -545,6 +746,10 @@ void BatchRender::flushInternal( void )
         mTextureBatchMap.clear();
     }
 
+    // Unbind the stream buffer.
+    if ( streaming )
+        glBindBuffer( GL_ARRAY_BUFFER, 0 );
+
     // Reset common render state.
     glDisableClientState( GL_VERTEX_ARRAY );
     glDisableClientState( GL_TEXTURE_COORD_ARRAY );
@@ -605,4 +810,329 @@ BatchRender::indexVectorType* BatchRender::findTextureBatch( TextureHandle& hand
     return pIndexVector;
 }
 
+//-----------------------------------------------------------------------------
+
+bool BatchRender::bindStreamVertices( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(BatchRender_BindStreamVertices);
 
+    // Finish if vertex buffer objects are not supported.
+    if ( !dglDoesSupportVertexBufferObject() )
+        return false;
+
+    // Create the stream buffer if needed.
+    if ( mStreamBufferName == 0 )
+    {
+        // Start receiving texture events so we know when the buffer is lost.
+        if ( mTextureEventKey == -1 )
+            mTextureEventKey = (S32)TextureManager::registerEventCallback( textureEventCallback, this );
+
+        glGenBuffers( 1, &mStreamBufferName );
+
+        // Finish if the buffer could not be created.
+        if ( mStreamBufferName == 0 )
+            return false;
+
+        // Allocate the buffer storage.
+        glBindBuffer( GL_ARRAY_BUFFER, mStreamBufferName );
+        glBufferData( GL_ARRAY_BUFFER, BATCHRENDER_STREAMBUFFERSIZE, NULL, GL_DYNAMIC_DRAW );
+        mStreamBufferOffset = 0;
+    }
+
+    // Interleave the batched vertices.
+    mStreamVertices.setSize( mVertexCount );
+    StreamVertex* pStreamVertex = mStreamVertices.address();
+    for ( U32 index = 0; index < mVertexCount; ++index, ++pStreamVertex )
+    {
+        pStreamVertex->mPosition = mVertexBuffer[index];
+        pStreamVertex->mTextureCoord = mTextureBuffer[index];
+    }
+
+    // Only fill colors if we have any.
+    if ( mColorCount > 0 )
+    {
+        pStreamVertex = mStreamVertices.address();
+        for ( U32 index = 0; index < mColorCount; ++index, ++pStreamVertex )
+        {
+            packStreamColor( mColorBuffer[index], pStreamVertex->mColor );
+        }
+    }
+
+    const U32 uploadBytes = mVertexCount * sizeof(StreamVertex);
+
+    glBindBuffer( GL_ARRAY_BUFFER, mStreamBufferName );
+
+    // Would the upload overrun the buffer?
+    if ( mStreamBufferOffset + uploadBytes > BATCHRENDER_STREAMBUFFERSIZE )
+    {
+        // Yes, so orphan the storage and start again at the beginning.
+        // NOTE: The driver hands us fresh storage so we never wait on draws still using the old one.
+        glBufferData( GL_ARRAY_BUFFER, BATCHRENDER_STREAMBUFFERSIZE, NULL, GL_DYNAMIC_DRAW );
+        mStreamBufferOffset = 0;
+
+        // Stats.
+        mpDebugStats->batchBufferOrphans++;
+    }
+
+    // Upload the vertices into the unused region.
+    glBufferSubData( GL_ARRAY_BUFFER, mStreamBufferOffset, uploadBytes, mStreamVertices.address() );
+
+    // Stats.
+    mpDebugStats->batchBytesUploaded += uploadBytes;
+
+    // Point the arrays at the uploaded region.
+    const U8* pBase = (const U8*)NULL + mStreamBufferOffset;
+    glVertexPointer( 2, GL_FLOAT, sizeof(StreamVertex), pBase + Offset(mPosition, StreamVertex) );
+    glTexCoordPointer( 2, GL_FLOAT, sizeof(StreamVertex), pBase + Offset(mTextureCoord, StreamVertex) );
+
+    if ( mColorCount > 0 )
+        glColorPointer( 4, GL_UNSIGNED_BYTE, sizeof(StreamVertex), pBase + Offset(mColor, StreamVertex) );
+
+    mStreamBufferOffset += uploadBytes;
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::destroyStreamBuffer( void )
+{
+    // Finish if no stream buffer.
+    if ( mStreamBufferName == 0 )
+        return;
+
+    glDeleteBuffers( 1, &mStreamBufferName );
+    mStreamBufferName = 0;
+    mStreamBufferOffset = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::textureEventCallback( const TextureManager::TextureEventCode eventCode, void* pUserData )
+{
+    // The GL context is about to go so release the stream buffer; it'll be recreated on the next flush.
+    if ( eventCode == TextureManager::BeginZombification )
+        static_cast<BatchRender*>( pUserData )->destroyStreamBuffer();
+}
+
+//-----------------------------------------------------------------------------
+
+BatchRender::StaticBatch::StaticBatch() :
+    mRunCount( 0 ),
+    mLastRun( 0 ),
+    mQuadCount( 0 ),
+    mBufferName( 0 ),
+    mBufferUploaded( false ),
+    mTextureEventKey( -1 )
+{
+}
+
+//-----------------------------------------------------------------------------
+
+BatchRender::StaticBatch::~StaticBatch()
+{
+    // Destroy the vertex buffer.
+    destroyBuffer();
+
+    // Stop receiving texture events.
+    if ( mTextureEventKey != -1 )
+        TextureManager::unregisterEventCallback( (U32)mTextureEventKey );
+
+    // Destroy the runs.
+    for ( VectorPtr<Run*>::iterator itr = mRuns.begin(); itr != mRuns.end(); ++itr )
+    {
+        delete (*itr);
+    }
+    mRuns.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::StaticBatch::clear( void )
+{
+    // Reset the runs keeping them for reuse.
+    for ( U32 runIndex = 0; runIndex < mRunCount; ++runIndex )
+    {
+        Run* pRun = mRuns[runIndex];
+        pRun->mTexture = TextureHandle();
+        pRun->mVertices.clear();
+    }
+
+    mRunCount = 0;
+    mLastRun = 0;
+    mQuadCount = 0;
+
+    // Flag the vertices as needing an upload.
+    mBufferUploaded = false;
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::StaticBatch::addQuad(
+        const Vector2& vertexPos0,
+        const Vector2& vertexPos1,
+        const Vector2& vertexPos2,
+        const Vector2& vertexPos3,
+        const Vector2& texturePos0,
+        const Vector2& texturePos1,
+        const Vector2& texturePos2,
+        const Vector2& texturePos3,
+        TextureHandle& texture,
+        const ColorF& color,
+        const bool blendMode,
+        const GLenum srcBlendFactor,
+        const GLenum dstBlendFactor,
+        const F32 alphaTestMode )
+{
+    // Fetch the run.
+    Run* pRun = findRun( texture, blendMode, srcBlendFactor, dstBlendFactor, alphaTestMode );
+
+    // Add the vertices.
+    const U32 vertexIndex = pRun->mVertices.size();
+    pRun->mVertices.setSize( vertexIndex + 4 );
+    StreamVertex* pStreamVertex = pRun->mVertices.address() + vertexIndex;
+
+    // NOTE: We swap #2/#3 here as SubmitQuad() does.
+    pStreamVertex[0].mPosition = vertexPos0;
+    pStreamVertex[0].mTextureCoord = texturePos0;
+    pStreamVertex[1].mPosition = vertexPos1;
+    pStreamVertex[1].mTextureCoord = texturePos1;
+    pStreamVertex[2].mPosition = vertexPos3;
+    pStreamVertex[2].mTextureCoord = texturePos3;
+    pStreamVertex[3].mPosition = vertexPos2;
+    pStreamVertex[3].mTextureCoord = texturePos2;
+
+    // Set the colors.
+    packStreamColor( color, pStreamVertex[0].mColor );
+    dMemcpy( pStreamVertex[1].mColor, pStreamVertex[0].mColor, sizeof(pStreamVertex[0].mColor) );
+    dMemcpy( pStreamVertex[2].mColor, pStreamVertex[0].mColor, sizeof(pStreamVertex[0].mColor) );
+    dMemcpy( pStreamVertex[3].mColor, pStreamVertex[0].mColor, sizeof(pStreamVertex[0].mColor) );
+
+    mQuadCount++;
+
+    // Flag the vertices as needing an upload.
+    mBufferUploaded = false;
+}
+
+//-----------------------------------------------------------------------------
+
+BatchRender::StaticBatch::Run* BatchRender::StaticBatch::findRun( TextureHandle& texture, const bool blendMode, const GLenum srcBlendFactor, const GLenum dstBlendFactor, const F32 alphaTestMode )
+{
+    // Check the last run first as consecutive quads usually share it.
+    for ( U32 n = 0; n < mRunCount; ++n )
+    {
+        const U32 runIndex = (mLastRun + n) % mRunCount;
+        Run* pRun = mRuns[runIndex];
+
+        // Skip if the state is different.
+        if ( pRun->mTexture != texture ||
+            pRun->mBlendMode != blendMode ||
+            pRun->mAlphaTestMode != alphaTestMode ||
+            ( blendMode && ( pRun->mSrcBlendFactor != srcBlendFactor || pRun->mDstBlendFactor != dstBlendFactor ) ) )
+            continue;
+
+        mLastRun = runIndex;
+        return pRun;
+    }
+
+    // Generate a run if there are none to reuse.
+    if ( mRunCount == (U32)mRuns.size() )
+    {
+        Run* pNewRun = new Run;
+        mRuns.push_back( pNewRun );
+    }
+
+    // Set the run state.
+    Run* pRun = mRuns[mRunCount];
+    pRun->mTexture = texture;
+    pRun->mBlendMode = blendMode;
+    pRun->mSrcBlendFactor = srcBlendFactor;
+    pRun->mDstBlendFactor = dstBlendFactor;
+    pRun->mAlphaTestMode = alphaTestMode;
+    pRun->mBufferOffset = 0;
+
+    mLastRun = mRunCount++;
+    return pRun;
+}
+
+//-----------------------------------------------------------------------------
+
+bool BatchRender::StaticBatch::bindBuffer( DebugStats* pDebugStats )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(BatchRender_StaticBatchBindBuffer);
+
+    // Finish if vertex buffer objects are not supported.
+    if ( !dglDoesSupportVertexBufferObject() )
+        return false;
+
+    // Create the vertex buffer if needed.
+    if ( mBufferName == 0 )
+    {
+        // Start receiving texture events so we know when the buffer is lost.
+        if ( mTextureEventKey == -1 )
+            mTextureEventKey = (S32)TextureManager::registerEventCallback( textureEventCallback, this );
+
+        glGenBuffers( 1, &mBufferName );
+
+        // Finish if the buffer could not be created.
+        if ( mBufferName == 0 )
+            return false;
+
+        mBufferUploaded = false;
+    }
+
+    glBindBuffer( GL_ARRAY_BUFFER, mBufferName );
+
+    // Finish if the vertices are already uploaded.
+    if ( mBufferUploaded )
+        return true;
+
+    // Place the runs one after another.
+    U32 vertexCount = 0;
+    for ( U32 runIndex = 0; runIndex < mRunCount; ++runIndex )
+    {
+        mRuns[runIndex]->mBufferOffset = vertexCount;
+        vertexCount += mRuns[runIndex]->mVertices.size();
+    }
+
+    // Allocate the buffer storage and upload the runs.
+    const U32 uploadBytes = vertexCount * sizeof(StreamVertex);
+    glBufferData( GL_ARRAY_BUFFER, uploadBytes, NULL, GL_STATIC_DRAW );
+    for ( U32 runIndex = 0; runIndex < mRunCount; ++runIndex )
+    {
+        Run* pRun = mRuns[runIndex];
+        glBufferSubData( GL_ARRAY_BUFFER, pRun->mBufferOffset * sizeof(StreamVertex), pRun->mVertices.size() * sizeof(StreamVertex), pRun->mVertices.address() );
+    }
+
+    // Stats.
+    pDebugStats->batchStaticUploads++;
+    pDebugStats->batchBytesUploaded += uploadBytes;
+
+    mBufferUploaded = true;
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::StaticBatch::destroyBuffer( void )
+{
+    // Finish if no vertex buffer.
+    if ( mBufferName == 0 )
+        return;
+
+    glDeleteBuffers( 1, &mBufferName );
+    mBufferName = 0;
+    mBufferUploaded = false;
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::StaticBatch::textureEventCallback( const TextureManager::TextureEventCode eventCode, void* pUserData )
+{
+    // The GL context is about to go so release the vertex buffer; it'll be recreated and uploaded on the next submit.
+    if ( eventCode == TextureManager::BeginZombification )
+        static_cast<BatchRender::StaticBatch*>( pUserData )->destroyBuffer();
+}
@@ -51,6 +51,8 @@
 
 #define BATCHRENDER_BUFFERSIZE      (65535)
 #define BATCHRENDER_MAXTRIANGLES    (BATCHRENDER_BUFFERSIZE/3)
+#define BATCHRENDER_STREAMBUFFERSIZE    (4*1024*1024)
+#define BATCHRENDER_STATICQUADS     (16384)
 
 //-----------------------------------------------------------------------------
 
@@ -80,6 +82,13 @@ private:
         U32 mStartIndex;
     };
 
+    struct StreamVertex
+    {
+        Vector2 mPosition;
+        Vector2 mTextureCoord;
+        U8      mColor[4];
+    };
+
     typedef Vector<TriangleRun> indexVectorType;
     typedef HashMap<U32, indexVectorType*> textureBatchType;
 
@@ -112,6 +121,90 @@ private:
     bool                mWireframeMode;
     bool                mBatchEnabled;
 
+    bool                mStreamingMode;
+    Vector<StreamVertex> mStreamVertices;
+    GLuint              mStreamBufferName;
+    U32                 mStreamBufferOffset;
+    S32                 mTextureEventKey;
+
+    Vector<U16>         mStaticQuadIndices;
+
+public:
+    /// Pre-baked geometry which is kept across frames.
+    /// Quads are added once (already transformed) and grouped into runs by texture and blend state.
+    /// The batch is then drawn each frame with SubmitStaticBatch() without submitting the quads again.
+    /// The vertices are kept in a static vertex buffer object when supported (client-side arrays otherwise)
+    /// and are only uploaded again after the batch has been cleared and rebuilt.
+    class StaticBatch
+    {
+        friend class BatchRender;
+
+    public:
+        StaticBatch();
+        ~StaticBatch();
+
+        /// Remove all the quads ready to rebuild the batch.
+        void clear( void );
+
+        /// Add a quad to the batch.
+        /// Vertex and textures are indexed as they are for SubmitQuad().
+        /// The color is stored per-vertex and the blend state is stored per-run.
+        void addQuad(
+                const Vector2& vertexPos0,
+                const Vector2& vertexPos1,
+                const Vector2& vertexPos2,
+                const Vector2& vertexPos3,
+                const Vector2& texturePos0,
+                const Vector2& texturePos1,
+                const Vector2& texturePos2,
+                const Vector2& texturePos3,
+                TextureHandle& texture,
+                const ColorF& color,
+                const bool blendMode,
+                const GLenum srcBlendFactor,
+                const GLenum dstBlendFactor,
+                const F32 alphaTestMode );
+
+        /// Gets the number of quads in the batch.
+        inline U32 getQuadCount( void ) const { return mQuadCount; }
+
+        /// Gets the number of runs (draws of a single texture and blend state) in the batch.
+        inline U32 getRunCount( void ) const { return mRunCount; }
+
+    private:
+        struct Run
+        {
+            TextureHandle           mTexture;
+            bool                    mBlendMode;
+            GLenum                  mSrcBlendFactor;
+            GLenum                  mDstBlendFactor;
+            F32                     mAlphaTestMode;
+            Vector<StreamVertex>    mVertices;
+            U32                     mBufferOffset;
+        };
+
+        VectorPtr<Run*>     mRuns;
+        U32                 mRunCount;
+        U32                 mLastRun;
+        U32                 mQuadCount;
+
+        GLuint              mBufferName;
+        bool                mBufferUploaded;
+        S32                 mTextureEventKey;
+
+        /// Find (or add) the run for the specified texture and blend state.
+        Run* findRun( TextureHandle& texture, const bool blendMode, const GLenum srcBlendFactor, const GLenum dstBlendFactor, const F32 alphaTestMode );
+
+        /// Bind the vertex buffer uploading the vertices if needed.
+        bool bindBuffer( DebugStats* pDebugStats );
+
+        /// Destroy the vertex buffer.
+        void destroyBuffer( void );
+
+        /// Texture manager events.
+        static void textureEventCallback( const TextureManager::TextureEventCode eventCode, void* pUserData );
+    };
+
 public:
     BatchRender();
     virtual ~BatchRender();
@@ -216,6 +309,17 @@ public:
     /// Gets the batch enabled mode.
     inline bool getBatchEnabled( void ) const { return mBatchEnabled; }
 
+    /// Sets the streaming mode.
+    /// When on, batched vertices are interleaved and streamed through a vertex buffer object
+    /// rather than being read from client-side arrays on each draw call.
+    void setStreamingMode( const bool enabled );
+
+    /// Gets the streaming mode.
+    inline bool getStreamingMode( void ) const { return mStreamingMode; }
+
+    /// Gets the stream buffer offset the next flush uploads its vertices to.
+    inline U32 getStreamBufferOffset( void ) const { return mStreamBufferOffset; }
+
     /// Sets the debug stats to use.
     inline void setDebugStats( DebugStats* pDebugStats ) { mpDebugStats = pDebugStats; }
 
@@ -250,6 +354,11 @@ public:
             TextureHandle& texture,
             const ColorF& color = ColorF(-1.0f, -1.0f, -1.0f) );
 
+    /// Submit a static batch.
+    /// Anything currently batched is flushed first then each run of the static batch
+    /// is drawn with its own texture and blend state.
+    void SubmitStaticBatch( StaticBatch& staticBatch );
+
     /// Render a quad immediately without affecting current batch.
     /// All render state should be set beforehand directly.
     /// Vertex and textures are indexed as:
@@ -291,6 +400,15 @@ private:
 
     /// Find texture batch.
     indexVectorType* findTextureBatch( TextureHandle& handle );
+
+    /// Upload the batched vertices to the stream buffer and bind them.
+    bool bindStreamVertices( void );
+
+    /// Destroy the stream buffer.
+    void destroyStreamBuffer( void );
+
+    /// Texture manager events.
+    static void textureEventCallback( const TextureManager::TextureEventCode eventCode, void* pUserData );
 };
 
 #endif
\ No newline at end of file
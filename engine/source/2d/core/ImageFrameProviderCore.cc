@@ -278,7 +278,7 @@ void ImageFrameProviderCore::renderGui( GuiControl& owner, Point2I offset, const
     {
         // Valid, so calculate source region.
         const ImageAsset::FrameArea& frameArea = getProviderImageFrameArea();
-        RectI sourceRegion( frameArea.mPixelArea.mPixelOffset, Point2I(frameArea.mPixelArea.mPixelWidth, frameArea.mPixelArea.mPixelHeight) );
+        RectI sourceRegion( frameArea.mPixelArea.mPixelOffset + getProviderImageTextureOffset(), Point2I(frameArea.mPixelArea.mPixelWidth, frameArea.mPixelArea.mPixelHeight) );
 
         // Calculate destination region.
         RectI destinationRegion(offset, owner.mBounds.extent);
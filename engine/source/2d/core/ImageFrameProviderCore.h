@@ -142,6 +142,7 @@ public:
     inline bool isUsingNamedImageFrame( void ) const { return mUsingNamedFrame; }
     inline TextureHandle& getProviderTexture( void ) const { return !validRender() ? BadTextureHandle : isStaticFrameProvider() ? (*mpImageAsset)->getImageTexture() : (*mpAnimationAsset)->getImage()->getImageTexture(); };
     const ImageAsset::FrameArea& getProviderImageFrameArea( void ) const;
+    inline Point2I getProviderImageTextureOffset( void ) const { return !validRender() ? Point2I( 0, 0 ) : isStaticFrameProvider() ? (*mpImageAsset)->getImageTextureOffset() : (*mpAnimationAsset)->getImage()->getImageTextureOffset(); };
     inline const AnimationAsset* getCurrentAnimation( void ) const { return mpAnimationAsset->notNull() ? *mpAnimationAsset : NULL; };
     inline const StringTableEntry getCurrentAnimationAssetId( void ) const { return mpAnimationAsset->getAssetId(); };
     const U32 getCurrentAnimationFrame( void ) const;
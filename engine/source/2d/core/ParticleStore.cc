@@ -0,0 +1,454 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "2d/core/ParticleStore.h"
+
+#ifndef _PARTICLE_SYSTEM_H_
+#include "2d/core/ParticleSystem.h"
+#endif
+
+#ifndef _MMATHFN_H_
+#include "math/mMathFn.h"
+#endif
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+// Use SSE2 where the compiler targets it.
+#if defined(TORQUE_CPU_X86) || defined(TORQUE_CPU_X86_64)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PARTICLE_STORE_SSE
+#include <emmintrin.h>
+#endif
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define PARTICLE_STORE_MIN_CAPACITY     64
+#define PARTICLE_STORE_ALIGNMENT        16
+
+//-----------------------------------------------------------------------------
+
+ParticleStore::ParticleStore() :
+    mCount( 0 ),
+    mCapacity( 0 ),
+    mpStreamMemory( NULL ),
+    mpFrameProviders( NULL )
+{
+    VECTOR_SET_ASSOCIATION( mExpired );
+
+    dMemset( mpStreams, 0, sizeof(mpStreams) );
+}
+
+//-----------------------------------------------------------------------------
+
+ParticleStore::~ParticleStore()
+{
+    // Free all the particles.
+    clear();
+
+    // Free the storage.
+    if ( mpStreamMemory != NULL )
+        dFree( mpStreamMemory );
+
+    if ( mpFrameProviders != NULL )
+        dFree( mpFrameProviders );
+}
+
+//-----------------------------------------------------------------------------
+
+void ParticleStore::reserve( const U32 capacity )
+{
+    // Finish if we've already got the capacity.
+    if ( capacity <= mCapacity )
+        return;
+
+    // Round the capacity to a whole number of SIMD registers so each stream stays aligned.
+    const U32 newCapacity = (capacity + 3) & ~3;
+
+    // Allocate the new streams.
+    void* pStreamMemory = dMalloc( STREAM_COUNT * newCapacity * sizeof(F32) + PARTICLE_STORE_ALIGNMENT );
+    F32* pAlignedStreams = (F32*)(((size_t)pStreamMemory + (PARTICLE_STORE_ALIGNMENT-1)) & ~(size_t)(PARTICLE_STORE_ALIGNMENT-1));
+
+    // Move any existing particles.
+    for ( U32 stream = 0; stream < STREAM_COUNT; ++stream )
+    {
+        F32* pNewStream = pAlignedStreams + (stream * newCapacity);
+
+        if ( mCount > 0 )
+            dMemcpy( pNewStream, mpStreams[stream], mCount * sizeof(F32) );
+
+        mpStreams[stream] = pNewStream;
+    }
+
+    if ( mpStreamMemory != NULL )
+        dFree( mpStreamMemory );
+
+    mpStreamMemory = pStreamMemory;
+
+    // Resize the frame providers.
+    mpFrameProviders = (ImageFrameProviderCore**)dRealloc( mpFrameProviders, newCapacity * sizeof(ImageFrameProviderCore*) );
+
+    mCapacity = newCapacity;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 ParticleStore::create( void )
+{
+    // Grow if needed.
+    if ( mCount == mCapacity )
+        reserve( getMax( mCapacity * 2, (U32)PARTICLE_STORE_MIN_CAPACITY ) );
+
+    const U32 index = mCount++;
+
+    mpFrameProviders[index] = NULL;
+
+    return index;
+}
+
+//-----------------------------------------------------------------------------
+
+void ParticleStore::clear( void )
+{
+    // Return the frame providers.
+    for ( U32 index = 0; index < mCount; ++index )
+    {
+        if ( mpFrameProviders[index] != NULL )
+            ParticleSystem::Instance->freeFrameProvider( mpFrameProviders[index] );
+    }
+
+    mCount = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 ParticleStore::removeExpired( const bool singleParticle )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(ParticleStore_RemoveExpired);
+
+    const F32* pAge = mpStreams[AGE];
+    const F32* pLifetime = mpStreams[LIFETIME];
+
+    // Flag the expired particles, returning their frame providers and compacting the rest.
+    // NOTE:-   If we're in single-particle mode then the particle lives as long as the particle player does.
+    mExpired.setSize( mCount );
+    U32 writeIndex = 0;
+    for ( U32 readIndex = 0; readIndex < mCount; ++readIndex )
+    {
+        const bool expired = ( !singleParticle && pAge[readIndex] > pLifetime[readIndex] ) || mIsZero( pLifetime[readIndex] );
+        mExpired[readIndex] = expired;
+
+        if ( expired )
+        {
+            if ( mpFrameProviders[readIndex] != NULL )
+                ParticleSystem::Instance->freeFrameProvider( mpFrameProviders[readIndex] );
+
+            continue;
+        }
+
+        mpFrameProviders[writeIndex++] = mpFrameProviders[readIndex];
+    }
+
+    // Finish if nothing was removed.
+    if ( writeIndex == mCount )
+        return 0;
+
+    // Compact each stream in turn.
+    for ( U32 stream = 0; stream < STREAM_COUNT; ++stream )
+    {
+        F32* pStream = mpStreams[stream];
+        U32 streamWriteIndex = 0;
+        for ( U32 readIndex = 0; readIndex < mCount; ++readIndex )
+        {
+            if ( !mExpired[readIndex] )
+                pStream[streamWriteIndex++] = pStream[readIndex];
+        }
+    }
+
+    const U32 removedCount = mCount - writeIndex;
+
+    mCount = writeIndex;
+
+    return removedCount;
+}
+
+//-----------------------------------------------------------------------------
+
+void ParticleStore::advanceAge( const F32 elapsedTime )
+{
+    F32* pAge = mpStreams[AGE];
+
+    U32 index = 0;
+
+#ifdef PARTICLE_STORE_SSE
+    const __m128 elapsed = _mm_set1_ps( elapsedTime );
+    for ( ; index + 4 <= mCount; index += 4 )
+        _mm_store_ps( pAge + index, _mm_add_ps( _mm_load_ps( pAge + index ), elapsed ) );
+#endif
+
+    for ( ; index < mCount; ++index )
+        pAge[index] += elapsedTime;
+}
+
+//-----------------------------------------------------------------------------
+
+void ParticleStore::updateLife( const U32 startIndex )
+{
+    const F32* pAge = mpStreams[AGE];
+    const F32* pLifetime = mpStreams[LIFETIME];
+    F32* pLife = mpStreams[LIFE];
+
+    U32 index = startIndex;
+
+#ifdef PARTICLE_STORE_SSE
+    const __m128 zero = _mm_setzero_ps();
+    for ( ; index + 4 <= mCount; index += 4 )
+    {
+        // A particle without a lifetime stays at the start of its life.
+        const __m128 lifetime = _mm_loadu_ps( pLifetime + index );
+        const __m128 life = _mm_div_ps( _mm_loadu_ps( pAge + index ), lifetime );
+        _mm_storeu_ps( pLife + index, _mm_and_ps( life, _mm_cmpneq_ps( lifetime, zero ) ) );
+    }
+#endif
+
+    for ( ; index < mCount; ++index )
+        pLife[index] = pLifetime[index] != 0.0f ? pAge[index] / pLifetime[index] : 0.0f;
+}
+
+//-----------------------------------------------------------------------------
+
+void ParticleStore::beginTick( const U32 startIndex )
+{
+    // Finish if nothing to do.
+    if ( startIndex >= mCount )
+        return;
+
+    const U32 bytes = (mCount - startIndex) * sizeof(F32);
+
+    // Copy the old tick position.
+    dMemcpy( mpStreams[PRE_TICK_X] + startIndex, mpStreams[POST_TICK_X] + startIndex, bytes );
+    dMemcpy( mpStreams[PRE_TICK_Y] + startIndex, mpStreams[POST_TICK_Y] + startIndex, bytes );
+    dMemcpy( mpStreams[RENDER_TICK_X] + startIndex, mpStreams[POST_TICK_X] + startIndex, bytes );
+    dMemcpy( mpStreams[RENDER_TICK_Y] + startIndex, mpStreams[POST_TICK_Y] + startIndex, bytes );
+}
+
+//-----------------------------------------------------------------------------
+
+void ParticleStore::endTick( const U32 startIndex )
+{
+    // Finish if nothing to do.
+    if ( startIndex >= mCount )
+        return;
+
+    const U32 bytes = (mCount - startIndex) * sizeof(F32);
+
+    // Set the post tick position.
+    dMemcpy( mpStreams[POST_TICK_X] + startIndex, mpStreams[POSITION_X] + startIndex, bytes );
+    dMemcpy( mpStreams[POST_TICK_Y] + startIndex, mpStreams[POSITION_Y] + startIndex, bytes );
+}
+
+//-----------------------------------------------------------------------------
+
+void ParticleStore::integrateMotion( const U32 startIndex, const Vector2& fixedForceDirection, const F32 elapsedTime )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(ParticleStore_IntegrateMotion);
+
+    F32* pPositionX = mpStreams[POSITION_X];
+    F32* pPositionY = mpStreams[POSITION_Y];
+    F32* pVelocityX = mpStreams[VELOCITY_X];
+    F32* pVelocityY = mpStreams[VELOCITY_Y];
+    const F32* pRenderSpeed = mpStreams[RENDER_SPEED];
+    const F32* pRenderFixedForce = mpStreams[RENDER_FIXED_FORCE];
+
+    const F32 forceX = fixedForceDirection.x * elapsedTime;
+    const F32 forceY = fixedForceDirection.y * elapsedTime;
+
+    U32 index = startIndex;
+
+#ifdef PARTICLE_STORE_SSE
+    const __m128 forceX4 = _mm_set1_ps( forceX );
+    const __m128 forceY4 = _mm_set1_ps( forceY );
+    const __m128 elapsed4 = _mm_set1_ps( elapsedTime );
+    for ( ; index + 4 <= mCount; index += 4 )
+    {
+        const __m128 fixedForce = _mm_loadu_ps( pRenderFixedForce + index );
+        const __m128 velocityX = _mm_add_ps( _mm_loadu_ps( pVelocityX + index ), _mm_mul_ps( forceX4, fixedForce ) );
+        const __m128 velocityY = _mm_add_ps( _mm_loadu_ps( pVelocityY + index ), _mm_mul_ps( forceY4, fixedForce ) );
+        const __m128 step = _mm_mul_ps( _mm_loadu_ps( pRenderSpeed + index ), elapsed4 );
+        _mm_storeu_ps( pVelocityX + index, velocityX );
+        _mm_storeu_ps( pVelocityY + index, velocityY );
+        _mm_storeu_ps( pPositionX + index, _mm_add_ps( _mm_loadu_ps( pPositionX + index ), _mm_mul_ps( velocityX, step ) ) );
+        _mm_storeu_ps( pPositionY + index, _mm_add_ps( _mm_loadu_ps( pPositionY + index ), _mm_mul_ps( velocityY, step ) ) );
+    }
+#endif
+
+    for ( ; index < mCount; ++index )
+    {
+        pVelocityX[index] += forceX * pRenderFixedForce[index];
+        pVelocityY[index] += forceY * pRenderFixedForce[index];
+
+        const F32 step = pRenderSpeed[index] * elapsedTime;
+        pPositionX[index] += pVelocityX[index] * step;
+        pPositionY[index] += pVelocityY[index] * step;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void ParticleStore::integrateSpin( const U32 startIndex, const F32 elapsedTime )
+{
+    F32* pOrientation = mpStreams[ORIENTATION];
+    const F32* pRenderSpin = mpStreams[RENDER_SPIN];
+
+    U32 index = startIndex;
+
+#ifdef PARTICLE_STORE_SSE
+    const __m128 elapsed4 = _mm_set1_ps( elapsedTime );
+    const __m128 fullTurn = _mm_set1_ps( 360.0f );
+    const __m128 inverseFullTurn = _mm_set1_ps( 1.0f / 360.0f );
+    const __m128 epsilon = _mm_set1_ps( FLT_EPSILON );
+    const __m128 absMask = _mm_castsi128_ps( _mm_set1_epi32( 0x7fffffff ) );
+    for ( ; index + 4 <= mCount; index += 4 )
+    {
+        const __m128 spin = _mm_loadu_ps( pRenderSpin + index );
+        const __m128 orientation = _mm_loadu_ps( pOrientation + index );
+        const __m128 spun = _mm_add_ps( orientation, _mm_mul_ps( spin, elapsed4 ) );
+
+        // Wrap to +/-360 degrees (truncating like fmod).
+        const __m128 turns = _mm_cvtepi32_ps( _mm_cvttps_epi32( _mm_mul_ps( spun, inverseFullTurn ) ) );
+        const __m128 wrapped = _mm_sub_ps( spun, _mm_mul_ps( turns, fullTurn ) );
+
+        // Only particles with some spin are changed.
+        const __m128 spinning = _mm_cmpge_ps( _mm_and_ps( spin, absMask ), epsilon );
+        _mm_storeu_ps( pOrientation + index, _mm_or_ps( _mm_and_ps( spinning, wrapped ), _mm_andnot_ps( spinning, orientation ) ) );
+    }
+#endif
+
+    for ( ; index < mCount; ++index )
+    {
+        if ( mNotZero( pRenderSpin[index] ) )
+            pOrientation[index] = mFmod( pOrientation[index] + pRenderSpin[index] * elapsedTime, 360.0f );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void ParticleStore::updateRotation( const U32 startIndex )
+{
+    const F32* pOrientation = mpStreams[ORIENTATION];
+    F32* pRotationSin = mpStreams[ROTATION_SIN];
+    F32* pRotationCos = mpStreams[ROTATION_COS];
+
+    for ( U32 index = startIndex; index < mCount; ++index )
+    {
+        const F32 angle = mDegToRad( pOrientation[index] );
+        pRotationSin[index] = mSin( angle );
+        pRotationCos[index] = mCos( angle );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void ParticleStore::calculateOOBB( const U32 startIndex, const Vector2* pLocalAABB, const bool useRenderTick )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(ParticleStore_CalculateOOBB);
+
+    const F32* pPositionX = mpStreams[useRenderTick ? RENDER_TICK_X : POSITION_X];
+    const F32* pPositionY = mpStreams[useRenderTick ? RENDER_TICK_Y : POSITION_Y];
+    const F32* pRenderSizeX = mpStreams[RENDER_SIZE_X];
+    const F32* pRenderSizeY = mpStreams[RENDER_SIZE_Y];
+    const F32* pRotationSin = mpStreams[ROTATION_SIN];
+    const F32* pRotationCos = mpStreams[ROTATION_COS];
+
+    F32* pOOBBX[4] = { mpStreams[OOBB0_X], mpStreams[OOBB1_X], mpStreams[OOBB2_X], mpStreams[OOBB3_X] };
+    F32* pOOBBY[4] = { mpStreams[OOBB0_Y], mpStreams[OOBB1_Y], mpStreams[OOBB2_Y], mpStreams[OOBB3_Y] };
+
+    U32 index = startIndex;
+
+#ifdef PARTICLE_STORE_SSE
+    for ( ; index + 4 <= mCount; index += 4 )
+    {
+        const __m128 positionX = _mm_loadu_ps( pPositionX + index );
+        const __m128 positionY = _mm_loadu_ps( pPositionY + index );
+        const __m128 sizeX = _mm_loadu_ps( pRenderSizeX + index );
+        const __m128 sizeY = _mm_loadu_ps( pRenderSizeY + index );
+        const __m128 rotationSin = _mm_loadu_ps( pRotationSin + index );
+        const __m128 rotationCos = _mm_loadu_ps( pRotationCos + index );
+
+        for ( U32 vertex = 0; vertex < 4; ++vertex )
+        {
+            // Scale the local vertex by the render size then transform it.
+            const __m128 localX = _mm_mul_ps( _mm_set1_ps( pLocalAABB[vertex].x ), sizeX );
+            const __m128 localY = _mm_mul_ps( _mm_set1_ps( pLocalAABB[vertex].y ), sizeY );
+            _mm_storeu_ps( pOOBBX[vertex] + index, _mm_add_ps( _mm_sub_ps( _mm_mul_ps( rotationCos, localX ), _mm_mul_ps( rotationSin, localY ) ), positionX ) );
+            _mm_storeu_ps( pOOBBY[vertex] + index, _mm_add_ps( _mm_add_ps( _mm_mul_ps( rotationSin, localX ), _mm_mul_ps( rotationCos, localY ) ), positionY ) );
+        }
+    }
+#endif
+
+    for ( ; index < mCount; ++index )
+    {
+        for ( U32 vertex = 0; vertex < 4; ++vertex )
+        {
+            const F32 localX = pLocalAABB[vertex].x * pRenderSizeX[index];
+            const F32 localY = pLocalAABB[vertex].y * pRenderSizeY[index];
+            pOOBBX[vertex][index] = (pRotationCos[index] * localX - pRotationSin[index] * localY) + pPositionX[index];
+            pOOBBY[vertex][index] = (pRotationSin[index] * localX + pRotationCos[index] * localY) + pPositionY[index];
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void ParticleStore::interpolateTick( const F32 timeDelta )
+{
+    const F32* pPreTickX = mpStreams[PRE_TICK_X];
+    const F32* pPreTickY = mpStreams[PRE_TICK_Y];
+    const F32* pPostTickX = mpStreams[POST_TICK_X];
+    const F32* pPostTickY = mpStreams[POST_TICK_Y];
+    F32* pRenderTickX = mpStreams[RENDER_TICK_X];
+    F32* pRenderTickY = mpStreams[RENDER_TICK_Y];
+
+    const F32 postDelta = 1.0f - timeDelta;
+
+    U32 index = 0;
+
+#ifdef PARTICLE_STORE_SSE
+    const __m128 preDelta4 = _mm_set1_ps( timeDelta );
+    const __m128 postDelta4 = _mm_set1_ps( postDelta );
+    for ( ; index + 4 <= mCount; index += 4 )
+    {
+        _mm_store_ps( pRenderTickX + index, _mm_add_ps( _mm_mul_ps( preDelta4, _mm_load_ps( pPreTickX + index ) ), _mm_mul_ps( postDelta4, _mm_load_ps( pPostTickX + index ) ) ) );
+        _mm_store_ps( pRenderTickY + index, _mm_add_ps( _mm_mul_ps( preDelta4, _mm_load_ps( pPreTickY + index ) ), _mm_mul_ps( postDelta4, _mm_load_ps( pPostTickY + index ) ) ) );
+    }
+#endif
+
+    for ( ; index < mCount; ++index )
+    {
+        pRenderTickX[index] = (timeDelta * pPreTickX[index]) + (postDelta * pPostTickX[index]);
+        pRenderTickY[index] = (timeDelta * pPreTickY[index]) + (postDelta * pPostTickY[index]);
+    }
+}
@@ -0,0 +1,151 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _PARTICLE_STORE_H_
+#define _PARTICLE_STORE_H_
+
+#ifndef _VECTOR2_H_
+#include "2d/core/Vector2.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+class ImageFrameProviderCore;
+
+//-----------------------------------------------------------------------------
+
+/// Structure-of-arrays storage for the particles of a single emitter.
+///
+/// Each particle component is held in its own contiguous, 16-byte aligned stream
+/// so the integration kernels below can work through the particles a SIMD register
+/// at a time.  Particles are kept in creation order (oldest first) and expired
+/// particles are removed by compacting the streams in place.
+class ParticleStore
+{
+public:
+    enum Stream
+    {
+        AGE,
+        LIFETIME,
+        LIFE,
+
+        POSITION_X,
+        POSITION_Y,
+        VELOCITY_X,
+        VELOCITY_Y,
+
+        PRE_TICK_X,
+        PRE_TICK_Y,
+        POST_TICK_X,
+        POST_TICK_Y,
+        RENDER_TICK_X,
+        RENDER_TICK_Y,
+
+        SIZE_X,
+        SIZE_Y,
+        RENDER_SIZE_X,
+        RENDER_SIZE_Y,
+
+        SPEED,
+        RENDER_SPEED,
+        SPIN,
+        RENDER_SPIN,
+        FIXED_FORCE,
+        RENDER_FIXED_FORCE,
+        RANDOM_MOTION,
+        RENDER_RANDOM_MOTION,
+
+        ORIENTATION,
+        ROTATION_SIN,
+        ROTATION_COS,
+
+        COLOR_RED,
+        COLOR_GREEN,
+        COLOR_BLUE,
+        COLOR_ALPHA,
+
+        OOBB0_X,
+        OOBB0_Y,
+        OOBB1_X,
+        OOBB1_Y,
+        OOBB2_X,
+        OOBB2_Y,
+        OOBB3_X,
+        OOBB3_Y,
+
+        STREAM_COUNT
+    };
+
+public:
+    ParticleStore();
+    ~ParticleStore();
+
+    /// Particle count.
+    inline U32 size( void ) const { return mCount; }
+    inline bool isEmpty( void ) const { return mCount == 0; }
+
+    /// Add a particle at the end of the store returning its index.
+    /// The particle components are not initialized.
+    U32 create( void );
+
+    /// Remove all the particles.
+    void clear( void );
+
+    /// Remove the particles that have outlived their lifetime (or have no lifetime) preserving the order of the rest.
+    /// Returns the number of particles removed.
+    U32 removeExpired( const bool singleParticle );
+
+    /// Component access.
+    inline F32* getStream( const Stream stream ) { return mpStreams[stream]; }
+    inline const F32* getStream( const Stream stream ) const { return mpStreams[stream]; }
+    inline ImageFrameProviderCore*& getFrameProvider( const U32 index ) { return mpFrameProviders[index]; }
+    inline ImageFrameProviderCore* getFrameProvider( const U32 index ) const { return mpFrameProviders[index]; }
+
+    /// Integration kernels.
+    /// These operate on the particles from "startIndex" to the end of the store.
+    void advanceAge( const F32 elapsedTime );
+    void updateLife( const U32 startIndex );
+    void beginTick( const U32 startIndex );
+    void endTick( const U32 startIndex );
+    void integrateMotion( const U32 startIndex, const Vector2& fixedForceDirection, const F32 elapsedTime );
+    void integrateSpin( const U32 startIndex, const F32 elapsedTime );
+    void updateRotation( const U32 startIndex );
+    void calculateOOBB( const U32 startIndex, const Vector2* pLocalAABB, const bool useRenderTick );
+    void interpolateTick( const F32 timeDelta );
+
+private:
+    void reserve( const U32 capacity );
+
+private:
+    U32                         mCount;
+    U32                         mCapacity;
+    void*                       mpStreamMemory;
+    F32*                        mpStreams[STREAM_COUNT];
+    ImageFrameProviderCore**    mpFrameProviders;
+    Vector<bool>                mExpired;
+};
+
+#endif // _PARTICLE_STORE_H_
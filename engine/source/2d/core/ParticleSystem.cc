@@ -46,10 +46,10 @@ void ParticleSystem::destroy( void )
 //------------------------------------------------------------------------------
 
 ParticleSystem::ParticleSystem() :
-                    mParticlePoolBlockSize(512)
+                    mFrameProviderPoolBlockSize(512)
 {
-    // Reset the free particle head.
-    mpFreeParticleNodes = NULL;
+    VECTOR_SET_ASSOCIATION( mFrameProviderPool );
+    VECTOR_SET_ASSOCIATION( mFreeFrameProviders );
 
     // Reset the active particle count.
     mActiveParticleCount = 0;
@@ -59,76 +59,59 @@ ParticleSystem::ParticleSystem() :
 
 ParticleSystem::~ParticleSystem()
 {
-    // Destroy all the particle pool blocks.
-    for ( U32 n = 0; n < (U32)mParticlePool.size(); n++ )
-        delete [] mParticlePool[n];
+    // Destroy all the frame provider pool blocks.
+    for ( U32 n = 0; n < (U32)mFrameProviderPool.size(); n++ )
+        delete [] mFrameProviderPool[n];
 
-    // Clear the particle pool.
-    mParticlePool.clear();
-
-    // Reset the free particle head.
-    mpFreeParticleNodes = NULL;
+    // Clear the frame provider pool.
+    mFrameProviderPool.clear();
+    mFreeFrameProviders.clear();
 }
 
 //------------------------------------------------------------------------------
 
-ParticleSystem::ParticleNode* ParticleSystem::createParticle( void )
+ImageFrameProviderCore* ParticleSystem::createFrameProvider( void )
 {
-    // Have we got any free particle nodes?
-    if ( mpFreeParticleNodes == NULL )
+    // Have we got any free frame providers?
+    if ( mFreeFrameProviders.size() == 0 )
     {
         // No, so generate a new free pool block.
-        ParticleNode* pFreePoolBlock = new ParticleNode[mParticlePoolBlockSize];
+        ImageFrameProviderCore* pFreePoolBlock = new ImageFrameProviderCore[mFrameProviderPoolBlockSize];
 
         // Store new free pool block.
-        mParticlePool.push_back( pFreePoolBlock );
-
-        // Initialise Free Pool Block.
-        for ( U32 n = 0; n < (mParticlePoolBlockSize-1); n++ )
-        {
-            pFreePoolBlock[n].mPreviousNode = NULL;
-            pFreePoolBlock[n].mNextNode     = pFreePoolBlock+n+1;
-        }
+        mFrameProviderPool.push_back( pFreePoolBlock );
 
-        // Insert Last Node Preceding any existing free nodes.
-        pFreePoolBlock[mParticlePoolBlockSize-1].mPreviousNode = NULL;
-        pFreePoolBlock[mParticlePoolBlockSize-1].mNextNode = mpFreeParticleNodes;
-
-        // Set Free References.
-        mpFreeParticleNodes = pFreePoolBlock;
+        // Add the block to the free frame providers.
+        // NOTE: Added in reverse so the block is handed out in address order.
+        mFreeFrameProviders.reserve( mFreeFrameProviders.size() + mFrameProviderPoolBlockSize );
+        for ( S32 n = (S32)mFrameProviderPoolBlockSize-1; n >= 0; n-- )
+            mFreeFrameProviders.push_back( pFreePoolBlock+n );
     }
 
-    // Fetch a free node,
-    ParticleNode* pFreeParticleNode = mpFreeParticleNodes;
-
-    // Set the new free node reference.
-    mpFreeParticleNodes = mpFreeParticleNodes->mNextNode;
-
-    // Reset any previous or next node references.
-    pFreeParticleNode->mNextNode        = NULL;
-    pFreeParticleNode->mPreviousNode    = NULL;
+    // Fetch a free frame provider.
+    ImageFrameProviderCore* pFrameProvider = mFreeFrameProviders.last();
+    mFreeFrameProviders.pop_back();
 
     // Increase the active particle count.
     mActiveParticleCount++;
 
-    return pFreeParticleNode;
+    return pFrameProvider;
 }
 
 //------------------------------------------------------------------------------
 
-void ParticleSystem::freeParticle( ParticleNode* pParticleNode )
+void ParticleSystem::freeFrameProvider( ImageFrameProviderCore* pFrameProvider )
 {
-    // Reset the particle.
-    pParticleNode->resetState();
+    // Sanity!
+    AssertFatal( pFrameProvider != NULL, "ParticleSystem::freeFrameProvider() - Cannot free a NULL frame provider." );
+
+    // Reset the frame provider.
+    pFrameProvider->deallocateAssets();
+    pFrameProvider->resetState();
 
-    // Remove the previous node reference.
-    pParticleNode->mPreviousNode = NULL;
-    
-    // Insert the node into the free pool.
-    pParticleNode->mNextNode = mpFreeParticleNodes;
-    mpFreeParticleNodes = pParticleNode;
+    // Insert into the free pool.
+    mFreeFrameProviders.push_back( pFrameProvider );
 
     // Decrease the active particle count.
     mActiveParticleCount--;
 }
-
@@ -31,60 +31,11 @@
 
 class ParticleSystem
 {
-public:
-    /// Particle node.
-    struct ParticleNode : public IFactoryObjectReset
-    {
-        /// Particle Node Linkages.
-        ParticleNode*           mPreviousNode;
-        ParticleNode*           mNextNode;
-
-        /// Suppress Movement.
-        bool                    mSuppressMovement;
-
-        /// Particle Components.
-        F32                     mParticleLifetime;
-        F32                     mParticleAge;
-        Vector2                 mPosition;
-        Vector2                 mVelocity;
-        F32                     mOrientationAngle;
-        Vector2                 mRenderOOBB[4];
-        b2Transform             mTransform;
-        ImageFrameProviderCore  mFrameProvider;
-
-        /// Render Properties.
-        Vector2                 mRenderSize;
-        F32                     mRenderSpeed;
-        F32                     mRenderSpin;
-        F32                     mRenderFixedForce;
-        F32                     mRenderRandomMotion;
-
-        /// Base Properties.
-        Vector2                 mSize;
-        F32                     mSpeed;
-        F32                     mSpin;
-        F32                     mFixedForce;
-        F32                     mRandomMotion;
-        ColorF                  mColor;    
-
-        /// Interpolated Tick Position.
-        Vector2                 mPreTickPosition;
-        Vector2                 mPostTickPosition;
-        Vector2                 mRenderTickPosition;
-
-        ParticleNode() { constructInPlace<ImageFrameProviderCore>(&mFrameProvider); resetState(); }
-
-        virtual void resetState( void )
-        {
-            mFrameProvider.resetState();
-        }
-    };
-
 private:
-    const U32               mParticlePoolBlockSize;
-    Vector<ParticleNode*>   mParticlePool;
-    ParticleNode*           mpFreeParticleNodes;
-    U32                     mActiveParticleCount;
+    const U32                           mFrameProviderPoolBlockSize;
+    Vector<ImageFrameProviderCore*>     mFrameProviderPool;
+    Vector<ImageFrameProviderCore*>     mFreeFrameProviders;
+    U32                                 mActiveParticleCount;
 
 public:
     static void Init( void );
@@ -94,11 +45,13 @@ public:
     ParticleSystem();
     ~ParticleSystem();
 
-    ParticleNode* createParticle( void );
-    void freeParticle( ParticleNode* pParticleNode );
+    /// Particle frame providers.
+    /// Each live particle owns a single frame provider so these also track the active particle count.
+    ImageFrameProviderCore* createFrameProvider( void );
+    void freeFrameProvider( ImageFrameProviderCore* pFrameProvider );
 
     inline U32 getActiveParticleCount( void ) const { return mActiveParticleCount; };
-    inline U32 getAllocatedParticleCount( void ) const { return (U32)mParticlePool.size() * mParticlePoolBlockSize; }
+    inline U32 getAllocatedParticleCount( void ) const { return (U32)mFrameProviderPool.size() * mFrameProviderPoolBlockSize; }
 };
 
 #endif // _PARTICLE_SYSTEM_H_
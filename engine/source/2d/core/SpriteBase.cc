@@ -99,6 +99,6 @@ void SpriteBase::copyTo(SimObject* object)
 
 void SpriteBase::onAnimationEnd( void )
 {
-    // Do script callback.
-    Con::executef( this, 1, "onAnimationEnd" );
+    // Do script callback (deferred if integrating in parallel).
+    postIntegrateCallback( "onAnimationEnd" );
 }
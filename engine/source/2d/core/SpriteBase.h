@@ -44,6 +44,7 @@ public:
     static void initPersistFields();
 
     virtual void integrateObject( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
+    virtual bool getIsIntegrateThreadSafe( void ) const { return true; }
 
     virtual bool validRender( void ) const;
     virtual bool shouldRender( void ) const { return true; }
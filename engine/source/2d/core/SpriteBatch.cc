@@ -39,14 +39,18 @@ static StringTableEntry spritesNodeName = StringTable->insert( "Sprites" );
 //------------------------------------------------------------------------------
 
 SpriteBatch::SpriteBatch() :
-    mMasterBatchId( 0 ),
     mSelectedSprite( NULL ),
     mBatchSortMode( SceneRenderQueue::RENDER_SORT_OFF ),
     mDefaultSpriteStride( 1.0f, 1.0f),
     mDefaultSpriteSize( 1.0f, 1.0f ),
     mDefaultSpriteAngle( 0.0f ),
     mpSpriteBatchQuery( NULL ),
-    mBatchCulling( true )
+    mBatchCulling( true ),
+    mBatchStatic( false ),
+    mpStaticBatch( NULL ),
+    mStaticBatchDirty( true ),
+    mStaticBatchAnimated( false ),
+    mStaticBatchTransformId( 0 )
 {
     // Reset batch transform.
     mBatchTransform.SetIdentity();
@@ -62,6 +66,8 @@ SpriteBatch::SpriteBatch() :
 
 SpriteBatch::~SpriteBatch()
 {
+    // Delete the static batch.
+    setBatchStatic( false );
 }
 
 //-----------------------------------------------------------------------------
@@ -153,10 +159,10 @@ void SpriteBatch::prepareRender( SceneRenderObject* pSceneRenderObject, const Sc
     else
     {
         // No, so perform a render request for all the sprites.
-        for( typeSpriteBatchHash::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
+        for( typeSpriteBatchSlots::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
         {
             // Fetch sprite batch Item.
-            SpriteBatchItem* pSpriteBatchItem = spriteItr->value;
+            SpriteBatchItem* pSpriteBatchItem = *spriteItr;
 
             // Skip if not visible.
             if ( !pSpriteBatchItem->getVisible() )
@@ -184,12 +190,83 @@ void SpriteBatch::render( const SceneRenderState* pSceneRenderState, const Scene
     // Fetch sprite batch Item.
     SpriteBatchItem* pSpriteBatchItem = (SpriteBatchItem*)pSceneRenderRequest->mpCustomData1;
 
+    // Is this a request for the whole static batch?
+    if ( pSpriteBatchItem == NULL )
+    {
+        // Yes, so render the static batch.
+        renderStaticBatch( pBatchRenderer );
+        return;
+    }
+
     // Batch render.
     pSpriteBatchItem->render( pBatchRenderer, pSceneRenderRequest, mBatchTransformId );
 }
 
 //------------------------------------------------------------------------------
 
+void SpriteBatch::renderStaticBatch( BatchRender* pBatchRenderer )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatch_RenderStaticBatch);
+
+    // Sanity!
+    AssertFatal( mpStaticBatch != NULL, "SpriteBatch::renderStaticBatch() - The batch is not static." );
+
+    // Update the static batch.
+    updateStaticBatch();
+
+    // Submit the static batch.
+    pBatchRenderer->SubmitStaticBatch( *mpStaticBatch );
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::updateStaticBatch( void )
+{
+    // Sanity!
+    AssertFatal( mpStaticBatch != NULL, "SpriteBatch::updateStaticBatch() - The batch is not static." );
+
+    // Rebuild the static batch if it's dirty, the batch has moved or any sprites are animated.
+    if ( mStaticBatchDirty || mStaticBatchAnimated || mStaticBatchTransformId != mBatchTransformId )
+        buildStaticBatch();
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::buildStaticBatch( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatch_BuildStaticBatch);
+
+    // Clear the static batch.
+    mpStaticBatch->clear();
+    mStaticBatchAnimated = false;
+
+    // Add all the sprites.
+    for( typeSpriteBatchSlots::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
+    {
+        // Fetch sprite batch Item.
+        SpriteBatchItem* pSpriteBatchItem = *spriteItr;
+
+        // Skip if not visible.
+        if ( !pSpriteBatchItem->getVisible() )
+            continue;
+
+        // Flag the static batch as animated if the sprite is as it'll need rebuilding each frame.
+        if ( !pSpriteBatchItem->isStaticFrameProvider() )
+            mStaticBatchAnimated = true;
+
+        // Add the sprite.
+        pSpriteBatchItem->addToStaticBatch( mpStaticBatch, mBatchTransformId );
+    }
+
+    // Flag the static batch as built.
+    mStaticBatchDirty = false;
+    mStaticBatchTransformId = mBatchTransformId;
+}
+
+//------------------------------------------------------------------------------
+
 void SpriteBatch::createQueryProxy( SpriteBatchItem* pSpriteBatchItem )
 {
     // Sanity!
@@ -266,25 +343,25 @@ void SpriteBatch::copyTo( SpriteBatch* pSpriteBatch ) const
     // Clear any existing sprites.
     pSpriteBatch->clearSprites();
 
-    // Set master sprite Id.
-    pSpriteBatch->mMasterBatchId = mMasterBatchId;
-
     // Set batch sort mode.
     pSpriteBatch->setBatchSortMode( getBatchSortMode() );
 
     // Set batch culling.
     pSpriteBatch->setBatchCulling( getBatchCulling() );
 
+    // Set batch static.
+    pSpriteBatch->setBatchStatic( getBatchStatic() );
+
     // Set sprite default size and angle.
     pSpriteBatch->setDefaultSpriteStride( getDefaultSpriteStride() );
     pSpriteBatch->setDefaultSpriteSize( getDefaultSpriteSize() );
     pSpriteBatch->setDefaultSpriteAngle( getDefaultSpriteAngle() );
 
     // Copy sprites.   
-    for( typeSpriteBatchHash::const_iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
+    for( typeSpriteBatchSlots::const_iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
     {        
         // Fetch sprite.
-        SpriteBatchItem* pSpriteBatchItem = spriteItr->value;
+        SpriteBatchItem* pSpriteBatchItem = *spriteItr;
 
         // Add a sprite.
         const U32 spriteBatchId = pSpriteBatch->addSprite( pSpriteBatchItem->getLogicalPosition() );
@@ -370,13 +447,17 @@ void SpriteBatch::clearSprites( void )
     // Clear sprite names.
     mSpriteNames.clear();
 
-    // Cache all sprites.
-    for( typeSpriteBatchHash::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
+    // Reset all sprites (keeping them for reuse).
+    for( typeSpriteBatchSlots::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
     {
-        SpriteBatchItemFactory.cacheObject( spriteItr->value );
+        (*spriteItr)->resetState();
     }
+
+    // Clear the sprites restarting the batch Ids.
     mSprites.clear();
-    mMasterBatchId = 0;
+
+    // Flag the static batch as dirty.
+    setStaticBatchDirty();
 
     // Flag local extents as dirty.
     setLocalExtentsDirty();
@@ -402,6 +483,32 @@ void SpriteBatch::setBatchCulling( const bool batchCulling )
 
 //------------------------------------------------------------------------------
 
+void SpriteBatch::setBatchStatic( const bool batchStatic )
+{
+    // Finish if no change.
+    if ( mBatchStatic == batchStatic )
+        return;
+
+    // Set batch static.
+    mBatchStatic = batchStatic;
+
+    // Create/delete the static batch appropriately.
+    if ( mBatchStatic )
+    {
+        mpStaticBatch = new BatchRender::StaticBatch();
+    }
+    else
+    {
+        delete mpStaticBatch;
+        mpStaticBatch = NULL;
+    }
+
+    // Flag the static batch as dirty.
+    setStaticBatchDirty();
+}
+
+//------------------------------------------------------------------------------
+
 bool SpriteBatch::selectSprite( const SpriteBatchItem::LogicalPosition& logicalPosition )
 {
     // Select sprite.
@@ -481,6 +588,9 @@ void SpriteBatch::setSpriteImage( const char* pAssetId, const U32 imageFrame )
     if ( !checkSpriteSelected() )
         return;
 
+    // Flag the static batch as dirty.
+    setStaticBatchDirty();
+
     // Set image and frame.
     mSelectedSprite->setImage( pAssetId, imageFrame );
 }
@@ -499,6 +609,9 @@ void SpriteBatch::setSpriteImage( const char* pAssetId, const char* namedFrame )
     if ( !checkSpriteSelected() )
         return;
 
+    // Flag the static batch as dirty.
+    setStaticBatchDirty();
+
     // Set image and frame.
     mSelectedSprite->setImage( pAssetId, namedFrame );
 }
@@ -523,6 +636,9 @@ void SpriteBatch::setSpriteImageFrame( const U32 imageFrame )
     if ( !checkSpriteSelected() )
         return;
 
+    // Flag the static batch as dirty.
+    setStaticBatchDirty();
+
     // Set image frame.
     mSelectedSprite->setImageFrame( imageFrame );
 }
@@ -547,6 +663,9 @@ void SpriteBatch::setSpriteNamedImageFrame( const char* namedFrame )
     if ( !checkSpriteSelected() )
         return;
 
+    // Flag the static batch as dirty.
+    setStaticBatchDirty();
+
     // Set image frame.
     mSelectedSprite->setNamedImageFrame( namedFrame );
 }
@@ -577,6 +696,9 @@ void SpriteBatch::setSpriteAnimation( const char* pAssetId )
     if ( !checkSpriteSelected() )
         return;
 
+    // Flag the static batch as dirty.
+    setStaticBatchDirty();
+
     // Set animation.
     mSelectedSprite->setAnimation( pAssetId );
 }
@@ -601,6 +723,9 @@ void SpriteBatch::setSpriteAnimationFrame(const U32 animationFrame)
 	if (!checkSpriteSelected())
 		return;
 
+	// Flag the static batch as dirty.
+	setStaticBatchDirty();
+
 	// Set image frame.
 	mSelectedSprite->setAnimationFrame(animationFrame);
 }
@@ -625,6 +750,9 @@ void SpriteBatch::clearSpriteAsset( void )
     if ( !checkSpriteSelected() )
         return;
 
+    // Flag the static batch as dirty.
+    setStaticBatchDirty();
+
     // Clear the asset.
     mSelectedSprite->clearAssets();
 }
@@ -637,6 +765,9 @@ void SpriteBatch::setSpriteVisible( const bool visible )
     if ( !checkSpriteSelected() )
         return;
 
+    // Flag the static batch as dirty.
+    setStaticBatchDirty();
+
     // Set visibility.
     mSelectedSprite->setVisible( visible );
 }
@@ -661,6 +792,9 @@ void SpriteBatch::setSpriteLocalPosition( const Vector2& localPosition )
     if ( !checkSpriteSelected() )
         return;
 
+    // Flag the static batch as dirty.
+    setStaticBatchDirty();
+
     // Set local position.
     mSelectedSprite->setLocalPosition( localPosition );
 
@@ -700,6 +834,9 @@ void SpriteBatch::setSpriteAngle( const F32 localAngle )
     if ( !checkSpriteSelected() )
         return;
 
+    // Flag the static batch as dirty.
+    setStaticBatchDirty();
+
     // Set local angle.
     mSelectedSprite->setLocalAngle( localAngle );
 
@@ -751,6 +888,9 @@ void SpriteBatch::setSpriteSize( const Vector2& size )
     if ( !checkSpriteSelected() )
         return;
 
+    // Flag the static batch as dirty.
+    setStaticBatchDirty();
+
     // Set size.
     mSelectedSprite->setSize( size );
 
@@ -778,6 +918,9 @@ void SpriteBatch::setSpriteFlipX( const bool flipX )
     if ( !checkSpriteSelected() )
         return;
 
+    // Flag the static batch as dirty.
+    setStaticBatchDirty();
+
     // Set flip X.
     mSelectedSprite->setFlipX( flipX );
 }
@@ -802,6 +945,9 @@ void SpriteBatch::setSpriteFlipY( const bool flipY )
     if ( !checkSpriteSelected() )
         return;
 
+    // Flag the static batch as dirty.
+    setStaticBatchDirty();
+
     // Set flip Y.
     mSelectedSprite->setFlipY( flipY );
 }
@@ -874,6 +1020,9 @@ void SpriteBatch::setSpriteBlendMode( const bool blendMode )
     if ( !checkSpriteSelected() )
         return;
 
+    // Flag the static batch as dirty.
+    setStaticBatchDirty();
+
     // Set blend mode.
     mSelectedSprite->setBlendMode( blendMode );
 }
@@ -898,6 +1047,9 @@ void SpriteBatch::setSpriteSrcBlendFactor( GLenum srcBlendFactor )
     if ( !checkSpriteSelected() )
         return;
 
+    // Flag the static batch as dirty.
+    setStaticBatchDirty();
+
     // Set source blend factor.
     mSelectedSprite->setSrcBlendFactor( srcBlendFactor );
 }
@@ -922,6 +1074,9 @@ void SpriteBatch::setSpriteDstBlendFactor( GLenum dstBlendFactor )
     if ( !checkSpriteSelected() )
         return ;
 
+    // Flag the static batch as dirty.
+    setStaticBatchDirty();
+
     // Set destination blend factor.
     mSelectedSprite->setDstBlendFactor( dstBlendFactor );
 }
@@ -946,6 +1101,9 @@ void SpriteBatch::setSpriteBlendColor( const ColorF& blendColor )
     if ( !checkSpriteSelected() )
         return;
 
+    // Flag the static batch as dirty.
+    setStaticBatchDirty();
+
     // Set blend color.
     mSelectedSprite->setBlendColor( blendColor );
 }
@@ -970,6 +1128,9 @@ void SpriteBatch::setSpriteBlendAlpha( const F32 alpha )
     if ( !checkSpriteSelected() )
         return;
 
+    // Flag the static batch as dirty.
+    setStaticBatchDirty();
+
     // Set blend alpha.
     mSelectedSprite->setBlendAlpha( alpha );
 }
@@ -994,6 +1155,9 @@ void SpriteBatch::setSpriteAlphaTest( const F32 alphaTestMode )
     if ( !checkSpriteSelected() )
         return;
 
+    // Flag the static batch as dirty.
+    setStaticBatchDirty();
+
     // Set alpha-test mode.
     mSelectedSprite->setAlphaTest( alphaTestMode );
 }
@@ -1096,17 +1260,15 @@ SpriteBatchItem* SpriteBatch::createSprite( void )
     // Debug Profiling.
     PROFILE_SCOPE(SpriteBatch_CreateSprite);
 
-    // Allocate batch Id.
-    const U32 batchId = ++mMasterBatchId;
-
-    // Create sprite batch item,
-    SpriteBatchItem* pSpriteBatchItem = SpriteBatchItemFactory.createObject();
+    // Create sprite batch item allocating its batch Id.
+    U32 batchId;
+    SpriteBatchItem* pSpriteBatchItem = mSprites.insert( batchId );
 
     // Set batch parent.
     pSpriteBatchItem->setBatchParent( this, batchId );
 
-    // Create sprite batch item,
-    mSprites.insert( batchId, pSpriteBatchItem );
+    // Flag the static batch as dirty.
+    setStaticBatchDirty();
 
     return pSpriteBatchItem;
 }
@@ -1118,24 +1280,22 @@ SpriteBatchItem* SpriteBatch::createSprite( const Vector2* explicitVertices  )
     // Debug Profiling.
     PROFILE_SCOPE(SpriteBatch_CreateSprite);
 
-    // Allocate batch Id.
-    const U32 batchId = ++mMasterBatchId;
-
-    // Create sprite batch item,
-    SpriteBatchItem* pSpriteBatchItem = SpriteBatchItemFactory.createObject();
+    // Create sprite batch item allocating its batch Id.
+    U32 batchId;
+    SpriteBatchItem* pSpriteBatchItem = mSprites.insert( batchId );
 
     // Set batch parent.
     pSpriteBatchItem->setBatchParent( this, batchId );
 
+    // Flag the static batch as dirty.
+    setStaticBatchDirty();
+
     // Set explicit mode.
     pSpriteBatchItem->setExplicitMode( true );
 
     // Set explicit vertices.
 
 
-    // Create sprite batch item,
-    mSprites.insert( batchId, pSpriteBatchItem );
-
     return pSpriteBatchItem;
 }
 
@@ -1164,9 +1324,7 @@ SpriteBatchItem* SpriteBatch::findSpriteId( const U32 batchId )
     PROFILE_SCOPE(SpriteBatch_FindSpriteId);
 
     // Find sprite.
-    typeSpriteBatchHash::iterator spriteItr = mSprites.find( batchId );
-
-    return spriteItr != mSprites.end() ? spriteItr->value : NULL;
+    return mSprites.find( batchId );
 }
 
 //------------------------------------------------------------------------------
@@ -1272,15 +1430,15 @@ void SpriteBatch::updateLocalExtents( void )
     }
 
     // Fetch first sprite.
-    typeSpriteBatchHash::iterator spriteItr = mSprites.begin();
+    typeSpriteBatchSlots::iterator spriteItr = mSprites.begin();
 
     // Set render AABB to this sprite.
-    b2AABB localAABB = spriteItr->value->getLocalAABB();
+    b2AABB localAABB = (*spriteItr)->getLocalAABB();
 
     // Combine with the rest of the sprites.
     for( ; spriteItr != mSprites.end(); ++spriteItr )
     {
-        localAABB.Combine( spriteItr->value->getLocalAABB() );
+        localAABB.Combine( (*spriteItr)->getLocalAABB() );
     }
 
     // Fetch local render extents.
@@ -1316,10 +1474,10 @@ void SpriteBatch::createSpriteBatchQuery( void )
         return;
 
     // Add proxies for all the sprites.
-    for( typeSpriteBatchHash::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
+    for( typeSpriteBatchSlots::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
     {
         // Fetch sprite batch item.
-        SpriteBatchItem* pSpriteBatchItem = spriteItr->value;
+        SpriteBatchItem* pSpriteBatchItem = *spriteItr;
 
         // Create query proxy for sprite.
         createQueryProxy( pSpriteBatchItem );
@@ -1341,10 +1499,10 @@ void SpriteBatch::destroySpriteBatchQuery( void )
     if ( mSprites.size() > 0 )
     {
         // Yes, so destroy proxies of all the sprites.
-        for( typeSpriteBatchHash::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
+        for( typeSpriteBatchSlots::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
         {
             // Destroy query proxy for sprite.
-            destroyQueryProxy( spriteItr->value );
+            destroyQueryProxy( *spriteItr );
         }
     }
 
@@ -1360,24 +1518,18 @@ bool SpriteBatch::destroySprite( const U32 batchId )
     // Debug Profiling.
     PROFILE_SCOPE(SpriteBatch_DestroySprite);
 
-    // Find sprite.
-    typeSpriteBatchHash::iterator spriteItr = mSprites.find( batchId );
+    // Remove from sprites.
+    SpriteBatchItem* pSpriteBatchItem = mSprites.erase( batchId );
 
     // Finish if sprite not found.
-    if ( spriteItr == mSprites.end() )
+    if ( pSpriteBatchItem == NULL )
         return false;
 
-    // Find sprite.    
-    SpriteBatchItem* pSpriteBatchItem = spriteItr->value;
-
-    // Sanity!
-    AssertFatal( pSpriteBatchItem != NULL, "SpriteBatch::destroySprite() - Found sprite but it was NULL." );
+    // Reset sprite (keeping it for reuse).
+    pSpriteBatchItem->resetState();
 
-    // Cache sprite.
-    SpriteBatchItemFactory.cacheObject( pSpriteBatchItem );
-
-    // Remove from sprites.
-    mSprites.erase( batchId );
+    // Flag the static batch as dirty.
+    setStaticBatchDirty();
 
     return true;
 }
@@ -1430,10 +1582,10 @@ void SpriteBatch::onTamlCustomWrite( TamlCustomNodes& customNodes )
     TamlCustomNode* pSpritesNode = customNodes.addNode( spritesNodeName );
 
     // Write all sprites.
-    for( typeSpriteBatchHash::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
+    for( typeSpriteBatchSlots::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
     {      
         // Write type with sprite item.
-        spriteItr->value->onTamlCustomWrite( pSpritesNode );
+        (*spriteItr)->onTamlCustomWrite( pSpritesNode );
     }
 }
 
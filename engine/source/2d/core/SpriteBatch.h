@@ -31,6 +31,10 @@
 #include "2d/scene/SceneRenderObject.h"
 #endif
 
+#ifndef _SLOTMAP_H_
+#include "collection/slotMap.h"
+#endif
+
 //------------------------------------------------------------------------------  
 
 class SpriteBatchQuery;
@@ -43,23 +47,23 @@ public:
     static const S32                INVALID_SPRITE_PROXY = -1;  
 
 protected:
-    typedef HashMap< U32, SpriteBatchItem* > typeSpriteBatchHash;
+    typedef SlotMap< SpriteBatchItem > typeSpriteBatchSlots;
     typedef HashMap< SpriteBatchItem::LogicalPosition, SpriteBatchItem* > typeSpritePositionHash;
     typedef HashMap< StringTableEntry, SpriteBatchItem* > typeSpriteNameHash;
 
-    typeSpriteBatchHash             mSprites;
+    typeSpriteBatchSlots            mSprites;
     typeSpritePositionHash          mSpritePositions;
     typeSpriteNameHash              mSpriteNames;
     SpriteBatchItem*                mSelectedSprite;
     SceneRenderQueue::RenderSort    mBatchSortMode;
     bool                            mBatchCulling;
+    bool                            mBatchStatic;
     Vector2                         mDefaultSpriteStride;
     Vector2                         mDefaultSpriteSize;
     F32                             mDefaultSpriteAngle;
 
 private:
     SpriteBatchQuery*               mpSpriteBatchQuery;
-    U32                             mMasterBatchId;
 
     b2Transform                     mBatchTransform;
     bool                            mBatchTransformDirty;
@@ -68,6 +72,11 @@ private:
     Vector2                         mLocalExtents;
     bool                            mLocalExtentsDirty;
 
+    BatchRender::StaticBatch*       mpStaticBatch;
+    bool                            mStaticBatchDirty;
+    bool                            mStaticBatchAnimated;
+    U32                             mStaticBatchTransformId;
+
 public:
     SpriteBatch();
     virtual ~SpriteBatch();
@@ -94,7 +103,7 @@ public:
 
     virtual void copyTo( SpriteBatch* pSpriteBatch ) const;
 
-    inline U32 getSpriteCount( void ) { return (U32)mSprites.size(); }
+    inline U32 getSpriteCount( void ) { return mSprites.size(); }
 
     U32 addSprite( const SpriteBatchItem::LogicalPosition& logicalPosition );
     bool removeSprite( void );
@@ -106,6 +115,13 @@ public:
     void setBatchCulling( const bool batchCulling );
     inline bool getBatchCulling( void ) const { return mBatchCulling; }
 
+    void setBatchStatic( const bool batchStatic );
+    inline bool getBatchStatic( void ) const { return mBatchStatic; }
+    inline void setStaticBatchDirty( void ) { mStaticBatchDirty = true; }
+    inline bool getStaticBatchDirty( void ) const { return mStaticBatchDirty; }
+    inline const BatchRender::StaticBatch* getStaticBatch( void ) const { return mpStaticBatch; }
+    void updateStaticBatch( void );
+
     inline void setDefaultSpriteStride( const Vector2& defaultStride ) { mDefaultSpriteStride = defaultStride; }
     inline const Vector2& getDefaultSpriteStride( void ) const { return mDefaultSpriteStride; }
 
@@ -211,6 +227,9 @@ private:
     bool destroySprite( const U32 batchId );
     bool checkSpriteSelected( void ) const;
 
+    void renderStaticBatch( BatchRender* pBatchRenderer );
+    void buildStaticBatch( void );
+
     b2AABB calculateLocalAABB( const b2AABB& renderAABB );
 };
 
@@ -63,6 +63,9 @@ static StringTableEntry spriteUserDataName          = StringTable->insert("UserD
 
 SpriteBatchItem::SpriteBatchItem() : mProxyId( SpriteBatch::INVALID_SPRITE_PROXY )
 {
+    // Register for image asset refresh notifications so a static batch can be rebuilt.
+    mImageAsset.registerRefreshNotify( this );
+
     resetState();
 }
 
@@ -182,6 +185,19 @@ void SpriteBatchItem::copyTo( SpriteBatchItem* pSpriteBatchItem ) const
 
 //------------------------------------------------------------------------------
 
+void SpriteBatchItem::onAssetRefreshed( AssetPtrBase* pAssetPtrBase )
+{
+    // Call parent if the animation was refreshed.
+    if ( pAssetPtrBase == &mAnimationAsset )
+        Parent::onAssetRefreshed( pAssetPtrBase );
+
+    // The refreshed asset may have new frames or a new texture so rebuild any static batch.
+    if ( mSpriteBatch != NULL )
+        mSpriteBatch->setStaticBatchDirty();
+}
+
+//------------------------------------------------------------------------------
+
 void SpriteBatchItem::prepareRender( SceneRenderRequest* pSceneRenderRequest, const U32 batchTransformId )
 {
     // Debug Profiling.
@@ -232,6 +248,48 @@ void SpriteBatchItem::render( BatchRender* pBatchRenderer, const SceneRenderRequ
 
 //------------------------------------------------------------------------------
 
+void SpriteBatchItem::addToStaticBatch( BatchRender::StaticBatch* pStaticBatch, const U32 batchTransformId )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatchItem_AddToStaticBatch);
+
+    // Update the world transform.
+    updateWorldTransform( batchTransformId );
+
+    // Finish if we can't render.
+    if ( !validRender() )
+        return;
+
+    // Fetch texel area.
+    ImageAsset::FrameArea::TexelArea texelArea = getProviderImageFrameArea().mTexelArea;
+
+    // Flip texture coordinates appropriately.
+    texelArea.setFlip( mFlipX, mFlipY );
+
+    // Fetch lower/upper texture coordinates.
+    const Vector2& texLower = texelArea.mTexelLower;
+    const Vector2& texUpper = texelArea.mTexelUpper;
+
+    // Add the quad with the blend color baked into the vertices.
+    pStaticBatch->addQuad(
+        mRenderOOBB[0],
+        mRenderOOBB[1],
+        mRenderOOBB[2],
+        mRenderOOBB[3],
+        Vector2( texLower.x, texUpper.y ),
+        Vector2( texUpper.x, texUpper.y ),
+        Vector2( texUpper.x, texLower.y ),
+        Vector2( texLower.x, texLower.y ),
+        getProviderTexture(),
+        mBlendMode ? mBlendColor : ColorF( 1.0f, 1.0f, 1.0f, 1.0f ),
+        mBlendMode,
+        mSrcBlendFactor,
+        mDstBlendFactor,
+        mAlphaTest );
+}
+
+//------------------------------------------------------------------------------
+
 void SpriteBatchItem::setExplicitVertices( const Vector2* explicitVertices )
 {
     mExplicitMode = true;
@@ -240,6 +298,8 @@ void SpriteBatchItem::setExplicitVertices( const Vector2* explicitVertices )
     mExplicitVerts[1] = explicitVertices[1];
     mExplicitVerts[2] = explicitVertices[2];
     mExplicitVerts[3] = explicitVertices[3];
+
+    mLocalTransformDirty = true;
 }
 
 //------------------------------------------------------------------------------
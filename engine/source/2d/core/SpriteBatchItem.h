@@ -307,6 +307,7 @@ public:
 
     void prepareRender( SceneRenderRequest* pSceneRenderRequest, const U32 batchTransformId );
     void render( BatchRender* pBatchRenderer, const SceneRenderRequest* pSceneRenderRequest, const U32 batchTransformId );
+    void addToStaticBatch( BatchRender::StaticBatch* pStaticBatch, const U32 batchTransformId );
 
     static void WriteCustomTamlSchema( const AbstractClassRep* pClassRep, TiXmlElement* pParentElement );
 
@@ -317,12 +318,10 @@ protected:
     void updateLocalTransform( void );
     void updateWorldTransform( const U32 batchTransformId );
 
+    virtual void onAssetRefreshed( AssetPtrBase* pAssetPtrBase );
+
     void onTamlCustomWrite( TamlCustomNode* pParentNode );
     void onTamlCustomRead( const TamlCustomNode* pSpriteNode );
 };
 
-//------------------------------------------------------------------------------  
-
-static FactoryCache<SpriteBatchItem> SpriteBatchItemFactory;
-
 #endif // _SPRITE_BATCH_ITEM_H_
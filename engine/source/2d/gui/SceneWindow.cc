@@ -34,6 +34,10 @@
 #include "assets/assetManager.h"
 #endif
 
+#ifndef _TEXTURE_ATLAS_H_
+#include "graphics/TextureAtlas.h"
+#endif
+
 // Script bindings.
 #include "SceneWindow_ScriptBinding.h"
 
@@ -1745,7 +1749,7 @@ void SceneWindow::renderMetricsOverlay( Point2I offset, const RectI& updateRect
     const S32 metricsOffset = (S32)font->getStrWidth( "WWWWWWWWWWWW" );
 
     // Set Banner Height.
-    F32 bannerLineHeight = fullMetrics ? 17.0f : 1.0f;
+    F32 bannerLineHeight = fullMetrics ? 20.75f : 1.0f;
 
     // Add an extra line if we're monitoring a scene object.
     if ( pDebugSceneObject != NULL )
@@ -1794,6 +1798,13 @@ void SceneWindow::renderMetricsOverlay( Point2I offset, const RectI& updateRect
         dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
         linePositionY += linePositionOffsetY;
 
+        // Rendering #2.
+        dSprintf( mDebugText, sizeof( mDebugText ), "- VisibilityCache=%s, Hits=%u, Misses=%u",
+            pScene->getVisibilityCacheEnabled() ? "On" : "Off",
+            debugStats.visibilityCacheHits, debugStats.visibilityCacheMisses );
+        dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
+        linePositionY += linePositionOffsetY;
+
         // Scene.
         dglDrawText( font, bannerOffset + Point2I(0,(S32)linePositionY), "Scene", NULL );
         dSprintf( mDebugText, sizeof( mDebugText ), "- Count=%d, Index=%d, Time=%0.1fs, Objects=%d<%d>(Global=%d), Enabled=%d<%d>, Visible=%d<%d>, Awake=%d<%d>, Controllers=%d",
@@ -1869,6 +1880,17 @@ void SceneWindow::renderMetricsOverlay( Point2I offset, const RectI& updateRect
         dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
         linePositionY += linePositionOffsetY;
 
+        // Batching #4.
+        dSprintf( mDebugText, sizeof( mDebugText ), "- %sUploadKB=%d<%d>, BufferOrphans=%d<%d>, StaticDraws=%d<%d>, StaticUploads=%d<%d>",
+            pScene->getBatchStreamingEnabled() ? "(VBO) " : "",
+            debugStats.batchBytesUploaded / 1024, debugStats.maxBatchBytesUploaded / 1024,
+            debugStats.batchBufferOrphans, debugStats.maxBatchBufferOrphans,
+            debugStats.batchDrawCallsStatic, debugStats.maxBatchDrawCallsStatic,
+            debugStats.batchStaticUploads, debugStats.maxBatchStaticUploads
+            );
+        dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
+        linePositionY += linePositionOffsetY;
+
         // Textures.
         dglDrawText( font, bannerOffset + Point2I(0,(S32)linePositionY), "Textures", NULL );
         dSprintf( mDebugText, sizeof( mDebugText ), "- TextureCount=%d, TextureSize=%d, TextureWaste=%d, BitmapSize=%d",
@@ -1880,6 +1902,21 @@ void SceneWindow::renderMetricsOverlay( Point2I offset, const RectI& updateRect
         dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
         linePositionY += linePositionOffsetY;
 
+        // Texture atlas.
+        TextureAtlas::Metrics atlasMetrics;
+        TextureAtlas::getMetrics( atlasMetrics );
+        dglDrawText( font, bannerOffset + Point2I(0,(S32)linePositionY), "Atlas", NULL );
+        dSprintf( mDebugText, sizeof( mDebugText ), "- %sPages=%d, Images=%d, Occupancy=%.1f%%, Rejected=%d, Uploads=%d",
+            TextureAtlas::getEnabled() ? "" : "(Off) ",
+            atlasMetrics.mPageCount,
+            atlasMetrics.mImageCount,
+            atlasMetrics.mPageArea == 0 ? 0.0f : 100.0f * (F32)atlasMetrics.mPackedArea / (F32)atlasMetrics.mPageArea,
+            atlasMetrics.mRejectedCount,
+            atlasMetrics.mUploadCount
+            );
+        dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
+        linePositionY += linePositionOffsetY;
+
         // Physics.
         dglDrawText( font, bannerOffset + Point2I(0,(S32)linePositionY), "Physics", NULL );
         dSprintf( mDebugText, sizeof( mDebugText ), "- Bodies=%d<%d>, Joints=%d<%d>, Contacts=%d<%d>, Proxies=%d<%d>",
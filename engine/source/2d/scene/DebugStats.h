@@ -93,6 +93,10 @@ public:
         if ( batchLayerFlush > maxBatchLayerFlush ) maxBatchLayerFlush = batchLayerFlush;
         if ( batchNoBatchFlush > maxBatchNoBatchFlush ) maxBatchNoBatchFlush = batchNoBatchFlush;
         if ( batchAnonymousFlush > maxBatchAnonymousFlush ) maxBatchAnonymousFlush = batchAnonymousFlush;
+        if ( batchBytesUploaded > maxBatchBytesUploaded ) maxBatchBytesUploaded = batchBytesUploaded;
+        if ( batchBufferOrphans > maxBatchBufferOrphans ) maxBatchBufferOrphans = batchBufferOrphans;
+        if ( batchDrawCallsStatic > maxBatchDrawCallsStatic ) maxBatchDrawCallsStatic = batchDrawCallsStatic;
+        if ( batchStaticUploads > maxBatchStaticUploads ) maxBatchStaticUploads = batchStaticUploads;
 
         // Particles.
         if ( particlesUsed > maxParticlesUsed ) maxParticlesUsed = particlesUsed;
@@ -186,6 +190,21 @@ public:
         batchAnonymousFlush = 0;
         maxBatchAnonymousFlush = 0;
 
+        batchBytesUploaded = 0;
+        maxBatchBytesUploaded = 0;
+
+        batchBufferOrphans = 0;
+        maxBatchBufferOrphans = 0;
+
+        batchDrawCallsStatic = 0;
+        maxBatchDrawCallsStatic = 0;
+
+        batchStaticUploads = 0;
+        maxBatchStaticUploads = 0;
+
+        visibilityCacheHits = 0;
+        visibilityCacheMisses = 0;
+
         particlesAlloc = 0;
         particlesFree = 0;
         particlesUsed = 0;
@@ -276,6 +295,21 @@ public:
     U32     batchAnonymousFlush;
     U32     maxBatchAnonymousFlush;
 
+    U32     batchBytesUploaded;
+    U32     maxBatchBytesUploaded;
+
+    U32     batchBufferOrphans;
+    U32     maxBatchBufferOrphans;
+
+    U32     batchDrawCallsStatic;
+    U32     maxBatchDrawCallsStatic;
+
+    U32     batchStaticUploads;
+    U32     maxBatchStaticUploads;
+
+    U32     visibilityCacheHits;
+    U32     visibilityCacheMisses;
+
     U32     particlesAlloc;
     U32     particlesFree;
     U32     particlesUsed;
@@ -56,6 +56,10 @@
 #include "2d/core/ParticleSystem.h"
 #endif
 
+#ifndef _JOB_SYSTEM_H_
+#include "platform/threads/jobSystem.h"
+#endif
+
 // Script bindings.
 #include "Scene_ScriptBinding.h"
 
@@ -66,6 +70,9 @@
 
 SimObjectPtr<Scene> Scene::LoadingScene = NULL;
 
+bool Scene::smParallelIntegrate = false;
+S32 Scene::smParallelIntegrateChunkSize = 256;
+
 //------------------------------------------------------------------------------
 
 static ContactFilter mContactFilter;
@@ -153,6 +160,12 @@ Scene::Scene() :
     mVelocityIterations(8),
     mPositionIterations(3),
 
+    /// Scene occupancy.
+    mTickingSceneObjects(false),
+    mTickedSceneObjectsFragmented(false),
+    mEnabledObjectCount(0),
+    mVisibleObjectCount(0),
+
     /// Joint access.
     mJointMasterId(1),
 
@@ -166,6 +179,14 @@ Scene::Scene() :
 
     /// Window rendering.
     mpCurrentRenderWindow(NULL),
+
+    /// Visibility cache.
+    mVisibilityCacheEnabled(false),
+    mVisibilityCacheValid(false),
+    mVisibilityCacheLayerMask(0),
+    mVisibilityCacheGroupMask(0),
+    mVisibilityCacheProxyEpoch(0),
+    mVisibilityCacheCount(0),
     
     /// Miscellaneous.
     mIsEditorScene(0),
@@ -175,6 +196,9 @@ Scene::Scene() :
 {
     // Set Vector Associations.
     VECTOR_SET_ASSOCIATION( mSceneObjects );
+    VECTOR_SET_ASSOCIATION( mTickedSceneObjects );
+    VECTOR_SET_ASSOCIATION( mPendingTickedSceneObjects );
+    VECTOR_SET_ASSOCIATION( mParallelTickedSceneObjects );
     VECTOR_SET_ASSOCIATION( mDeleteRequests );
     VECTOR_SET_ASSOCIATION( mDeleteRequestsTemp );
     VECTOR_SET_ASSOCIATION( mEndContacts );
@@ -184,6 +208,16 @@ Scene::Scene() :
     for ( U32 n = 0; n < MAX_LAYERS_SUPPORTED; ++n )
        mLayerSortModes[n] = SceneRenderQueue::RENDER_SORT_NEWEST;
 
+    // Initialize the visibility cache layers.
+    for ( U32 n = 0; n < MAX_LAYERS_SUPPORTED; ++n )
+    {
+        VECTOR_SET_ASSOCIATION( mVisibilityCacheLayers[n].mQueryResults );
+        mVisibilityCacheLayers[n].mpRenderQueue = NULL;
+        mVisibilityCacheLayers[n].mCustomPrepared = false;
+    }
+    mVisibilityCacheAABB.lowerBound.SetZero();
+    mVisibilityCacheAABB.upperBound.SetZero();
+
     // Set debug stats for batch renderer.
     mBatchRenderer.setDebugStats( &mDebugStats );
 
@@ -260,6 +294,9 @@ void Scene::onRemove()
     // Process Delete Requests.
     processDeleteRequests(true);
 
+    // Release the visibility cache.
+    releaseVisibilityCache();
+
     // Delete ground body.
     mpWorld->DestroyBody( mpGroundBody );
     mpGroundBody = NULL;
@@ -297,6 +334,14 @@ void Scene::onDeleteNotify( SimObject* object )
 
 //-----------------------------------------------------------------------------
 
+void Scene::consoleInit()
+{
+    Con::addVariable("Scene::ParallelIntegrate", TypeBool, &smParallelIntegrate);
+    Con::addVariable("Scene::ParallelIntegrateChunkSize", TypeS32, &smParallelIntegrateChunkSize);
+}
+
+//-----------------------------------------------------------------------------
+
 void Scene::initPersistFields()
 {
     // Call Parent.
@@ -738,51 +783,22 @@ void Scene::processTick( void )
     // Finish if scene is paused.
     if ( !getScenePause() )
     {
-        // Reset object stats.
-        U32 objectsEnabled = 0;
-        U32 objectsVisible = 0;
-        U32 objectsAwake   = 0;
-
         // Fetch if a "normal" i.e. non-editor scene.
         const bool isNormalScene = !getIsEditorScene();
 
         // Update scene time.
         mSceneTime += Tickable::smTickSec;
 
-        // Clear ticked scene objects.
-        mTickedSceneObjects.clear();
-
-        // Iterate scene objects.
-        for( S32 n = 0; n < mSceneObjects.size(); ++n )
-        {
-            // Fetch scene object.
-            SceneObject* pSceneObject = mSceneObjects[n];
-
-            // Update awake/asleep counts.
-            if ( pSceneObject->getAwake() )
-                objectsAwake++;
-
-            // Update visible.
-            if ( pSceneObject->getVisible() )
-                objectsVisible++;
-
-            // Push scene object if it's eligible for ticking.
-            if ( pSceneObject->isEnabled() )
-            {
-                // Update enabled.
-                objectsEnabled++;
-
-                // Add to ticked objects if object is not being deleted and this is a "normal" scene or
-                // the object is marked as allowing editor ticks.
-                if ( !pSceneObject->isBeingDeleted() && (isNormalScene || pSceneObject->getIsEditorTickAllowed() )  )
-                    mTickedSceneObjects.push_back( pSceneObject );
-            }
-        }
-
         // Update object stats.
-        mDebugStats.objectsEnabled = objectsEnabled;
-        mDebugStats.objectsVisible = objectsVisible;
-        mDebugStats.objectsAwake   = objectsAwake;
+        // NOTE:    The enabled and visible counts are maintained as the objects change and the awake count
+        //          is maintained by the physics world which also contains the ground body.
+        mDebugStats.objectsEnabled = mEnabledObjectCount;
+        mDebugStats.objectsVisible = mVisibleObjectCount;
+        mDebugStats.objectsAwake   = (U32)mpWorld->GetAwakeBodyCount() - (mpGroundBody->IsAwake() ? 1 : 0);
+
+        // The ticked scene objects are maintained as the objects change.
+        // NOTE:    Changes are deferred whilst ticking so the ticked scene objects remain stable.
+        mTickingSceneObjects = true;
 
         // Debug Status Reference.
         DebugStats* pDebugStats = &mDebugStats;
@@ -800,8 +816,15 @@ void Scene::processTick( void )
             // Debug Profiling.
             PROFILE_SCOPE(Scene_PreIntegrate);
 
+            // Fetch scene object.
+            SceneObject* pSceneObject = mTickedSceneObjects[i];
+
+            // Skip if the scene object was removed.
+            if ( pSceneObject == NULL )
+                continue;
+
             // Pre-integrate.
-            mTickedSceneObjects[i]->preIntegrate( mSceneTime, Tickable::smTickSec, pDebugStats );
+            pSceneObject->preIntegrate( mSceneTime, Tickable::smTickSec, pDebugStats );
         }
 
         // ****************************************************
@@ -859,14 +882,63 @@ void Scene::processTick( void )
         // Integrate objects.
         // ****************************************************
 
+        // Reset parallel ticked scene objects.
+        mParallelTickedSceneObjects.clear();
+
+        // Is parallel integration enabled?
+        if ( smParallelIntegrate && JobSystem::getWorkerCount() > 0 )
+        {
+            // Yes, so gather the ticked scene objects that can be integrated in parallel.
+            for ( S32 i = 0; i < tickedSceneObjectCount; ++i )
+            {
+                // Fetch scene object.
+                SceneObject* pSceneObject = mTickedSceneObjects[i];
+
+                // Skip if the scene object was removed or cannot be integrated in parallel.
+                if ( pSceneObject == NULL || !pSceneObject->getCanIntegrateInParallel() )
+                    continue;
+
+                // Flag as integrating in parallel.
+                pSceneObject->setIsIntegratingInParallel( true );
+                mParallelTickedSceneObjects.push_back( pSceneObject );
+            }
+        }
+
+        // Do we have any scene objects to integrate in parallel?
+        if ( mParallelTickedSceneObjects.size() > 0 )
+        {
+            // Debug Profiling.
+            PROFILE_SCOPE(Scene_IntegrateObjectParallel);
+
+            // Yes, so integrate them in chunks using the job system.
+            const U32 chunkSize = (U32)getMax( smParallelIntegrateChunkSize, 1 );
+            const U32 chunkCount = ((U32)mParallelTickedSceneObjects.size() + chunkSize - 1) / chunkSize;
+            JobSystem::parallelFor( integrateParallelChunk, this, chunkCount );
+        }
+
         // Iterate ticked scene objects.
         for ( S32 i = 0; i < tickedSceneObjectCount; ++i )
         {
             // Debug Profiling.
             PROFILE_SCOPE(Scene_IntegrateObject);
 
+            // Fetch scene object.
+            SceneObject* pSceneObject = mTickedSceneObjects[i];
+
+            // Skip if the scene object was removed.
+            if ( pSceneObject == NULL )
+                continue;
+
+            // Was the scene object integrated in parallel?
+            if ( pSceneObject->getIsIntegratingInParallel() )
+            {
+                // Yes, so commit the deferred integration in the original tick order.
+                pSceneObject->commitParallelIntegrate();
+                continue;
+            }
+
             // Integrate.
-            mTickedSceneObjects[i]->integrateObject( mSceneTime, Tickable::smTickSec, pDebugStats );
+            pSceneObject->integrateObject( mSceneTime, Tickable::smTickSec, pDebugStats );
         }
 
         // ****************************************************
@@ -879,8 +951,15 @@ void Scene::processTick( void )
             // Debug Profiling.
             PROFILE_SCOPE(Scene_PostIntegrate);
 
+            // Fetch scene object.
+            SceneObject* pSceneObject = mTickedSceneObjects[i];
+
+            // Skip if the scene object was removed.
+            if ( pSceneObject == NULL )
+                continue;
+
             // Post-integrate.
-            mTickedSceneObjects[i]->postIntegrate( mSceneTime, Tickable::smTickSec, pDebugStats );
+            pSceneObject->postIntegrate( mSceneTime, Tickable::smTickSec, pDebugStats );
         }
 
         // Scene update callback.
@@ -900,8 +979,10 @@ void Scene::processTick( void )
             dispatchBeginContactCallbacks();
         }
 
-        // Clear ticked scene objects.
-        mTickedSceneObjects.clear();
+        // Commit any changes to the ticked scene objects.
+        mTickingSceneObjects = false;
+        commitTickedSceneObjects();
+        mParallelTickedSceneObjects.clear();
     }
 
     // Update debug stat ranges.
@@ -910,6 +991,25 @@ void Scene::processTick( void )
 
 //-----------------------------------------------------------------------------
 
+void Scene::integrateParallelChunk( void* pContext, const U32 jobIndex )
+{
+    // Fetch scene.
+    Scene* pScene = static_cast<Scene*>( pContext );
+
+    // Calculate the chunk range.
+    const U32 chunkSize = (U32)getMax( smParallelIntegrateChunkSize, 1 );
+    const U32 startIndex = jobIndex * chunkSize;
+    const U32 endIndex = getMin( startIndex + chunkSize, (U32)pScene->mParallelTickedSceneObjects.size() );
+
+    // Integrate the chunk.
+    for ( U32 i = startIndex; i < endIndex; ++i )
+    {
+        pScene->mParallelTickedSceneObjects[i]->integrateObject( pScene->mSceneTime, Tickable::smTickSec, &pScene->mDebugStats );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 void Scene::interpolateTick( F32 timeDelta )
 {
     // Finish if scene is paused.
@@ -922,6 +1022,28 @@ void Scene::interpolateTick( F32 timeDelta )
     // Interpolate scene objects.
     // ****************************************************
 
+    // Is this a "normal" i.e. non-editor scene?
+    if ( !getIsEditorScene() )
+    {
+        // Yes, so the ticked scene objects are exactly those eligible for interpolation.
+        const S32 tickedSceneObjectCount = mTickedSceneObjects.size();
+
+        // Iterate ticked scene objects.
+        for( S32 n = 0; n < tickedSceneObjectCount; ++n )
+        {
+            // Fetch scene object.
+            SceneObject* pSceneObject = mTickedSceneObjects[n];
+
+            // Skip if the scene object was removed whilst ticking.
+            if ( pSceneObject == NULL )
+                continue;
+
+            pSceneObject->interpolateObject( timeDelta );
+        }
+
+        return;
+    }
+
     // Fetch the scene object count.
     const S32 sceneObjectCount = mSceneObjects.size();
 
@@ -966,6 +1088,10 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
     pDebugStats->batchLayerFlush                = 0;
     pDebugStats->batchNoBatchFlush              = 0;
     pDebugStats->batchAnonymousFlush            = 0;
+    pDebugStats->batchBytesUploaded             = 0;
+    pDebugStats->batchBufferOrphans             = 0;
+    pDebugStats->batchDrawCallsStatic           = 0;
+    pDebugStats->batchStaticUploads             = 0;
 
     // Set batch renderer wireframe mode.
     mBatchRenderer.setWireframeMode( getDebugMask() & SCENE_DEBUG_WIREFRAME_RENDER );
@@ -983,85 +1109,148 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
     glRotatef( mRadToDeg(pSceneRenderState->mRenderAngle), 0.0f, 0.0f, 1.0f );
     glTranslatef( -cameraPosition.x, -cameraPosition.y, 0.0f );
 
-    // Clear world query.
-    mpWorldQuery->clearQuery();
+    // Is the visibility cache valid for this render?
+    const bool visibilityCacheHit = mVisibilityCacheEnabled && getVisibilityCacheHit( cameraAABB, pSceneRenderState );
+
+    if ( !visibilityCacheHit )
+    {
+        // No, so clear world query.
+        mpWorldQuery->clearQuery();
 
-    // Set filter.
-    WorldQueryFilter queryFilter( pSceneRenderState->mRenderLayerMask, pSceneRenderState->mRenderGroupMask, true, true, false, false );
-    mpWorldQuery->setQueryFilter( queryFilter );
+        // Set filter.
+        WorldQueryFilter queryFilter( pSceneRenderState->mRenderLayerMask, pSceneRenderState->mRenderGroupMask, true, true, false, false );
+        mpWorldQuery->setQueryFilter( queryFilter );
 
-    // Query render AABB.
-    mpWorldQuery->aabbQueryAABB( cameraAABB );
+        // Query render AABB.
+        mpWorldQuery->aabbQueryAABB( cameraAABB );
+
+        // Fill the visibility cache if it's enabled.
+        if ( mVisibilityCacheEnabled )
+        {
+            fillVisibilityCache( cameraAABB, pSceneRenderState );
+            pDebugStats->visibilityCacheMisses++;
+        }
+    }
+    else
+    {
+        // Yes, so the query can be skipped.
+        pDebugStats->visibilityCacheHits++;
+    }
+
+    // Fetch the visible object count.
+    const U32 visibleObjectCount = mVisibilityCacheEnabled ? mVisibilityCacheCount : mpWorldQuery->getQueryResultsCount();
 
     // Debug Profiling.
     PROFILE_END();  //Scene_RenderSceneVisibleQuery
 
     // Are there any query results?
-    if ( mpWorldQuery->getQueryResultsCount() > 0 )
+    if ( visibleObjectCount > 0 )
     {
         // Debug Profiling.
         PROFILE_SCOPE(Scene_RenderSceneCompileRenderRequests);
 
         // Fetch the primary scene render queue.
-        SceneRenderQueue* pSceneRenderQueue = SceneRenderQueueFactory.createObject();      
+        // NOTE:    The visibility cache has its own render queue per layer.
+        SceneRenderQueue* pPrimaryRenderQueue = mVisibilityCacheEnabled ? NULL : SceneRenderFrameArena.createRenderQueue();
 
         // Yes so step through layers.
         for ( S32 layer = MAX_LAYERS_SUPPORTED-1; layer >= 0 ; layer-- )
         {
             // Fetch layer.
-            typeWorldQueryResultVector& layerResults = mpWorldQuery->getLayeredQueryResults( layer );
+            typeWorldQueryResultVector& layerResults = mVisibilityCacheEnabled ? mVisibilityCacheLayers[layer].mQueryResults : mpWorldQuery->getLayeredQueryResults( layer );
 
             // Fetch layer object count.
             const U32 layerObjectCount = layerResults.size();
 
+            // Fetch the layer render queue.
+            SceneRenderQueue* pSceneRenderQueue = mVisibilityCacheEnabled ? mVisibilityCacheLayers[layer].mpRenderQueue : pPrimaryRenderQueue;
+
             // Are there any objects to render in this layer?
             if ( layerObjectCount > 0 )
             {
                 // Yes, so increase render picked.
                 pDebugStats->renderPicked += layerObjectCount;
 
-                // Iterate query results.
-                for( typeWorldQueryResultVector::iterator worldQueryItr = layerResults.begin(); worldQueryItr != layerResults.end(); ++worldQueryItr )
+                // Can the cached render requests be used?
+                // NOTE:    Objects that prepare their own render requests can change them at any time so are always prepared.
+                const bool useCachedRequests = visibilityCacheHit && !mVisibilityCacheLayers[layer].mCustomPrepared;
+
+                // Flag the layer as needing a sort if the render requests are compiled.
+                bool sortRequired = !useCachedRequests;
+
+                if ( useCachedRequests )
                 {
-                    // Fetch scene object.
-                    SceneObject* pSceneObject = worldQueryItr->mpSceneObject;
+                    // Debug Profiling.
+                    PROFILE_SCOPE(Scene_RenderSceneRefreshRenderRequests);
 
-                    // Skip if the object should not render.
-                    if ( !pSceneObject->shouldRender() )
-                        continue;
+                    // Refresh the cached render requests as the objects can change without moving.
+                    SceneRenderQueue::typeRenderRequestVector& cachedRenderRequests = pSceneRenderQueue->getRenderRequests();
+                    for( SceneRenderQueue::typeRenderRequestVector::iterator renderRequestItr = cachedRenderRequests.begin(); renderRequestItr != cachedRenderRequests.end(); ++renderRequestItr )
+                    {
+#if defined(TORQUE_DEBUG)
+                        // Sanity!
+                        // NOTE:    Any change that can stop an object rendering here must invalidate the visibility cache.
+                        const SceneObject* pCachedSceneObject = static_cast<const SceneObject*>( (*renderRequestItr)->mpSceneRenderObject );
+                        AssertFatal( pCachedSceneObject->shouldRender() && pCachedSceneObject->isEnabled() && pCachedSceneObject->getVisible() &&
+                            pCachedSceneObject->getSceneLayer() == (U32)layer &&
+                            (pCachedSceneObject->getSceneLayerMask() & pSceneRenderState->mRenderLayerMask) != 0 &&
+                            (pCachedSceneObject->getSceneGroupMask() & pSceneRenderState->mRenderGroupMask) != 0,
+                            "Scene::sceneRender() - The visibility cache is stale." );
+#endif
 
-                    // Can the scene object prepare a render?
-                    if ( pSceneObject->canPrepareRender() )
+                        if ( Scene::refreshDefaultRenderRequest( *renderRequestItr ) )
+                            sortRequired = true;
+                    }
+                }
+                else
+                {
+                    // Reset any cached render requests.
+                    if ( mVisibilityCacheEnabled )
+                        pSceneRenderQueue->resetState();
+
+                    // Iterate query results.
+                    for( typeWorldQueryResultVector::iterator worldQueryItr = layerResults.begin(); worldQueryItr != layerResults.end(); ++worldQueryItr )
                     {
-                        // Yes. so is it batch isolated.
-                        if ( pSceneObject->getBatchIsolated() )
+                        // Fetch scene object.
+                        SceneObject* pSceneObject = worldQueryItr->mpSceneObject;
+
+                        // Skip if the object should not render.
+                        if ( !pSceneObject->shouldRender() )
+                            continue;
+
+                        // Can the scene object prepare a render?
+                        if ( pSceneObject->canPrepareRender() )
                         {
-                            // Yes, so create a default render request  on the primary queue.
-                            SceneRenderRequest* pIsolatedSceneRenderRequest = Scene::createDefaultRenderRequest( pSceneRenderQueue, pSceneObject );
+                            // Yes. so is it batch isolated.
+                            if ( pSceneObject->getBatchIsolated() )
+                            {
+                                // Yes, so create a default render request  on the primary queue.
+                                SceneRenderRequest* pIsolatedSceneRenderRequest = Scene::createDefaultRenderRequest( pSceneRenderQueue, pSceneObject );
 
-                            // Create a new isolated render queue.
-                            pIsolatedSceneRenderRequest->mpIsolatedRenderQueue = SceneRenderQueueFactory.createObject();
+                                // Create a new isolated render queue (owned by the frame arena).
+                                pIsolatedSceneRenderRequest->mpIsolatedRenderQueue = SceneRenderFrameArena.createRenderQueue();
 
-                            // Prepare in the isolated queue.
-                            pSceneObject->scenePrepareRender( pSceneRenderState, pIsolatedSceneRenderRequest->mpIsolatedRenderQueue );
+                                // Prepare in the isolated queue.
+                                pSceneObject->scenePrepareRender( pSceneRenderState, pIsolatedSceneRenderRequest->mpIsolatedRenderQueue );
 
-                            // Increase render request count.
-                            pDebugStats->renderRequests += (U32)pIsolatedSceneRenderRequest->mpIsolatedRenderQueue->getRenderRequests().size();
+                                // Increase render request count.
+                                pDebugStats->renderRequests += (U32)pIsolatedSceneRenderRequest->mpIsolatedRenderQueue->getRenderRequests().size();
 
-                            // Adjust for the extra private render request.
-                            pDebugStats->renderRequests -= 1;
+                                // Adjust for the extra private render request.
+                                pDebugStats->renderRequests -= 1;
+                            }
+                            else
+                            {
+                                // No, so prepare in primary queue.
+                                pSceneObject->scenePrepareRender( pSceneRenderState, pSceneRenderQueue );
+                            }
                         }
                         else
                         {
-                            // No, so prepare in primary queue.
-                            pSceneObject->scenePrepareRender( pSceneRenderState, pSceneRenderQueue );
+                            // No, so create a default render request for it.
+                            Scene::createDefaultRenderRequest( pSceneRenderQueue, pSceneObject );
                         }
                     }
-                    else
-                    {
-                        // No, so create a default render request for it.
-                        Scene::createDefaultRenderRequest( pSceneRenderQueue, pSceneObject );
-                    }
                 }
 
                 // Fetch render requests.
@@ -1086,11 +1275,15 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
                     if ( !mBatchRenderer.getBatchEnabled() && mode == SceneRenderQueue::RENDER_SORT_BATCH )
                         mode = SceneRenderQueue::RENDER_SORT_NEWEST;
 
-                    // Set render queue mode.
-                    pSceneRenderQueue->setSortMode( mode );
+                    // Sort unless the cached render requests are still sorted.
+                    if ( sortRequired || pSceneRenderQueue->getSortMode() != mode )
+                    {
+                        // Set render queue mode.
+                        pSceneRenderQueue->setSortMode( mode );
 
-                    // Sort the render requests.
-                    pSceneRenderQueue->sort();
+                        // Sort the render requests.
+                        pSceneRenderQueue->sort();
+                    }
                 }
 
                 // Iterate render requests.
@@ -1207,11 +1400,12 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
             }
 
             // Reset render queue.
-            pSceneRenderQueue->resetState();
+            // NOTE:    The visibility cache keeps its render queues.
+            if ( !mVisibilityCacheEnabled )
+                pSceneRenderQueue->resetState();
         }
 
-        // Cache render queue..
-        SceneRenderQueueFactory.cacheObject( pSceneRenderQueue );
+        // NOTE:    The primary render queue is owned by the frame arena.
     }
 
     // Draw controllers.
@@ -1273,6 +1467,142 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
 
 //-----------------------------------------------------------------------------
 
+void Scene::setVisibilityCacheEnabled( const bool enabled )
+{
+    // Finish if no change.
+    if ( mVisibilityCacheEnabled == enabled )
+        return;
+
+    mVisibilityCacheEnabled = enabled;
+
+    // Release the visibility cache.
+    // NOTE:    When enabled, it is filled when the scene is next rendered.
+    releaseVisibilityCache();
+}
+
+//-----------------------------------------------------------------------------
+
+bool Scene::getVisibilityCacheHit( const b2AABB& cameraAABB, const SceneRenderState* pSceneRenderState ) const
+{
+    // The cached visible objects can be used if nothing has invalidated them, no world proxy has been
+    // created, destroyed or moved and the camera is viewing the same area, layers and groups.
+    return  mVisibilityCacheValid &&
+            mVisibilityCacheProxyEpoch == mpWorldQuery->getProxyEpoch() &&
+            mVisibilityCacheLayerMask == pSceneRenderState->mRenderLayerMask &&
+            mVisibilityCacheGroupMask == pSceneRenderState->mRenderGroupMask &&
+            mVisibilityCacheAABB.lowerBound == cameraAABB.lowerBound &&
+            mVisibilityCacheAABB.upperBound == cameraAABB.upperBound;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::fillVisibilityCache( const b2AABB& cameraAABB, const SceneRenderState* pSceneRenderState )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_FillVisibilityCache);
+
+    // Reset the visible object count.
+    mVisibilityCacheCount = 0;
+
+    // Iterate layers.
+    for ( U32 layer = 0; layer < MAX_LAYERS_SUPPORTED; ++layer )
+    {
+        // Fetch the cache layer.
+        VisibilityCacheLayer& cacheLayer = mVisibilityCacheLayers[layer];
+
+        // Copy the query results.
+        cacheLayer.mQueryResults = mpWorldQuery->getLayeredQueryResults( layer );
+        mVisibilityCacheCount += (U32)cacheLayer.mQueryResults.size();
+
+        // Create the layer render queue if required.
+        // NOTE:    The render requests are compiled when the layer is next rendered.
+        if ( cacheLayer.mpRenderQueue == NULL )
+            cacheLayer.mpRenderQueue = SceneRenderQueueFactory.createObject();
+
+        // Flag if any of the objects prepare their own render requests.
+        cacheLayer.mCustomPrepared = false;
+        for( typeWorldQueryResultVector::iterator worldQueryItr = cacheLayer.mQueryResults.begin(); worldQueryItr != cacheLayer.mQueryResults.end(); ++worldQueryItr )
+        {
+            // Fetch scene object.
+            SceneObject* pSceneObject = worldQueryItr->mpSceneObject;
+
+            if ( pSceneObject->shouldRender() && pSceneObject->canPrepareRender() )
+            {
+                cacheLayer.mCustomPrepared = true;
+                break;
+            }
+        }
+    }
+
+    // Store the cache key.
+    mVisibilityCacheAABB = cameraAABB;
+    mVisibilityCacheLayerMask = pSceneRenderState->mRenderLayerMask;
+    mVisibilityCacheGroupMask = pSceneRenderState->mRenderGroupMask;
+    mVisibilityCacheProxyEpoch = mpWorldQuery->getProxyEpoch();
+    mVisibilityCacheValid = true;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::releaseVisibilityCache( void )
+{
+    // Iterate layers.
+    for ( U32 layer = 0; layer < MAX_LAYERS_SUPPORTED; ++layer )
+    {
+        // Fetch the cache layer.
+        VisibilityCacheLayer& cacheLayer = mVisibilityCacheLayers[layer];
+
+        // Cache the layer render queue.
+        if ( cacheLayer.mpRenderQueue != NULL )
+        {
+            SceneRenderQueueFactory.cacheObject( cacheLayer.mpRenderQueue );
+            cacheLayer.mpRenderQueue = NULL;
+        }
+
+        cacheLayer.mQueryResults.clear();
+        cacheLayer.mCustomPrepared = false;
+    }
+
+    mVisibilityCacheCount = 0;
+    mVisibilityCacheValid = false;
+}
+
+//-----------------------------------------------------------------------------
+
+bool Scene::refreshDefaultRenderRequest( SceneRenderRequest* pSceneRenderRequest )
+{
+    // Fetch scene object.
+    SceneObject* pSceneObject = static_cast<SceneObject*>( pSceneRenderRequest->mpSceneRenderObject );
+
+    // Fetch the details used to sort the request.
+    const Vector2 renderPosition = pSceneObject->getRenderPosition();
+    const F32 depth = pSceneObject->getSceneLayerDepth();
+    const Vector2& sortPoint = pSceneObject->getSortPoint();
+    StringTableEntry renderGroup = pSceneObject->getRenderGroup();
+
+    // Have any of the sort details changed?
+    const bool sortChanged =
+        pSceneRenderRequest->mWorldPosition != renderPosition ||
+        pSceneRenderRequest->mDepth != depth ||
+        pSceneRenderRequest->mSortPoint != sortPoint ||
+        pSceneRenderRequest->mRenderGroup != renderGroup;
+
+    // Refresh the request with the default details.
+    pSceneRenderRequest->mWorldPosition = renderPosition;
+    pSceneRenderRequest->mDepth = depth;
+    pSceneRenderRequest->mSortPoint = sortPoint;
+    pSceneRenderRequest->mRenderGroup = renderGroup;
+    pSceneRenderRequest->mBlendMode = pSceneObject->getBlendMode();
+    pSceneRenderRequest->mBlendColor = pSceneObject->getBlendColor();
+    pSceneRenderRequest->mSrcBlendFactor = pSceneObject->getSrcBlendFactor();
+    pSceneRenderRequest->mDstBlendFactor = pSceneObject->getDstBlendFactor();
+    pSceneRenderRequest->mAlphaTest = pSceneObject->getAlphaTest();
+
+    return sortChanged;
+}
+
+//-----------------------------------------------------------------------------
+
 void Scene::clearScene( bool deleteObjects )
 {
     while( mSceneObjects.size() > 0 )
@@ -1338,6 +1668,15 @@ void Scene::addToScene( SceneObject* pSceneObject )
     // Register with the scene.
     pSceneObject->OnRegisterScene( this );
 
+    // Update the object counts.
+    if ( pSceneObject->isEnabled() )
+        mEnabledObjectCount++;
+    if ( pSceneObject->getVisible() )
+        mVisibleObjectCount++;
+
+    // Update the ticked scene objects.
+    updateTickedSceneObject( pSceneObject );
+
     // Perform callback only if properly added to the simulation.
     if ( pSceneObject->isProperlyAdded() )
     {
@@ -1380,6 +1719,15 @@ void Scene::removeFromScene( SceneObject* pSceneObject )
         (dynamic_cast<SceneWindow*>(mAttachedSceneWindows[i]))->removeFromInputEventPick(pSceneObject);
     }
 
+    // Update the object counts.
+    if ( pSceneObject->isEnabled() )
+        mEnabledObjectCount--;
+    if ( pSceneObject->getVisible() )
+        mVisibleObjectCount--;
+
+    // Remove from the ticked scene objects.
+    removeTickedSceneObject( pSceneObject );
+
     // Unregister from scene.
     pSceneObject->OnUnregisterScene( this );
 
@@ -1399,6 +1747,208 @@ void Scene::removeFromScene( SceneObject* pSceneObject )
 
 //-----------------------------------------------------------------------------
 
+void Scene::onSceneObjectEnabledChanged( SceneObject* pSceneObject )
+{
+    // Sanity!
+    AssertFatal( pSceneObject->getScene() == this, "Scene::onSceneObjectEnabledChanged() - Object is not in this scene." );
+
+    // Update the enabled count.
+    if ( pSceneObject->isEnabled() )
+        mEnabledObjectCount++;
+    else
+        mEnabledObjectCount--;
+
+    // Disabled objects are not rendered.
+    invalidateVisibilityCache();
+
+    // Update the ticked scene objects.
+    updateTickedSceneObject( pSceneObject );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::onSceneObjectVisibleChanged( SceneObject* pSceneObject )
+{
+    // Sanity!
+    AssertFatal( pSceneObject->getScene() == this, "Scene::onSceneObjectVisibleChanged() - Object is not in this scene." );
+
+    // Update the visible count.
+    if ( pSceneObject->getVisible() )
+        mVisibleObjectCount++;
+    else
+        mVisibleObjectCount--;
+
+    // Invisible objects are not rendered.
+    invalidateVisibilityCache();
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setIsEditorScene( bool status )
+{
+    // Fetch the current editor status.
+    const bool wasEditorScene = getIsEditorScene();
+
+    mIsEditorScene += (status ? 1 : -1);
+
+    // Refresh the ticked scene objects if the editor status changed.
+    if ( getIsEditorScene() != wasEditorScene )
+        refreshTickedSceneObjects();
+}
+
+//-----------------------------------------------------------------------------
+
+bool Scene::getIsTickEligible( const SceneObject* pSceneObject ) const
+{
+    // Tick the scene object if it's in the scene, enabled and not being deleted and this is a "normal" scene
+    // or the object is marked as allowing editor ticks.
+    return  pSceneObject->getScene() == this &&
+            pSceneObject->isEnabled() &&
+            !pSceneObject->isBeingDeleted() &&
+            ( !getIsEditorScene() || pSceneObject->getIsEditorTickAllowed() );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::updateTickedSceneObject( SceneObject* pSceneObject )
+{
+    // Are the ticked scene objects being ticked?
+    if ( mTickingSceneObjects )
+    {
+        // Yes, so defer the update until the tick has finished.
+        if ( !pSceneObject->mTickedPending )
+        {
+            pSceneObject->mTickedPending = true;
+            mPendingTickedSceneObjects.push_back( pSceneObject );
+        }
+
+        return;
+    }
+
+    // Fetch whether the scene object should be ticked.
+    const bool tickEligible = getIsTickEligible( pSceneObject );
+
+    // Add the scene object if it should be ticked but isn't.
+    if ( tickEligible && pSceneObject->mTickedIndex == -1 )
+    {
+        pSceneObject->mTickedIndex = mTickedSceneObjects.size();
+        mTickedSceneObjects.push_back( pSceneObject );
+        return;
+    }
+
+    // Remove the scene object if it shouldn't be ticked but is.
+    if ( !tickEligible && pSceneObject->mTickedIndex != -1 )
+    {
+        removeTickedSceneObject( pSceneObject );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::removeTickedSceneObject( SceneObject* pSceneObject )
+{
+    // Remove any deferred update.
+    if ( pSceneObject->mTickedPending )
+    {
+        pSceneObject->mTickedPending = false;
+
+        for ( S32 n = 0; n < mPendingTickedSceneObjects.size(); ++n )
+        {
+            if ( mPendingTickedSceneObjects[n] == pSceneObject )
+            {
+                mPendingTickedSceneObjects.erase_fast( n );
+                break;
+            }
+        }
+    }
+
+    // Finish if the scene object isn't ticked.
+    const S32 tickedIndex = pSceneObject->mTickedIndex;
+    if ( tickedIndex == -1 )
+        return;
+
+    pSceneObject->mTickedIndex = -1;
+
+    // Are the ticked scene objects being ticked?
+    if ( mTickingSceneObjects )
+    {
+        // Yes, so leave a hole which is removed when the tick has finished.
+        mTickedSceneObjects[tickedIndex] = NULL;
+        mTickedSceneObjectsFragmented = true;
+
+        // Abandon any parallel integration that has not been committed.
+        pSceneObject->cancelParallelIntegrate();
+        return;
+    }
+
+    // Move the last ticked scene object into the vacant slot (unless it's the scene object being removed).
+    SceneObject* pLastSceneObject = mTickedSceneObjects.last();
+    mTickedSceneObjects.pop_back();
+    if ( pLastSceneObject != pSceneObject )
+    {
+        mTickedSceneObjects[tickedIndex] = pLastSceneObject;
+        pLastSceneObject->mTickedIndex = tickedIndex;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::refreshTickedSceneObjects( void )
+{
+    // Update all the scene objects.
+    for ( S32 n = 0; n < mSceneObjects.size(); ++n )
+    {
+        updateTickedSceneObject( mSceneObjects[n] );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::commitTickedSceneObjects( void )
+{
+    // Sanity!
+    AssertFatal( !mTickingSceneObjects, "Scene::commitTickedSceneObjects() - Cannot commit whilst ticking." );
+
+    // Remove any holes left by scene objects removed whilst ticking.
+    if ( mTickedSceneObjectsFragmented )
+    {
+        S32 tickedCount = 0;
+        for ( S32 n = 0; n < mTickedSceneObjects.size(); ++n )
+        {
+            // Fetch scene object.
+            SceneObject* pSceneObject = mTickedSceneObjects[n];
+
+            // Skip holes.
+            if ( pSceneObject == NULL )
+                continue;
+
+            pSceneObject->mTickedIndex = tickedCount;
+            mTickedSceneObjects[tickedCount++] = pSceneObject;
+        }
+
+        mTickedSceneObjects.setSize( tickedCount );
+        mTickedSceneObjectsFragmented = false;
+    }
+
+    // Finish if there are no deferred updates.
+    if ( mPendingTickedSceneObjects.size() == 0 )
+        return;
+
+    // Perform the deferred updates.
+    for ( S32 n = 0; n < mPendingTickedSceneObjects.size(); ++n )
+    {
+        // Fetch scene object.
+        SceneObject* pSceneObject = mPendingTickedSceneObjects[n];
+
+        pSceneObject->mTickedPending = false;
+        updateTickedSceneObject( pSceneObject );
+    }
+
+    mPendingTickedSceneObjects.clear();
+}
+
+//-----------------------------------------------------------------------------
+
 SceneObject* Scene::getSceneObject( const U32 objectIndex ) const
 {
     // Sanity!
@@ -1485,22 +2035,66 @@ void Scene::addAssetPreload( const char* pAssetId )
             return;
     }
 
-    // Create asset pointer.
-    AssetPtr<AssetBase>* pAssetPtr = new AssetPtr<AssetBase>( pAssetId );
+    // Ignore if asset already being acquired.
+    const S32 pendingAssetPreloadCount = mPendingAssetPreloads.size();
+    for( S32 index = 0; index < pendingAssetPreloadCount; ++index )
+    {
+        if ( mPendingAssetPreloads[index].mAssetId == assetId )
+            return;
+    }
 
-    // Was the asset acquired?
-    if ( pAssetPtr->isNull() )
+    // Acquire the asset in the background.
+    const U32 requestId = AssetDatabase.acquireAssetAsync( assetId, 0, &Scene::assetPreloadAcquired, this );
+
+    // Was the acquisition started?
+    if ( requestId == 0 )
     {
         // No, so warn.
         Con::warnf( "Scene::addAssetPreload() - Failed to acquire asset '%s' so not added as a preload.", pAssetId );
-
-        // No, so delete the asset pointer.
-        delete pAssetPtr;
         return;
     }
 
-    // Add asset.
-    mAssetPreloads.push_back( pAssetPtr );
+    // Add pending asset.
+    PendingAssetPreload pendingAssetPreload;
+    pendingAssetPreload.mAssetId = assetId;
+    pendingAssetPreload.mRequestId = requestId;
+    mPendingAssetPreloads.push_back( pendingAssetPreload );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::assetPreloadAcquired( void* pUserData, const U32 requestId, StringTableEntry assetId, AssetBase* pAsset )
+{
+    Scene* pScene = (Scene*)pUserData;
+
+    // Remove the pending asset.
+    const S32 pendingAssetPreloadCount = pScene->mPendingAssetPreloads.size();
+    for( S32 index = 0; index < pendingAssetPreloadCount; ++index )
+    {
+        if ( pScene->mPendingAssetPreloads[index].mRequestId == requestId )
+        {
+            pScene->mPendingAssetPreloads.erase( index );
+            break;
+        }
+    }
+
+    // Was the asset acquired?
+    if ( pAsset == NULL )
+    {
+        // No, so warn.
+        Con::warnf( "Scene::addAssetPreload() - Failed to acquire asset '%s' so not added as a preload.", assetId );
+    }
+    else
+    {
+        // Yes, so add asset.
+        // NOTE: The asset pointer takes its own reference so release the one we were handed.
+        pScene->mAssetPreloads.push_back( new AssetPtr<AssetBase>( assetId ) );
+        AssetDatabase.releaseAsset( assetId );
+    }
+
+    // Notify the scene when all the assets are preloaded.
+    if ( pScene->mPendingAssetPreloads.size() == 0 && pScene->isMethod( "onAssetPreloadsComplete" ) )
+        Con::executef( pScene, 1, "onAssetPreloadsComplete" );
 }
 
 //-----------------------------------------------------------------------------
@@ -1524,6 +2118,18 @@ void Scene::removeAssetPreload( const char* pAssetId )
             return;
         }
     }
+
+    // Cancel the acquisition of a pending asset Id.
+    const S32 pendingAssetPreloadCount = mPendingAssetPreloads.size();
+    for( S32 index = 0; index < pendingAssetPreloadCount; ++index )
+    {
+        if ( mPendingAssetPreloads[index].mAssetId == assetId )
+        {
+            AssetDatabase.cancelAcquireAssetAsync( mPendingAssetPreloads[index].mRequestId );
+            mPendingAssetPreloads.erase( index );
+            return;
+        }
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -1536,6 +2142,13 @@ void Scene::clearAssetPreloads( void )
         delete mAssetPreloads.back();
         mAssetPreloads.pop_back();
     }
+
+    // Cancel all the pending asset preloads.
+    while( mPendingAssetPreloads.size() > 0 )
+    {
+        AssetDatabase.cancelAcquireAssetAsync( mPendingAssetPreloads.back().mRequestId );
+        mPendingAssetPreloads.pop_back();
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -3649,6 +4262,10 @@ void Scene::addDeleteRequest( SceneObject* pSceneObject )
 
     // Flag Delete in Progress.
     pSceneObject->mBeingSafeDeleted = true;
+
+    // Objects being deleted are not ticked.
+    if ( pSceneObject->getScene() == this )
+        updateTickedSceneObject( pSceneObject );
 }
 
 
@@ -5162,8 +5779,8 @@ void Scene::onTamlCustomWrite( TamlCustomNodes& customNodes )
         }
     }
 
-    // Fetch asset preload count.
-    const S32 assetPreloadCount = getAssetPreloadCount();
+    // Fetch asset preload count (including those still being acquired).
+    const S32 assetPreloadCount = getAssetPreloadCount() + getPendingAssetPreloadCount();
 
     // Do we have any asset preloads?
     if ( assetPreloadCount > 0 )
@@ -5186,6 +5803,19 @@ void Scene::onTamlCustomWrite( TamlCustomNodes& customNodes )
             // Add asset Id.
             pAssetNode->addField( "Id", valueBuffer );
         }        
+
+        // Iterate pending asset preloads.
+        for( typePendingAssetPreloadVector::const_iterator pendingItr = mPendingAssetPreloads.begin(); pendingItr != mPendingAssetPreloads.end(); ++pendingItr )
+        {
+            // Add node.
+            TamlCustomNode* pAssetNode = pAssetPreloadCustomNode->addNode( assetNodeName );
+
+            char valueBuffer[1024];
+            dSprintf( valueBuffer, sizeof(valueBuffer), "%s%s", assetIdTypePrefix, pendingItr->mAssetId );
+
+            // Add asset Id.
+            pAssetNode->addField( "Id", valueBuffer );
+        }
     }
 }
 
@@ -173,6 +173,14 @@ public:
     typedef HashMap<b2Contact*, TickContact>    typeContactHash;
     typedef Vector<AssetPtr<AssetBase>*>        typeAssetPtrVector;
 
+    /// An asset preload being acquired.
+    struct PendingAssetPreload
+    {
+        StringTableEntry    mAssetId;
+        U32                 mRequestId;
+    };
+    typedef Vector<PendingAssetPreload>         typePendingAssetPreloadVector;
+
     /// Scene Debug Options.
     enum DebugOption
     {
@@ -222,6 +230,12 @@ private:
     /// Scene occupancy.
     typeSceneObjectVector       mSceneObjects;
     typeSceneObjectVector       mTickedSceneObjects;
+    typeSceneObjectVector       mPendingTickedSceneObjects;
+    typeSceneObjectVector       mParallelTickedSceneObjects;
+    bool                        mTickingSceneObjects;
+    bool                        mTickedSceneObjectsFragmented;
+    U32                         mEnabledObjectCount;
+    U32                         mVisibleObjectCount;
 
     /// Joint access.
     typeJointHash               mJoints;
@@ -233,6 +247,7 @@ private:
 
     /// Asset pre-loads.
     typeAssetPtrVector          mAssetPreloads;
+    typePendingAssetPreloadVector mPendingAssetPreloads;
 
     /// Scene time.
     F32                         mSceneTime;
@@ -249,6 +264,22 @@ private:
     /// Batch rendering.
     BatchRender                 mBatchRenderer;
 
+    /// Visibility cache.
+    struct VisibilityCacheLayer
+    {
+        typeWorldQueryResultVector  mQueryResults;
+        SceneRenderQueue*           mpRenderQueue;
+        bool                        mCustomPrepared;
+    };
+    bool                        mVisibilityCacheEnabled;
+    bool                        mVisibilityCacheValid;
+    b2AABB                      mVisibilityCacheAABB;
+    U32                         mVisibilityCacheLayerMask;
+    U32                         mVisibilityCacheGroupMask;
+    U32                         mVisibilityCacheProxyEpoch;
+    U32                         mVisibilityCacheCount;
+    VisibilityCacheLayer        mVisibilityCacheLayers[MAX_LAYERS_SUPPORTED];
+
     /// Window rendering.
     SceneWindow*                mpCurrentRenderWindow;
 
@@ -273,6 +304,25 @@ private:
     void                        dispatchBeginContactCallbacks( void );
     void                        dispatchEndContactCallbacks( void );
 
+    /// Parallel integration.
+    static void                 integrateParallelChunk( void* pContext, const U32 jobIndex );
+
+    /// Asset preloads.
+    static void                 assetPreloadAcquired( void* pUserData, const U32 requestId, StringTableEntry assetId, AssetBase* pAsset );
+
+    /// Ticked scene objects.
+    bool                        getIsTickEligible( const SceneObject* pSceneObject ) const;
+    void                        updateTickedSceneObject( SceneObject* pSceneObject );
+    void                        removeTickedSceneObject( SceneObject* pSceneObject );
+    void                        refreshTickedSceneObjects( void );
+    void                        commitTickedSceneObjects( void );
+
+    /// Visibility cache.
+    bool                        getVisibilityCacheHit( const b2AABB& cameraAABB, const SceneRenderState* pSceneRenderState ) const;
+    void                        fillVisibilityCache( const b2AABB& cameraAABB, const SceneRenderState* pSceneRenderState );
+    void                        releaseVisibilityCache( void );
+    static bool                 refreshDefaultRenderRequest( SceneRenderRequest* pSceneRenderRequest );
+
     /// Joint definition.
     struct CommonJointDefinition
     {
@@ -310,6 +360,7 @@ public:
     virtual void            onRemove();
     virtual void            onDeleteNotify( SimObject* object );
     static void             initPersistFields();
+    static void             consoleInit();
 
     /// Contact processing.
     virtual void            PreSolve( b2Contact* pContact, const b2Manifold* pOldManifold ) {}
@@ -344,6 +395,8 @@ public:
     void                    clearScene( bool deleteObjects = true );
     void                    addToScene( SceneObject* pSceneObject );
     void                    removeFromScene( SceneObject* pSceneObject );
+    void                    onSceneObjectEnabledChanged( SceneObject* pSceneObject );
+    void                    onSceneObjectVisibleChanged( SceneObject* pSceneObject );
 
     inline typeSceneObjectVectorConstRef getSceneObjects( void ) const  { return mSceneObjects; }
     inline U32              getSceneObjectCount( void ) const           { return mSceneObjects.size(); }
@@ -356,6 +409,7 @@ public:
     inline SimSet*			getControllers( void )						{ return mControllers; }
 
     inline S32              getAssetPreloadCount( void ) const          { return mAssetPreloads.size(); }
+    inline S32              getPendingAssetPreloadCount( void ) const   { return mPendingAssetPreloads.size(); }
     const AssetPtr<AssetBase>* getAssetPreload( const S32 index ) const;
     void                    addAssetPreload( const char* pAssetId );
     void                    removeAssetPreload( const char* pAssetId );
@@ -636,6 +690,11 @@ public:
     void setLayerSortMode( const U32 layer, const SceneRenderQueue::RenderSort sortMode );
     SceneRenderQueue::RenderSort getLayerSortMode( const U32 layer );
 
+    /// Visibility cache.
+    void                    setVisibilityCacheEnabled( const bool enabled );
+    inline bool             getVisibilityCacheEnabled( void ) const     { return mVisibilityCacheEnabled; }
+    inline void             invalidateVisibilityCache( void )           { mVisibilityCacheValid = false; }
+
     /// Window attachments.
     void                    attachSceneWindow( SceneWindow* pSceneWindow2D );
     void                    detachSceneWindow( SceneWindow* pSceneWindow2D );
@@ -656,8 +715,10 @@ public:
     /// Miscellaneous.
     inline void             setBatchingEnabled( const bool enabled )    { mBatchRenderer.setBatchEnabled( enabled ); }
     inline bool             getBatchingEnabled( void ) const            { return mBatchRenderer.getBatchEnabled(); }
+    inline void             setBatchStreamingEnabled( const bool enabled ) { mBatchRenderer.setStreamingMode( enabled ); }
+    inline bool             getBatchStreamingEnabled( void ) const      { return mBatchRenderer.getStreamingMode(); }
     inline bool             getIsEditorScene( void ) const              { return ((mIsEditorScene > 0) ? true : false); }
-    inline void             setIsEditorScene( bool status )             { mIsEditorScene += (status ? 1 : -1); }
+    void                    setIsEditorScene( bool status );
     static U32              getGlobalSceneCount( void );
     inline U32              getSceneIndex( void ) const                 { return mSceneIndex; }
     inline void             setUpdateCallback( const bool callback )    { mUpdateCallback = callback; }
@@ -725,6 +786,10 @@ protected:
 
 public:
     static SimObjectPtr<Scene> LoadingScene;
+
+    /// Parallel integration.
+    static bool             smParallelIntegrate;
+    static S32              smParallelIntegrateChunkSize;
 };
 
 //-----------------------------------------------------------------------------
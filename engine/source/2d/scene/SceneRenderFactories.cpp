@@ -31,4 +31,86 @@
 //-----------------------------------------------------------------------------
 
 FactoryCache<SceneRenderRequest> SceneRenderRequestFactory;
-FactoryCache<SceneRenderQueue> SceneRenderQueueFactory;   
+FactoryCache<SceneRenderQueue> SceneRenderQueueFactory;
+SceneRenderArena SceneRenderFrameArena;
+
+//-----------------------------------------------------------------------------
+
+SceneRenderArena::SceneRenderArena()
+{
+    VECTOR_SET_ASSOCIATION( mFrameQueues );
+    VECTOR_SET_ASSOCIATION( mFreeQueues );
+}
+
+//-----------------------------------------------------------------------------
+
+SceneRenderArena::~SceneRenderArena()
+{
+    // Release the frame.
+    reset();
+
+    // Delete the pooled queues.
+    for( typeRenderQueueVector::iterator itr = mFreeQueues.begin(); itr != mFreeQueues.end(); ++itr )
+    {
+        delete *itr;
+    }
+    mFreeQueues.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+SceneRenderRequest* SceneRenderArena::createRenderRequest( void )
+{
+    return mFrameArena.create<SceneRenderRequest>();
+}
+
+//-----------------------------------------------------------------------------
+
+SceneRenderQueue* SceneRenderArena::createRenderQueue( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneRenderArena_CreateRenderQueue);
+
+    SceneRenderQueue* pSceneRenderQueue;
+
+    // Reuse a pooled queue if one is available.
+    if ( mFreeQueues.size() > 0 )
+    {
+        pSceneRenderQueue = mFreeQueues.last();
+        mFreeQueues.pop_back();
+    }
+    else
+    {
+        pSceneRenderQueue = new SceneRenderQueue();
+        pSceneRenderQueue->setFrameScoped( true );
+    }
+
+    mFrameQueues.push_back( pSceneRenderQueue );
+
+    return pSceneRenderQueue;
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneRenderArena::reset( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneRenderArena_Reset);
+
+    // Return the frame queues to the pool.
+    // NOTE:    The queues must be reset before the arena as they reference its requests.
+    for( typeRenderQueueVector::iterator itr = mFrameQueues.begin(); itr != mFrameQueues.end(); ++itr )
+    {
+        SceneRenderQueue* pSceneRenderQueue = *itr;
+        pSceneRenderQueue->resetState();
+        mFreeQueues.push_back( pSceneRenderQueue );
+    }
+    mFrameQueues.clear();
+
+    // Release the requests.
+    mFrameArena.reset();
+}
+
+//-----------------------------------------------------------------------------
+
+#include "SceneRenderFactories_ScriptBinding.h"   
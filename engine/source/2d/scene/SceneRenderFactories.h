@@ -27,6 +27,14 @@
 #include "memory/factoryCache.h"
 #endif
 
+#ifndef _FRAME_ARENA_H_
+#include "memory/frameArena.h"
+#endif
+
+#ifndef _TVECTOR_H_
+#include "collection/vector.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
 class SceneRenderRequest;
@@ -37,4 +45,45 @@ class SceneRenderQueue;
 extern FactoryCache<SceneRenderRequest> SceneRenderRequestFactory;
 extern FactoryCache<SceneRenderQueue> SceneRenderQueueFactory;
 
+//-----------------------------------------------------------------------------
+
+/// The scene render arena owns the render requests and queues that only live for a single frame.
+///
+/// Render requests are bump-allocated from a frame arena and are simply forgotten when the
+/// arena is reset.  Render queues hold vectors whose capacity is worth keeping so they are
+/// pooled instead: every queue handed out during a frame is reset and returned to the pool
+/// when the arena is reset.
+class SceneRenderArena
+{
+public:
+    typedef Vector<SceneRenderQueue*> typeRenderQueueVector;
+
+private:
+    FrameArena              mFrameArena;
+    typeRenderQueueVector   mFrameQueues;
+    typeRenderQueueVector   mFreeQueues;
+
+public:
+    SceneRenderArena();
+    ~SceneRenderArena();
+
+    /// Create a render request that is valid until the arena is reset.
+    SceneRenderRequest* createRenderRequest( void );
+
+    /// Create a render queue that is valid until the arena is reset.
+    /// Any requests created by the queue are also allocated from the arena.
+    SceneRenderQueue* createRenderQueue( void );
+
+    /// Release everything allocated since the last reset.  Called once per frame.
+    void reset( void );
+
+    inline void getFrameArenaStats( FrameArena::Stats& stats ) const { mFrameArena.getStats( stats ); }
+    inline U32 getFrameQueueCount( void ) const { return mFrameQueues.size(); }
+    inline U32 getPooledQueueCount( void ) const { return mFrameQueues.size() + mFreeQueues.size(); }
+};
+
+//-----------------------------------------------------------------------------
+
+extern SceneRenderArena SceneRenderFrameArena;
+
 #endif // _SCENE_RENDER_FACTORIES_H_
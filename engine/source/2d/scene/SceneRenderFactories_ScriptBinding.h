@@ -0,0 +1,69 @@
+﻿//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+/*! @defgroup SceneRenderArena Scene Render Arena
+    @ingroup TorqueScriptFunctions
+    @{
+*/
+
+/*! Gets the statistics of the frame arena that owns the transient scene render requests and queues.
+    @return The statistics formatted as "frameBytes peakFrameBytes frameAllocations peakFrameAllocations reservedBytes blockCount threadCount resetCount frameQueues pooledQueues".
+*/
+ConsoleFunctionWithDocs( getSceneRenderArenaStats, ConsoleString, 1, 1, ())
+{
+    // Fetch the arena statistics.
+    FrameArena::Stats stats;
+    SceneRenderFrameArena.getFrameArenaStats( stats );
+
+    // Format the statistics.
+    char* pBuffer = Con::getReturnBuffer( 128 );
+    dSprintf( pBuffer, 128, "%u %u %u %u %u %u %u %u %u %u",
+        stats.mFrameBytes, stats.mPeakFrameBytes,
+        stats.mFrameAllocations, stats.mPeakFrameAllocations,
+        stats.mReservedBytes, stats.mBlockCount,
+        stats.mLaneCount, stats.mResetCount,
+        SceneRenderFrameArena.getFrameQueueCount(), SceneRenderFrameArena.getPooledQueueCount() );
+
+    return pBuffer;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Dumps the statistics of the frame arena that owns the transient scene render requests and queues to the console.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs( dumpSceneRenderArenaStats, ConsoleVoid, 1, 1, ())
+{
+    // Fetch the arena statistics.
+    FrameArena::Stats stats;
+    SceneRenderFrameArena.getFrameArenaStats( stats );
+
+    Con::printf( "Scene Render Arena:" );
+    Con::printf( "- Frame Bytes=%u, Peak=%u", stats.mFrameBytes, stats.mPeakFrameBytes );
+    Con::printf( "- Frame Allocations=%u, Peak=%u", stats.mFrameAllocations, stats.mPeakFrameAllocations );
+    Con::printf( "- Reserved Bytes=%u, Blocks=%u, Threads=%u", stats.mReservedBytes, stats.mBlockCount, stats.mLaneCount );
+    Con::printf( "- Frame Queues=%u, Pooled Queues=%u", SceneRenderFrameArena.getFrameQueueCount(), SceneRenderFrameArena.getPooledQueueCount() );
+    Con::printf( "- Resets=%u", stats.mResetCount );
+}
+
+/*! @} */ // end group SceneRenderArena
@@ -81,6 +81,342 @@ const char* SceneRenderQueue::getRenderSortDescription( const RenderSort& sortMo
 
 //-----------------------------------------------------------------------------
 
+// Layers with at most this many requests, or this fraction of out-of-order requests, try an insertion sort first.
+static const U32 COHERENT_SORT_MIN_COUNT        = 32;
+static const U32 COHERENT_SORT_DESCENT_DIVISOR  = 16;
+
+// The insertion sort gives up and falls back to the radix sort after this many moves per request.
+static const U32 COHERENT_SORT_MOVE_FACTOR      = 8;
+
+//-----------------------------------------------------------------------------
+
+static inline U32 getSerialSortKey( const S32 serialId )
+{
+    // Flip the sign so negative serial Ids order before positive ones.
+    return (U32)serialId ^ 0x80000000;
+}
+
+//-----------------------------------------------------------------------------
+
+static inline U32 getFloatSortKey( F32 value )
+{
+    // Treat negative zero as zero to match the comparisons.
+    if ( value == 0.0f )
+        value = 0.0f;
+
+    U32 bits;
+    dMemcpy( &bits, &value, sizeof(bits) );
+
+    // Flip all the bits of negative values and the sign of positive values so the keys order as the values do.
+    return (bits & 0x80000000) ? ~bits : bits | 0x80000000;
+}
+
+//-----------------------------------------------------------------------------
+
+static inline U64 getPointerSortKey( const void* pointer )
+{
+#ifdef TORQUE_64
+    return (U64)pointer;
+#else
+    return (U64)(U32)pointer;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneRenderQueue::sort( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneRenderQueue_Sort);
+
+    // Finish if not sorting.
+    if ( mSortMode == RENDER_SORT_OFF || mSortMode == RENDER_SORT_INVALID )
+        return;
+
+    // Finish if nothing to sort.
+    const U32 requestCount = (U32)mRenderRequests.size();
+    if ( requestCount < 2 )
+    {
+        // Batching means we don't need strict order.
+        if ( mSortMode == RENDER_SORT_BATCH )
+            mStrictOrderMode = false;
+
+        return;
+    }
+
+    // Sort layer appropriately.
+    if ( mSortMode == RENDER_SORT_GROUP )
+    {
+        // Groups are ordered by their address which may not fit alongside the serial Id
+        // so sort by the serial Id and then (stably) by the group.
+        buildSortKeys( RENDER_SORT_NEWEST );
+        sortEntries();
+        buildGroupSortKeys();
+        sortEntries();
+    }
+    else
+    {
+        buildSortKeys( mSortMode );
+        sortEntries();
+    }
+
+    // Write the sorted render requests.
+    SceneRenderRequest** pRenderRequests = mRenderRequests.address();
+    const SortEntry* pSortEntries = mSortEntries.address();
+    for ( U32 index = 0; index < requestCount; ++index )
+    {
+        pRenderRequests[index] = pSortEntries[index].mpRenderRequest;
+    }
+
+    switch( mSortMode )
+    {
+        case RENDER_SORT_NEWEST:        validateSort( layeredNewFrontSort ); break;
+        case RENDER_SORT_OLDEST:        validateSort( layeredOldFrontSort ); break;
+        case RENDER_SORT_GROUP:         validateSort( layerGroupOrderSort ); break;
+        case RENDER_SORT_XAXIS:         validateSort( layeredXSortPointSort ); break;
+        case RENDER_SORT_YAXIS:         validateSort( layeredYSortPointSort ); break;
+        case RENDER_SORT_ZAXIS:         validateSort( layeredDepthSort ); break;
+        case RENDER_SORT_INVERSE_XAXIS: validateSort( layeredInverseXSortPointSort ); break;
+        case RENDER_SORT_INVERSE_YAXIS: validateSort( layeredInverseYSortPointSort ); break;
+        case RENDER_SORT_INVERSE_ZAXIS: validateSort( layeredInverseDepthSort ); break;
+
+        case RENDER_SORT_BATCH:
+            {
+                validateSort( layerBatchOrderSort );
+
+                // Batching means we don't need strict order.
+                mStrictOrderMode = false;
+                break;
+            }
+
+        default:
+            break;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneRenderQueue::buildSortKeys( const RenderSort sortMode )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneRenderQueue_BuildSortKeys);
+
+    const U32 requestCount = (U32)mRenderRequests.size();
+    mSortEntries.setSize( requestCount );
+
+    SceneRenderRequest** pRenderRequests = mRenderRequests.address();
+    SortEntry* pSortEntries = mSortEntries.address();
+
+    // The primary key is in the upper 32-bits and the serial Id (the tie-breaker for all modes) is in the lower 32-bits.
+    for ( U32 index = 0; index < requestCount; ++index )
+    {
+        SceneRenderRequest* pSceneRenderRequest = pRenderRequests[index];
+        const U64 serialKey = getSerialSortKey( pSceneRenderRequest->mSerialId );
+
+        U64 key;
+        switch( sortMode )
+        {
+            case RENDER_SORT_OLDEST:
+                key = ~serialKey & 0xFFFFFFFF;
+                break;
+
+            case RENDER_SORT_BATCH:
+                // Render isolated requests first.
+                key = ((U64)(pSceneRenderRequest->mpSceneRenderObject->getBatchIsolated() ? 0 : 1) << 32) | serialKey;
+                break;
+
+            case RENDER_SORT_XAXIS:
+                key = ((U64)getFloatSortKey( pSceneRenderRequest->mWorldPosition.x + pSceneRenderRequest->mSortPoint.x ) << 32) | serialKey;
+                break;
+
+            case RENDER_SORT_YAXIS:
+                key = ((U64)getFloatSortKey( pSceneRenderRequest->mWorldPosition.y + pSceneRenderRequest->mSortPoint.y ) << 32) | serialKey;
+                break;
+
+            case RENDER_SORT_ZAXIS:
+                // Deepest first.
+                key = ((U64)~getFloatSortKey( pSceneRenderRequest->mDepth ) << 32) | serialKey;
+                break;
+
+            case RENDER_SORT_INVERSE_XAXIS:
+                key = ((U64)~getFloatSortKey( pSceneRenderRequest->mWorldPosition.x + pSceneRenderRequest->mSortPoint.x ) << 32) | serialKey;
+                break;
+
+            case RENDER_SORT_INVERSE_YAXIS:
+                key = ((U64)~getFloatSortKey( pSceneRenderRequest->mWorldPosition.y + pSceneRenderRequest->mSortPoint.y ) << 32) | serialKey;
+                break;
+
+            case RENDER_SORT_INVERSE_ZAXIS:
+                key = ((U64)getFloatSortKey( pSceneRenderRequest->mDepth ) << 32) | serialKey;
+                break;
+
+            default:
+                key = serialKey;
+                break;
+        }
+
+        pSortEntries[index].mKey = key;
+        pSortEntries[index].mpRenderRequest = pSceneRenderRequest;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneRenderQueue::buildGroupSortKeys( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneRenderQueue_BuildGroupSortKeys);
+
+    // Re-key the (already ordered) entries by their render group.
+    const U32 entryCount = (U32)mSortEntries.size();
+    SortEntry* pSortEntries = mSortEntries.address();
+    for ( U32 index = 0; index < entryCount; ++index )
+    {
+        pSortEntries[index].mKey = getPointerSortKey( pSortEntries[index].mpRenderRequest->mRenderGroup );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneRenderQueue::sortEntries( void )
+{
+    // Use the insertion sort if the entries are (nearly) in order already, otherwise use the radix sort.
+    // NOTE:    Both sorts are stable so equal keys keep their submission order.
+    if ( !coherentSortEntries() )
+        radixSortEntries();
+}
+
+//-----------------------------------------------------------------------------
+
+bool SceneRenderQueue::coherentSortEntries( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneRenderQueue_CoherentSort);
+
+    const U32 entryCount = (U32)mSortEntries.size();
+    SortEntry* pSortEntries = mSortEntries.address();
+
+    // Count the out-of-order entries.
+    U32 descentCount = 0;
+    for ( U32 index = 1; index < entryCount; ++index )
+    {
+        if ( pSortEntries[index].mKey < pSortEntries[index-1].mKey )
+            descentCount++;
+    }
+
+    // Finish if already sorted.
+    if ( descentCount == 0 )
+        return true;
+
+    // Too disordered for an insertion sort?
+    if ( entryCount > COHERENT_SORT_MIN_COUNT && descentCount > entryCount / COHERENT_SORT_DESCENT_DIVISOR )
+        return false;
+
+    // Insertion sort within a move budget.
+    U32 moveBudget = entryCount * COHERENT_SORT_MOVE_FACTOR;
+    for ( U32 index = 1; index < entryCount; ++index )
+    {
+        const SortEntry entry = pSortEntries[index];
+
+        U32 insertIndex = index;
+        while ( insertIndex > 0 && entry.mKey < pSortEntries[insertIndex-1].mKey )
+        {
+            // Give up if the budget is spent.
+            // NOTE:    The entries are left as a valid (stable) permutation for the radix sort.
+            if ( moveBudget == 0 )
+            {
+                pSortEntries[insertIndex] = entry;
+                return false;
+            }
+
+            pSortEntries[insertIndex] = pSortEntries[insertIndex-1];
+            insertIndex--;
+            moveBudget--;
+        }
+
+        pSortEntries[insertIndex] = entry;
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneRenderQueue::radixSortEntries( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneRenderQueue_RadixSort);
+
+    const U32 entryCount = (U32)mSortEntries.size();
+    mSortScratch.setSize( entryCount );
+
+    SortEntry* pSource = mSortEntries.address();
+    SortEntry* pTarget = mSortScratch.address();
+
+    // Build the histograms for all the key bytes in a single pass.
+    U32 histograms[sizeof(U64)][256];
+    dMemset( histograms, 0, sizeof(histograms) );
+    for ( U32 index = 0; index < entryCount; ++index )
+    {
+        const U64 key = pSource[index].mKey;
+        for ( U32 byteIndex = 0; byteIndex < sizeof(U64); ++byteIndex )
+        {
+            histograms[byteIndex][(key >> (byteIndex * 8)) & 0xFF]++;
+        }
+    }
+
+    // Least-significant byte first.
+    for ( U32 byteIndex = 0; byteIndex < sizeof(U64); ++byteIndex )
+    {
+        U32* pHistogram = histograms[byteIndex];
+        const U32 shift = byteIndex * 8;
+
+        // Skip the pass if all the keys have the same byte.
+        if ( pHistogram[(pSource[0].mKey >> shift) & 0xFF] == entryCount )
+            continue;
+
+        // Calculate the bucket offsets.
+        U32 offset = 0;
+        for ( U32 bucket = 0; bucket < 256; ++bucket )
+        {
+            const U32 bucketCount = pHistogram[bucket];
+            pHistogram[bucket] = offset;
+            offset += bucketCount;
+        }
+
+        // Scatter.
+        for ( U32 index = 0; index < entryCount; ++index )
+        {
+            const SortEntry& entry = pSource[index];
+            pTarget[pHistogram[(entry.mKey >> shift) & 0xFF]++] = entry;
+        }
+
+        SortEntry* pSwap = pSource;
+        pSource = pTarget;
+        pTarget = pSwap;
+    }
+
+    // Copy back if the result ended up in the scratch.
+    if ( pSource != mSortEntries.address() )
+        dMemcpy( mSortEntries.address(), pSource, entryCount * sizeof(SortEntry) );
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneRenderQueue::validateSort( typeSortCallback sortCallback ) const
+{
+#ifdef TORQUE_DEBUG
+    // Check the order agrees with the reference comparison.
+    const U32 requestCount = (U32)mRenderRequests.size();
+    for ( U32 index = 1; index < requestCount; ++index )
+    {
+        AssertFatal( sortCallback( &mRenderRequests[index-1], &mRenderRequests[index] ) <= 0, "SceneRenderQueue::sort() - Render requests are out of order." );
+    }
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
 S32 QSORT_CALLBACK SceneRenderQueue::layeredNewFrontSort(const void* a, const void* b)
 {
     // Fetch scene render requests.
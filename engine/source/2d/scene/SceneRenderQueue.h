@@ -55,12 +55,39 @@ public:
         RENDER_SORT_INVERSE_ZAXIS,
     };
 
+private:
+    /// A render request with its packed sort key.
+    struct SortEntry
+    {
+        U64                 mKey;
+        SceneRenderRequest* mpRenderRequest;
+    };
+    typedef Vector<SortEntry> typeSortEntryVector;
+
 private: 
     typeRenderRequestVector mRenderRequests;
     RenderSort              mSortMode;
     bool                    mStrictOrderMode;
 
+    typeSortEntryVector     mSortEntries;
+    typeSortEntryVector     mSortScratch;
+
+    bool                    mFrameScoped;
+
 private:
+    friend class SceneRenderArena;
+
+    inline void setFrameScoped( const bool frameScoped ) { mFrameScoped = frameScoped; }
+
+    void buildSortKeys( const RenderSort sortMode );
+    void buildGroupSortKeys( void );
+    void sortEntries( void );
+    bool coherentSortEntries( void );
+    void radixSortEntries( void );
+
+    typedef S32 (QSORT_CALLBACK *typeSortCallback)(const void* a, const void* b);
+    void validateSort( typeSortCallback sortCallback ) const;
+
     static S32 QSORT_CALLBACK layeredNewFrontSort(const void* a, const void* b);
     static S32 QSORT_CALLBACK layeredOldFrontSort(const void* a, const void* b);
     static S32 QSORT_CALLBACK layeredDepthSort(const void* a, const void* b);
@@ -73,7 +100,7 @@ private:
     static S32 QSORT_CALLBACK layeredInverseYSortPointSort(const void* a, const void* b);
 
 public:
-    SceneRenderQueue()
+    SceneRenderQueue() : mFrameScoped( false )
     {
         resetState();
     }
@@ -87,13 +114,20 @@ public:
         // Debug Profiling.
         PROFILE_SCOPE(SceneRenderQueue_ResetState);
 
-        // Cache request.
-        for( typeRenderRequestVector::iterator itr = mRenderRequests.begin(); itr != mRenderRequests.end(); ++itr )
+        // Cache request (requests of a frame-scoped queue belong to the frame arena).
+        if ( !mFrameScoped )
         {
-            SceneRenderRequestFactory.cacheObject( *itr );
+            for( typeRenderRequestVector::iterator itr = mRenderRequests.begin(); itr != mRenderRequests.end(); ++itr )
+            {
+                SceneRenderRequestFactory.cacheObject( *itr );
+            }
         }
         mRenderRequests.clear();
 
+        // Clear the sort entries (keeping their storage).
+        mSortEntries.clear();
+        mSortScratch.clear();
+
         // Reset sort mode.
         mSortMode = RENDER_SORT_NEWEST;
 
@@ -107,7 +141,7 @@ public:
         PROFILE_SCOPE(SceneRenderQueue_CreateRenderRequest);
 
         // Create scene render request.
-        SceneRenderRequest* pSceneRenderRequest = SceneRenderRequestFactory.createObject();
+        SceneRenderRequest* pSceneRenderRequest = mFrameScoped ? SceneRenderFrameArena.createRenderRequest() : SceneRenderRequestFactory.createObject();
 
         // Queue render request.
         mRenderRequests.push_back( pSceneRenderRequest );
@@ -123,113 +157,9 @@ public:
     inline void setStrictOrderMode( const bool strictOrderMode ) { mStrictOrderMode = strictOrderMode; }
     inline bool getStrictOrderMode( void ) const { return mStrictOrderMode; }
 
-    void sort( void )
-    {
-        // Sort layer appropriately.
-        switch( mSortMode )
-        {
-            case RENDER_SORT_NEWEST:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortNewest);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredNewFrontSort );
-                    return;
-                }
-
-            case RENDER_SORT_OLDEST:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortOldest);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredOldFrontSort );
-                    return;
-                }
-
-            case RENDER_SORT_BATCH:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortBatch);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layerBatchOrderSort );
-
-                    // Batching means we don't need strict order.
-                    mStrictOrderMode = false;
-                    return;
-                }
-
-            case RENDER_SORT_GROUP:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortGroup);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layerGroupOrderSort );
-                    return;
-                }
-
-            case RENDER_SORT_XAXIS:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortXAxis);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredXSortPointSort);
-                    return;
-                }
-
-            case RENDER_SORT_YAXIS:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortYAxis);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredYSortPointSort );
-                    return;
-                }
-
-            case RENDER_SORT_ZAXIS:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortZAxis);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredDepthSort );
-                    return;
-                }
-
-            case RENDER_SORT_INVERSE_XAXIS:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortInverseXAxis);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredInverseXSortPointSort );
-                    return;
-                }
-
-            case RENDER_SORT_INVERSE_YAXIS:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortInverseYAxis);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredInverseYSortPointSort );
-                    return;
-                }
-
-            case RENDER_SORT_INVERSE_ZAXIS:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortInverseZAxis);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredInverseDepthSort );
-                    return;
-                }
-
-            case RENDER_SORT_OFF:
-                {
-                    return;
-                }
-
-            default:
-                break;
-        };
-    }
+    inline bool getFrameScoped( void ) const { return mFrameScoped; }
+
+    void sort( void );
 
     static RenderSort getRenderSortEnum(const char* label);
     static const char* getRenderSortDescription( const RenderSort& sortMode );
@@ -109,11 +109,8 @@ public:
         mCustomDataKey1 = 0;
         mCustomDataKey2 = 0;
 
-        if ( mpIsolatedRenderQueue != NULL )
-        {
-            SceneRenderQueueFactory.cacheObject( mpIsolatedRenderQueue );
-            mpIsolatedRenderQueue = NULL;
-        }
+        // NOTE:    Isolated render queues are owned by the scene render arena.
+        mpIsolatedRenderQueue = NULL;
     }
 
 public:
@@ -278,8 +278,8 @@ ConsoleMethodWithDocs(Scene, getSceneObjectList, ConsoleString, 2, 2, ())
 
 //-----------------------------------------------------------------------------
 
-/*! Gets the number of assets set to preload for this scene.
-    @return The number of assets set to preload for this scene.
+/*! Gets the number of assets set to preload for this scene that have been acquired.
+    @return The number of assets set to preload for this scene that have been acquired.
 */
 ConsoleMethodWithDocs(Scene, getAssetPreloadCount, ConsoleInt, 2, 2, ())
 {
@@ -305,8 +305,19 @@ ConsoleMethodWithDocs(Scene, getAssetPreload, ConsoleString, 3, 3, (index))
 
 //-----------------------------------------------------------------------------
 
+/*! Gets the number of assets set to preload for this scene that are still being acquired.
+    @return The number of assets still being acquired.
+*/
+ConsoleMethodWithDocs(Scene, getPendingAssetPreloadCount, ConsoleInt, 2, 2, ())
+{
+    return object->getPendingAssetPreloadCount();
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Adds the asset Id so that it is preloaded when the scene is loaded.
-    The asset loaded immediately by this operation.  Duplicate assets are ignored.
+    The asset is acquired in the background over the following frames and the callback "onAssetPreloadsComplete()"
+    is performed on the scene once all the pending asset preloads are acquired.  Duplicate assets are ignored.
     @param assetId The asset Id to be added.
     @return No return value.
 */
@@ -3568,6 +3579,80 @@ ConsoleMethodWithDocs(Scene, getBatchingEnabled, ConsoleBool, 2, 2, ())
 
 //-----------------------------------------------------------------------------
 
+/*! Sets whether render batches are streamed through a vertex buffer object or not.
+    Streaming is ignored if vertex buffer objects are not supported.
+    @param enabled Whether render batches are streamed through a vertex buffer object or not.
+    return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setBatchStreamingEnabled, ConsoleVoid, 3, 3, ( bool enabled ))
+{
+    // Fetch args.
+    const bool enabled = dAtob(argv[2]);
+
+    // Sets batch streaming enabled.
+    object->setBatchStreamingEnabled( enabled );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether render batches are streamed through a vertex buffer object or not.
+    return Whether render batches are streamed through a vertex buffer object or not.
+*/
+ConsoleMethodWithDocs(Scene, getBatchStreamingEnabled, ConsoleBool, 2, 2, ())
+{
+    // Gets batch streaming enabled.
+    return object->getBatchStreamingEnabled();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets whether the visible objects and their render requests are cached between renders or not.
+    The cache is only used when the camera, the render layers and groups and the visible objects haven't changed.
+    @param enabled Whether the visibility cache is enabled or not.
+    return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setVisibilityCacheEnabled, ConsoleVoid, 3, 3, ( bool enabled ))
+{
+    // Fetch args.
+    const bool enabled = dAtob(argv[2]);
+
+    // Sets visibility cache enabled.
+    object->setVisibilityCacheEnabled( enabled );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether the visible objects and their render requests are cached between renders or not.
+    return Whether the visibility cache is enabled or not.
+*/
+ConsoleMethodWithDocs(Scene, getVisibilityCacheEnabled, ConsoleBool, 2, 2, ())
+{
+    // Gets visibility cache enabled.
+    return object->getVisibilityCacheEnabled();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the number of renders that used the visibility cache since the debug statistics were reset.
+    @return The number of visibility cache hits.
+*/
+ConsoleMethodWithDocs(Scene, getVisibilityCacheHits, ConsoleInt, 2, 2, ())
+{
+    return (S32)object->getDebugStats().visibilityCacheHits;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the number of renders that had to refill the visibility cache since the debug statistics were reset.
+    @return The number of visibility cache misses.
+*/
+ConsoleMethodWithDocs(Scene, getVisibilityCacheMisses, ConsoleInt, 2, 2, ())
+{
+    return (S32)object->getDebugStats().visibilityCacheMisses;
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Sets whether this is an editor scene.
     @return No return value.
 */
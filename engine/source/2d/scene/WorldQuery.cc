@@ -39,6 +39,7 @@ WorldQuery::WorldQuery( Scene* pScene ) :
         mpScene(pScene),
         mIsRaycastQueryResult(false),
         mMasterQueryKey(0),
+        mProxyEpoch(0),
         mCheckPoint(false),
         mCheckAABB(false),
         mCheckOOBB(false),
@@ -62,6 +63,8 @@ S32 WorldQuery::add( SceneObject* pSceneObject )
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_Add);
 
+    mProxyEpoch++;
+
     return CreateProxy( pSceneObject->getAABB(), static_cast<PhysicsProxy*>(pSceneObject) );
 }
 
@@ -72,6 +75,8 @@ void WorldQuery::remove( SceneObject* pSceneObject )
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_Remove);
 
+    mProxyEpoch++;
+
     DestroyProxy( pSceneObject->getWorldProxy() );
 }
 
@@ -82,6 +87,8 @@ bool WorldQuery::update( SceneObject* pSceneObject, const b2AABB& aabb, const b2
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_Update);
 
+    mProxyEpoch++;
+
     return MoveProxy( pSceneObject->getWorldProxy(), aabb, displacement );
 }
 
@@ -100,6 +107,7 @@ void WorldQuery::addAlwaysInScope( SceneObject* pSceneObject )
 
     // Add to always-in-scope.
     mAlwaysInScopeSet.push_back( pSceneObject );
+    mProxyEpoch++;
 
     // Set always in scope.
     pSceneObject->mAlwaysInScope = true;
@@ -120,6 +128,7 @@ void WorldQuery::removeAlwaysInScope( SceneObject* pSceneObject )
             continue;
 
         mAlwaysInScopeSet.erase_fast( itr );
+        mProxyEpoch++;
 
         // Reset always in scope.
         pSceneObject->mAlwaysInScope = false;
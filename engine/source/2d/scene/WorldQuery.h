@@ -52,6 +52,9 @@ public:
     void            remove( SceneObject* pSceneObject );
     bool            update( SceneObject* pSceneObject, const b2AABB& aabb, const b2Vec2& displacement );
 
+    /// The proxy epoch changes whenever a proxy is created, destroyed or moved or the always-in-scope set changes.
+    inline U32      getProxyEpoch( void ) const { return mProxyEpoch; }
+
     /// Always in scope.
     void            addAlwaysInScope( SceneObject* pSceneObject );
     void            removeAlwaysInScope( SceneObject* pSceneObject );
@@ -118,6 +121,7 @@ private:
     bool                        mIsRaycastQueryResult;
     typeSceneObjectVector       mAlwaysInScopeSet;
     U32                         mMasterQueryKey;
+    U32                         mProxyEpoch;
 };
 
 #endif // _WORLD_QUERY_H_
\ No newline at end of file
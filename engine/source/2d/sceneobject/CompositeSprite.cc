@@ -109,6 +109,7 @@ void CompositeSprite::initPersistFields()
     addProtectedField( "DefaultSpriteAngle", TypeF32, Offset(mDefaultSpriteSize, CompositeSprite), &setDefaultSpriteAngle, &getDefaultSpriteAngle, &writeDefaultSpriteAngle, "");
     addProtectedField( "BatchLayout", TypeEnum, Offset(mBatchLayoutType, CompositeSprite), &setBatchLayout, &defaultProtectedGetFn, &writeBatchLayout, 1, &batchLayoutTypeTable, "");
     addProtectedField( "BatchCulling", TypeBool, Offset(mBatchCulling, CompositeSprite), &setBatchCulling, &defaultProtectedGetFn, &writeBatchCulling, "");
+    addProtectedField( "BatchStatic", TypeBool, Offset(mBatchStatic, CompositeSprite), &setBatchStatic, &defaultProtectedGetFn, &writeBatchStatic, "");
     addField( "BatchIsolated", TypeBool, Offset(mBatchIsolated, CompositeSprite), &writeBatchIsolated, "");
     addField( "BatchSortMode", TypeEnum, Offset(mBatchSortMode, CompositeSprite), &writeBatchSortMode, 1, &SceneRenderQueue::renderSortTable, "");
 }
@@ -192,6 +193,15 @@ void CompositeSprite::interpolateObject( const F32 timeDelta )
 
 void CompositeSprite::scenePrepareRender( const SceneRenderState* pSceneRenderState, SceneRenderQueue* pSceneRenderQueue )
 {
+    // Is the batch static?
+    if ( getBatchStatic() )
+    {
+        // Yes, so render the whole batch with a single request.
+        // NOTE: The request has no sprite as custom data which is what selects the static batch when rendering.
+        Scene::createDefaultRenderRequest( pSceneRenderQueue, this );
+        return;
+    }
+
     // Prepare render.
     SpriteBatch::prepareRender( this, pSceneRenderState, pSceneRenderQueue );
 }
@@ -151,6 +151,33 @@ ConsoleMethodWithDocs(CompositeSprite, getBatchCulling, ConsoleBool, 2, 2, ())
 
 //-----------------------------------------------------------------------------
 
+/*! Sets whether the sprites are rendered from a static batch.
+    The static batch is built once and kept in a vertex buffer so composites that don't move
+    draw with one call per texture without submitting their sprites each frame.
+    Sprite culling and the batch sort mode are not used when the batch is static.
+    The batch is rebuilt when the sprites change, when the composite moves or each frame if any sprite is animated.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(CompositeSprite, setBatchStatic, ConsoleVoid, 3, 3, (bool batchStatic))
+{
+    // Fetch batch static.
+    const bool batchStatic = dAtob(argv[2]);
+
+    STATIC_VOID_CAST_TO(CompositeSprite, SpriteBatch, object)->setBatchStatic( batchStatic );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether the sprites are rendered from a static batch or not.
+    @return Whether the sprites are rendered from a static batch or not.
+*/
+ConsoleMethodWithDocs(CompositeSprite, getBatchStatic, ConsoleBool, 2, 2, ())
+{
+    return object->getBatchStatic();
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Sets the batch render sort mode.
     The render sort mode is used when isolated batch mode is on.
     @return No return value.
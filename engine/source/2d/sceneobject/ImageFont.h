@@ -92,6 +92,8 @@ public:
     void onRemove();
     void copyTo(SimObject* object);
 
+    virtual bool getIsIntegrateThreadSafe( void ) const                     { return true; }
+
     virtual bool canPrepareRender( void ) const                             { return true; }
     virtual bool validRender( void ) const                                  { return mImageAsset.notNull() && mText.length() > 0; }
     virtual bool shouldRender( void ) const                                 { return true; }
@@ -28,42 +28,32 @@
 
 //------------------------------------------------------------------------------
 
-ParticleSystem::ParticleNode* ParticlePlayer::EmitterNode::createParticle( void )
+void ParticlePlayer::EmitterNode::createParticles( const U32 particleCount )
 {
     // Sanity!
-    AssertFatal( mOwner != NULL, "ParticlePlayer::EmitterNode::createParticle() - Cannot create a particle with a NULL owner." );
-  
-    // Fetch a free node,
-    ParticleSystem::ParticleNode* pFreeParticleNode = ParticleSystem::Instance->createParticle();
+    AssertFatal( mOwner != NULL, "ParticlePlayer::EmitterNode::createParticles() - Cannot create particles with a NULL owner." );
 
-    // Insert node into emitter chain.
-    pFreeParticleNode->mNextNode        = mParticleNodeHead.mNextNode;
-    pFreeParticleNode->mPreviousNode    = &mParticleNodeHead;
-    mParticleNodeHead.mNextNode         = pFreeParticleNode;
-    pFreeParticleNode->mNextNode->mPreviousNode = pFreeParticleNode;
-
-    // Configure the node.
-    mOwner->configureParticle( this, pFreeParticleNode );
+    // Finish if nothing to create.
+    if ( particleCount == 0 )
+        return;
 
-    return pFreeParticleNode;
-}
+    // Fetch the index of the first new particle.
+    const U32 startIndex = mParticles.size();
 
-//------------------------------------------------------------------------------
+    for ( U32 n = 0; n < particleCount; ++n )
+    {
+        // Add the particle.
+        const U32 particleIndex = mParticles.create();
 
-void ParticlePlayer::EmitterNode::freeParticle( ParticleSystem::ParticleNode* pParticleNode )
-{
-    // Sanity!
-    AssertFatal( mOwner != NULL, "ParticlePlayer::EmitterNode::freeParticle() - Cannot free a particle with a NULL owner." );
+        // Fetch a frame provider for it.
+        mParticles.getFrameProvider( particleIndex ) = ParticleSystem::Instance->createFrameProvider();
 
-    // Deallocate the assets.
-    pParticleNode->mFrameProvider.deallocateAssets();
+        // Configure the particle.
+        mOwner->configureParticle( this, particleIndex );
+    }
 
-    // Remove the node from the emitter chain.
-    pParticleNode->mPreviousNode->mNextNode = pParticleNode->mNextNode;
-    pParticleNode->mNextNode->mPreviousNode = pParticleNode->mPreviousNode;
-   
-    // Free the node.
-    ParticleSystem::Instance->freeParticle( pParticleNode );
+    // Do a single integration of the new particles to get things going.
+    mOwner->integrateParticles( this, startIndex, 0.0f );
 }
 
 //------------------------------------------------------------------------------
@@ -73,11 +63,8 @@ void ParticlePlayer::EmitterNode::freeAllParticles( void )
     // Sanity!
     AssertFatal( mOwner != NULL, "ParticlePlayer::EmitterNode::freeAllParticles() - Cannot free all particles with a NULL owner." );
 
-    // Free all the nodes,
-    while( mParticleNodeHead.mNextNode != &mParticleNodeHead )
-    {
-        freeParticle( mParticleNodeHead.mNextNode );
-    }
+    // Free all the particles.
+    mParticles.clear();
 }
 
 //------------------------------------------------------------------------------
@@ -299,42 +286,21 @@ void ParticlePlayer::integrateObject( const F32 totalTime, const F32 elapsedTime
             // Fetch the asset emitter.
             ParticleAssetEmitter* pParticleAssetEmitter = pEmitterNode->getAssetEmitter();
 
-            // Fetch the first particle node.
-            ParticleSystem::ParticleNode* pParticleNode = pEmitterNode->getFirstParticle();
-
-            // Fetch the particle node head.
-            ParticleSystem::ParticleNode* pParticleNodeHead = pEmitterNode->getParticleNodeHead();
-
-            // Process All particle nodes.
-            while ( pParticleNode != pParticleNodeHead )
-            {
-                // Update the particle age.
-                pParticleNode->mParticleAge += scaledTime;
+            // Fetch the particles.
+            ParticleStore& particles = pEmitterNode->getParticles();
 
-                // Has the particle expired?
-                // NOTE:-   If we're in single-particle mode then the particle lives as long as the particle player does.
-                if (    ( !pParticleAssetEmitter->getSingleParticle() && pParticleNode->mParticleAge > pParticleNode->mParticleLifetime ) ||
-                        ( mIsZero(pParticleNode->mParticleLifetime) ) )
-                {
-                    // Yes, so fetch next particle before we kill it.
-                    pParticleNode = pParticleNode->mNextNode;
+            // Update the particle ages.
+            particles.advanceAge( scaledTime );
 
-                    // Kill the particle.
-                    // NOTE:-   Because we move to the next particle the particle to kill is now the previous!
-                    pEmitterNode->freeParticle( pParticleNode->mPreviousNode );
-                }
-                else
-                {
-                    // No, so integrate the particle.
-                    integrateParticle( pEmitterNode, pParticleNode, pParticleNode->mParticleAge / pParticleNode->mParticleLifetime, scaledTime );
+            // Kill the expired particles.
+            // NOTE:-   If we're in single-particle mode then the particle lives as long as the particle player does.
+            particles.removeExpired( pParticleAssetEmitter->getSingleParticle() );
 
-                    // Move to the next particle node.
-                    pParticleNode = pParticleNode->mNextNode;
+            // Integrate the remaining particles.
+            integrateParticles( pEmitterNode, 0, scaledTime );
 
-                    // Only count particles when not in single-particle mode.
-                    activeParticleCount++;
-                }
-            };
+            // Count the active particles.
+            activeParticleCount += particles.size();
 
             // Skip generating new particles if the emitter is paused.
             if ( pEmitterNode->getPaused() )
@@ -344,10 +310,10 @@ void ParticlePlayer::integrateObject( const F32 totalTime, const F32 elapsedTime
             if ( pParticleAssetEmitter->getSingleParticle() )
             {
                 // Yes, so do we have a single particle yet?
-                if ( pParticleNodeHead->mNextNode == pParticleNodeHead )
+                if ( !pEmitterNode->getActiveParticles() )
                 {
                     // No, so generate a single particle.
-                    pEmitterNode->createParticle();
+                    pEmitterNode->createParticles( 1 );
                 }
             }
             else
@@ -391,8 +357,7 @@ void ParticlePlayer::integrateObject( const F32 totalTime, const F32 elapsedTime
                         pEmitterNode->setTimeSinceLastGeneration( 0.0f );
 
                     // Generate the required emission.
-                    for ( U32 n = 0; n < emissionCount; n++ )
-                        pEmitterNode->createParticle();
+                    pEmitterNode->createParticles( emissionCount );
                 }
             }
         }
@@ -475,46 +440,23 @@ void ParticlePlayer::interpolateObject( const F32 timeDelta )
         // Fetch the emitter node.
         EmitterNode* pEmitterNode = *emitterItr;
 
-        // Fetch First Particle Node.
-        ParticleSystem::ParticleNode* pParticleNode = pEmitterNode->getFirstParticle();
-
-        // Fetch the particle node head.
-        ParticleSystem::ParticleNode* pParticleNodeHead = pEmitterNode->getParticleNodeHead();
+        // Fetch the particles.
+        ParticleStore& particles = pEmitterNode->getParticles();
 
         // Fetch the asset emitter.
         ParticleAssetEmitter* pParticleAssetEmitter = pEmitterNode->getAssetEmitter();
 
         // Fetch the local AABB..
-        const Vector2& localAABB0 = pParticleAssetEmitter->getLocalPivotAABB0();
-        const Vector2& localAABB1 = pParticleAssetEmitter->getLocalPivotAABB1();
-        const Vector2& localAABB2 = pParticleAssetEmitter->getLocalPivotAABB2();
-        const Vector2& localAABB3 = pParticleAssetEmitter->getLocalPivotAABB3();
-
-        // Process All particle nodes.
-        while ( pParticleNode != pParticleNodeHead )
-        {
-            // Interpolate the position.
-            pParticleNode->mRenderTickPosition = (timeDelta * pParticleNode->mPreTickPosition) + ((1.0f-timeDelta) * pParticleNode->mPostTickPosition);
-
-            // Set the transform.
-            pParticleNode->mTransform.p = pParticleNode->mRenderTickPosition;
-
-            // Fetch the render size.
-            const Vector2& renderSize = pParticleNode->mRenderSize;
-
-            // Calculate the scaled AABB.
-            Vector2 scaledAABB[4];
-            scaledAABB[0] = localAABB0 * renderSize;
-            scaledAABB[1] = localAABB1 * renderSize;
-            scaledAABB[2] = localAABB2 * renderSize;
-            scaledAABB[3] = localAABB3 * renderSize;
+        const Vector2 localAABB[4] = {  pParticleAssetEmitter->getLocalPivotAABB0(),
+                                        pParticleAssetEmitter->getLocalPivotAABB1(),
+                                        pParticleAssetEmitter->getLocalPivotAABB2(),
+                                        pParticleAssetEmitter->getLocalPivotAABB3() };
 
-            // Calculate the world OOBB..
-            CoreMath::mCalculateOOBB( scaledAABB, pParticleNode->mTransform, pParticleNode->mRenderOOBB );
+        // Interpolate the positions.
+        particles.interpolateTick( timeDelta );
 
-            // Move to the next particle.
-            pParticleNode = pParticleNode->mNextNode;
-        }
+        // Calculate the world OOBBs at the interpolated positions.
+        particles.calculateOOBB( 0, localAABB, true );
     }
 }
 
@@ -619,17 +561,34 @@ void ParticlePlayer::sceneRender( const SceneRenderState* pSceneRenderState, con
         // Fetch the oldest-in-front flag.
         const bool oldestInFront = pParticleAssetEmitter->getOldestInFront();
 
-        // Fetch the starting particle (using appropriate particle order).
-        ParticleSystem::ParticleNode* pParticleNode = oldestInFront ? pEmitterNode->getFirstParticle() : pEmitterNode->getLastParticle();
+        // Fetch the particles.
+        const ParticleStore& particles = pEmitterNode->getParticles();
+        const S32 particleCount = (S32)particles.size();
+
+        // Fetch the render streams.
+        const F32* pOOBB0X = particles.getStream( ParticleStore::OOBB0_X );
+        const F32* pOOBB0Y = particles.getStream( ParticleStore::OOBB0_Y );
+        const F32* pOOBB1X = particles.getStream( ParticleStore::OOBB1_X );
+        const F32* pOOBB1Y = particles.getStream( ParticleStore::OOBB1_Y );
+        const F32* pOOBB2X = particles.getStream( ParticleStore::OOBB2_X );
+        const F32* pOOBB2Y = particles.getStream( ParticleStore::OOBB2_Y );
+        const F32* pOOBB3X = particles.getStream( ParticleStore::OOBB3_X );
+        const F32* pOOBB3Y = particles.getStream( ParticleStore::OOBB3_Y );
+        const F32* pColorRed = particles.getStream( ParticleStore::COLOR_RED );
+        const F32* pColorGreen = particles.getStream( ParticleStore::COLOR_GREEN );
+        const F32* pColorBlue = particles.getStream( ParticleStore::COLOR_BLUE );
+        const F32* pColorAlpha = particles.getStream( ParticleStore::COLOR_ALPHA );
 
-        // Fetch the particle node head.
-        ParticleSystem::ParticleNode* pParticleNodeHead = pEmitterNode->getParticleNodeHead();
+        // Fetch the starting particle (using appropriate particle order).
+        // NOTE:-   The particles are stored oldest first so the oldest are in front when rendered last.
+        const S32 indexStep = oldestInFront ? -1 : 1;
+        S32 particleIndex = oldestInFront ? particleCount-1 : 0;
 
-        // Process all particle nodes.
-        while ( pParticleNode != pParticleNodeHead )
+        // Process all particles.
+        for ( S32 n = 0; n < particleCount; ++n, particleIndex += indexStep )
         {
             // Fetch the frame provider.
-            const ImageFrameProviderCore& frameProvider = pParticleNode->mFrameProvider;
+            const ImageFrameProviderCore& frameProvider = *particles.getFrameProvider( particleIndex );
 
             // Fetch the frame area.
             const ImageAsset::FrameArea::TexelArea& texelFrameArea = frameProvider.getProviderImageFrameArea().mTexelArea;
@@ -637,29 +596,23 @@ void ParticlePlayer::sceneRender( const SceneRenderState* pSceneRenderState, con
             // Frame texture.
             TextureHandle& frameTexture = frameProvider.getProviderTexture();
 
-            // Fetch the particle render OOBB.
-            Vector2* renderOOBB = pParticleNode->mRenderOOBB;
-
             // Fetch lower/upper texture coordinates.
             const Vector2& texLower = texelFrameArea.mTexelLower;
             const Vector2& texUpper = texelFrameArea.mTexelUpper;
 
             // Submit batched quad.
             pBatchRenderer->SubmitQuad(
-                renderOOBB[0],
-                renderOOBB[1],
-                renderOOBB[2],
-                renderOOBB[3],
+                Vector2( pOOBB0X[particleIndex], pOOBB0Y[particleIndex] ),
+                Vector2( pOOBB1X[particleIndex], pOOBB1Y[particleIndex] ),
+                Vector2( pOOBB2X[particleIndex], pOOBB2Y[particleIndex] ),
+                Vector2( pOOBB3X[particleIndex], pOOBB3Y[particleIndex] ),
                 Vector2( texLower.x, texUpper.y ),
                 Vector2( texUpper.x, texUpper.y ),
                 Vector2( texUpper.x, texLower.y ),
                 Vector2( texLower.x, texLower.y ),
                 frameTexture,
-                pParticleNode->mColor );
-
-            // Move to next Particle ( using appropriate sort-order ).
-            pParticleNode = oldestInFront ? pParticleNode->mNextNode : pParticleNode->mPreviousNode;
-        };
+                ColorF( pColorRed[particleIndex], pColorGreen[particleIndex], pColorBlue[particleIndex], pColorAlpha[particleIndex] ) );
+        }
 
         // Flush.
         pBatchRenderer->flush( getScene()->getDebugStats().batchIsolatedFlush );
@@ -877,7 +830,7 @@ void ParticlePlayer::stop( const bool waitForParticles, const bool killEffect )
 
 //------------------------------------------------------------------------------
 
-void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSystem::ParticleNode* pParticleNode )
+void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, const U32 particleIndex )
 {
     // Fetch the particle player age.
     const F32 particlePlayerAge = mAge;
@@ -885,15 +838,24 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     // Fetch the particle player position.
     const Vector2& particlePlayerPosition = getPosition();
 
-    // Default to not suppressing movement.
-    pParticleNode->mSuppressMovement = false;
-
     // Fetch particle asset.
     ParticleAsset* pParticleAsset = mParticleAsset;
 
+    // Fetch the particles.
+    ParticleStore& particles = pEmitterNode->getParticles();
+
     // Fetch the asset emitter.
     ParticleAssetEmitter* pParticleAssetEmitter = pEmitterNode->getAssetEmitter();
 
+    // The particle components.
+    // NOTE:-   Single particles don't move so they've no speed or velocity.
+    Vector2 position( 0.0f, 0.0f );
+    Vector2 velocity( 0.0f, 0.0f );
+    Vector2 size;
+    F32 speed = 0.0f;
+    F32 randomMotion = 0.0f;
+    F32 orientationAngle = 0.0f;
+
 
     // **********************************************************************************************************************
     // Calculate Particle Position.
@@ -913,11 +875,11 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
         // Determine whether to use world-space or emitter-space.
         if ( attachPositionToEmitter )
         {
-            pParticleNode->mPosition = emitterOffset;
+            position = emitterOffset;
         }
         else
         {
-            pParticleNode->mPosition = particlePlayerPosition + emitterOffset;
+            position = particlePlayerPosition + emitterOffset;
         }
     }
     else
@@ -932,12 +894,12 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 if ( attachPositionToEmitter )
                 {
                     // Yes, so transform the particle into emitter-space only.
-                    pParticleNode->mPosition = emitterOffset;
+                    position = emitterOffset;
                 }
                 else
                 {
                     // No, so transform the particle into world-space here.
-                    pParticleNode->mPosition = emitterOffset + particlePlayerPosition;
+                    position = emitterOffset + particlePlayerPosition;
                 }
 
             } break;
@@ -952,14 +914,14 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 Vector2 emissionPosition( CoreMath::mGetRandomF( -halfWidth, halfWidth ), 0.0f );
 
                 // Transform particle position in emitter-space.
-                pParticleNode->mPosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
+                position = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
 
                 // Are we attaching the position to the emitter?
                 if ( !attachPositionToEmitter )
                 {
                     // No, so transform the particle into world-space here.
                     b2Transform xform( particlePlayerPosition, b2Rot( getAngle()) );
-                    pParticleNode->mPosition = b2Mul( xform, pParticleNode->mPosition );
+                    position = b2Mul( xform, position );
                 }
 
             } break;
@@ -975,14 +937,14 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 Vector2 emissionPosition( CoreMath::mGetRandomF( -halfWidth, halfWidth ), CoreMath::mGetRandomF( -halfHeight, halfHeight ) );
 
                 // Transform particle position in emitter-space.
-                pParticleNode->mPosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
+                position = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
 
                 // Are we attaching the position to the emitter?
                 if ( !attachPositionToEmitter )
                 {
                     // No, so transform the particle into world-space here.
                     b2Transform xform( particlePlayerPosition, b2Rot( getAngle()) );
-                    pParticleNode->mPosition = b2Mul( xform, pParticleNode->mPosition );
+                    position = b2Mul( xform, position );
                 }
 
             } break;
@@ -1008,14 +970,14 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 Vector2 emissionPosition( radiusX * mCos(angle), radiusY * mSin(angle) );
 
                 // Transform particle position in emitter-space.
-                pParticleNode->mPosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
+                position = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
 
                 // Are we attaching the position to the emitter?
                 if ( !attachPositionToEmitter )
                 {
                     // No, so transform the particle into world-space here.
                     b2Transform xform( particlePlayerPosition, b2Rot( getAngle()) );
-                    pParticleNode->mPosition = b2Mul( xform, pParticleNode->mPosition );
+                    position = b2Mul( xform, position );
                 }
 
             } break;
@@ -1030,14 +992,14 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 Vector2 emissionPosition( emitterSize.x * 0.5f * mCos(angle), emitterSize.y * 0.5f * mSin(angle) );
 
                 // Transform particle position in emitter-space.
-                pParticleNode->mPosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
+                position = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
 
                 // Are we attaching the position to the emitter?
                 if ( !attachPositionToEmitter )
                 {
                     // No, so transform the particle into world-space here.
                     b2Transform xform( particlePlayerPosition, b2Rot( getAngle()) );
-                    pParticleNode->mPosition = b2Mul( xform, pParticleNode->mPosition );
+                    position = b2Mul( xform, position );
                 }
 
             } break;
@@ -1065,12 +1027,12 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 if ( attachPositionToEmitter )
                 {
                     // Yes, so transform the particle into emitter-space only.
-                    pParticleNode->mPosition = emissionPosition + emitterOffset;
+                    position = emissionPosition + emitterOffset;
                 }
                 else
                 {
                     // No, so transform the particle into world-space here.
-                    pParticleNode->mPosition = emissionPosition + emitterOffset + particlePlayerPosition;
+                    position = emissionPosition + emitterOffset + particlePlayerPosition;
                 }
 
             } break;
@@ -1084,40 +1046,36 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     // Calculate Particle Lifetime.
     // **********************************************************************************************************************
 
-    pParticleNode->mParticleAge = 0.0f;
-    pParticleNode->mParticleLifetime = ParticleAssetField::calculateFieldBVE(   pParticleAssetEmitter->getParticleLifeBaseField(),
-                                                                                pParticleAssetEmitter->getParticleLifeVariationField(),
-                                                                                pParticleAsset->getParticleLifeScaleField(),
-                                                                                particlePlayerAge );
+    const F32 lifetime = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getParticleLifeBaseField(),
+                                                                pParticleAssetEmitter->getParticleLifeVariationField(),
+                                                                pParticleAsset->getParticleLifeScaleField(),
+                                                                particlePlayerAge );
 
 
     // **********************************************************************************************************************
     // Calculate Particle Size-X.
     // **********************************************************************************************************************
 
-    pParticleNode->mSize.x = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getSizeXBaseField(),
-                                                                    pParticleAssetEmitter->getSizeXVariationField(),
-                                                                    pParticleAsset->getSizeXScaleField(),
-                                                                    particlePlayerAge ) * getSizeScale();
+    size.x = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getSizeXBaseField(),
+                                                    pParticleAssetEmitter->getSizeXVariationField(),
+                                                    pParticleAsset->getSizeXScaleField(),
+                                                    particlePlayerAge ) * getSizeScale();
 
     // Is the particle using a fixed aspect?
     if ( pParticleAssetEmitter->getFixedAspect() )
     {
         // Yes, so simply copy Size-X.
-        pParticleNode->mSize.y = pParticleNode->mSize.x;
+        size.y = size.x;
     }
     else
     {
         // No, so calculate the particle Size-Y.
-        pParticleNode->mSize.y = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getSizeYBaseField(),
-                                                                        pParticleAssetEmitter->getSizeYVariationField(),
-                                                                        pParticleAsset->getSizeYScaleField(),
-                                                                        particlePlayerAge ) * getSizeScale();
+        size.y = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getSizeYBaseField(),
+                                                        pParticleAssetEmitter->getSizeYVariationField(),
+                                                        pParticleAsset->getSizeYScaleField(),
+                                                        particlePlayerAge ) * getSizeScale();
     }
 
-    // Reset the render size.
-    pParticleNode->mRenderSize.Set(-1.0f, -1.0f);
-
 
     // **********************************************************************************************************************
     // Calculate Speed, Random Motion and Emission Angle.
@@ -1131,15 +1089,15 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     // Ignore if we're using a single-particle.
     if ( !pParticleAssetEmitter->getSingleParticle() )
     {
-        pParticleNode->mSpeed = ParticleAssetField::calculateFieldBVE(  pParticleAssetEmitter->getSpeedBaseField(),
-                                                                        pParticleAssetEmitter->getSpeedVariationField(),
-                                                                        pParticleAsset->getSpeedScaleField(),
-                                                                        particlePlayerAge ) * getForceScale();
+        speed = ParticleAssetField::calculateFieldBVE(  pParticleAssetEmitter->getSpeedBaseField(),
+                                                        pParticleAssetEmitter->getSpeedVariationField(),
+                                                        pParticleAsset->getSpeedScaleField(),
+                                                        particlePlayerAge ) * getForceScale();
 
-        pParticleNode->mRandomMotion = ParticleAssetField::calculateFieldBVE(   pParticleAssetEmitter->getRandomMotionBaseField(),
-                                                                                pParticleAssetEmitter->getRandomMotionVariationField(),
-                                                                                pParticleAsset->getRandomMotionScaleField(),
-                                                                                particlePlayerAge ) * getForceScale();
+        randomMotion = ParticleAssetField::calculateFieldBVE(   pParticleAssetEmitter->getRandomMotionBaseField(),
+                                                                pParticleAssetEmitter->getRandomMotionVariationField(),
+                                                                pParticleAsset->getRandomMotionScaleField(),
+                                                                particlePlayerAge ) * getForceScale();
 
 
         //  Calculate the emission force.
@@ -1170,7 +1128,7 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
 
         // Calculate the particle velocity.
         const F32 emissionAngleRadians = mDegToRad( emissionAngle );
-        pParticleNode->mVelocity.Set( emissionForce * mCos( emissionAngleRadians ), emissionForce * mSin( emissionAngleRadians ) );
+        velocity.Set( emissionForce * mCos( emissionAngleRadians ), emissionForce * mSin( emissionAngleRadians ) );
     }
 
 
@@ -1178,20 +1136,20 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     // Calculate Spin.
     // **********************************************************************************************************************
 
-    pParticleNode->mSpin = ParticleAssetField::calculateFieldBVE(   pParticleAssetEmitter->getSpinBaseField(),
-                                                                    pParticleAssetEmitter->getSpinVariationField(),
-                                                                    pParticleAsset->getSpinScaleField(),
-                                                                    particlePlayerAge );
+    const F32 spin = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getSpinBaseField(),
+                                                            pParticleAssetEmitter->getSpinVariationField(),
+                                                            pParticleAsset->getSpinScaleField(),
+                                                            particlePlayerAge );
 
 
     // **********************************************************************************************************************
     // Calculate Fixed-Force.
     // **********************************************************************************************************************
 
-    pParticleNode->mFixedForce = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getFixedForceBaseField(),
-                                                                        pParticleAssetEmitter->getFixedForceVariationField(),
-                                                                        pParticleAsset->getFixedForceScaleField(),
-                                                                        particlePlayerAge ) * getForceScale();
+    const F32 fixedForce = ParticleAssetField::calculateFieldBVE(   pParticleAssetEmitter->getFixedForceBaseField(),
+                                                                    pParticleAssetEmitter->getFixedForceVariationField(),
+                                                                    pParticleAsset->getFixedForceScaleField(),
+                                                                    particlePlayerAge ) * getForceScale();
 
 
     // **********************************************************************************************************************
@@ -1205,7 +1163,7 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
         case ParticleAssetEmitter::ALIGNED_ORIENTATION:
         {
             // Use the emission angle with fixed offset.
-            pParticleNode->mOrientationAngle = mFmod( emissionAngle - pParticleAssetEmitter->getAlignedAngleOffset(), 360.0f );
+            orientationAngle = mFmod( emissionAngle - pParticleAssetEmitter->getAlignedAngleOffset(), 360.0f );
 
         } break;
 
@@ -1213,7 +1171,7 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
         case ParticleAssetEmitter::FIXED_ORIENTATION:
         {
             // Use a fixed angle.
-            pParticleNode->mOrientationAngle = mFmod( pParticleAssetEmitter->getFixedAngleOffset(), 360.0f );
+            orientationAngle = mFmod( pParticleAssetEmitter->getFixedAngleOffset(), 360.0f );
 
         } break;
 
@@ -1222,7 +1180,7 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
         {
             // Used a random angle/arc.
             const F32 randomArc = pParticleAssetEmitter->getRandomArc() * 0.5f;
-            pParticleNode->mOrientationAngle = mFmod( CoreMath::mGetRandomF( pParticleAssetEmitter->getRandomAngleOffset() - randomArc, pParticleAssetEmitter->getRandomAngleOffset() + randomArc ), 360.0f );
+            orientationAngle = mFmod( CoreMath::mGetRandomF( pParticleAssetEmitter->getRandomAngleOffset() - randomArc, pParticleAssetEmitter->getRandomAngleOffset() + randomArc ), 360.0f );
 
         } break;
         
@@ -1242,10 +1200,10 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     const ParticleAssetField& alphaChannelScale = pParticleAsset->getAlphaChannelScaleField();
 
     // Calculate the color.
-    pParticleNode->mColor.set(  mClampF( redChannel.getFieldValue( 0.0f ), redChannel.getMinValue(), redChannel.getMaxValue() ),
-                                mClampF( greenChannel.getFieldValue( 0.0f ),greenChannel.getMinValue(), greenChannel.getMaxValue() ),
-                                mClampF( blueChannel.getFieldValue( 0.0f ), blueChannel.getMinValue(),blueChannel.getMaxValue() ),
-                                mClampF( alphaChannel.getFieldValue( 0.0f ) * alphaChannelScale.getFieldValue( 0.0f ), alphaChannel.getMinValue(), alphaChannel.getMaxValue() ) );
+    const ColorF color( mClampF( redChannel.getFieldValue( 0.0f ), redChannel.getMinValue(), redChannel.getMaxValue() ),
+                        mClampF( greenChannel.getFieldValue( 0.0f ),greenChannel.getMinValue(), greenChannel.getMaxValue() ),
+                        mClampF( blueChannel.getFieldValue( 0.0f ), blueChannel.getMinValue(),blueChannel.getMaxValue() ),
+                        mClampF( alphaChannel.getFieldValue( 0.0f ) * alphaChannelScale.getFieldValue( 0.0f ), alphaChannel.getMinValue(), alphaChannel.getMaxValue() ) );
 
 
     // **********************************************************************************************************************
@@ -1253,7 +1211,7 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     // **********************************************************************************************************************
 
     // Fetch the image frame provider.
-    ImageFrameProviderCore& frameProvider = pParticleNode->mFrameProvider;
+    ImageFrameProviderCore& frameProvider = *particles.getFrameProvider( particleIndex );
 
     // Allocate assets to the particle.
     frameProvider.allocateAssets( &(pParticleAssetEmitter->getImageAsset()), &(pParticleAssetEmitter->getAnimationAsset()) );
@@ -1290,21 +1248,97 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
 
 
     // **********************************************************************************************************************
-    // Reset Tick Position.
+    // Store the Particle.
     // **********************************************************************************************************************
-    pParticleNode->mPreTickPosition = pParticleNode->mPostTickPosition = pParticleNode->mRenderTickPosition = pParticleNode->mPosition;
+
+    particles.getStream( ParticleStore::AGE )[particleIndex] = 0.0f;
+    particles.getStream( ParticleStore::LIFETIME )[particleIndex] = lifetime;
+    particles.getStream( ParticleStore::POSITION_X )[particleIndex] = position.x;
+    particles.getStream( ParticleStore::POSITION_Y )[particleIndex] = position.y;
+    particles.getStream( ParticleStore::VELOCITY_X )[particleIndex] = velocity.x;
+    particles.getStream( ParticleStore::VELOCITY_Y )[particleIndex] = velocity.y;
+    particles.getStream( ParticleStore::SIZE_X )[particleIndex] = size.x;
+    particles.getStream( ParticleStore::SIZE_Y )[particleIndex] = size.y;
+    particles.getStream( ParticleStore::SPEED )[particleIndex] = speed;
+    particles.getStream( ParticleStore::RANDOM_MOTION )[particleIndex] = randomMotion;
+    particles.getStream( ParticleStore::SPIN )[particleIndex] = spin;
+    particles.getStream( ParticleStore::FIXED_FORCE )[particleIndex] = fixedForce;
+    particles.getStream( ParticleStore::ORIENTATION )[particleIndex] = orientationAngle;
+    particles.getStream( ParticleStore::COLOR_RED )[particleIndex] = color.red;
+    particles.getStream( ParticleStore::COLOR_GREEN )[particleIndex] = color.green;
+    particles.getStream( ParticleStore::COLOR_BLUE )[particleIndex] = color.blue;
+    particles.getStream( ParticleStore::COLOR_ALPHA )[particleIndex] = color.alpha;
 
 
     // **********************************************************************************************************************
-    // Do a Single Particle Integration to get things going.
+    // Reset Tick Position.
     // **********************************************************************************************************************
-    integrateParticle( pEmitterNode, pParticleNode, 0.0f, 0.0f );
+    particles.getStream( ParticleStore::PRE_TICK_X )[particleIndex] = position.x;
+    particles.getStream( ParticleStore::PRE_TICK_Y )[particleIndex] = position.y;
+    particles.getStream( ParticleStore::POST_TICK_X )[particleIndex] = position.x;
+    particles.getStream( ParticleStore::POST_TICK_Y )[particleIndex] = position.y;
+    particles.getStream( ParticleStore::RENDER_TICK_X )[particleIndex] = position.x;
+    particles.getStream( ParticleStore::RENDER_TICK_Y )[particleIndex] = position.y;
+}
+
+//------------------------------------------------------------------------------
+
+static void scaleParticleStream( ParticleStore& particles, const U32 startIndex, const ParticleStore::Stream baseStream, const ParticleStore::Stream renderStream, const ParticleAssetField& lifeField, const ParticleAssetField& baseField )
+{
+    // Fetch the streams.
+    const F32* pLife = particles.getStream( ParticleStore::LIFE );
+    const F32* pBase = particles.getStream( baseStream );
+    F32* pRender = particles.getStream( renderStream );
+
+    // Fetch the limits.
+    const F32 minValue = baseField.getMinValue();
+    const F32 maxValue = baseField.getMaxValue();
+
+    // Scale the base value by the life field.
+    const U32 particleCount = particles.size();
+    for ( U32 index = startIndex; index < particleCount; ++index )
+    {
+        pRender[index] = mClampF( pBase[index] * lifeField.getFieldValue( pLife[index] ), minValue, maxValue );
+    }
+}
+
+//------------------------------------------------------------------------------
+
+static void calculateParticleChannel( ParticleStore& particles, const U32 startIndex, const ParticleStore::Stream channelStream, const ParticleAssetField& channelField, const F32 channelScale )
+{
+    // Fetch the streams.
+    const F32* pLife = particles.getStream( ParticleStore::LIFE );
+    F32* pChannel = particles.getStream( channelStream );
+
+    // Fetch the limits.
+    const F32 minValue = channelField.getMinValue();
+    const F32 maxValue = channelField.getMaxValue();
+
+    // Calculate the channel.
+    const U32 particleCount = particles.size();
+    for ( U32 index = startIndex; index < particleCount; ++index )
+    {
+        pChannel[index] = mClampF( channelField.getFieldValue( pLife[index] ) * channelScale, minValue, maxValue );
+    }
 }
 
 //------------------------------------------------------------------------------
 
-void ParticlePlayer::integrateParticle( EmitterNode* pEmitterNode, ParticleSystem::ParticleNode* pParticleNode, F32 particleAge, F32 elapsedTime )
+void ParticlePlayer::integrateParticles( EmitterNode* pEmitterNode, const U32 startIndex, const F32 elapsedTime )
 {
+    // Debug Profiling.
+    PROFILE_SCOPE(ParticlePlayer_IntegrateParticles);
+
+    // Fetch the particles.
+    ParticleStore& particles = pEmitterNode->getParticles();
+
+    // Fetch the particle count.
+    const U32 particleCount = particles.size();
+
+    // Finish if there's nothing to integrate.
+    if ( startIndex >= particleCount )
+        return;
+
     // Fetch particle asset.
     ParticleAsset* pParticleAsset = mParticleAsset;
 
@@ -1315,7 +1349,13 @@ void ParticlePlayer::integrateParticle( EmitterNode* pEmitterNode, ParticleSyste
     // **********************************************************************************************************************
     // Copy Old Tick Position.
     // **********************************************************************************************************************
-    pParticleNode->mRenderTickPosition = pParticleNode->mPreTickPosition = pParticleNode->mPostTickPosition;
+    particles.beginTick( startIndex );
+
+
+    // **********************************************************************************************************************
+    // Calculate the Particle Life.
+    // **********************************************************************************************************************
+    particles.updateLife( startIndex );
 
 
     // **********************************************************************************************************************
@@ -1323,77 +1363,48 @@ void ParticlePlayer::integrateParticle( EmitterNode* pEmitterNode, ParticleSyste
     // **********************************************************************************************************************
 
     // Scale Size-X.
-    pParticleNode->mRenderSize.x = mClampF( pParticleNode->mSize.x * pParticleAssetEmitter->getSizeXLifeField().getFieldValue( particleAge ),
-                                            pParticleAssetEmitter->getSizeXBaseField().getMinValue(),
-                                            pParticleAssetEmitter->getSizeXBaseField().getMaxValue());
+    scaleParticleStream( particles, startIndex, ParticleStore::SIZE_X, ParticleStore::RENDER_SIZE_X, pParticleAssetEmitter->getSizeXLifeField(), pParticleAssetEmitter->getSizeXBaseField() );
 
     // Is the particle using a fixed aspect?
     if ( pParticleAssetEmitter->getFixedAspect() )
     {
         // Yes, so simply copy Size-X.
-        pParticleNode->mRenderSize.y = pParticleNode->mRenderSize.x;
+        dMemcpy( particles.getStream( ParticleStore::RENDER_SIZE_Y ) + startIndex, particles.getStream( ParticleStore::RENDER_SIZE_X ) + startIndex, (particleCount - startIndex) * sizeof(F32) );
     }
     else
     {
         // No, so Scale Size-Y.
-        pParticleNode->mRenderSize.y = mClampF( pParticleNode->mSize.y * pParticleAssetEmitter->getSizeYLifeField().getFieldValue( particleAge ),
-                                                pParticleAssetEmitter->getSizeYBaseField().getMinValue(),
-                                                pParticleAssetEmitter->getSizeYBaseField().getMaxValue() );
+        scaleParticleStream( particles, startIndex, ParticleStore::SIZE_Y, ParticleStore::RENDER_SIZE_Y, pParticleAssetEmitter->getSizeYLifeField(), pParticleAssetEmitter->getSizeYBaseField() );
     }
 
 
     // **********************************************************************************************************************
-    // Scale Speed.
-    // **********************************************************************************************************************
-    pParticleNode->mRenderSpeed = mClampF(  pParticleNode->mSpeed * pParticleAssetEmitter->getSpeedLifeField().getFieldValue( particleAge ),
-                                            pParticleAssetEmitter->getSpeedBaseField().getMinValue(),
-                                            pParticleAssetEmitter->getSpeedBaseField().getMaxValue() );
-
-
-    // **********************************************************************************************************************
-    // Scale Fixed-Force.
-    // **********************************************************************************************************************
-    pParticleNode->mRenderFixedForce = mClampF( pParticleNode->mFixedForce * pParticleAssetEmitter->getFixedForceLifeField().getFieldValue( particleAge ),
-                                                pParticleAssetEmitter->getFixedForceBaseField().getMinValue(),
-                                                pParticleAssetEmitter->getFixedForceBaseField().getMaxValue() );
-
-
-    // **********************************************************************************************************************
-    // Scale Random-Motion.
+    // Scale Speed, Fixed-Force and Random-Motion.
     // **********************************************************************************************************************
-    pParticleNode->mRenderRandomMotion = mClampF(   pParticleNode->mRandomMotion * pParticleAssetEmitter->getRandomMotionLifeField().getFieldValue( particleAge ),
-                                                    pParticleAssetEmitter->getRandomMotionBaseField().getMinValue(),
-                                                    pParticleAssetEmitter->getRandomMotionBaseField().getMaxValue() );
+    scaleParticleStream( particles, startIndex, ParticleStore::SPEED, ParticleStore::RENDER_SPEED, pParticleAssetEmitter->getSpeedLifeField(), pParticleAssetEmitter->getSpeedBaseField() );
+    scaleParticleStream( particles, startIndex, ParticleStore::FIXED_FORCE, ParticleStore::RENDER_FIXED_FORCE, pParticleAssetEmitter->getFixedForceLifeField(), pParticleAssetEmitter->getFixedForceBaseField() );
+    scaleParticleStream( particles, startIndex, ParticleStore::RANDOM_MOTION, ParticleStore::RENDER_RANDOM_MOTION, pParticleAssetEmitter->getRandomMotionLifeField(), pParticleAssetEmitter->getRandomMotionBaseField() );
 
 
     // **********************************************************************************************************************
     // Calculate RGBA Components.
     // **********************************************************************************************************************
-
-    // Fetch the channels.
-    const ParticleAssetField& redChannel = pParticleAssetEmitter->getRedChannelLifeField();
-    const ParticleAssetField& greenChannel = pParticleAssetEmitter->getGreenChannelLifeField();
-    const ParticleAssetField& blueChannel = pParticleAssetEmitter->getBlueChannelLifeField();
-    const ParticleAssetField& alphaChannel = pParticleAssetEmitter->getAlphaChannelLifeField();
-    const ParticleAssetField& alphaChannelScale = pParticleAsset->getAlphaChannelScaleField();
-
-    // Calculate the color.
-    pParticleNode->mColor.set(  mClampF( redChannel.getFieldValue( particleAge ), redChannel.getMinValue(), redChannel.getMaxValue() ),
-                                mClampF( greenChannel.getFieldValue( particleAge ),greenChannel.getMinValue(), greenChannel.getMaxValue() ),
-                                mClampF( blueChannel.getFieldValue( particleAge ), blueChannel.getMinValue(),blueChannel.getMaxValue() ),
-                                mClampF( alphaChannel.getFieldValue( particleAge ) * alphaChannelScale.getFieldValue( 0.0f ), alphaChannel.getMinValue(), alphaChannel.getMaxValue() ) );
+    calculateParticleChannel( particles, startIndex, ParticleStore::COLOR_RED, pParticleAssetEmitter->getRedChannelLifeField(), 1.0f );
+    calculateParticleChannel( particles, startIndex, ParticleStore::COLOR_GREEN, pParticleAssetEmitter->getGreenChannelLifeField(), 1.0f );
+    calculateParticleChannel( particles, startIndex, ParticleStore::COLOR_BLUE, pParticleAssetEmitter->getBlueChannelLifeField(), 1.0f );
+    calculateParticleChannel( particles, startIndex, ParticleStore::COLOR_ALPHA, pParticleAssetEmitter->getAlphaChannelLifeField(), pParticleAsset->getAlphaChannelScaleField().getFieldValue( 0.0f ) );
 
 
     // **********************************************************************************************************************
     // Integrate Particle.
     // **********************************************************************************************************************
 
-
     // Is the emitter in static mode?
     if ( !pParticleAssetEmitter->isStaticFrameProvider() )
     {
         // No, so update animation.
-        pParticleNode->mFrameProvider.updateAnimation( elapsedTime );
+        for ( U32 index = startIndex; index < particleCount; ++index )
+            particles.getFrameProvider( index )->updateAnimation( elapsedTime );
     }
 
 
@@ -1404,29 +1415,27 @@ void ParticlePlayer::integrateParticle( EmitterNode* pEmitterNode, ParticleSyste
     // Calculate the velocity if not a single particle.
     if ( !pParticleAssetEmitter->getSingleParticle() )
     {
-        // Calculate random motion (if we've got any).
-        if ( mNotZero( pParticleNode->mRenderRandomMotion ) )
-        {
-            // Fetch random motion.
-            const F32 randomMotion = pParticleNode->mRenderRandomMotion * 0.5f;
-
-            // Add time-integrated random motion into velocity.
-            pParticleNode->mVelocity += Vector2( CoreMath::mGetRandomF(-randomMotion, randomMotion) * elapsedTime, CoreMath::mGetRandomF(-randomMotion, randomMotion) * elapsedTime );
-        }
+        // Fetch the streams.
+        const F32* pRenderRandomMotion = particles.getStream( ParticleStore::RENDER_RANDOM_MOTION );
+        F32* pVelocityX = particles.getStream( ParticleStore::VELOCITY_X );
+        F32* pVelocityY = particles.getStream( ParticleStore::VELOCITY_Y );
 
-        // Do we have any fixed force?
-        if ( mNotZero( pParticleNode->mRenderFixedForce ) )
+        for ( U32 index = startIndex; index < particleCount; ++index )
         {
-            // Yes, so time-integrate a fixed force to the velocity.
-            pParticleNode->mVelocity += (pParticleAssetEmitter->getFixedForceDirection() * (pParticleNode->mRenderFixedForce * getForceScale()) * elapsedTime);
-        }
+            // Calculate random motion (if we've got any).
+            if ( mNotZero( pRenderRandomMotion[index] ) )
+            {
+                // Fetch random motion.
+                const F32 randomMotion = pRenderRandomMotion[index] * 0.5f;
 
-        // Are we suppressing movement?
-        if ( !pParticleNode->mSuppressMovement )
-        {
-            // No, so adjust particle position.
-            pParticleNode->mPosition += (pParticleNode->mVelocity * pParticleNode->mRenderSpeed * elapsedTime);
+                // Add time-integrated random motion into velocity.
+                pVelocityX[index] += CoreMath::mGetRandomF(-randomMotion, randomMotion) * elapsedTime;
+                pVelocityY[index] += CoreMath::mGetRandomF(-randomMotion, randomMotion) * elapsedTime;
+            }
         }
+
+        // Time-integrate the fixed force to the velocity and adjust the particle positions.
+        particles.integrateMotion( startIndex, pParticleAssetEmitter->getFixedForceDirection() * getForceScale(), elapsedTime );
     }
 
 
@@ -1435,60 +1444,59 @@ void ParticlePlayer::integrateParticle( EmitterNode* pEmitterNode, ParticleSyste
     // **********************************************************************************************************************
     if ( pParticleAssetEmitter->getKeepAligned() && pParticleAssetEmitter->getOrientationType() == ParticleAssetEmitter::ALIGNED_ORIENTATION )
     {
-        // Yes, so calculate last movement direction.
-        F32 movementAngle = mRadToDeg( mAtan( pParticleNode->mVelocity.x, pParticleNode->mVelocity.y ) );
+        // Fetch the streams.
+        const F32* pVelocityX = particles.getStream( ParticleStore::VELOCITY_X );
+        const F32* pVelocityY = particles.getStream( ParticleStore::VELOCITY_Y );
+        F32* pOrientation = particles.getStream( ParticleStore::ORIENTATION );
+
+        // Fetch the aligned angle offset.
+        const F32 alignedAngleOffset = pParticleAssetEmitter->getAlignedAngleOffset();
 
-        // Adjust for negative ArcTan quadrants.
-        if ( movementAngle < 0.0f )
-            movementAngle += 360.0f;
+        for ( U32 index = startIndex; index < particleCount; ++index )
+        {
+            // Yes, so calculate last movement direction.
+            F32 movementAngle = mRadToDeg( mAtan( pVelocityX[index], pVelocityY[index] ) );
 
-        // Set new Orientation Angle.
-        pParticleNode->mOrientationAngle = movementAngle - pParticleAssetEmitter->getAlignedAngleOffset();
+            // Adjust for negative ArcTan quadrants.
+            if ( movementAngle < 0.0f )
+                movementAngle += 360.0f;
 
+            // Set new Orientation Angle.
+            pOrientation[index] = movementAngle - alignedAngleOffset;
+        }
     }
     else
     {
         // No, so calculate the render spin.
-        pParticleNode->mRenderSpin = pParticleNode->mSpin * pParticleAssetEmitter->getSpinLifeField().getFieldValue( particleAge );
+        const F32* pLife = particles.getStream( ParticleStore::LIFE );
+        const F32* pSpin = particles.getStream( ParticleStore::SPIN );
+        F32* pRenderSpin = particles.getStream( ParticleStore::RENDER_SPIN );
+        const ParticleAssetField& spinLifeField = pParticleAssetEmitter->getSpinLifeField();
 
-        // Have we got some Spin?
-        if ( mNotZero(pParticleNode->mRenderSpin) )
-        {
-            // Yes, so add into Orientation.
-            pParticleNode->mOrientationAngle += pParticleNode->mRenderSpin * elapsedTime;
+        for ( U32 index = startIndex; index < particleCount; ++index )
+            pRenderSpin[index] = pSpin[index] * spinLifeField.getFieldValue( pLife[index] );
 
-            // Clamp the orientation angle.
-            pParticleNode->mOrientationAngle = mFmod( pParticleNode->mOrientationAngle, 360.0f );
-        }
+        // Add any spin into the orientation.
+        particles.integrateSpin( startIndex, elapsedTime );
     }
 
-    // Calculate the transform.
-    pParticleNode->mTransform.Set( pParticleNode->mPosition, mDegToRad(pParticleNode->mOrientationAngle) );
+    // Calculate the rotations.
+    particles.updateRotation( startIndex );
 
     // Fetch the local AABB..
-    const Vector2& localAABB0 = pParticleAssetEmitter->getLocalPivotAABB0();
-    const Vector2& localAABB1 = pParticleAssetEmitter->getLocalPivotAABB1();
-    const Vector2& localAABB2 = pParticleAssetEmitter->getLocalPivotAABB2();
-    const Vector2& localAABB3 = pParticleAssetEmitter->getLocalPivotAABB3();
-
-    // Fetch the render size.
-    const Vector2& renderSize = pParticleNode->mRenderSize;
-
-    // Calculate the scaled AABB.
-    Vector2 scaledAABB[4];
-    scaledAABB[0] = localAABB0 * renderSize;
-    scaledAABB[1] = localAABB1 * renderSize;
-    scaledAABB[2] = localAABB2 * renderSize;
-    scaledAABB[3] = localAABB3 * renderSize;
+    const Vector2 localAABB[4] = {  pParticleAssetEmitter->getLocalPivotAABB0(),
+                                    pParticleAssetEmitter->getLocalPivotAABB1(),
+                                    pParticleAssetEmitter->getLocalPivotAABB2(),
+                                    pParticleAssetEmitter->getLocalPivotAABB3() };
 
-    // Calculate the world OOBB..
-    CoreMath::mCalculateOOBB( scaledAABB, pParticleNode->mTransform, pParticleNode->mRenderOOBB );
+    // Calculate the world OOBBs.
+    particles.calculateOOBB( startIndex, localAABB, false );
 
 
     // **********************************************************************************************************************
     // Set Post Tick Position.
     // **********************************************************************************************************************
-    pParticleNode->mPostTickPosition = pParticleNode->mPosition;
+    particles.endTick( startIndex );
 }
 
 //-----------------------------------------------------------------------------
@@ -31,6 +31,10 @@
 #include "2d/core/ParticleSystem.h"
 #endif
 
+#ifndef _PARTICLE_STORE_H_
+#include "2d/core/ParticleStore.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
 #define PARTICLE_PLAYER_EMISSION_RATE_SCALE     "$pref::T2D::ParticlePlayerEmissionRateScale"
@@ -51,7 +55,7 @@ private:
     private:
         ParticlePlayer*                 mOwner;
         ParticleAssetEmitter*           mpAssetEmitter;
-        ParticleSystem::ParticleNode    mParticleNodeHead;
+        ParticleStore                   mParticles;
         F32                             mTimeSinceLastGeneration;
         bool                            mPaused;
         bool                            mVisible;
@@ -77,9 +81,6 @@ private:
 
             // Reset time since last generation.
             mTimeSinceLastGeneration = 0.0f;
-
-            // Reset the node head.
-            mParticleNodeHead.mNextNode = mParticleNodeHead.mPreviousNode = &mParticleNodeHead;
         }
 
         ~EmitterNode()
@@ -90,11 +91,11 @@ private:
         inline ParticlePlayer* getOwner( void ) const { return mOwner; }
         inline ParticleAssetEmitter* getAssetEmitter( void ) const { return mpAssetEmitter; }
 
-        inline bool getActiveParticles( void ) const { return mParticleNodeHead.mNextNode != &mParticleNodeHead; }
+        inline bool getActiveParticles( void ) const { return !mParticles.isEmpty(); }
 
-        inline ParticleSystem::ParticleNode* getFirstParticle( void ) const { return mParticleNodeHead.mNextNode; }
-        inline ParticleSystem::ParticleNode* getLastParticle( void ) const { return mParticleNodeHead.mPreviousNode; }
-        inline ParticleSystem::ParticleNode* getParticleNodeHead( void ) { return &mParticleNodeHead; }
+        /// The particles are held in creation order (oldest first).
+        inline ParticleStore& getParticles( void ) { return mParticles; }
+        inline const ParticleStore& getParticles( void ) const { return mParticles; }
 
         inline void setTimeSinceLastGeneration( const F32 timeSinceLastGeneration ) { mTimeSinceLastGeneration = timeSinceLastGeneration; }
         inline F32 getTimeSinceLastGeneration( void ) const { return mTimeSinceLastGeneration; }
@@ -105,8 +106,7 @@ private:
         inline void setVisible( const bool visible ) { mVisible = visible; }
         inline bool getVisible( void ) const { return mVisible; }
 
-        ParticleSystem::ParticleNode* createParticle( void );
-        void freeParticle( ParticleSystem::ParticleNode* pParticleNode );
+        void createParticles( const U32 particleCount );
         void freeAllParticles( void );        
     };
 
@@ -192,8 +192,8 @@ protected:
     virtual void onAssetRefreshed( AssetPtrBase* pAssetPtrBase );
 
     /// Particle Creation/Integration.
-    void configureParticle( EmitterNode* pEmitterNode, ParticleSystem::ParticleNode* pParticleNode );
-    void integrateParticle( EmitterNode* pEmitterNode, ParticleSystem::ParticleNode* pParticleNode, const F32 particleAge, const F32 elapsedTime );
+    void configureParticle( EmitterNode* pEmitterNode, const U32 particleIndex );
+    void integrateParticles( EmitterNode* pEmitterNode, const U32 startIndex, const F32 elapsedTime );
 
     /// Persistence.
     virtual void onTamlAddParent( SimObject* pParentObject );
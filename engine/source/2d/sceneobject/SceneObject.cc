@@ -192,6 +192,16 @@ SceneObject::SceneObject() :
     mBeingSafeDeleted(false),
     mSafeDeleteReady(true),
 
+    /// Scene tick-set membership.
+    mTickedIndex(-1),
+    mTickedPending(false),
+
+    /// Parallel integration.
+    mIntegratingInParallel(false),
+    mDeferredWorldProxyUpdate(false),
+    mDeferredTickDisplacement(0.0f, 0.0f),
+    mDeferredCallbackCount(0),
+
     /// Miscellaneous.
     mBatchIsolated(false),
     mSerialiseKey(0),
@@ -316,7 +326,7 @@ void SceneObject::initPersistFields()
     addProtectedField("GravityScale", TypeF32, NULL, &setGravityScale, &getGravityScale, &writeGravityScale, "");
 
     /// Render visibility.
-    addField("Visible", TypeBool, Offset(mVisible, SceneObject), &writeVisible, "");
+    addProtectedField("Visible", TypeBool, Offset(mVisible, SceneObject), &setVisible, &defaultProtectedGetFn, &writeVisible, "");
 
     /// Render blending.
     addField("BlendMode", TypeBool, Offset(mBlendMode, SceneObject), &writeBlendMode, "");
@@ -610,8 +620,19 @@ void SceneObject::integrateObject( const F32 totalTime, const F32 elapsedTime, D
         // Calculate tick displacement.
         b2Vec2 tickDisplacement = position - mPreTickPosition;
             
-        // Update world proxy.
-        mpScene->getWorldQuery()->update( this, tickAABB, tickDisplacement );
+        // Are we integrating in parallel?
+        if ( mIntegratingInParallel )
+        {
+            // Yes, so defer the world proxy update as the world query is not thread-safe.
+            mDeferredWorldProxyUpdate = true;
+            mDeferredTickAABB = tickAABB;
+            mDeferredTickDisplacement = tickDisplacement;
+        }
+        else
+        {
+            // No, so update world proxy.
+            mpScene->getWorldQuery()->update( this, tickAABB, tickDisplacement );
+        }
 
         //have we arrived at the target position?
         if (mTargetPositionActive)
@@ -648,6 +669,85 @@ void SceneObject::integrateObject( const F32 totalTime, const F32 elapsedTime, D
 
 //-----------------------------------------------------------------------------
 
+bool SceneObject::getCanIntegrateInParallel( void ) const
+{
+    // The class must be flagged as having a thread-safe integration.
+    if ( !getIsIntegrateThreadSafe() )
+        return false;
+
+    // Lifetime, target position and attachments all touch shared state during integration.
+    return  !mLifetimeActive &&
+            !mTargetPositionActive &&
+            mpAttachedCamera == NULL &&
+            mpAttachedGui == NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneObject::postIntegrateCallback( const char* pCallbackName )
+{
+    // Perform the callback immediately if not integrating in parallel.
+    if ( !mIntegratingInParallel )
+    {
+        Con::executef( this, 1, pCallbackName );
+        return;
+    }
+
+    // Sanity!
+    AssertFatal( mDeferredCallbackCount < MAX_DEFERRED_INTEGRATE_CALLBACKS, "SceneObject::postIntegrateCallback() - Too many deferred callbacks." );
+
+    // Defer the callback until the integration is committed on the main thread.
+    // NOTE:    The callback name must be a string literal or StringTable entry.
+    if ( mDeferredCallbackCount < MAX_DEFERRED_INTEGRATE_CALLBACKS )
+        mDeferredCallbacks[mDeferredCallbackCount++] = pCallbackName;
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneObject::commitParallelIntegrate( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneObject_CommitParallelIntegrate);
+
+    // Finished integrating in parallel.
+    mIntegratingInParallel = false;
+
+    // Update the world proxy if it was deferred.
+    if ( mDeferredWorldProxyUpdate )
+    {
+        mDeferredWorldProxyUpdate = false;
+        mpScene->getWorldQuery()->update( this, mDeferredTickAABB, mDeferredTickDisplacement );
+    }
+
+    // Finish if no deferred callbacks.
+    if ( mDeferredCallbackCount == 0 )
+        return;
+
+    // Fetch the deferred callbacks.
+    // NOTE:    The callbacks are copied as they can cause further callbacks to be posted.
+    const char* deferredCallbacks[MAX_DEFERRED_INTEGRATE_CALLBACKS];
+    const U32 deferredCallbackCount = mDeferredCallbackCount;
+    for ( U32 index = 0; index < deferredCallbackCount; ++index )
+        deferredCallbacks[index] = mDeferredCallbacks[index];
+    mDeferredCallbackCount = 0;
+
+    // Perform the deferred callbacks.
+    for ( U32 index = 0; index < deferredCallbackCount; ++index )
+        Con::executef( this, 1, deferredCallbacks[index] );
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneObject::cancelParallelIntegrate( void )
+{
+    // Discard any deferred integration.
+    mIntegratingInParallel = false;
+    mDeferredWorldProxyUpdate = false;
+    mDeferredCallbackCount = 0;
+}
+
+//-----------------------------------------------------------------------------
+
 void SceneObject::postIntegrate(const F32 totalTime, const F32 elapsedTime, DebugStats *pDebugStats)
 {
     // Debug Profiling.
@@ -884,6 +984,9 @@ void SceneObject::unpackUpdate(NetConnection * conn, BitStream *stream)
 
 void SceneObject::setEnabled( const bool enabled )
 {
+    // Fetch the current enabled state.
+    const bool wasEnabled = isEnabled();
+
     // Call parent.
     Parent::setEnabled( enabled );
 
@@ -891,11 +994,30 @@ void SceneObject::setEnabled( const bool enabled )
     if ( mpScene )
     {
         mpBody->SetActive( enabled );
+
+        // Notify the scene if the enabled state changed.
+        if ( isEnabled() != wasEnabled )
+            mpScene->onSceneObjectEnabledChanged( this );
     }
 }
 
 //-----------------------------------------------------------------------------
 
+void SceneObject::setVisible( const bool status )
+{
+    // Ignore no change.
+    if ( status == mVisible )
+        return;
+
+    mVisible = status;
+
+    // Notify the scene.
+    if ( mpScene )
+        mpScene->onSceneObjectVisibleChanged( this );
+}
+
+//-----------------------------------------------------------------------------
+
 void SceneObject::setLifetime( const F32 lifetime )
 {
     // Debug Profiling.
@@ -955,6 +1077,10 @@ void SceneObject::setSceneLayer( const U32 sceneLayer )
 
     // Set Layer Mask.
     mSceneLayerMask = BIT( mSceneLayer );
+
+    // The cached visible objects are layered.
+    if ( mpScene )
+        mpScene->invalidateVisibilityCache();
 }
 
 //-----------------------------------------------------------------------------
@@ -1181,6 +1307,10 @@ void SceneObject::setSceneGroup( const U32 sceneGroup )
 
     // Set Group Mask.
     mSceneGroupMask = BIT( mSceneGroup );
+
+    // The cached visible objects are filtered by group.
+    if ( mpScene )
+        mpScene->invalidateVisibilityCache();
 }
 
 //-----------------------------------------------------------------------------
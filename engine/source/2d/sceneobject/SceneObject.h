@@ -85,6 +85,7 @@ typedef Vector<tDestroyNotification> typeDestroyNotificationVector;
 
 const S32 GL_INVALID_BLEND_FACTOR = -1;
 const S32 INVALID_COLLISION_SHAPE_INDEX = -1;
+const U32 MAX_DEFERRED_INTEGRATE_CALLBACKS = 4;
 
 //-----------------------------------------------------------------------------
 
@@ -227,6 +228,18 @@ protected:
     bool                    mBeingSafeDeleted;
     bool                    mSafeDeleteReady;
 
+    /// Scene tick-set membership.
+    S32                     mTickedIndex;
+    bool                    mTickedPending;
+
+    /// Parallel integration.
+    bool                    mIntegratingInParallel;
+    bool                    mDeferredWorldProxyUpdate;
+    b2AABB                  mDeferredTickAABB;
+    b2Vec2                  mDeferredTickDisplacement;
+    const char*             mDeferredCallbacks[MAX_DEFERRED_INTEGRATE_CALLBACKS];
+    U32                     mDeferredCallbackCount;
+
     /// Destroy notifications.
     typeDestroyNotificationVector mDestroyNotifyList;
 
@@ -279,6 +292,15 @@ public:
     virtual void            interpolateObject( const F32 timeDelta );
     inline bool             getIsEditorTickAllowed( void ) const { return mEditorTickAllowed; }
 
+    /// Parallel integration.
+    virtual bool            getIsIntegrateThreadSafe( void ) const { return false; }
+    bool                    getCanIntegrateInParallel( void ) const;
+    inline void             setIsIntegratingInParallel( const bool status ) { mIntegratingInParallel = status; }
+    inline bool             getIsIntegratingInParallel( void ) const { return mIntegratingInParallel; }
+    void                    postIntegrateCallback( const char* pCallbackName );
+    void                    commitParallelIntegrate( void );
+    void                    cancelParallelIntegrate( void );
+
     /// Render batching.
     inline void             setBatchIsolated( const bool batchIsolated ) { mBatchIsolated = batchIsolated; }
     virtual bool            getBatchIsolated( void ) { return mBatchIsolated; }
@@ -513,7 +535,7 @@ public:
     Vector2                 getEdgeCollisionShapeAdjacentEnd( const U32 shapeIndex ) const;
 
     /// Render visibility.
-    inline void             setVisible( const bool status )             { mVisible = status; }
+    void                    setVisible( const bool status );
     inline bool             getVisible(void) const                      { return mVisible; }
 
     /// Render blending.
@@ -727,6 +749,7 @@ protected:
     static bool             writeGravityScale( void* obj, StringTableEntry pFieldName ) { return mNotEqual(static_cast<SceneObject*>(obj)->getGravityScale(), 1.0f); }
 
     /// Render visibility.
+    static bool             setVisible(void* obj, const char* data)         { static_cast<SceneObject*>(obj)->setVisible(dAtob(data)); return false; }
     static bool             writeVisible( void* obj, StringTableEntry pFieldName ) { return static_cast<SceneObject*>(obj)->getVisible() == false; }
 
     /// Render blending.
@@ -94,6 +94,9 @@ public:
     virtual bool validRender( void ) const { return (mPolygonLocalList.size() > 0 || mIsCircle); }
     virtual bool shouldRender( void ) const { return true; }
 
+    /// Integration.
+    virtual bool getIsIntegrateThreadSafe( void ) const { return true; }
+
     /// Render batching.
     virtual bool isBatchRendered( void ) { return false; }
 
@@ -46,13 +46,13 @@ IMPLEMENT_CONOBJECT(SkeletonObject);
 
 //------------------------------------------------------------------------------
 
-SkeletonObject::SkeletonObject() :  mPreTickTime( 0.0f ),
+SkeletonObject::SkeletonObject() :  mSkeleton(NULL),
+                                    mState(NULL),
+                                    mPreTickTime( 0.0f ),
                                     mPostTickTime( 0.0f ),
                                     mTimeScale(1),
                                     mLastFrameTime(0),
                                     mTotalAnimationTime(0),
-                                    mSkeleton(NULL),
-                                    mState(NULL),
                                     mAnimationCycle(false),
                                     mAnimationFinished(true),
                                     mAnimationDuration(0.0),
@@ -336,7 +336,6 @@ void SkeletonObject::generateComposition( void )
 {
     // Clear existing visualization
     clearSprites();
-    mSkeletonSprites.clear();
     
     // Finish if skeleton asset isn't available.
     if ( mSkeletonAsset.isNull() )
@@ -382,51 +381,132 @@ void SkeletonObject::generateComposition( void )
 
 void SkeletonObject::updateComposition( const F32 time )
 {
+    // Debug Profiling.
+    PROFILE_SCOPE(SkeletonObject_UpdateComposition);
+
+    // Finish if the skeleton isn't available.
+    if ( mSkeleton == NULL )
+        return;
+
     // Update position/orientation/state of visualization
     float delta = (time - mLastFrameTime) * mTimeScale;
     mLastFrameTime = time;
     
     spSkeleton_update(mSkeleton, delta);
     
+    SkeletonAnimationCache* pAnimationCache = NULL;
+    spTrackEntry* pTrack = NULL;
+
     if (!mAnimationFinished)
     {
         spAnimationState_update(mState, delta);
-        spAnimationState_apply(mState, mSkeleton);
+
+        // Use the shared animation cache if a single animation is playing without mixing.
+        pTrack = mState->trackCount == 1 ? mState->tracks[0] : NULL;
+        if ( pTrack != NULL && pTrack->previous == NULL )
+            pAnimationCache = mSkeletonAsset->getAnimationCache( pTrack->animation, mSkeleton->skin );
+
+        // Evaluate the animation unless it's cached.
+        if ( pAnimationCache == NULL )
+            spAnimationState_apply(mState, mSkeleton);
     }
     
-    spSkeleton_updateWorldTransform(mSkeleton);
+    mSkeleton->r = mBlendColor.red;
+    mSkeleton->g = mBlendColor.green;
+    mSkeleton->b = mBlendColor.blue;
+    mSkeleton->a = mBlendColor.alpha;
     
-    // Get the ImageAsset used by the sprites
-    StringTableEntry assetId = (*mSkeletonAsset).mImageAsset.getAssetId();
+    mSkeleton->flipX = getFlipX();
+    mSkeleton->flipY = getFlipY();
     
-    clearSprites();
+    // Look up the world transform if the animation is cached, otherwise compute it.
+    if ( pAnimationCache != NULL )
+    {
+        pAnimationCache->apply( mSkeleton, pTrack->time, pTrack->loop != 0 );
+        pTrack->lastTime = pTrack->time;
+    }
+    else
+    {
+        spSkeleton_updateWorldTransform(mSkeleton);
+    }
     
-    Vector2 vertices[4];
+    // Update the sprites with the ImageAsset used by the skeleton.
+    updateSprites( (*mSkeletonAsset).mImageAsset.getAssetId() );
     
-    F32 vertexPositions[8];
-    for (int i = 0; i < mSkeleton->slotCount; ++i)
+    if (mLastFrameTime >= mTotalAnimationTime)
+        mAnimationFinished = true;
+    
+    if (mAnimationFinished && !mAnimationCycle)
+    {
+        onAnimationFinished();
+    }
+    else
+    {
+        mAnimationFinished = false;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void SkeletonObject::updateSprites( StringTableEntry imageAssetId )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SkeletonObject_UpdateSprites);
+
+    const U32 slotCount = (U32)mSkeleton->slotCount;
+
+    // Start again if the slots have changed.
+    if ( (U32)mSkeletonSprites.size() != slotCount )
+    {
+        clearSprites();
+
+        // Create a hidden sprite for each slot in slot order so the sprites render in the slot draw order.
+        mSkeletonSprites.setSize( slotCount );
+        mSkeletonSpriteAttachments.setSize( slotCount );
+        for ( U32 i = 0; i < slotCount; ++i )
+        {
+            SpriteBatchItem* pSprite = SpriteBatch::createSprite();
+            pSprite->setVisible( false );
+            mSkeletonSprites[i] = pSprite;
+            mSkeletonSpriteAttachments[i] = NULL;
+        }
+    }
+
+    // Compute the world vertices of all the region attachments in one pass.
+    mSkeletonVertices.setSize( slotCount * 8 );
+    computeWorldVertices( &mSkeleton, 1, mSkeletonVertices.address() );
+
+    Vector2 vertices[4];
+
+    for ( U32 i = 0; i < slotCount; ++i )
     {
         spSlot* slot = mSkeleton->slots[i];
         spAttachment* attachment = slot->attachment;
-        
+
+        // Fetch the slot sprite.
+        SpriteBatchItem* pSprite = mSkeletonSprites[i];
+
+        // Hide the slot sprite if the slot has nothing to show.
         if (!attachment || attachment->type != ATTACHMENT_REGION)
+        {
+            pSprite->setVisible( false );
             continue;
-        
-        spRegionAttachment* regionAttachment = (spRegionAttachment*)attachment;
-        spRegionAttachment_computeWorldVertices(regionAttachment, slot->skeleton->x, slot->skeleton->y, slot->bone, vertexPositions);
-        
-        SpriteBatchItem* pSprite = SpriteBatch::createSprite();
+        }
+
+        // Set the image frame only when the slot attachment changes.
+        if ( mSkeletonSpriteAttachments[i] != attachment )
+        {
+            pSprite->setImage( imageAssetId, attachment->name );
+            mSkeletonSpriteAttachments[i] = attachment;
+        }
+
+        pSprite->setVisible( true );
 
         pSprite->setDepth(mSceneLayerDepth);
         
         pSprite->setSrcBlendFactor(mSrcBlendFactor);
         pSprite->setDstBlendFactor(mDstBlendFactor);
         
-        mSkeleton->r = mBlendColor.red;
-        mSkeleton->g = mBlendColor.green;
-        mSkeleton->b = mBlendColor.blue;
-        mSkeleton->a = mBlendColor.alpha;
-        
         F32 alpha = mSkeleton->a * slot->a;
         pSprite->setBlendColor(ColorF(
             mSkeleton->r * slot->r * alpha,
@@ -435,9 +515,7 @@ void SkeletonObject::updateComposition( const F32 time )
             alpha
         ));
         
-        mSkeleton->flipX = getFlipX();
-        mSkeleton->flipY = getFlipY();
-        
+        const F32* vertexPositions = mSkeletonVertices.address() + (i * 8);
         vertices[0].x = vertexPositions[VERTEX_X1];
         vertices[0].y = vertexPositions[VERTEX_Y1];
         vertices[1].x = vertexPositions[VERTEX_X4];
@@ -447,24 +525,78 @@ void SkeletonObject::updateComposition( const F32 time )
         vertices[3].x = vertexPositions[VERTEX_X2];
         vertices[3].y = vertexPositions[VERTEX_Y2];
         pSprite->setExplicitVertices(vertices);
-        
-        pSprite->setImage(assetId);
-        pSprite->setNamedImageFrame(attachment->name);
     }
-    
-    if (mLastFrameTime >= mTotalAnimationTime)
-        mAnimationFinished = true;
-    
-    if (mAnimationFinished && !mAnimationCycle)
-    {
-        onAnimationFinished();
-    }
-    else
+
+    // The sprites have moved so flag the local extents and static batch as dirty.
+    setLocalExtentsDirty();
+    setStaticBatchDirty();
+}
+
+//-----------------------------------------------------------------------------
+
+void SkeletonObject::computeWorldVertices( spSkeleton** pSkeletons, const U32 skeletonCount, F32* pWorldVertices )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SkeletonObject_ComputeWorldVertices);
+
+    // Finish if no skeletons.
+    if ( skeletonCount == 0 )
+        return;
+
+    // Fetch the slot count shared by the skeletons.
+    const S32 slotCount = pSkeletons[0]->slotCount;
+
+    for ( U32 skeletonIndex = 0; skeletonIndex < skeletonCount; ++skeletonIndex )
     {
-        mAnimationFinished = false;
+        spSkeleton* pSkeleton = pSkeletons[skeletonIndex];
+
+        // Sanity!
+        AssertFatal( pSkeleton->data == pSkeletons[0]->data, "SkeletonObject::computeWorldVertices() - The skeletons must share the same skeleton data." );
+
+        for ( S32 i = 0; i < slotCount; ++i, pWorldVertices += 8 )
+        {
+            spSlot* slot = pSkeleton->slots[i];
+            spAttachment* attachment = slot->attachment;
+
+            if (!attachment || attachment->type != ATTACHMENT_REGION)
+                continue;
+
+            // Transform the attachment offsets by the slot bone.
+            // NOTE: This is spRegionAttachment_computeWorldVertices() inlined so the loop stays tight.
+            const F32* offset = ((spRegionAttachment*)attachment)->offset;
+            const spBone* bone = slot->bone;
+            const F32 x = pSkeleton->x + bone->worldX;
+            const F32 y = pSkeleton->y + bone->worldY;
+            const F32 m00 = bone->m00;
+            const F32 m01 = bone->m01;
+            const F32 m10 = bone->m10;
+            const F32 m11 = bone->m11;
+            pWorldVertices[VERTEX_X1] = offset[VERTEX_X1] * m00 + offset[VERTEX_Y1] * m01 + x;
+            pWorldVertices[VERTEX_Y1] = offset[VERTEX_X1] * m10 + offset[VERTEX_Y1] * m11 + y;
+            pWorldVertices[VERTEX_X2] = offset[VERTEX_X2] * m00 + offset[VERTEX_Y2] * m01 + x;
+            pWorldVertices[VERTEX_Y2] = offset[VERTEX_X2] * m10 + offset[VERTEX_Y2] * m11 + y;
+            pWorldVertices[VERTEX_X3] = offset[VERTEX_X3] * m00 + offset[VERTEX_Y3] * m01 + x;
+            pWorldVertices[VERTEX_Y3] = offset[VERTEX_X3] * m10 + offset[VERTEX_Y3] * m11 + y;
+            pWorldVertices[VERTEX_X4] = offset[VERTEX_X4] * m00 + offset[VERTEX_Y4] * m01 + x;
+            pWorldVertices[VERTEX_Y4] = offset[VERTEX_X4] * m10 + offset[VERTEX_Y4] * m11 + y;
+        }
     }
 }
 
+//-----------------------------------------------------------------------------
+
+void SkeletonObject::clearSprites( void )
+{
+    // Call parent.
+    SpriteBatch::clearSprites();
+
+    // The slots no longer have sprites.
+    mSkeletonSprites.clear();
+    mSkeletonSpriteAttachments.clear();
+}
+
+//-----------------------------------------------------------------------------
+
 void SkeletonObject::onAnimationFinished()
 {
     // Do script callback.
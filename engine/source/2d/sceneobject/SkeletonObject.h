@@ -42,13 +42,18 @@ class SkeletonObject : public SceneObject, public SpriteBatch
 protected:
     typedef SceneObject Parent;
     
-private:
     typedef Vector<SpriteBatchItem*> typeSkeletonSpritesVector;
+    typedef Vector<spAttachment*> typeSkeletonAttachmentsVector;
+
+    spSkeleton*                 mSkeleton;
+    spAnimationState*           mState;
+
+private:
     typeSkeletonSpritesVector   mSkeletonSprites;
+    typeSkeletonAttachmentsVector mSkeletonSpriteAttachments;
+    Vector<F32>                 mSkeletonVertices;
     
     AssetPtr<SkeletonAsset>     mSkeletonAsset;
-    spSkeleton*                 mSkeleton;
-    spAnimationState*           mState;
     
     F32                         mPreTickTime;
     F32                         mPostTickTime;
@@ -81,6 +86,8 @@ public:
     virtual void interpolateObject( const F32 timeDelta );
     
     virtual void copyTo( SimObject* object );
+
+    virtual void clearSprites( void );
     
     virtual bool canPrepareRender( void ) const { return true; }
     virtual bool validRender( void ) const { return mSkeletonAsset.notNull(); }
@@ -122,6 +129,11 @@ public:
     inline bool getAnimationCycle( void ) const {return mAnimationCycle; };
     
     void onAnimationFinished();
+
+    /// Compute the world vertices of the region attachments for skeletons which share the same skeleton data.
+    /// Eight floats are written for each slot (slots without a region attachment are left untouched) with the
+    /// skeletons one after another so the vertices buffer must hold (skeletonCount * slotCount * 8) floats.
+    static void computeWorldVertices( spSkeleton** pSkeletons, const U32 skeletonCount, F32* pWorldVertices );
     
     /// Declare Console Object.
     DECLARE_CONOBJECT( SkeletonObject );
@@ -129,6 +141,7 @@ public:
 protected:
     void generateComposition( void );
     void updateComposition( const F32 time );
+    void updateSprites( StringTableEntry imageAssetId );
     
 protected:
     static bool setSkeletonAsset( void* obj, const char* data )                  { static_cast<SkeletonObject*>(obj)->setSkeletonAsset(data); return false; }
@@ -110,6 +110,33 @@ b2Body::~b2Body()
 	// shapes and joints are destroyed in b2World::Destroy
 }
 
+void b2Body::SetAwake(bool flag)
+{
+	if (flag)
+	{
+		if ((m_flags & e_awakeFlag) == 0)
+		{
+			m_flags |= e_awakeFlag;
+			m_sleepTime = 0.0f;
+			++m_world->m_awakeBodyCount;
+		}
+	}
+	else
+	{
+		if (m_flags & e_awakeFlag)
+		{
+			--m_world->m_awakeBodyCount;
+		}
+
+		m_flags &= ~e_awakeFlag;
+		m_sleepTime = 0.0f;
+		m_linearVelocity.SetZero();
+		m_angularVelocity = 0.0f;
+		m_force.SetZero();
+		m_torque = 0.0f;
+	}
+}
+
 void b2Body::SetType(b2BodyType type)
 {
 	b2Assert(m_world->IsLocked() == false);
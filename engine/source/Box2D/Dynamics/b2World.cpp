@@ -43,6 +43,7 @@ b2World::b2World(const b2Vec2& gravity)
 	m_jointList = NULL;
 
 	m_bodyCount = 0;
+	m_awakeBodyCount = 0;
 	m_jointCount = 0;
 
 	m_warmStarting = true;
@@ -125,6 +126,11 @@ b2Body* b2World::CreateBody(const b2BodyDef* def)
 	m_bodyList = b;
 	++m_bodyCount;
 
+	if (b->IsAwake())
+	{
+		++m_awakeBodyCount;
+	}
+
 	return b;
 }
 
@@ -205,6 +211,12 @@ void b2World::DestroyBody(b2Body* b)
 	}
 
 	--m_bodyCount;
+
+	if (b->IsAwake())
+	{
+		--m_awakeBodyCount;
+	}
+
 	b->~b2Body();
 	m_blockAllocator.Free(b, sizeof(b2Body));
 }
@@ -163,6 +163,9 @@ public:
 	/// Get the number of bodies.
 	int32 GetBodyCount() const;
 
+	/// Get the number of awake bodies.
+	int32 GetAwakeBodyCount() const;
+
 	/// Get the number of joints.
 	int32 GetJointCount() const;
 
@@ -241,6 +244,7 @@ private:
 	b2Joint* m_jointList;
 
 	int32 m_bodyCount;
+	int32 m_awakeBodyCount;
 	int32 m_jointCount;
 
 	b2Vec2 m_gravity;
@@ -298,6 +302,11 @@ inline int32 b2World::GetBodyCount() const
 	return m_bodyCount;
 }
 
+inline int32 b2World::GetAwakeBodyCount() const
+{
+	return m_awakeBodyCount;
+}
+
 inline int32 b2World::GetJointCount() const
 {
 	return m_jointCount;
@@ -0,0 +1,686 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+
+#include "assets/assetAsyncAcquirer.h"
+#include "assets/assetManager.h"
+#include "persistence/taml/tamlReadNode.h"
+#include "persistence/taml/tamlReadNodeParser.h"
+#include "graphics/TextureManager.h"
+#include "graphics/TextureDictionary.h"
+#include "graphics/TextureAtlas.h"
+#include "graphics/gBitmap.h"
+#include "io/fileStream.h"
+#include "platform/threads/jobSystem.h"
+#include "platform/threads/mutex.h"
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+static StringTableEntry imageAssetTypeName = StringTable->insert( "ImageAsset" );
+static StringTableEntry imageAssetForce16BitFieldName = StringTable->insert( "Force16bit" );
+static StringTableEntry imageAssetAtlasFieldName = StringTable->insert( "Atlas" );
+
+//-----------------------------------------------------------------------------
+
+/// An image to load as a texture before the asset is acquired.
+struct AssetTextureLoad
+{
+    AssetTextureLoad() :
+        mAssetFilePath( StringTable->EmptyString ),
+        mImageFilePath( StringTable->EmptyString ),
+        mFormatMode( Taml::InvalidFormat ),
+        mAtlas( false ),
+        mpBitmap( NULL )
+    {
+    }
+
+    ~AssetTextureLoad()
+    {
+        delete mpBitmap;
+    }
+
+    StringTableEntry    mAssetFilePath;
+    StringTableEntry    mImageFilePath;
+    Taml::TamlFormatMode mFormatMode;
+    bool                mAtlas;
+    GBitmap*            mpBitmap;
+    TextureHandle       mTexture;
+};
+
+//-----------------------------------------------------------------------------
+
+/// A request that is queued, being loaded or being acquired.
+class AssetAsyncRequest
+{
+public:
+    enum RequestState
+    {
+        Queued,
+        Loading,
+        Loaded,
+    };
+
+    AssetAsyncRequest() :
+        mRequestId( 0 ),
+        mpAssetManager( NULL ),
+        mAssetId( StringTable->EmptyString ),
+        mPriority( 0 ),
+        mCallback( NULL ),
+        mpUserData( NULL ),
+        mHasNotifyObject( false ),
+        mState( Queued ),
+        mCancelled( false ),
+        mUploadIndex( 0 ),
+        mpAsset( NULL )
+    {
+    }
+
+    ~AssetAsyncRequest()
+    {
+        for( U32 index = 0; index < (U32)mTextureLoads.size(); ++index )
+            delete mTextureLoads[index];
+    }
+
+    /// Upload the next texture or acquire the asset.
+    /// @return Whether the asset has been acquired.
+    bool commitStep( void );
+
+    U32                         mRequestId;
+    AssetManager*               mpAssetManager;
+    StringTableEntry            mAssetId;
+    S32                         mPriority;
+    AssetAcquiredCallback       mCallback;
+    void*                       mpUserData;
+    SimObjectPtr<SimObject>     mNotifyObject;
+    bool                        mHasNotifyObject;
+    RequestState                mState;
+    bool                        mCancelled;
+    Vector<AssetTextureLoad*>   mTextureLoads;
+    U32                         mUploadIndex;
+    AssetBase*                  mpAsset;
+};
+
+//-----------------------------------------------------------------------------
+
+// The requests in order of priority (only used on the main thread).
+static Vector<AssetAsyncRequest*> gAsyncRequests;
+
+// The load jobs.
+static JobSystem::JobGroup gLoadGroup;
+
+// Guards the loaded state of the requests.
+static Mutex gLoadMutex;
+
+// The request being committed (acquiring can cancel it while it is).
+static AssetAsyncRequest* gpCommittingRequest = NULL;
+
+// The last request Id.
+static U32 gLastRequestId = 0;
+
+//-----------------------------------------------------------------------------
+
+static GBitmap* decodeBitmap( const char* pFilePath )
+{
+    // Find the image format.
+    const char* pExtension = dStrrchr( pFilePath, '.' );
+    if ( pExtension == NULL )
+        return NULL;
+
+    const bool isPNG = dStricmp( pExtension, ".png" ) == 0;
+    const bool isJPEG = dStricmp( pExtension, ".jpg" ) == 0 || dStricmp( pExtension, ".jpeg" ) == 0;
+
+#ifdef USE_APPLE_OPTIMIZED_PNGS
+    // The optimized PNGs are read by the platform on the main thread.
+    if ( isPNG )
+        return NULL;
+#endif
+
+    if ( !isPNG && !isJPEG )
+        return NULL;
+
+    // Open the file.
+    // NOTE: Files that aren't on disk (such as in an archive) are left for the main thread.
+    FileStream stream;
+    if ( !stream.open( pFilePath, FileStream::Read ) )
+        return NULL;
+
+    // Decode the image.
+    GBitmap* pBitmap = new GBitmap();
+    const bool decoded = isPNG ? pBitmap->readPNG( stream ) : pBitmap->readJPEG( stream );
+    stream.close();
+
+    // Discard images the texture manager would reject so it warns about them.
+    if ( !decoded || pBitmap->getWidth() > MaximumProductSupportedTextureWidth || pBitmap->getHeight() > MaximumProductSupportedTextureHeight )
+    {
+        delete pBitmap;
+        return NULL;
+    }
+
+    return pBitmap;
+}
+
+//-----------------------------------------------------------------------------
+
+static void readImageFields( const char* pAssetFilePath, const Taml::TamlFormatMode formatMode, bool& force16Bit, bool& atlas )
+{
+    // Use the defaults of the image asset.
+    force16Bit = false;
+    atlas = true;
+
+    // Read the asset file.
+    TamlReadNode* pRootNode = TamlReadNodeParser::readNodes( pAssetFilePath, formatMode );
+    if ( pRootNode == NULL )
+        return;
+
+    // Find the fields.
+    for( Vector<TamlReadNode::FieldValuePair*>::iterator fieldItr = pRootNode->mFields.begin(); fieldItr != pRootNode->mFields.end(); ++fieldItr )
+    {
+        if ( (*fieldItr)->mName == imageAssetForce16BitFieldName )
+            force16Bit = dAtob( (*fieldItr)->mpValue );
+        else if ( (*fieldItr)->mName == imageAssetAtlasFieldName )
+            atlas = dAtob( (*fieldItr)->mpValue );
+    }
+
+    delete pRootNode;
+}
+
+//-----------------------------------------------------------------------------
+
+static void loadRequestJob( void* pContext, const U32 jobIndex )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetAsyncAcquirer_Load);
+
+    AssetAsyncRequest* pRequest = (AssetAsyncRequest*)pContext;
+
+    // Decode the images.
+    for( U32 index = 0; index < (U32)pRequest->mTextureLoads.size(); ++index )
+    {
+        AssetTextureLoad* pTextureLoad = pRequest->mTextureLoads[index];
+
+        pTextureLoad->mpBitmap = decodeBitmap( pTextureLoad->mImageFilePath );
+
+        // Skip the image if it wasn't decoded.
+        if ( pTextureLoad->mpBitmap == NULL )
+            continue;
+
+        // Match the depth the image asset will ask for and whether it will pack it into a texture atlas page.
+        bool force16Bit;
+        bool atlas;
+        readImageFields( pTextureLoad->mAssetFilePath, pTextureLoad->mFormatMode, force16Bit, atlas );
+        pTextureLoad->mpBitmap->mForce16Bit = force16Bit;
+        pTextureLoad->mAtlas = pTextureLoad->mAtlas && atlas && !force16Bit;
+    }
+
+    // The request isn't touched by the job once it's loaded.
+    MutexHandle handle;
+    handle.lock( &gLoadMutex, true );
+    pRequest->mState = AssetAsyncRequest::Loaded;
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetAsyncRequest::commitStep( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetAsyncAcquirer_CommitStep);
+
+    // Upload the next texture.
+    while ( mUploadIndex < (U32)mTextureLoads.size() )
+    {
+        AssetTextureLoad* pTextureLoad = mTextureLoads[mUploadIndex++];
+
+        // Skip images that weren't decoded.
+        if ( pTextureLoad->mpBitmap == NULL )
+            continue;
+
+        // Keep the image until the asset is acquired if it will be packed into a texture atlas page.
+        if ( pTextureLoad->mAtlas && TextureManager::getManagerState() == TextureManager::Alive )
+            continue;
+
+        // Discard the image if the texture was loaded while it was decoded.
+        if ( TextureManager::getManagerState() != TextureManager::Alive ||
+            TextureDictionary::find( pTextureLoad->mImageFilePath, TextureHandle::BitmapTexture, true ) != NULL )
+        {
+            delete pTextureLoad->mpBitmap;
+            pTextureLoad->mpBitmap = NULL;
+            continue;
+        }
+
+        // Upload the texture.
+        // NOTE: The texture manager owns the bitmap and the handle keeps the texture until the asset is acquired.
+        pTextureLoad->mTexture = TextureHandle( pTextureLoad->mImageFilePath, pTextureLoad->mpBitmap, TextureHandle::BitmapTexture, true );
+        pTextureLoad->mpBitmap = NULL;
+        return false;
+    }
+
+    // Stage the images that will be packed into texture atlas pages.
+    for( U32 index = 0; index < (U32)mTextureLoads.size(); ++index )
+    {
+        AssetTextureLoad* pTextureLoad = mTextureLoads[index];
+        if ( pTextureLoad->mpBitmap != NULL )
+        {
+            TextureAtlas::stageBitmap( pTextureLoad->mImageFilePath, pTextureLoad->mpBitmap );
+            pTextureLoad->mpBitmap = NULL;
+        }
+    }
+
+    // Acquire the asset.
+    // NOTE: The asset finds its textures already loaded or staged.
+    mpAsset = mpAssetManager->acquireAsset<AssetBase>( mAssetId );
+
+    // Discard any staged images the asset didn't use.
+    TextureAtlas::clearStagedBitmaps();
+
+    // Release the textures.
+    for( U32 index = 0; index < (U32)mTextureLoads.size(); ++index )
+        delete mTextureLoads[index];
+    mTextureLoads.clear();
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+static AssetAsyncRequest::RequestState getState( AssetAsyncRequest* pRequest )
+{
+    MutexHandle handle;
+    handle.lock( &gLoadMutex, true );
+    return pRequest->mState;
+}
+
+//-----------------------------------------------------------------------------
+
+static void removeRequest( AssetAsyncRequest* pRequest )
+{
+    for( U32 index = 0; index < (U32)gAsyncRequests.size(); ++index )
+    {
+        if ( gAsyncRequests[index] == pRequest )
+        {
+            gAsyncRequests.erase( index );
+            return;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static void completeRequest( AssetAsyncRequest* pRequest )
+{
+    // Release the asset if the request was cancelled while it was acquired.
+    if ( pRequest->mCancelled )
+    {
+        if ( pRequest->mpAsset != NULL )
+            pRequest->mpAssetManager->releaseAsset( pRequest->mAssetId );
+        return;
+    }
+
+    // Did we acquire the asset?
+    if ( pRequest->mpAsset == NULL )
+    {
+        // No, so warn.
+        Con::warnf( "AssetAsyncAcquirer - Failed to acquire asset Id '%s'.", pRequest->mAssetId );
+    }
+
+    // Count the owners the reference is handed to.
+    U32 ownerCount = 0;
+
+    // Notify the callback.
+    if ( pRequest->mCallback != NULL )
+    {
+        pRequest->mCallback( pRequest->mpUserData, pRequest->mRequestId, pRequest->mAssetId, pRequest->mpAsset );
+        ownerCount++;
+    }
+
+    // Notify the object if it wasn't deleted.
+    if ( pRequest->mHasNotifyObject && !pRequest->mNotifyObject.isNull() )
+    {
+        // The object gets its own reference if the callback has one.
+        if ( ownerCount > 0 && pRequest->mpAsset != NULL )
+            pRequest->mpAssetManager->acquireAsset<AssetBase>( pRequest->mAssetId );
+
+        char requestIdBuffer[16];
+        dSprintf( requestIdBuffer, sizeof(requestIdBuffer), "%d", pRequest->mRequestId );
+        Con::executef( pRequest->mNotifyObject, 4, "onAssetAcquired", requestIdBuffer, pRequest->mAssetId, pRequest->mpAsset == NULL ? "" : pRequest->mpAsset->getIdString() );
+        ownerCount++;
+    }
+
+    // Release the reference if nobody was notified.
+    if ( ownerCount == 0 && pRequest->mpAsset != NULL )
+        pRequest->mpAssetManager->releaseAsset( pRequest->mAssetId );
+}
+
+//-----------------------------------------------------------------------------
+
+static void submitRequests( void )
+{
+    // Count the requests being loaded.
+    U32 loadingCount = 0;
+    for( U32 index = 0; index < (U32)gAsyncRequests.size(); ++index )
+    {
+        if ( getState( gAsyncRequests[index] ) == AssetAsyncRequest::Loading )
+            loadingCount++;
+    }
+
+    // Load the queued requests in order of priority.
+    for( U32 index = 0; index < (U32)gAsyncRequests.size() && loadingCount < ASSET_ASYNC_ACQUIRE_MAX_LOADING; ++index )
+    {
+        AssetAsyncRequest* pRequest = gAsyncRequests[index];
+
+        if ( getState( pRequest ) != AssetAsyncRequest::Queued )
+            continue;
+
+        // Are there any images to load?
+        if ( pRequest->mTextureLoads.size() == 0 )
+        {
+            // No, so the request is ready to acquire.
+            pRequest->mState = AssetAsyncRequest::Loaded;
+            continue;
+        }
+
+        // Load the request in the background.
+        pRequest->mState = AssetAsyncRequest::Loading;
+        loadingCount++;
+        JobSystem::submit( loadRequestJob, pRequest, 0, &gLoadGroup );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetAsyncAcquirer::addTextureLoads( AssetAsyncRequest* pRequest, AssetDefinition* pAssetDefinition )
+{
+    // Finish if the asset isn't an image or is already loaded.
+    if ( pAssetDefinition->mAssetType != imageAssetTypeName || pAssetDefinition->mpAssetBase != NULL )
+        return;
+
+    // Load the images that aren't already textures.
+    for( U32 index = 0; index < (U32)pAssetDefinition->mAssetLooseFiles.size(); ++index )
+    {
+        StringTableEntry imageFilePath = pAssetDefinition->mAssetLooseFiles[index];
+
+        if ( TextureDictionary::find( imageFilePath, TextureHandle::BitmapTexture, true ) != NULL )
+            continue;
+
+        AssetTextureLoad* pTextureLoad = new AssetTextureLoad();
+        pTextureLoad->mAssetFilePath = pAssetDefinition->mAssetBaseFilePath;
+        pTextureLoad->mImageFilePath = imageFilePath;
+        pTextureLoad->mFormatMode = pRequest->mpAssetManager->mTaml.getFileAutoFormatMode( pAssetDefinition->mAssetBaseFilePath );
+        pTextureLoad->mAtlas = TextureAtlas::getEnabled();
+        pRequest->mTextureLoads.push_back( pTextureLoad );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+U32 AssetAsyncAcquirer::queue( AssetManager* pAssetManager, const char* pAssetId, const S32 priority, AssetAcquiredCallback callback, void* pUserData, SimObject* pNotifyObject )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetAsyncAcquirer_Queue);
+
+    // Sanity!
+    AssertFatal( pAssetManager != NULL, "AssetAsyncAcquirer::queue() - Cannot acquire with a NULL asset manager." );
+    AssertFatal( pAssetId != NULL, "AssetAsyncAcquirer::queue() - Cannot acquire a NULL asset Id." );
+
+    // Find the asset.
+    AssetDefinition* pAssetDefinition = pAssetManager->findAsset( pAssetId );
+
+    // Did we find the asset?
+    if ( pAssetDefinition == NULL )
+    {
+        // No, so warn.
+        Con::warnf( "AssetAsyncAcquirer::queue() - Failed to acquire asset Id '%s' as it does not exist.", pAssetId );
+        return 0;
+    }
+
+    AssetAsyncRequest* pRequest = new AssetAsyncRequest();
+    pRequest->mRequestId = ++gLastRequestId;
+    pRequest->mpAssetManager = pAssetManager;
+    pRequest->mAssetId = pAssetDefinition->mAssetId;
+    pRequest->mPriority = priority;
+    pRequest->mCallback = callback;
+    pRequest->mpUserData = pUserData;
+    pRequest->mNotifyObject = pNotifyObject;
+    pRequest->mHasNotifyObject = pNotifyObject != NULL;
+
+    // Are the textures being managed?
+    if ( TextureManager::getManagerState() == TextureManager::Alive )
+    {
+        // Yes, so find the images of the asset and of the assets it depends on.
+        Vector<StringTableEntry> assetIds;
+        assetIds.push_back( pRequest->mAssetId );
+        for( U32 assetIndex = 0; assetIndex < (U32)assetIds.size(); ++assetIndex )
+        {
+            AssetDefinition* pDefinition = pAssetManager->findAsset( assetIds[assetIndex] );
+            if ( pDefinition == NULL )
+                continue;
+
+            addTextureLoads( pRequest, pDefinition );
+
+            // Add the dependencies that haven't been visited.
+            AssetManager::typeAssetDependsOnHash::iterator dependsOnItr = pAssetManager->mAssetDependsOn.find( assetIds[assetIndex] );
+            while( dependsOnItr != pAssetManager->mAssetDependsOn.end() && dependsOnItr->key == assetIds[assetIndex] )
+            {
+                bool visited = false;
+                for( U32 visitedIndex = 0; visitedIndex < (U32)assetIds.size() && !visited; ++visitedIndex )
+                    visited = assetIds[visitedIndex] == dependsOnItr->value;
+
+                if ( !visited )
+                    assetIds.push_back( dependsOnItr->value );
+
+                dependsOnItr++;
+            }
+        }
+    }
+
+    // Insert the request after the requests with the same or a higher priority.
+    U32 insertIndex = 0;
+    while( insertIndex < (U32)gAsyncRequests.size() && gAsyncRequests[insertIndex]->mPriority >= priority )
+        insertIndex++;
+    gAsyncRequests.insert( insertIndex );
+    gAsyncRequests[insertIndex] = pRequest;
+
+    // Start loading it if there's room.
+    submitRequests();
+
+    return pRequest->mRequestId;
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetAsyncAcquirer::process( void )
+{
+    if ( gAsyncRequests.size() == 0 )
+        return;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetAsyncAcquirer_Process);
+
+    // Fetch the budget.
+    const U32 budget = (U32)getMax( Con::getIntVariable( ASSET_ASYNC_ACQUIRE_BUDGET_VARIABLE, ASSET_ASYNC_ACQUIRE_DEFAULT_BUDGET ), 0 );
+    const U32 startTime = Platform::getRealMilliseconds();
+
+    // Commit the loaded requests in order of priority.
+    // NOTE: At least one step is committed each frame however small the budget.
+    bool budgetUsed = false;
+    while( !budgetUsed )
+    {
+        // Start loading the next requests.
+        submitRequests();
+
+        // Find the first loaded request, discarding any that were cancelled.
+        AssetAsyncRequest* pRequest = NULL;
+        for( U32 index = 0; index < (U32)gAsyncRequests.size() && pRequest == NULL; )
+        {
+            AssetAsyncRequest* pCandidate = gAsyncRequests[index];
+
+            if ( getState( pCandidate ) != AssetAsyncRequest::Loaded )
+            {
+                index++;
+                continue;
+            }
+
+            if ( pCandidate->mCancelled )
+            {
+                gAsyncRequests.erase( index );
+                delete pCandidate;
+                continue;
+            }
+
+            pRequest = pCandidate;
+        }
+
+        // Finish if nothing is loaded.
+        if ( pRequest == NULL )
+            break;
+
+        // Commit the request.
+        gpCommittingRequest = pRequest;
+        const bool committed = pRequest->commitStep();
+        gpCommittingRequest = NULL;
+
+        budgetUsed = Platform::getRealMilliseconds() - startTime >= budget;
+
+        if ( !committed && !pRequest->mCancelled )
+            continue;
+
+        // Remove the request before notifying as the callbacks can make or cancel requests.
+        removeRequest( pRequest );
+        completeRequest( pRequest );
+        delete pRequest;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetAsyncAcquirer::flush( void )
+{
+    if ( gAsyncRequests.size() == 0 )
+        return;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetAsyncAcquirer_Flush);
+
+    while( true )
+    {
+        // Find the first request that isn't already being committed.
+        // NOTE: The callbacks may have changed the requests so start again each time.
+        AssetAsyncRequest* pRequest = NULL;
+        for( U32 index = 0; index < (U32)gAsyncRequests.size() && pRequest == NULL; ++index )
+        {
+            if ( gAsyncRequests[index] != gpCommittingRequest )
+                pRequest = gAsyncRequests[index];
+        }
+
+        // Finish if there are no more requests.
+        if ( pRequest == NULL )
+            break;
+
+        // Load all the requests.
+        for( U32 index = 0; index < (U32)gAsyncRequests.size(); ++index )
+        {
+            if ( getState( gAsyncRequests[index] ) == AssetAsyncRequest::Queued )
+            {
+                gAsyncRequests[index]->mState = AssetAsyncRequest::Loading;
+                JobSystem::submit( loadRequestJob, gAsyncRequests[index], 0, &gLoadGroup );
+            }
+        }
+
+        // Wait for the images to be decoded.
+        JobSystem::wait( &gLoadGroup );
+
+        // Commit the request.
+        AssetAsyncRequest* pCommittingRequest = gpCommittingRequest;
+        gpCommittingRequest = pRequest;
+        while( !pRequest->mCancelled && !pRequest->commitStep() )
+        {
+        }
+        gpCommittingRequest = pCommittingRequest;
+
+        // Remove the request before notifying as the callbacks can make or cancel requests.
+        removeRequest( pRequest );
+        completeRequest( pRequest );
+
+        delete pRequest;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetAsyncAcquirer::cancel( const U32 requestId )
+{
+    for( U32 index = 0; index < (U32)gAsyncRequests.size(); ++index )
+    {
+        AssetAsyncRequest* pRequest = gAsyncRequests[index];
+
+        if ( pRequest->mRequestId != requestId )
+            continue;
+
+        // Ignore a request that was already cancelled.
+        if ( pRequest->mCancelled )
+            return false;
+
+        // Discard the request once it's loaded or committed.
+        if ( pRequest == gpCommittingRequest || getState( pRequest ) == AssetAsyncRequest::Loading )
+        {
+            pRequest->mCancelled = true;
+            return true;
+        }
+
+        gAsyncRequests.erase( index );
+        delete pRequest;
+        return true;
+    }
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 AssetAsyncAcquirer::getPendingCount( void )
+{
+    U32 pendingCount = 0;
+    for( U32 index = 0; index < (U32)gAsyncRequests.size(); ++index )
+    {
+        if ( !gAsyncRequests[index]->mCancelled )
+            pendingCount++;
+    }
+
+    return pendingCount;
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetAsyncAcquirer::shutdown( void )
+{
+    // Wait for the requests being loaded.
+    JobSystem::wait( &gLoadGroup );
+
+    // Cancel all the requests.
+    for( U32 index = 0; index < (U32)gAsyncRequests.size(); ++index )
+        delete gAsyncRequests[index];
+
+    gAsyncRequests.clear();
+}
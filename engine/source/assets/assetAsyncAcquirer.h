@@ -0,0 +1,109 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+
+#ifndef _ASSET_ASYNC_ACQUIRER_H_
+#define _ASSET_ASYNC_ACQUIRER_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _STRINGTABLE_H_
+#include "string/stringTable.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+class AssetBase;
+class AssetManager;
+class AssetAsyncRequest;
+struct AssetDefinition;
+class SimObject;
+
+//-----------------------------------------------------------------------------
+
+#define ASSET_ASYNC_ACQUIRE_BUDGET_VARIABLE     "$pref::T2D::AssetAcquireBudget"
+#define ASSET_ASYNC_ACQUIRE_DEFAULT_BUDGET      4
+#define ASSET_ASYNC_ACQUIRE_MAX_LOADING         4
+
+//-----------------------------------------------------------------------------
+
+/// The callback of an asynchronous acquisition.
+/// The asset is NULL if it could not be acquired, otherwise the callback owns the acquired
+/// reference and must release it with "AssetManager::releaseAsset()".
+typedef void (*AssetAcquiredCallback)( void* pUserData, const U32 requestId, StringTableEntry assetId, AssetBase* pAsset );
+
+//-----------------------------------------------------------------------------
+
+/// Acquires assets without blocking the main thread.
+///
+/// An acquisition happens in two phases.  The files of the asset (and of the assets it
+/// depends on) are read and their images decoded on a job system worker.  The main thread
+/// then uploads the decoded images as textures and acquires the asset, which finds its
+/// textures already loaded.  The main thread work is spread over frames, uploading a
+/// texture at a time until the budget of the frame (in milliseconds) is used up.  The
+/// budget is the "$pref::T2D::AssetAcquireBudget" variable.
+///
+/// Requests are loaded and acquired in order of their priority (highest first) and then
+/// in the order they were made.  Only a few requests are loaded at once so a request with
+/// a higher priority doesn't wait behind all the requests made before it.
+///
+/// Completion is notified with a callback and/or the script callback
+/// "onAssetAcquired(%requestId, %assetId, %asset)" on a notify object, where the asset is
+/// an empty string if it could not be acquired.  The notified code owns the acquired
+/// reference.  A cancelled request is never notified and releases anything it loaded.
+///
+/// @code
+/// %requestId = AssetDatabase.acquireAssetAsync( "MyModule:Background", 10, %this );
+///
+/// function MyLevel::onAssetAcquired(%this, %requestId, %assetId, %asset) { ... }
+/// @endcode
+class AssetAsyncAcquirer
+{
+public:
+    /// Start acquiring an asset.
+    /// @return The request Id or zero if the asset could not be found.
+    static U32 queue( AssetManager* pAssetManager, const char* pAssetId, const S32 priority, AssetAcquiredCallback callback, void* pUserData, SimObject* pNotifyObject );
+
+    /// Upload and acquire the loaded requests within the frame budget.  Called once a frame.
+    static void process( void );
+
+    /// Complete all the requests immediately.
+    static void flush( void );
+
+    /// Cancel a request.
+    /// @return Whether the request was found.
+    static bool cancel( const U32 requestId );
+
+    /// Get the number of requests that have not completed.
+    static U32 getPendingCount( void );
+
+    /// Wait for the requests being loaded and cancel all the requests.  Must be called before the job system is destroyed.
+    static void shutdown( void );
+
+private:
+    static void addTextureLoads( AssetAsyncRequest* pRequest, AssetDefinition* pAssetDefinition );
+};
+
+#endif // _ASSET_ASYNC_ACQUIRER_H_
@@ -50,6 +50,18 @@
 #include "tamlAssetReferencedUpdateVisitor.h"
 #endif
 
+#ifndef _ASSET_MANIFEST_CACHE_H_
+#include "assets/assetManifestCache.h"
+#endif
+
+#ifndef _TAML_READ_NODE_PARSER_H_
+#include "persistence/taml/tamlReadNodeParser.h"
+#endif
+
+#ifndef _JOB_SYSTEM_H_
+#include "platform/threads/jobSystem.h"
+#endif
+
 #ifndef _CONSOLETYPES_H_
 #include "console/consoleTypes.h"
 #endif
@@ -67,6 +79,38 @@ AssetManager AssetDatabase;
 
 //-----------------------------------------------------------------------------
 
+#define DECLARED_ASSETS_READ_CHUNK_SIZE     16
+
+//-----------------------------------------------------------------------------
+
+/// The declared asset files being read on the job system.
+struct DeclaredAssetReadJob
+{
+    Vector<AssetManifestCache::Entry*>  mEntries;
+    Vector<Taml::TamlFormatMode>        mFormatModes;
+    Vector<TamlReadNode*>               mRootNodes;
+};
+
+//-----------------------------------------------------------------------------
+
+static void readDeclaredAssetsChunk( void* pContext, const U32 jobIndex )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManager_ReadDeclaredAssets);
+
+    DeclaredAssetReadJob* pReadJob = (DeclaredAssetReadJob*)pContext;
+
+    // Read the files in the chunk.
+    const U32 startIndex = jobIndex * DECLARED_ASSETS_READ_CHUNK_SIZE;
+    const U32 endIndex = getMin( startIndex + DECLARED_ASSETS_READ_CHUNK_SIZE, (U32)pReadJob->mEntries.size() );
+    for ( U32 index = startIndex; index < endIndex; ++index )
+    {
+        pReadJob->mRootNodes[index] = TamlReadNodeParser::readNodes( pReadJob->mEntries[index]->mFilePath, pReadJob->mFormatModes[index] );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 AssetManager::AssetManager() :
     mLoadedInternalAssetsCount( 0 ),
     mLoadedExternalAssetsCount( 0 ),
@@ -76,7 +120,8 @@ AssetManager::AssetManager() :
     mMaxLoadedPrivateAssetsCount( 0 ),
     mAcquiredReferenceCount( 0 ),
     mEchoInfo( false ),
-    mIgnoreAutoUnload( false )
+    mIgnoreAutoUnload( false ),
+    mManifestCache( true )
 {
 }
 
@@ -115,6 +160,7 @@ void AssetManager::initPersistFields()
 
     addField( "EchoInfo", TypeBool, Offset(mEchoInfo, AssetManager), "Whether the asset manager echos extra information to the console or not." );
     addField( "IgnoreAutoUnload", TypeBool, Offset(mIgnoreAutoUnload, AssetManager), "Whether the asset manager should ignore unloading of auto-unload assets or not." );
+    addField( "ManifestCache", TypeBool, Offset(mManifestCache, AssetManager), "Whether the asset manager caches the declared assets of each module so only the asset files that change are parsed or not." );
 }
 
 //-----------------------------------------------------------------------------
@@ -173,6 +219,15 @@ bool AssetManager::addModuleDeclaredAssets( ModuleDefinition* pModuleDefinition
         return false;
     }
 
+    // Format the asset manifest cache file-path.
+    char cacheFilePathBuffer[1024];
+    dSprintf( cacheFilePathBuffer, sizeof(cacheFilePathBuffer), "%s/%s", pModuleDefinition->getModulePath(), ASSET_MANIFEST_CACHE_FILENAME );
+
+    // Read the asset manifest cache.
+    AssetManifestCache manifestCache;
+    if ( mManifestCache )
+        manifestCache.read( cacheFilePathBuffer );
+
     // Iterate the module definition children.
     for( SimSet::iterator itr = pModuleDefinition->begin(); itr != pModuleDefinition->end(); ++itr )
     {
@@ -188,13 +243,27 @@ bool AssetManager::addModuleDeclaredAssets( ModuleDefinition* pModuleDefinition
         dSprintf( filePathBuffer, sizeof(filePathBuffer), "%s/%s", pModuleDefinition->getModulePath(), pDeclaredAssets->getPath() );
 
         // Scan declared assets at location.
-        if ( !scanDeclaredAssets( filePathBuffer, pDeclaredAssets->getExtension(), pDeclaredAssets->getRecurse(), pModuleDefinition ) )
+        if ( !scanDeclaredAssets( filePathBuffer, pDeclaredAssets->getExtension(), pDeclaredAssets->getRecurse(), pModuleDefinition, manifestCache ) )
         {
             // Warn.
             Con::warnf( "AssetManager::addModuleDeclaredAssets() - Could not scan for declared assets at location '%s' with extension '%s'.", filePathBuffer, pDeclaredAssets->getExtension() );
         }
     }  
 
+    // Is the asset manifest cache enabled?
+    if ( mManifestCache )
+    {
+        // Yes, so forget the files that were not found.
+        manifestCache.removeUnused();
+
+        // Write the asset manifest cache if it changed.
+        if ( manifestCache.isDirty() && !manifestCache.write( cacheFilePathBuffer ) && mEchoInfo )
+        {
+            // Info.
+            Con::printf( "Asset Manager: Could not write the asset manifest cache '%s'.", cacheFilePathBuffer );
+        }
+    }
+
     return true;
 }
 
@@ -233,7 +302,9 @@ bool AssetManager::addDeclaredAsset( ModuleDefinition* pModuleDefinition, const
     pFileStart++;
 
     // Scan declared assets at location.
-    if ( !scanDeclaredAssets( assetFilePathBuffer, pFileStart, false, pModuleDefinition ) )
+    // NOTE: A single asset is always parsed.
+    AssetManifestCache manifestCache;
+    if ( !scanDeclaredAssets( assetFilePathBuffer, pFileStart, false, pModuleDefinition, manifestCache ) )
     {
         // Warn.
         Con::warnf( "AssetManager::addDeclaredAsset() - Could not scan declared assets at location '%s' with extension '%s'.", assetFilePathBuffer, pFileStart );
@@ -961,6 +1032,53 @@ bool AssetManager::releaseAsset( const char* pAssetId )
 
 //-----------------------------------------------------------------------------
 
+U32 AssetManager::acquireAssetAsync( const char* pAssetId, const S32 priority, AssetAcquiredCallback callback, void* pUserData, SimObject* pNotifyObject )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManager_AcquireAssetAsync);
+
+    // Sanity!
+    AssertFatal( pAssetId != NULL, "Cannot acquire NULL asset Id." );
+
+    // Is this an empty asset Id?
+    if ( *pAssetId == 0 )
+    {
+        // Yes, so nothing to acquire.
+        return 0;
+    }
+
+    // Info.
+    if ( mEchoInfo )
+    {
+        Con::printf( "Asset Manager: Queued acquiring Asset Id '%s' with priority '%d'.", pAssetId, priority );
+    }
+
+    return AssetAsyncAcquirer::queue( this, pAssetId, priority, callback, pUserData, pNotifyObject );
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetManager::cancelAcquireAssetAsync( const U32 requestId )
+{
+    return AssetAsyncAcquirer::cancel( requestId );
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::flushAcquireAssetAsync( void )
+{
+    AssetAsyncAcquirer::flush();
+}
+
+//-----------------------------------------------------------------------------
+
+U32 AssetManager::getPendingAcquireAssetAsyncCount( void ) const
+{
+    return AssetAsyncAcquirer::getPendingCount();
+}
+
+//-----------------------------------------------------------------------------
+
 void AssetManager::purgeAssets( void )
 {
     // Debug Profiling.
@@ -2306,7 +2424,7 @@ S32 AssetManager::findAssetLooseFile( AssetQuery* pAssetQuery, const char* pLoos
 
 //-----------------------------------------------------------------------------
 
-bool AssetManager::scanDeclaredAssets( const char* pPath, const char* pExtension, const bool recurse, ModuleDefinition* pModuleDefinition )
+bool AssetManager::scanDeclaredAssets( const char* pPath, const char* pExtension, const bool recurse, ModuleDefinition* pModuleDefinition, AssetManifestCache& manifestCache )
 {
     // Debug Profiling.
     PROFILE_SCOPE(AssetManager_ScanDeclaredAssets);
@@ -2351,7 +2469,11 @@ bool AssetManager::scanDeclaredAssets( const char* pPath, const char* pExtension
     // Fetch module assets.
     ModuleDefinition::typeModuleAssetsVector& moduleAssets = pModuleDefinition->getModuleAssets();
 
-    TamlAssetDeclaredVisitor assetDeclaredVisitor;
+    // The declared asset files in the order they were found.
+    Vector<AssetManifestCache::Entry*> fileEntries;
+
+    // The declared asset files that need parsing.
+    DeclaredAssetReadJob readJob;
 
     // Iterate files.
     for ( Vector<Platform::FileInfo>::iterator fileItr = files.begin(); fileItr != files.end(); ++fileItr )
@@ -2373,29 +2495,103 @@ bool AssetManager::scanDeclaredAssets( const char* pPath, const char* pExtension
         if ( dStricmp( pFilename + filenameLength - extensionLength, pExtension ) != 0 )
             continue;
 
-        // Clear declared assets.
-        assetDeclaredVisitor.clear();
-
         // Format full file-path.
         char assetFileBuffer[1024];
         dSprintf( assetFileBuffer, sizeof(assetFileBuffer), "%s/%s", fileInfo.pFullPath, fileInfo.pFileName );
+        StringTableEntry assetFilePath = StringTable->insert( assetFileBuffer );
 
-        // Parse the filename.
-        if ( !mTaml.parse( assetFileBuffer, assetDeclaredVisitor ) )
+        // Fetch the file modification time.
+        FileTime modifyTime;
+        dMemset( &modifyTime, 0, sizeof(modifyTime) );
+        Platform::getFileTimes( assetFilePath, NULL, &modifyTime );
+
+        // Use the cached asset declaration if the file has not changed.
+        AssetManifestCache::Entry* pEntry = mManifestCache ? manifestCache.find( assetFilePath, modifyTime, fileInfo.fileSize ) : NULL;
+
+        // Was the asset declaration cached?
+        if ( pEntry == NULL )
         {
-            // Warn.
-            Con::warnf( "Asset Manager: Failed to parse file containing asset declaration: '%s'.", assetFileBuffer );
+            // No, so the file needs parsing.
+            pEntry = manifestCache.insert( assetFilePath, modifyTime, fileInfo.fileSize );
+            readJob.mEntries.push_back( pEntry );
+            readJob.mFormatModes.push_back( mTaml.getFileAutoFormatMode( assetFilePath ) );
+        }
+
+        fileEntries.push_back( pEntry );
+    }
+
+    // Fetch the parse count.
+    const U32 readCount = (U32)readJob.mEntries.size();
+
+    // Are there any files to parse?
+    if ( readCount > 0 )
+    {
+        // Yes, so read the files on the job system.
+        readJob.mRootNodes.setSize( readCount );
+        JobSystem::parallelFor( readDeclaredAssetsChunk, &readJob, (readCount + DECLARED_ASSETS_READ_CHUNK_SIZE - 1) / DECLARED_ASSETS_READ_CHUNK_SIZE );
+
+        TamlAssetDeclaredVisitor assetDeclaredVisitor;
+
+        // Visit the files that were read.
+        for ( U32 index = 0; index < readCount; ++index )
+        {
+            // Fetch the root node.
+            TamlReadNode* pRootNode = readJob.mRootNodes[index];
+
+            // Skip if the file was not read.
+            // NOTE: The entry is kept without an asset type so the failure is reported until the file changes.
+            if ( pRootNode == NULL )
+                continue;
+
+            // Fetch entry.
+            AssetManifestCache::Entry* pEntry = readJob.mEntries[index];
+
+            // Clear declared assets.
+            assetDeclaredVisitor.clear();
+
+            // Visit the nodes.
+            TamlReadNodeParser parser( readJob.mFormatModes[index] );
+            parser.accept( pRootNode, pEntry->mFilePath, assetDeclaredVisitor );
+
+            // Store the asset declaration.
+            pEntry->mAssetDefinition = assetDeclaredVisitor.getAssetDefinition();
+            pEntry->mAssetDefinition.mAssetType = pRootNode->mTypeName;
+            pEntry->mAssetDefinition.mAssetBaseFilePath = pEntry->mFilePath;
+            pEntry->mAssetDependencies = assetDeclaredVisitor.getAssetDependencies();
+            pEntry->mAssetLooseFiles = assetDeclaredVisitor.getAssetLooseFiles();
+
+            delete pRootNode;
+        }
+    }
+
+    // Info.
+    if ( mEchoInfo )
+    {
+        Con::printf( "Asset Manager: Found %d declared asset files, %d cached and %d parsed.", fileEntries.size(), fileEntries.size() - readCount, readCount );
+    }
+
+    // Iterate asset declarations.
+    for ( Vector<AssetManifestCache::Entry*>::iterator entryItr = fileEntries.begin(); entryItr != fileEntries.end(); ++entryItr )
+    {
+        // Fetch entry.
+        const AssetManifestCache::Entry* pEntry = *entryItr;
+
+        // Was the file parsed?
+        if ( pEntry->mAssetDefinition.mAssetType == StringTable->EmptyString )
+        {
+            // No, so warn.
+            Con::warnf( "Asset Manager: Failed to parse file containing asset declaration: '%s'.", pEntry->mFilePath );
             continue;
         }
 
         // Fetch asset definition.
-        AssetDefinition& foundAssetDefinition = assetDeclaredVisitor.getAssetDefinition();
+        AssetDefinition foundAssetDefinition( pEntry->mAssetDefinition );
 
         // Did we get an asset name?
         if ( foundAssetDefinition.mAssetName == StringTable->EmptyString )
         {
             // No, so warn.
-            Con::warnf( "Asset Manager: Parsed file '%s' but did not encounter an asset.", assetFileBuffer );
+            Con::warnf( "Asset Manager: Parsed file '%s' but did not encounter an asset.", pEntry->mFilePath );
             continue;
         }
 
@@ -2447,13 +2643,13 @@ bool AssetManager::scanDeclaredAssets( const char* pPath, const char* pExtension
         StringTableEntry assetId = pAssetDefinition->mAssetId;
 
         // Fetch asset dependencies.
-        TamlAssetDeclaredVisitor::typeAssetIdVector& assetDependencies = assetDeclaredVisitor.getAssetDependencies();
+        const Vector<StringTableEntry>& assetDependencies = pEntry->mAssetDependencies;
 
         // Are there any asset dependencies?
         if ( assetDependencies.size() > 0 )
         {
             // Yes, so iterate dependencies.
-            for( TamlAssetDeclaredVisitor::typeAssetIdVector::iterator assetDependencyItr = assetDependencies.begin(); assetDependencyItr != assetDependencies.end(); ++assetDependencyItr )
+            for( Vector<StringTableEntry>::const_iterator assetDependencyItr = assetDependencies.begin(); assetDependencyItr != assetDependencies.end(); ++assetDependencyItr )
             {
                 // Fetch asset Ids.
                 StringTableEntry dependencyAssetId = *assetDependencyItr;
@@ -2473,13 +2669,13 @@ bool AssetManager::scanDeclaredAssets( const char* pPath, const char* pExtension
         }
 
         // Fetch asset loose files.
-        TamlAssetDeclaredVisitor::typeLooseFileVector& assetLooseFiles = assetDeclaredVisitor.getAssetLooseFiles();
+        const Vector<StringTableEntry>& assetLooseFiles = pEntry->mAssetLooseFiles;
 
         // Are there any loose files?
         if ( assetLooseFiles.size() > 0 )
         {
             // Yes, so iterate loose files.
-            for( TamlAssetDeclaredVisitor::typeLooseFileVector::iterator assetLooseFileItr = assetLooseFiles.begin(); assetLooseFileItr != assetLooseFiles.end(); ++assetLooseFileItr )
+            for( Vector<StringTableEntry>::const_iterator assetLooseFileItr = assetLooseFiles.begin(); assetLooseFileItr != assetLooseFiles.end(); ++assetLooseFileItr )
             {
                 // Fetch loose file.
                 StringTableEntry looseFile = *assetLooseFileItr;
@@ -59,6 +59,10 @@
 #include "assets/assetFieldTypes.h"
 #endif
 
+#ifndef _ASSET_ASYNC_ACQUIRER_H_
+#include "assets/assetAsyncAcquirer.h"
+#endif
+
 // Debug Profiling.
 #include "debug/profiler.h"
 
@@ -66,11 +70,14 @@
 
 class AssetPtrCallback;
 class AssetPtrBase;
+class AssetManifestCache;
 
 //-----------------------------------------------------------------------------
 
 class AssetManager : public SimObject, public ModuleCallbacks
 {
+    friend class AssetAsyncAcquirer;
+
 private:
     typedef SimObject Parent;
     typedef StringTableEntry typeAssetId;
@@ -102,6 +109,7 @@ private:
     /// Miscellaneous.
     bool                                mEchoInfo;
     bool                                mIgnoreAutoUnload;
+    bool                                mManifestCache;
     U32                                 mLoadedInternalAssetsCount;
     U32                                 mLoadedExternalAssetsCount;
     U32                                 mLoadedPrivateAssetsCount;
@@ -322,6 +330,12 @@ public:
     bool releaseAsset( const char* pAssetId );
     void purgeAssets( void );
 
+    /// Asynchronous asset acquisition (see AssetAsyncAcquirer).
+    U32 acquireAssetAsync( const char* pAssetId, const S32 priority = 0, AssetAcquiredCallback callback = NULL, void* pUserData = NULL, SimObject* pNotifyObject = NULL );
+    bool cancelAcquireAssetAsync( const U32 requestId );
+    void flushAcquireAssetAsync( void );
+    U32 getPendingAcquireAssetAsyncCount( void ) const;
+
     /// Asset deletion.
     bool deleteAsset( const char* pAssetId, const bool deleteLooseFiles, const bool deleteDependencies );
 
@@ -371,7 +385,7 @@ public:
     DECLARE_CONOBJECT( AssetManager );
 
 private:
-    bool scanDeclaredAssets( const char* pPath, const char* pExtension, const bool recurse, ModuleDefinition* pModuleDefinition );
+    bool scanDeclaredAssets( const char* pPath, const char* pExtension, const bool recurse, ModuleDefinition* pModuleDefinition, AssetManifestCache& manifestCache );
     bool scanReferencedAssets( const char* pPath, const char* pExtension, const bool recurse );
     AssetDefinition* findAsset( const char* pAssetId );
     void addReferencedAsset( StringTableEntry assetId, StringTableEntry referenceFilePath );
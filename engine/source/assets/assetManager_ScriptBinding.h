@@ -369,6 +369,77 @@ ConsoleMethodWithDocs( AssetManager, releaseAsset, ConsoleBool, 3, 3, (assetId))
 
 //-----------------------------------------------------------------------------
 
+/*! Acquire the specified asset Id without blocking.
+    The asset files are read and its images decoded in the background and the textures are uploaded over
+    the following frames.  Completion is notified with the callback "onAssetAcquired(%requestId, %assetId, %asset)"
+    on the notify object where the asset is an empty string if it could not be acquired.
+    You must release the asset once you're finished with it using 'releaseAsset'.  If the notify object
+    is deleted before completion then the asset is released.
+    @param assetId The selected asset Id.
+    @param priority The priority of the request.  Requests with a higher priority are acquired first.  Optional: Defaults to zero.
+    @param notifyObject The object to notify.  Optional: Defaults to the asset manager.
+    @return The request Id or zero if the asset could not be found.
+*/
+ConsoleMethodWithDocs( AssetManager, acquireAssetAsync, ConsoleInt, 3, 5, (assetId, [priority], [notifyObject]))
+{
+    // Fetch asset Id.
+    const char* pAssetId = argv[2];
+
+    // Fetch priority.
+    const S32 priority = argc >= 4 ? dAtoi(argv[3]) : 0;
+
+    // Fetch notify object.
+    SimObject* pNotifyObject = object;
+    if ( argc >= 5 )
+    {
+        pNotifyObject = Sim::findObject( argv[4] );
+
+        // Did we find the notify object?
+        if ( pNotifyObject == NULL )
+        {
+            // No, so warn.
+            Con::warnf( "AssetManager::acquireAssetAsync() - Could not find notify object '%s'.", argv[4] );
+            return 0;
+        }
+    }
+
+    return object->acquireAssetAsync( pAssetId, priority, NULL, NULL, pNotifyObject );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Cancel an asset acquisition started with 'acquireAssetAsync'.
+    A cancelled request is not notified and releases anything it has loaded.
+    @param requestId The request Id.
+    @return Whether the request was found and cancelled.
+*/
+ConsoleMethodWithDocs( AssetManager, cancelAcquireAssetAsync, ConsoleBool, 3, 3, (requestId))
+{
+    return object->cancelAcquireAssetAsync( dAtoi(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Complete all the asset acquisitions started with 'acquireAssetAsync' immediately.
+    @return No return value.
+*/
+ConsoleMethodWithDocs( AssetManager, flushAcquireAssetAsync, ConsoleVoid, 2, 2, ())
+{
+    object->flushAcquireAssetAsync();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the number of asset acquisitions started with 'acquireAssetAsync' that have not completed.
+    @return The number of pending asset acquisitions.
+*/
+ConsoleMethodWithDocs( AssetManager, getPendingAcquireAssetAsyncCount, ConsoleInt, 2, 2, ())
+{
+    return object->getPendingAcquireAssetAsyncCount();
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Purge all assets that are not referenced even if they are set to not auto-unload.
     Assets can be in this state because they are either set to not auto-unload or the asset manager has/is disabling auto-unload.
     @return No return value.
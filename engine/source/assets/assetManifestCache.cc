@@ -0,0 +1,314 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+
+#include "assets/assetManifestCache.h"
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+#ifndef _RESMANAGER_H_
+#include "io/resource/resourceManager.h"
+#endif
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+#define ASSET_MANIFEST_CACHE_MAX_STRING         1024
+
+//-----------------------------------------------------------------------------
+
+static bool readCacheString( Stream& stream, StringTableEntry& string )
+{
+    char stringBuffer[ASSET_MANIFEST_CACHE_MAX_STRING+1];
+    stream.readLongString( ASSET_MANIFEST_CACHE_MAX_STRING, stringBuffer );
+
+    // Fail if the string was not read.
+    if ( stream.getStatus() != Stream::Ok )
+        return false;
+
+    string = StringTable->insert( stringBuffer );
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+static bool readCacheStrings( Stream& stream, Vector<StringTableEntry>& strings )
+{
+    U32 stringCount = 0;
+    if ( !stream.read( &stringCount ) )
+        return false;
+
+    strings.setSize( stringCount );
+    for ( U32 index = 0; index < stringCount; ++index )
+    {
+        if ( !readCacheString( stream, strings[index] ) )
+            return false;
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+static void writeCacheStrings( Stream& stream, const Vector<StringTableEntry>& strings )
+{
+    stream.write( (U32)strings.size() );
+    for ( S32 index = 0; index < strings.size(); ++index )
+        stream.writeLongString( ASSET_MANIFEST_CACHE_MAX_STRING, strings[index] );
+}
+
+//-----------------------------------------------------------------------------
+
+AssetManifestCache::AssetManifestCache() :
+    mDirty( false )
+{
+}
+
+//-----------------------------------------------------------------------------
+
+AssetManifestCache::~AssetManifestCache()
+{
+    clear();
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetManifestCache::read( const char* pCacheFilePath )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManifestCache_Read);
+
+    // Sanity!
+    AssertFatal( pCacheFilePath != NULL, "Cannot read an asset manifest cache with a NULL file-path." );
+
+    // Remove any entries.
+    clear();
+
+    // Finish if there's no cache.
+    if ( !Platform::isFile( pCacheFilePath ) )
+        return false;
+
+    // Open the cache.
+    FileStream stream;
+    if ( !stream.open( pCacheFilePath, FileStream::Read ) )
+        return false;
+
+    // Finish if the cache isn't the current version.
+    StringTableEntry signature = StringTable->EmptyString;
+    U32 version = 0;
+    U32 entryCount = 0;
+    if ( !readCacheString( stream, signature ) || signature != StringTable->insert( ASSET_MANIFEST_CACHE_SIGNATURE ) ||
+         !stream.read( &version ) || version != ASSET_MANIFEST_CACHE_VERSION ||
+         !stream.read( &entryCount ) )
+    {
+        stream.close();
+        return false;
+    }
+
+    // Read the entries.
+    for ( U32 index = 0; index < entryCount; ++index )
+    {
+        Entry* pEntry = new Entry();
+        AssetDefinition& assetDefinition = pEntry->mAssetDefinition;
+
+        bool entryRead =
+            readCacheString( stream, pEntry->mFilePath ) &&
+            stream.read( sizeof(FileTime), &pEntry->mModifyTime ) &&
+            stream.read( &pEntry->mFileSize ) &&
+            readCacheString( stream, assetDefinition.mAssetType ) &&
+            readCacheString( stream, assetDefinition.mAssetName ) &&
+            readCacheString( stream, assetDefinition.mAssetDescription ) &&
+            readCacheString( stream, assetDefinition.mAssetCategory ) &&
+            stream.read( &assetDefinition.mAssetAutoUnload ) &&
+            stream.read( &assetDefinition.mAssetInternal ) &&
+            readCacheStrings( stream, pEntry->mAssetDependencies ) &&
+            readCacheStrings( stream, pEntry->mAssetLooseFiles );
+
+        // Discard the whole cache if the entry was not read.
+        if ( !entryRead )
+        {
+            delete pEntry;
+            stream.close();
+            clear();
+            return false;
+        }
+
+        // The asset is declared in the file.
+        assetDefinition.mAssetBaseFilePath = pEntry->mFilePath;
+        pEntry->mUsed = false;
+
+        mEntries.insert( pEntry->mFilePath, pEntry );
+    }
+
+    stream.close();
+
+    mDirty = false;
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetManifestCache::write( const char* pCacheFilePath )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManifestCache_Write);
+
+    // Sanity!
+    AssertFatal( pCacheFilePath != NULL, "Cannot write an asset manifest cache with a NULL file-path." );
+
+    // Open the cache.
+    FileStream stream;
+    if ( !ResourceManager->openFileForWrite( stream, pCacheFilePath ) )
+        return false;
+
+    // Write the header.
+    stream.writeLongString( ASSET_MANIFEST_CACHE_MAX_STRING, ASSET_MANIFEST_CACHE_SIGNATURE );
+    stream.write( (U32)ASSET_MANIFEST_CACHE_VERSION );
+    stream.write( (U32)mEntries.size() );
+
+    // Write the entries.
+    for ( typeEntryHash::iterator entryItr = mEntries.begin(); entryItr != mEntries.end(); ++entryItr )
+    {
+        const Entry* pEntry = entryItr->value;
+        const AssetDefinition& assetDefinition = pEntry->mAssetDefinition;
+
+        stream.writeLongString( ASSET_MANIFEST_CACHE_MAX_STRING, pEntry->mFilePath );
+        stream.write( sizeof(FileTime), &pEntry->mModifyTime );
+        stream.write( pEntry->mFileSize );
+        stream.writeLongString( ASSET_MANIFEST_CACHE_MAX_STRING, assetDefinition.mAssetType );
+        stream.writeLongString( ASSET_MANIFEST_CACHE_MAX_STRING, assetDefinition.mAssetName );
+        stream.writeLongString( ASSET_MANIFEST_CACHE_MAX_STRING, assetDefinition.mAssetDescription );
+        stream.writeLongString( ASSET_MANIFEST_CACHE_MAX_STRING, assetDefinition.mAssetCategory );
+        stream.write( assetDefinition.mAssetAutoUnload );
+        stream.write( assetDefinition.mAssetInternal );
+        writeCacheStrings( stream, pEntry->mAssetDependencies );
+        writeCacheStrings( stream, pEntry->mAssetLooseFiles );
+    }
+
+    const bool status = stream.getStatus() == Stream::Ok;
+
+    stream.close();
+
+    // The cache is up-to-date if it was written.
+    if ( status )
+        mDirty = false;
+
+    return status;
+}
+
+//-----------------------------------------------------------------------------
+
+AssetManifestCache::Entry* AssetManifestCache::find( StringTableEntry filePath, const FileTime& modifyTime, const U32 fileSize )
+{
+    // Find the entry.
+    typeEntryHash::iterator entryItr = mEntries.find( filePath );
+    if ( entryItr == mEntries.end() )
+        return NULL;
+
+    Entry* pEntry = entryItr->value;
+
+    // Finish if the file has changed.
+    if ( pEntry->mFileSize != fileSize || Platform::compareFileTimes( pEntry->mModifyTime, modifyTime ) != 0 )
+        return NULL;
+
+    // Flag as used.
+    pEntry->mUsed = true;
+
+    return pEntry;
+}
+
+//-----------------------------------------------------------------------------
+
+AssetManifestCache::Entry* AssetManifestCache::insert( StringTableEntry filePath, const FileTime& modifyTime, const U32 fileSize )
+{
+    // Find any existing entry.
+    Entry* pEntry = NULL;
+    typeEntryHash::iterator entryItr = mEntries.find( filePath );
+    if ( entryItr != mEntries.end() )
+    {
+        // Reuse it.
+        pEntry = entryItr->value;
+        pEntry->mAssetDefinition.reset();
+        pEntry->mAssetDependencies.clear();
+        pEntry->mAssetLooseFiles.clear();
+    }
+    else
+    {
+        // Create an entry.
+        pEntry = new Entry();
+        mEntries.insert( filePath, pEntry );
+    }
+
+    pEntry->mFilePath = filePath;
+    pEntry->mModifyTime = modifyTime;
+    pEntry->mFileSize = fileSize;
+    pEntry->mUsed = true;
+    pEntry->mAssetDefinition.mAssetBaseFilePath = filePath;
+
+    mDirty = true;
+
+    return pEntry;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 AssetManifestCache::removeUnused( void )
+{
+    // Find the unused entries.
+    Vector<StringTableEntry> unusedFilePaths;
+    for ( typeEntryHash::iterator entryItr = mEntries.begin(); entryItr != mEntries.end(); ++entryItr )
+    {
+        if ( !entryItr->value->mUsed )
+            unusedFilePaths.push_back( entryItr->key );
+    }
+
+    // Remove them.
+    for ( S32 index = 0; index < unusedFilePaths.size(); ++index )
+    {
+        typeEntryHash::iterator entryItr = mEntries.find( unusedFilePaths[index] );
+        delete entryItr->value;
+        mEntries.erase( entryItr );
+    }
+
+    if ( unusedFilePaths.size() > 0 )
+        mDirty = true;
+
+    return (U32)unusedFilePaths.size();
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManifestCache::clear( void )
+{
+    for ( typeEntryHash::iterator entryItr = mEntries.begin(); entryItr != mEntries.end(); ++entryItr )
+        delete entryItr->value;
+
+    mEntries.clear();
+
+    mDirty = false;
+}
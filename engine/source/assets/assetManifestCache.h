@@ -0,0 +1,110 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+
+#ifndef _ASSET_MANIFEST_CACHE_H_
+#define _ASSET_MANIFEST_CACHE_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _HASHTABLE_H
+#include "collection/hashTable.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+#ifndef _ASSET_DEFINITION_H_
+#include "assets/assetDefinition.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define ASSET_MANIFEST_CACHE_FILENAME           "assets.manifest"
+#define ASSET_MANIFEST_CACHE_SIGNATURE          "AssetManifestCache"
+#define ASSET_MANIFEST_CACHE_VERSION            1
+
+//-----------------------------------------------------------------------------
+
+/// The assets declared by the files of a module.
+///
+/// Each entry holds what the asset manager found when it parsed a declared asset file
+/// and is keyed on the file-path, modification time and size of the file.  The cache
+/// is persisted in the module path so that, when a module is loaded again, only the
+/// declared asset files that have changed since it was last scanned need parsing.
+class AssetManifestCache
+{
+public:
+    /// The asset declared by a file.
+    struct Entry
+    {
+        StringTableEntry            mFilePath;
+        FileTime                    mModifyTime;
+        U32                         mFileSize;
+        bool                        mUsed;
+
+        AssetDefinition             mAssetDefinition;
+        Vector<StringTableEntry>    mAssetDependencies;
+        Vector<StringTableEntry>    mAssetLooseFiles;
+    };
+
+private:
+    typedef HashMap<StringTableEntry, Entry*> typeEntryHash;
+
+    typeEntryHash   mEntries;
+    bool            mDirty;
+
+public:
+    AssetManifestCache();
+    ~AssetManifestCache();
+
+    /// Read the cache (replacing any entries).
+    /// @return Whether the cache was read.  A missing or out-of-date cache is not read.
+    bool read( const char* pCacheFilePath );
+
+    /// Write the cache.
+    /// @return Whether the cache was written.
+    bool write( const char* pCacheFilePath );
+
+    /// Find the entry for a file, flagging it as used.
+    /// @return The entry or NULL if the file isn't cached or has changed.
+    Entry* find( StringTableEntry filePath, const FileTime& modifyTime, const U32 fileSize );
+
+    /// Insert an empty entry for a file (replacing any existing entry), flagging it as used.
+    Entry* insert( StringTableEntry filePath, const FileTime& modifyTime, const U32 fileSize );
+
+    /// Remove the entries that were not used since the cache was read.
+    /// @return The number of entries removed.
+    U32 removeUnused( void );
+
+    /// Remove all the entries.
+    void clear( void );
+
+    inline U32 size( void ) const                               { return mEntries.size(); }
+    inline bool isDirty( void ) const                           { return mDirty; }
+};
+
+#endif // _ASSET_MANIFEST_CACHE_H_
@@ -90,7 +90,7 @@ private:
       Node* mNext;
       Pair mPair;
       Node(): mNext(0) {}
-      Node(Pair p,Node* n): mPair(p),mNext(n) {}
+      Node(Pair p,Node* n): mNext(n),mPair(p) {}
    };
 
    Node** mTable;                      ///< Hash table
@@ -0,0 +1,246 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SLOTMAP_H_
+#define _SLOTMAP_H_
+
+//Includes
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+#ifndef _PLATFORMASSERT_H_
+#include "platform/platformAssert.h"
+#endif
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+//-----------------------------------------------------------------------------
+/// A generational slot map.
+///
+/// The slot map owns a set of objects which are identified by a non-zero Id.
+/// The Id is made of the index of the slot the object lives in and the
+/// generation of that slot, which is bumped each time the slot is reused, so
+/// the Id of a removed object never finds the object that replaces it.
+///
+/// - Inserting, finding and removing an object is O(1).
+/// - The live objects are iterated from a dense array without gaps.
+/// - The objects are allocated in chunks and never move so pointers to them
+///   stay valid until they are removed.
+///
+/// Removed objects are not destructed; they are kept for reuse by a later
+/// insert so the caller is expected to reset their state.  All the objects
+/// are destructed when the slot map is.
+///
+/// Slots are reused in order of their index after the map is cleared so the
+/// Ids of objects inserted into a new (or cleared) map are 1, 2, 3 and so on.
+template <class T>
+class SlotMap
+{
+public:
+   enum
+   {
+      IndexBits      = 20,                   ///< Bits of the Id used for the slot index.
+      GenerationBits = 11,                   ///< Bits of the Id used for the generation (the Id stays positive as an S32).
+      MaxSlots       = (1 << IndexBits) - 1, ///< The maximum number of live objects.
+      IndexMask      = (1 << IndexBits) - 1,
+      GenerationMask = (1 << GenerationBits) - 1,
+
+      MinChunkSize   = 16,                   ///< Objects in the first chunk.
+      MaxChunkSize   = 1024,                 ///< Objects in the largest chunk.
+   };
+
+   typedef T**       iterator;
+   typedef T* const* const_iterator;
+
+private:
+   enum { InvalidDenseIndex = 0xFFFFFFFF };
+
+   struct Slot
+   {
+      T*  mpObject;
+      U32 mGeneration;
+      U32 mDenseIndex;
+   };
+
+   Vector<Slot>   mSlots;
+   Vector<U32>    mFreeSlots;
+   Vector<T*>     mDense;
+   Vector<U32>    mDenseSlots;
+
+   Vector<T*>     mChunks;
+   U32            mChunkSize;
+   U32            mChunkUsed;
+
+   T* allocateObject();
+
+public:
+   SlotMap();
+   ~SlotMap();
+
+   /// Insert an object.
+   /// @param id The Id of the inserted object.
+   /// @return The inserted object.
+   T* insert(U32& id);
+
+   /// Remove the object with the specified Id.
+   /// @return The removed object (kept for reuse) or NULL if the Id was not found.
+   T* erase(const U32 id);
+
+   /// Find the object with the specified Id or NULL if it's not found.
+   inline T* find(const U32 id) const
+   {
+      const U32 index = (id & IndexMask) - 1;
+      if (index >= (U32)mSlots.size())
+         return NULL;
+
+      const Slot& slot = mSlots[index];
+      if (slot.mDenseIndex == InvalidDenseIndex || slot.mGeneration != (id >> IndexBits))
+         return NULL;
+
+      return slot.mpObject;
+   }
+
+   /// Remove all the objects (keeping them for reuse) and restart the Ids.
+   void clear();
+
+   inline U32 size() const { return (U32)mDense.size(); }
+   inline bool empty() const { return mDense.size() == 0; }
+
+   /// The number of objects allocated (live and kept for reuse).
+   inline U32 capacity() const { return (U32)mSlots.size(); }
+
+   /// Iterate the live objects.
+   inline iterator begin() { return mDense.begin(); }
+   inline iterator end() { return mDense.end(); }
+   inline const_iterator begin() const { return mDense.begin(); }
+   inline const_iterator end() const { return mDense.end(); }
+   inline T* operator[](const U32 index) const { return mDense[index]; }
+};
+
+template <class T>
+inline SlotMap<T>::SlotMap()
+{
+   mChunkSize = 0;
+   mChunkUsed = 0;
+}
+
+template <class T>
+inline SlotMap<T>::~SlotMap()
+{
+   for (S32 i = 0; i < mChunks.size(); i++)
+      delete [] mChunks[i];
+}
+
+template <class T>
+inline T* SlotMap<T>::allocateObject()
+{
+   // Start a new chunk if the current one is full.
+   if (mChunkUsed == mChunkSize)
+   {
+      mChunkSize = mChunkSize == 0 ? (U32)MinChunkSize : getMin(mChunkSize * 2, (U32)MaxChunkSize);
+      mChunks.push_back(new T[mChunkSize]);
+      mChunkUsed = 0;
+   }
+
+   return mChunks.last() + mChunkUsed++;
+}
+
+template <class T>
+inline T* SlotMap<T>::insert(U32& id)
+{
+   U32 index;
+   if (mFreeSlots.size() > 0)
+   {
+      // Reuse a free slot.
+      index = mFreeSlots.last();
+      mFreeSlots.pop_back();
+   }
+   else
+   {
+      AssertISV(mSlots.size() < MaxSlots, "SlotMap::insert() - Too many objects.");
+
+      // Add a slot.
+      index = (U32)mSlots.size();
+      Slot slot;
+      slot.mpObject = allocateObject();
+      slot.mGeneration = 0;
+      slot.mDenseIndex = InvalidDenseIndex;
+      mSlots.push_back(slot);
+   }
+
+   Slot& slot = mSlots[index];
+   slot.mDenseIndex = (U32)mDense.size();
+   mDense.push_back(slot.mpObject);
+   mDenseSlots.push_back(index);
+
+   id = (slot.mGeneration << IndexBits) | (index + 1);
+   return slot.mpObject;
+}
+
+template <class T>
+inline T* SlotMap<T>::erase(const U32 id)
+{
+   T* pObject = find(id);
+   if (pObject == NULL)
+      return NULL;
+
+   const U32 index = (id & IndexMask) - 1;
+   Slot& slot = mSlots[index];
+
+   // Move the last live object into the gap.
+   const U32 denseIndex = slot.mDenseIndex;
+   const U32 lastIndex = (U32)mDense.size() - 1;
+   if (denseIndex != lastIndex)
+   {
+      mDense[denseIndex] = mDense[lastIndex];
+      mDenseSlots[denseIndex] = mDenseSlots[lastIndex];
+      mSlots[mDenseSlots[denseIndex]].mDenseIndex = denseIndex;
+   }
+   mDense.pop_back();
+   mDenseSlots.pop_back();
+
+   // Free the slot for a new generation.
+   slot.mDenseIndex = InvalidDenseIndex;
+   slot.mGeneration = (slot.mGeneration + 1) & GenerationMask;
+   mFreeSlots.push_back(index);
+
+   return pObject;
+}
+
+template <class T>
+inline void SlotMap<T>::clear()
+{
+   mDense.clear();
+   mDenseSlots.clear();
+
+   // Free all the slots, lowest index last so it's reused first.
+   mFreeSlots.setSize(mSlots.size());
+   for (S32 i = 0; i < mSlots.size(); i++)
+   {
+      mSlots[i].mGeneration = 0;
+      mSlots[i].mDenseIndex = InvalidDenseIndex;
+      mFreeSlots[mSlots.size() - 1 - i] = (U32)i;
+   }
+}
+
+#endif // _SLOTMAP_H_
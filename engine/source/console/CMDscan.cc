@@ -2210,17 +2210,21 @@ void CMDerror(char *format, ...)
       Con::warnf(ConsoleLogEntry::Script, ">>> Error report complete.\n");
 #endif
 
-      // Update the script-visible error buffer.
-      const char *prevStr = Con::getVariable("$ScriptError");
-      if (prevStr[0])
-         dSprintf(tempBuf, sizeof(tempBuf), "%s\n%s Line: %d - Syntax error.", prevStr, fileName, lineIndex);
-      else
-         dSprintf(tempBuf, sizeof(tempBuf), "%s Line: %d - Syntax error.", fileName, lineIndex);
-      Con::setVariable("$ScriptError", tempBuf);
+      // Update the script-visible error buffer.  Scripts compiled in the background
+      // don't, their errors are reported again when they're executed.
+      if (Con::isMainThread())
+      {
+         const char *prevStr = Con::getVariable("$ScriptError");
+         if (prevStr[0])
+            dSprintf(tempBuf, sizeof(tempBuf), "%s\n%s Line: %d - Syntax error.", prevStr, fileName, lineIndex);
+         else
+            dSprintf(tempBuf, sizeof(tempBuf), "%s Line: %d - Syntax error.", fileName, lineIndex);
+         Con::setVariable("$ScriptError", tempBuf);
 
-      // We also need to mark that we came up with a new error.
-      static S32 sScriptErrorHash=1000;
-      Con::setIntVariable("$ScriptErrorHash", sScriptErrorHash++);
+         // We also need to mark that we came up with a new error.
+         static S32 sScriptErrorHash=1000;
+         Con::setIntVariable("$ScriptErrorHash", sScriptErrorHash++);
+      }
    }
    else
       Con::errorf(ConsoleLogEntry::Script, tempBuf);
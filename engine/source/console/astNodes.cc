@@ -68,20 +68,21 @@ using namespace Compiler;
 void StmtNode::addBreakCount()
 {
    #ifndef TORQUE_EXTRA_BREAKLINES      
-   if(CodeBlock::smInFunction)
+   if(getState().inFunction)
    #endif
-      CodeBlock::smBreakLineCount++;
+      getState().breakLineCount++;
 }
 
 void StmtNode::addBreakLine(U32 ip)
 {
    #ifndef TORQUE_EXTRA_BREAKLINES      
-   if(CodeBlock::smInFunction)
+   if(getState().inFunction)
    {
    #endif
 
-      U32 line = CodeBlock::smBreakLineCount * 2;
-      CodeBlock::smBreakLineCount++;
+      CompilerState &state = getState();
+      U32 line = state.breakLineCount * 2;
+      state.breakLineCount++;
 
       if(getBreakCodeBlock()->lineBreakPairs)
       {
@@ -1315,10 +1316,8 @@ U32 FuncCallExprNode::compile(U32 *codeStream, U32 ip, TypeReq type)
       ip = walk->compile(codeStream, ip, TypeReqString);
       codeStream[ip++] = OP_PUSH;
    }
-   if(callType == MethodCall || callType == ParentCall)
-      codeStream[ip++] = OP_CALLFUNC;
-   else
-      codeStream[ip++] = OP_CALLFUNC_RESOLVE;
+   // Every call site resolves to a call site cache the first time it's executed.
+   codeStream[ip++] = OP_CALLFUNC_RESOLVE;
 
    STEtoCode(funcName, ip, codeStream);
    ip += 2;
@@ -1451,9 +1450,60 @@ TypeReq InternalSlotAccessNode::getPreferredType()
 
 //------------------------------------------------------------
 
+static TypeReq getSlotAssignValueType(SlotAssignNode *node)
+{
+   // Arithmetic results are stored on object fields as numbers, without going
+   // through a string.  Literals are stored as the text they compile to.
+   if(!node->objectExpr)
+      return TypeReqString;
+
+   ExprNode *valueExpr = node->valueExpr;
+   if(dynamic_cast<IntBinaryExprNode *>(valueExpr) || dynamic_cast<IntUnaryExprNode *>(valueExpr))
+      return TypeReqUInt;
+   if(dynamic_cast<FloatBinaryExprNode *>(valueExpr) || dynamic_cast<FloatUnaryExprNode *>(valueExpr))
+      return TypeReqFloat;
+   if(dynamic_cast<AssignOpExprNode *>(valueExpr) || dynamic_cast<SlotAssignOpNode *>(valueExpr))
+   {
+      TypeReq valueType = valueExpr->getPreferredType();
+      if(valueType == TypeReqUInt || valueType == TypeReqFloat)
+         return valueType;
+   }
+
+   return TypeReqString;
+}
+
 U32 SlotAssignNode::precompile(TypeReq type)
 {
-   // first eval the expression TypeReqString
+   // if the value is a number (see getSlotAssignValueType):
+
+   // eval the expression as its type
+   // if it's an array:
+   // eval array
+   // OP_ADVANCE_STR
+   // evaluate object expr
+   // OP_SETCUROBJECT
+   // OP_SETCURFIELD
+   // fieldName
+   // if it's an array:
+   // OP_TERMINATE_REWIND_STR
+   // OP_SETCURFIELDARRAY
+   // OP_SAVEFIELD of appropriate type
+   // convert to return type if necessary.
+
+   TypeReq valueType = getSlotAssignValueType(this);
+   if(valueType != TypeReqString)
+   {
+      precompileIdent(slotName);
+      U32 size = valueExpr->precompile(valueType);
+      if(type != valueType)
+         size++;
+      if(arrayExpr)
+         return size + 8 + arrayExpr->precompile(TypeReqString) + objectExpr->precompile(TypeReqString);
+      else
+         return size + 5 + objectExpr->precompile(TypeReqString);
+   }
+
+   // otherwise first eval the expression TypeReqString
 
    // if it's an array:
 
@@ -1501,6 +1551,31 @@ U32 SlotAssignNode::precompile(TypeReq type)
 
 U32 SlotAssignNode::compile(U32 *codeStream, U32 ip, TypeReq type)
 {
+   TypeReq valueType = getSlotAssignValueType(this);
+   if(valueType != TypeReqString)
+   {
+      ip = valueExpr->compile(codeStream, ip, valueType);
+      if(arrayExpr)
+      {
+         ip = arrayExpr->compile(codeStream, ip, TypeReqString);
+         codeStream[ip++] = OP_ADVANCE_STR;
+      }
+      ip = objectExpr->compile(codeStream, ip, TypeReqString);
+      codeStream[ip++] = OP_SETCUROBJECT;
+      codeStream[ip++] = OP_SETCURFIELD;
+      STEtoCode(slotName, ip, codeStream);
+      ip += 2;
+      if(arrayExpr)
+      {
+         codeStream[ip++] = OP_TERMINATE_REWIND_STR;
+         codeStream[ip++] = OP_SETCURFIELD_ARRAY;
+      }
+      codeStream[ip++] = (valueType == TypeReqFloat) ? OP_SAVEFIELD_FLT : OP_SAVEFIELD_UINT;
+      if(valueType != type)
+         codeStream[ip++] = conversionOp(valueType, type);
+      return ip;
+   }
+
    ip = valueExpr->compile(codeStream, ip, TypeReqString);
    codeStream[ip++] = OP_ADVANCE_STR;
    if(arrayExpr)
@@ -1730,7 +1805,7 @@ U32 FunctionDeclStmtNode::precompileStmt(U32)
    for(VarNode *walk = args; walk; walk = (VarNode *)((StmtNode*)walk)->getNext())
       argc++;
    
-   CodeBlock::smInFunction = true;
+   getState().inFunction = true;
    
    precompileIdent(fnName);
    precompileIdent(nameSpace);
@@ -1742,7 +1817,7 @@ U32 FunctionDeclStmtNode::precompileStmt(U32)
       addBreakCount();   
    #endif
 
-   CodeBlock::smInFunction = false;
+   getState().inFunction = false;
 
    setCurrentStringTable(&getGlobalStringTable());
    setCurrentFloatTable(&getGlobalFloatTable());
@@ -1769,14 +1844,14 @@ U32 FunctionDeclStmtNode::compileStmt(U32 *codeStream, U32 ip, U32, U32)
       STEtoCode(walk->varName, ip, codeStream);
       ip += 2;
    }
-   CodeBlock::smInFunction = true;
+   getState().inFunction = true;
    ip = compileBlock(stmts, codeStream, ip, 0, 0);
 
    #ifdef TORQUE_EXTRA_BREAKLINES      
       addBreakLine(ip);   
    #endif
 
-   CodeBlock::smInFunction = false;
+   getState().inFunction = false;
    codeStream[ip++] = OP_RETURN;
    return ip;
 }
\ No newline at end of file
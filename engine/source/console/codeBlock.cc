@@ -23,6 +23,8 @@
 #include "console/compiler.h"
 #include "console/codeBlock.h"
 #include "io/resource/resourceManager.h"
+#include "platform/platformFileIO.h"
+#include "io/memstream.h"
 #include "math/mMath.h"
 
 #include "debug/telnetDebugger.h"
@@ -33,11 +35,11 @@
 
 using namespace Compiler;
 
-bool           CodeBlock::smInFunction = false;
-U32            CodeBlock::smBreakLineCount = 0;
 CodeBlock *    CodeBlock::smCodeBlockList = NULL;
 CodeBlock *    CodeBlock::smCurrentCodeBlock = NULL;
 ConsoleParser *CodeBlock::smCurrentParser = NULL;
+bool           CodeBlock::smCallSiteCaching = true;
+bool           CodeBlock::smMapDSOs = true;
 
 //-------------------------------------------------------------------------
 
@@ -57,6 +59,9 @@ CodeBlock::CodeBlock()
    fullPath = NULL;
    modPath = NULL;
    mRoot = StringTable->EmptyString;
+   mpCallSites = NULL;
+   mpFileView = NULL;
+   mpImage = NULL;
 }
 
 CodeBlock::~CodeBlock()
@@ -66,12 +71,23 @@ CodeBlock::~CodeBlock()
 
    if(name)
       removeFromCodeList();
-   delete[] const_cast<char*>(globalStrings);
-   delete[] const_cast<char*>(functionStrings);
-   delete[] globalFloats;
-   delete[] functionFloats;
-   delete[] code;
+
+   if(mpFileView != NULL || mpImage != NULL)
+   {
+      // The code, strings and floats are in the DSO image.
+      delete mpFileView;
+      delete[] mpImage;
+   }
+   else
+   {
+      delete[] const_cast<char*>(globalStrings);
+      delete[] const_cast<char*>(functionStrings);
+      delete[] globalFloats;
+      delete[] functionFloats;
+      delete[] code;
+   }
    delete[] breakList;
+   clearCallSites();
 }
 
 //-------------------------------------------------------------------------
@@ -348,7 +364,50 @@ void CodeBlock::calcBreakList()
        pRemoteDebugger->addCodeBlock( this );
 }
 
-bool CodeBlock::read(StringTableEntry fileName, Stream &st)
+// The layout of a DSO.
+//
+// The header is followed by the string, float, code and identifier sections,
+// each aligned so that a DSO can be used in place once it's in memory.  The
+// identifier section holds, for each identifier, its global string offset,
+// its string table hash and the code offsets to patch with it.
+struct DSOHeader
+{
+   U32 version;
+   U32 byteOrder;
+   U32 imageSize;
+   U32 globalStringsOffset;
+   U32 globalStringsSize;
+   U32 functionStringsOffset;
+   U32 functionStringsSize;
+   U32 globalFloatsOffset;
+   U32 globalFloatCount;
+   U32 functionFloatsOffset;
+   U32 functionFloatCount;
+   U32 codeOffset;
+   U32 codeSize;
+   U32 lineBreakPairCount;
+   U32 identsOffset;
+   U32 identCount;
+};
+
+static const U32 DSOByteOrder = 0x01020304;
+static const U32 DSOSectionAlignment = 8;
+
+static inline U32 alignDSOSection(U32 offset)
+{
+   return (offset + (DSOSectionAlignment - 1)) & ~(DSOSectionAlignment - 1);
+}
+
+static void padDSOSection(Stream &st, U32 &position, U32 offset)
+{
+   AssertFatal(position <= offset, "padDSOSection - The section was overwritten.");
+   for(; position < offset; position++)
+      st.write(U8(0));
+}
+
+//-------------------------------------------------------------------------
+
+void CodeBlock::setFileName(StringTableEntry fileName)
 {
    const StringTableEntry exePath = Platform::getMainDotCsDir();
    const StringTableEntry cwd = Platform::getCurrentDirectory();
@@ -390,82 +449,62 @@ bool CodeBlock::read(StringTableEntry fileName, Stream &st)
 
    //
    addToCodeList();
+}
 
-   U32 globalSize,size,i;
-   st.read(&size);
-   if(size)
-   {
-      globalSize = size;
-      globalStrings = new char[size];
-      st.read(size, globalStrings);
-   }
-   st.read(&size);
-   if(size)
-   {
-      functionStrings = new char[size];
-      st.read(size, functionStrings);
-   }
-   st.read(&size);
-   if(size)
-   {
-      globalFloats = new F64[size];
-      for(U32 i = 0; i < size; i++)
-         st.read(&globalFloats[i]);
-   }
-   st.read(&size);
-   if(size)
+bool CodeBlock::loadImage(U8 *pImage, U32 imageSize)
+{
+   const DSOHeader *pHeader = (const DSOHeader *) pImage;
+
+   if(imageSize < sizeof(DSOHeader) || pHeader->imageSize != imageSize)
    {
-      functionFloats = new F64[size];
-      for(U32 i = 0; i < size; i++)
-         st.read(&functionFloats[i]);
+      Con::errorf(ConsoleLogEntry::Script, "CodeBlock::loadImage - The DSO for %s is truncated.", name);
+      return false;
    }
-   U32 codeSize;
-   st.read(&codeSize);
-   st.read(&lineBreakPairCount);
-
-   U32 totSize = codeSize + lineBreakPairCount * 2;
-   code = new U32[totSize];
-
-   for(i = 0; i < codeSize; i++)
+   if(pHeader->byteOrder != DSOByteOrder)
    {
-      U8 b;
-      st.read(&b);
-      if(b == 0xFF)
-         st.read(&code[i]);
-      else
-         code[i] = b;
+      Con::errorf(ConsoleLogEntry::Script, "CodeBlock::loadImage - The DSO for %s was compiled for another byte order.", name);
+      return false;
    }
 
-   for(i = codeSize; i < totSize; i++)
-      st.read(&code[i]);
-
+   // Use the sections in place.
+   if(pHeader->globalStringsSize)
+      globalStrings = (char *) (pImage + pHeader->globalStringsOffset);
+   if(pHeader->functionStringsSize)
+      functionStrings = (char *) (pImage + pHeader->functionStringsOffset);
+   if(pHeader->globalFloatCount)
+      globalFloats = (F64 *) (pImage + pHeader->globalFloatsOffset);
+   if(pHeader->functionFloatCount)
+      functionFloats = (F64 *) (pImage + pHeader->functionFloatsOffset);
+
+   codeSize = pHeader->codeSize;
+   lineBreakPairCount = pHeader->lineBreakPairCount;
+   code = (U32 *) (pImage + pHeader->codeOffset);
    lineBreakPairs = code + codeSize;
 
-   // StringTable-ize our identifiers.
-   U32 identCount;
-   st.read(&identCount);
-   while(identCount--)
+   // StringTable-ize our identifiers, patching all the uses of each as we go.
+   const U32 globalSize = pHeader->globalStringsSize;
+   const U32 *pIdent = (const U32 *) (pImage + pHeader->identsOffset);
+   for(U32 identIndex = 0; identIndex < pHeader->identCount; identIndex++)
    {
-      U32 offset;
-      st.read(&offset);
+      const U32 offset = pIdent[0];
       StringTableEntry ste;
       if(offset < globalSize)
-         ste = StringTable->insert(globalStrings + offset);
+         ste = StringTable->insertHashed(globalStrings + offset, pIdent[1]);
       else
          ste = StringTable->EmptyString;
-      
-      U32 count;
-      st.read(&count);
-      while(count--)
+
+      const U32 count = pIdent[2];
+      pIdent += 3;
+      for(U32 i = 0; i < count; i++)
       {
-         U32 ip;
-         st.read(&ip);
+         const U32 ip = pIdent[i];
 #ifdef TORQUE_64
          *(U64*)(code+ip) = (U64)ste;
 #else
          code[ip] = (U32)ste;
 #endif
       }
+      pIdent += count;
    }
 
    if(lineBreakPairCount)
@@ -474,65 +513,208 @@ bool CodeBlock::read(StringTableEntry fileName, Stream &st)
    return true;
 }
 
+bool CodeBlock::read(StringTableEntry fileName, Stream &st)
+{
+   PROFILE_SCOPE(CodeBlock_Read);
 
-bool CodeBlock::compile(const char *codeFileName, StringTableEntry fileName, const char *script)
+   setFileName(fileName);
+
+   // Read the rest of the header (the version has already been read).
+   DSOHeader header;
+   header.version = DSO_VERSION;
+   U32 *pHeaderFields = &header.byteOrder;
+   for(U32 i = 1; i < sizeof(DSOHeader) / sizeof(U32); i++)
+      st.read(pHeaderFields++);
+
+   if(header.byteOrder != DSOByteOrder || header.imageSize < sizeof(DSOHeader))
+   {
+      Con::errorf(ConsoleLogEntry::Script, "CodeBlock::read - The DSO for %s is invalid.", name);
+      return false;
+   }
+
+   // The stream converts the header to the host byte order but the sections are
+   // used as they are so they must already be in the host byte order.
+   if(convertHostToLEndian(DSOByteOrder) != DSOByteOrder)
+   {
+      Con::errorf(ConsoleLogEntry::Script, "CodeBlock::read - The DSO for %s was compiled for another byte order.", name);
+      return false;
+   }
+
+   // Read the whole image in one go and use it in place.
+   mpImage = new U8[header.imageSize];
+   dMemcpy(mpImage, &header, sizeof(DSOHeader));
+   if(!st.read(header.imageSize - sizeof(DSOHeader), mpImage + sizeof(DSOHeader)))
+   {
+      Con::errorf(ConsoleLogEntry::Script, "CodeBlock::read - The DSO for %s is truncated.", name);
+      return false;
+   }
+
+   return loadImage(mpImage, header.imageSize);
+}
+
+bool CodeBlock::readMapped(StringTableEntry fileName, const char *dsoPath)
 {
-   gSyntaxError = false;
+   PROFILE_SCOPE(CodeBlock_ReadMapped);
 
-   consoleAllocReset();
+   if(!smMapDSOs || !FileView::isMappingSupported())
+      return false;
 
-   STEtoCode = compileSTEtoCode;
+   FileView *pFileView = new FileView;
+   if(pFileView->open(dsoPath) && pFileView->getSize() >= sizeof(DSOHeader))
+   {
+      // Check the DSO before it's used so the caller can fall back to reading it.
+      const DSOHeader *pHeader = (const DSOHeader *) pFileView->getData();
+      if(pHeader->version == DSO_VERSION && pHeader->byteOrder == DSOByteOrder && pHeader->imageSize == pFileView->getSize())
+      {
+         setFileName(fileName);
+
+         mpFileView = pFileView;
+         return loadImage(mpFileView->getData(), mpFileView->getSize());
+      }
+   }
+
+   delete pFileView;
+   return false;
+}
+
+// The parsers are generated and aren't reentrant so only one thread parses at a time.
+static Mutex gParserMutex;
+
+/// Parses a script into the calling thread's compiler state.
+static StmtNode *parseScript(StringTableEntry fileName, const char *script, bool &syntaxError)
+{
+   MutexHandle handle;
+   handle.lock(&gParserMutex, true);
+
+   gSyntaxError = false;
 
    statementList = NULL;
 
    // Set up the parser.
-   smCurrentParser = getParserForFile(fileName);
-   AssertISV(smCurrentParser, avar("CodeBlock::compile - no parser available for '%s'!", fileName));
+   CodeBlock::smCurrentParser = getParserForFile(fileName);
+   AssertISV(CodeBlock::smCurrentParser, avar("CodeBlock::compile - no parser available for '%s'!", fileName));
 
    // Now do some parsing.
-   smCurrentParser->setScanBuffer(script, fileName);
-   smCurrentParser->restart(NULL);
-   smCurrentParser->parse();
+   CodeBlock::smCurrentParser->setScanBuffer(script, fileName);
+   CodeBlock::smCurrentParser->restart(NULL);
+   CodeBlock::smCurrentParser->parse();
+
+   syntaxError = gSyntaxError;
 
-   if(gSyntaxError)
+   StmtNode *pStatements = statementList;
+   statementList = NULL;
+   return pStatements;
+}
+
+static void layoutDSO(DSOHeader &header, U32 codeSize, U32 lineBreakPairCount)
+{
+   U32 identCount, fixupCount;
+   getIdentTable().getCounts(identCount, fixupCount);
+
+   const U32 totSize = codeSize + lineBreakPairCount * 2;
+
+   header.version = DSO_VERSION;
+   header.byteOrder = DSOByteOrder;
+   header.globalStringsOffset = alignDSOSection(sizeof(DSOHeader));
+   header.globalStringsSize = getGlobalStringTable().totalLen;
+   header.functionStringsOffset = alignDSOSection(header.globalStringsOffset + header.globalStringsSize);
+   header.functionStringsSize = getFunctionStringTable().totalLen;
+   header.globalFloatsOffset = alignDSOSection(header.functionStringsOffset + header.functionStringsSize);
+   header.globalFloatCount = getGlobalFloatTable().count;
+   header.functionFloatsOffset = alignDSOSection(header.globalFloatsOffset + header.globalFloatCount * sizeof(F64));
+   header.functionFloatCount = getFunctionFloatTable().count;
+   header.codeOffset = alignDSOSection(header.functionFloatsOffset + header.functionFloatCount * sizeof(F64));
+   header.codeSize = codeSize;
+   header.lineBreakPairCount = lineBreakPairCount;
+   header.identsOffset = alignDSOSection(header.codeOffset + totSize * sizeof(U32));
+   header.identCount = identCount;
+   header.imageSize = header.identsOffset + (identCount * 3 + fixupCount) * sizeof(U32);
+}
+
+bool CodeBlock::compile(const char *codeFileName, StringTableEntry fileName, const char *script)
+{
+   consoleAllocReset();
+
+   getState().steToCode = compileSTEtoCode;
+
+   bool syntaxError;
+   StmtNode *pStatements = parseScript(fileName, script, syntaxError);
+   if(syntaxError)
    {
       consoleAllocReset();
       return false;
    }   
 
+   // Replace the DSO rather than overwriting it so that code blocks still using
+   // a mapping of the old one are unaffected.
+   if(FileView::isMappingSupported() && Platform::isFile(codeFileName))
+      Platform::fileDelete(codeFileName);
+
    FileStream st;
    if(!ResourceManager->openFileForWrite(st, codeFileName)) 
+   {
+      consoleAllocReset();
       return false;
-   st.write(DSO_VERSION);
+   }
+
+   generateCode(pStatements);
+   writeDSO(st);
+
+   consoleAllocReset();
+   st.close();
+
+   return true;
+}
+
+bool CodeBlock::compileToImage(StringTableEntry fileName, const char *script, U8 *&pImage, U32 &imageSize)
+{
+   consoleAllocReset();
+
+   getState().steToCode = compileSTEtoCode;
+
+   bool syntaxError;
+   StmtNode *pStatements = parseScript(fileName, script, syntaxError);
+   if(syntaxError)
+   {
+      consoleAllocReset();
+      return false;
+   }
+
+   imageSize = generateCode(pStatements);
+   pImage = new U8[imageSize];
+
+   MemStream st(imageSize, pImage, false, true);
+   writeDSO(st);
+
+   consoleAllocReset();
+
+   return true;
+}
+
+U32 CodeBlock::generateCode(StmtNode *pStatements)
+{
+   CompilerState &state = getState();
 
    // Reset all our value tables...
    resetTables();
 
-   smInFunction = false;
-   smBreakLineCount = 0;
+   state.inFunction = false;
+   state.breakLineCount = 0;
    setBreakCodeBlock(this);
 
-   if(statementList)
-      codeSize = precompileBlock(statementList, 0) + 1;
+   if(pStatements)
+      codeSize = precompileBlock(pStatements, 0) + 1;
    else
       codeSize = 1;
 
-   lineBreakPairCount = smBreakLineCount;
-   code = new U32[codeSize + smBreakLineCount * 2];
+   lineBreakPairCount = state.breakLineCount;
+   code = new U32[codeSize + lineBreakPairCount * 2];
    lineBreakPairs = code + codeSize;
 
-   // Write string table data...
-   getGlobalStringTable().write(st);
-   getFunctionStringTable().write(st);
-
-   // Write float table data...
-   getGlobalFloatTable().write(st);
-   getFunctionFloatTable().write(st);
-
-   smBreakLineCount = 0;
+   state.breakLineCount = 0;
    U32 lastIp;
-   if(statementList)
-      lastIp = compileBlock(statementList, code, 0, 0, 0);
+   if(pStatements)
+      lastIp = compileBlock(pStatements, code, 0, 0, 0);
    else
       lastIp = 0;
 
@@ -540,38 +722,55 @@ bool CodeBlock::compile(const char *codeFileName, StringTableEntry fileName, con
       Con::errorf(ConsoleLogEntry::General, "CodeBlock::compile - precompile size mismatch, a precompile/compile function pair is probably mismatched.");
 
    code[lastIp++] = OP_RETURN;
-   U32 totSize = codeSize + smBreakLineCount * 2;
-   st.write(codeSize);
-   st.write(lineBreakPairCount);
 
-   // Write out our bytecode, doing a bit of compression for low numbers.
-   U32 i;   
-   for(i = 0; i < codeSize; i++)
-   {
-      if(code[i] < 0xFF)
-         st.write(U8(code[i]));
-      else
-      {
-         st.write(U8(0xFF));
-         st.write(code[i]);
-      }
-   }
+   DSOHeader header;
+   layoutDSO(header, codeSize, lineBreakPairCount);
+   return header.imageSize;
+}
 
-   // Write the break info...
-   for(i = codeSize; i < totSize; i++)
-      st.write(code[i]);
+void CodeBlock::writeDSO(Stream &st)
+{
+   DSOHeader header;
+   layoutDSO(header, codeSize, lineBreakPairCount);
+   const U32 totSize = codeSize + lineBreakPairCount * 2;
 
-   getIdentTable().write(st);
+   // Write the header...
+   const U32 *pHeaderFields = &header.version;
+   for(U32 i = 0; i < sizeof(DSOHeader) / sizeof(U32); i++)
+      st.write(*pHeaderFields++);
+   U32 position = sizeof(DSOHeader);
 
-   consoleAllocReset();
-   st.close();
+   // Write string table data...
+   padDSOSection(st, position, header.globalStringsOffset);
+   getGlobalStringTable().write(st);
+   position += header.globalStringsSize;
+   padDSOSection(st, position, header.functionStringsOffset);
+   getFunctionStringTable().write(st);
+   position += header.functionStringsSize;
 
-   return true;
+   // Write float table data...
+   padDSOSection(st, position, header.globalFloatsOffset);
+   getGlobalFloatTable().write(st);
+   position += header.globalFloatCount * sizeof(F64);
+   padDSOSection(st, position, header.functionFloatsOffset);
+   getFunctionFloatTable().write(st);
+   position += header.functionFloatCount * sizeof(F64);
+
+   // Write out our bytecode and the break info...
+   padDSOSection(st, position, header.codeOffset);
+   for(U32 i = 0; i < totSize; i++)
+      st.write(code[i]);
+   position += totSize * sizeof(U32);
+
+   // Write the identifiers...
+   padDSOSection(st, position, header.identsOffset);
+   getIdentTable().write(st);
 }
 
 const char *CodeBlock::compileExec(StringTableEntry fileName, const char *string, bool noCalls, int setFrame)
 {
-   STEtoCode = evalSTEtoCode;
+   CompilerState &state = getState();
+   state.steToCode = evalSTEtoCode;
    consoleAllocReset();
 
    name = fileName;
@@ -603,18 +802,9 @@ const char *CodeBlock::compileExec(StringTableEntry fileName, const char *string
    if(name)
       addToCodeList();
    
-   statementList = NULL;
-
-   // Set up the parser.
-   smCurrentParser = getParserForFile(fileName);
-   AssertISV(smCurrentParser, avar("CodeBlock::compile - no parser available for '%s'!", fileName));
-
-   // Now do some parsing.
-   smCurrentParser->setScanBuffer(string, fileName);
-   smCurrentParser->restart(NULL);
-   smCurrentParser->parse();
-
-   if(!statementList)
+   bool syntaxError;
+   StmtNode *pStatements = parseScript(fileName, string, syntaxError);
+   if(!pStatements)
    {
       delete this;
       return "";
@@ -622,13 +812,13 @@ const char *CodeBlock::compileExec(StringTableEntry fileName, const char *string
 
    resetTables();
 
-   smInFunction = false;
-   smBreakLineCount = 0;
+   state.inFunction = false;
+   state.breakLineCount = 0;
    setBreakCodeBlock(this);
 
-   codeSize = precompileBlock(statementList, 0) + 1;
+   codeSize = precompileBlock(pStatements, 0) + 1;
 
-   lineBreakPairCount = smBreakLineCount;
+   lineBreakPairCount = state.breakLineCount;
 
    globalStrings   = getGlobalStringTable().build();
    functionStrings = getFunctionStringTable().build();
@@ -638,8 +828,8 @@ const char *CodeBlock::compileExec(StringTableEntry fileName, const char *string
    code = new U32[codeSize + lineBreakPairCount * 2];
    lineBreakPairs = code + codeSize;
 
-   smBreakLineCount = 0;
-   U32 lastIp = compileBlock(statementList, code, 0, 0, 0);
+   state.breakLineCount = 0;
+   U32 lastIp = compileBlock(pStatements, code, 0, 0, 0);
    code[lastIp++] = OP_RETURN;
    
    consoleAllocReset();
@@ -27,6 +27,7 @@
 #include "console/consoleParser.h"
 
 class Stream;
+class FileView;
 
 
 /// Core TorqueScript code management class.
@@ -39,10 +40,15 @@ private:
    static CodeBlock* smCurrentCodeBlock;
    
 public:
-   static U32                       smBreakLineCount;
-   static bool                      smInFunction;
+   /// The parser in use.  Only the thread holding the parser lock may use it.
    static Compiler::ConsoleParser * smCurrentParser;
 
+   /// Whether call sites cache the namespace entries they resolve to.
+   static bool                      smCallSiteCaching;
+
+   /// Whether DSOs on disk are mapped and executed in place rather than read.
+   static bool                      smMapDSOs;
+
    static CodeBlock* getCurrentBlock()
    {
       return smCurrentCodeBlock;
@@ -82,6 +88,23 @@ public:
    CodeBlock *nextFile;
    StringTableEntry mRoot;
 
+   /// The inline cache of a function call site.
+   struct CallSite;
+
+   /// The call site caches owned by this block.
+   CallSite *mpCallSites;
+
+   CallSite *createCallSite(StringTableEntry fnNamespace);
+   void clearCallSites();
+
+   /// The DSO image the code, strings and floats are used in place from, if any.
+   /// The image is either mapped (mpFileView) or read into memory (mpImage).
+   FileView *mpFileView;
+   U8 *mpImage;
+
+   void setFileName(StringTableEntry fileName);
+   bool loadImage(U8 *pImage, U32 imageSize);
+
 
    void addToCodeList();
    void removeFromCodeList();
@@ -104,9 +127,27 @@ public:
    void getFunctionArgs(char buffer[1024], U32 offset);
    const char *getFileLine(U32 ip);
 
+   /// Reads a DSO from a stream positioned after its version.
    bool read(StringTableEntry fileName, Stream &st);
+
+   /// Maps a DSO file and uses it in place.  This fails if the platform can't
+   /// map files, in which case the DSO should be read from a stream instead.
+   bool readMapped(StringTableEntry fileName, const char *dsoPath);
+
    bool compile(const char *dsoName, StringTableEntry fileName, const char *script);
 
+   /// Compiles a script to a DSO image in memory rather than to a file.  This can
+   /// be called from any thread.
+   /// @param pImage Set to the image (allocated with new[]) if the script compiled.
+   /// @param imageSize Set to the size of the image.
+   bool compileToImage(StringTableEntry fileName, const char *script, U8 *&pImage, U32 &imageSize);
+
+   /// Generates the code for a parsed script, returning the size of its DSO image.
+   U32 generateCode(StmtNode *pStatements);
+
+   /// Writes the DSO image of the generated code.
+   void writeDSO(Stream &st);
+
    void incRefCount();
    void decRefCount();
 
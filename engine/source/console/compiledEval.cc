@@ -213,6 +213,68 @@ inline void ExprEvalState::setStringVariable(const char *val)
 
 //------------------------------------------------------------
 
+struct CodeBlock::CallSite
+{
+   StringTableEntry  mNamespaceName;   ///< The namespace a function call is resolved in.
+   Namespace*        mpNamespace;      ///< The namespace the entry was looked up in.
+   Namespace::Entry* mpEntry;          ///< The entry the call site resolved to.
+   U32               mCacheSequence;   ///< The namespace cache sequence the entry is valid for.
+   CallSite*         mpNext;
+};
+
+CodeBlock::CallSite *CodeBlock::createCallSite(StringTableEntry fnNamespace)
+{
+   CallSite *callSite = new CallSite;
+   callSite->mNamespaceName = fnNamespace;
+   callSite->mpNamespace = NULL;
+   callSite->mpEntry = NULL;
+
+   // Make sure the call site resolves the first time it's used.
+   callSite->mCacheSequence = Namespace::mCacheSequence - 1;
+
+   callSite->mpNext = mpCallSites;
+   mpCallSites = callSite;
+   return callSite;
+}
+
+void CodeBlock::clearCallSites()
+{
+   while(mpCallSites)
+   {
+      CallSite *next = mpCallSites->mpNext;
+      delete mpCallSites;
+      mpCallSites = next;
+   }
+}
+
+inline CodeBlock::CallSite *CodeToCallSite(U32 *code, U32 ip)
+{
+#ifdef TORQUE_64
+   return (CodeBlock::CallSite *)(*((U64*)(code+ip)));
+#else
+   return (CodeBlock::CallSite *)(*(code+ip));
+#endif
+}
+
+/// Look up a method through a call site cache.
+///
+/// The cache is keyed on the namespace the method is looked up in and the namespace cache
+/// sequence, which changes whenever a function is defined, a class is linked or a package is
+/// activated or deactivated.
+static inline Namespace::Entry *lookupCallSite(CodeBlock::CallSite *callSite, Namespace *ns, StringTableEntry fnName)
+{
+   if(callSite->mpNamespace != ns || callSite->mCacheSequence != Namespace::mCacheSequence || !CodeBlock::smCallSiteCaching)
+   {
+      callSite->mpEntry = ns->lookup(fnName);
+      callSite->mpNamespace = ns;
+      callSite->mCacheSequence = Namespace::mCacheSequence;
+   }
+
+   return callSite->mpEntry;
+}
+
+//------------------------------------------------------------
+
 void CodeBlock::getFunctionArgs(char buffer[1024], U32 ip)
 {
    U32 fnArgc = code[ip + 5];
@@ -1232,7 +1294,7 @@ breakContinue:
 
          case OP_LOADFIELD_UINT:
             if(curObject)
-               intStack[UINT+1] = U32(dAtoi(curObject->getDataField(curField, curFieldArray)));
+               intStack[UINT+1] = U32(curObject->getDataFieldInt(curField, curFieldArray));
             else
             {
                // The field is not being retrieved from an object. Maybe it's
@@ -1246,7 +1308,7 @@ breakContinue:
 
          case OP_LOADFIELD_FLT:
             if(curObject)
-               floatStack[FLT+1] = dAtof(curObject->getDataField(curField, curFieldArray));
+               floatStack[FLT+1] = curObject->getDataFieldFloat(curField, curFieldArray);
             else
             {
                // The field is not being retrieved from an object. Maybe it's
@@ -1274,26 +1336,26 @@ breakContinue:
             break;
 
          case OP_SAVEFIELD_UINT:
-            STR.setIntValue((U32)intStack[UINT]);
             if(curObject)
-               curObject->setDataField(curField, curFieldArray, STR.getStringValue());
+               curObject->setDataFieldInt(curField, curFieldArray, (S32)intStack[UINT]);
             else
             {
                // The field is not being set on an object. Maybe it's
                // a special accessor?
+               STR.setIntValue((U32)intStack[UINT]);
                setFieldComponent( prevObject, prevField, prevFieldArray, curField );
                prevObject = NULL;
             }
             break;
 
          case OP_SAVEFIELD_FLT:
-            STR.setFloatValue(floatStack[FLT]);
             if(curObject)
-               curObject->setDataField(curField, curFieldArray, STR.getStringValue());
+               curObject->setDataFieldFloat(curField, curFieldArray, floatStack[FLT]);
             else
             {
                // The field is not being set on an object. Maybe it's
                // a special accessor?
+               STR.setFloatValue(floatStack[FLT]);
                setFieldComponent( prevObject, prevField, prevFieldArray, curField );
                prevObject = NULL;
             }
@@ -1415,31 +1477,17 @@ breakContinue:
             break;
 
          case OP_CALLFUNC_RESOLVE:
-            // This deals with a function that is potentially living in a namespace.
-            fnNamespace = CodeToSTE(code, ip+2);
-            fnName      = CodeToSTE(code, ip);
-
-            // Try to look it up.
-            ns = Namespace::find(fnNamespace);
-            nsEntry = ns->lookup(fnName);
-            if(!nsEntry)
-            {
-               ip+= 5;
-               Con::warnf(ConsoleLogEntry::General,
-                  "%s: Unable to find function %s%s%s",
-                  getFileLine(ip-4), fnNamespace ? fnNamespace : "",
-                  fnNamespace ? "::" : "", fnName);
-               STR.popFrame();
-               break;
-            }
-            // Now, rewrite our code a bit (ie, avoid future lookups) and fall
-            // through to OP_CALLFUNC
+         {
+            // Give the call site a cache, storing it in place of the namespace
+            // (which the cache keeps), and fall through to OP_CALLFUNC.
+            CallSite *callSite = createCallSite(CodeToSTE(code, ip+2));
 #ifdef TORQUE_64
-            *((U64*)(code+ip+2)) = ((U64)nsEntry);
+            *((U64*)(code+ip+2)) = ((U64)callSite);
 #else
-            code[ip+2] = ((U32)nsEntry);
+            code[ip+2] = ((U32)callSite);
 #endif
             code[ip-1] = OP_CALLFUNC;
+         }
 
          case OP_CALLFUNC:
          {
@@ -1458,6 +1506,7 @@ breakContinue:
                gEvalState.stack.last()->ip = ip - 1;
             }
 
+            CallSite *callSite = CodeToCallSite(code, ip+2);
             U32 callType = code[ip+4];
 
             ip += 5;
@@ -1465,12 +1514,29 @@ breakContinue:
 
             if(callType == FuncCallExprNode::FunctionCall) 
             {
-#ifdef TORQUE_64
-               nsEntry = ((Namespace::Entry *) *((U64*)(code+ip-3)));
-#else
-               nsEntry = ((Namespace::Entry *) *(code+ip-3));
-#endif
+               // This deals with a function that is potentially living in a namespace
+               // so resolve it again if the namespaces have changed.
+               if(callSite->mCacheSequence != Namespace::mCacheSequence || !smCallSiteCaching)
+               {
+                  Namespace *fnNamespaceObject = Namespace::find(callSite->mNamespaceName);
+                  callSite->mpEntry = fnNamespaceObject->lookup(fnName);
+                  callSite->mpNamespace = fnNamespaceObject;
+                  callSite->mCacheSequence = Namespace::mCacheSequence;
+               }
+
+               nsEntry = callSite->mpEntry;
                ns = NULL;
+
+               if(!nsEntry)
+               {
+                  fnNamespace = callSite->mNamespaceName;
+                  Con::warnf(ConsoleLogEntry::General,
+                     "%s: Unable to find function %s%s%s",
+                     getFileLine(ip-4), fnNamespace ? fnNamespace : "",
+                     fnNamespace ? "::" : "", fnName);
+                  STR.popFrame();
+                  break;
+               }
             }
             else if(callType == FuncCallExprNode::MethodCall)
             {
@@ -1497,7 +1563,7 @@ breakContinue:
                
                ns = gEvalState.thisObject->getNamespace();
                if(ns)
-                  nsEntry = ns->lookup(fnName);
+                  nsEntry = lookupCallSite(callSite, ns, fnName);
                else
                   nsEntry = NULL;
             }
@@ -1507,7 +1573,7 @@ breakContinue:
                {
                   ns = thisNamespace->mParent;
                   if(ns)
-                     nsEntry = ns->lookup(fnName);
+                     nsEntry = lookupCallSite(callSite, ns, fnName);
                   else
                      nsEntry = NULL;
                }
@@ -1762,8 +1828,12 @@ execFinished:
    }
    else
    {
-      delete[] const_cast<char*>(globalStrings);
-      delete[] globalFloats;
+      // The global strings and floats of a DSO image are freed with the image.
+      if(mpFileView == NULL && mpImage == NULL)
+      {
+         delete[] const_cast<char*>(globalStrings);
+         delete[] globalFloats;
+      }
       globalStrings = NULL;
       globalFloats = NULL;
    }
@@ -58,17 +58,64 @@ namespace Compiler
 
    //------------------------------------------------------------
 
-   CompilerStringTable *gCurrentStringTable, gGlobalStringTable, gFunctionStringTable;
-   CompilerFloatTable  *gCurrentFloatTable,  gGlobalFloatTable,  gFunctionFloatTable;
-   DataChunker          gConsoleAllocator;
-   CompilerIdentTable   gIdentTable;
-   CodeBlock           *gCurBreakBlock;
+   CompilerState::CompilerState(ThreadIdent id)
+   {
+      currentStringTable = &globalStringTable;
+      currentFloatTable = &globalFloatTable;
+      globalStringTable.reset();
+      functionStringTable.reset();
+      globalFloatTable.reset();
+      functionFloatTable.reset();
+      identTable.reset();
+      breakBlock = NULL;
+      steToCode = evalSTEtoCode;
+      inFunction = false;
+      breakLineCount = 0;
+      threadId = id;
+   }
 
    //------------------------------------------------------------
 
+   enum { MaxCompilerStates = 64 };
+
+   static CompilerState *gCompilerStates[MaxCompilerStates];
+   static volatile U32   gCompilerStateCount = 0;
+   static Mutex          gCompilerStateMutex;
+
+   static CompilerState &registerState(ThreadIdent threadId)
+   {
+      MutexHandle handle;
+      handle.lock(&gCompilerStateMutex, true);
+
+      AssertISV(gCompilerStateCount < MaxCompilerStates, "Compiler::registerState - Too many threads are compiling script.");
+
+      // Store the state before the count so searching threads never see an unfinished state.
+      CompilerState *pState = new CompilerState(threadId);
+      gCompilerStates[gCompilerStateCount] = pState;
+      gCompilerStateCount = gCompilerStateCount + 1;
+
+      return *pState;
+   }
+
+   CompilerState &getState()
+   {
+      const ThreadIdent threadId = ThreadManager::getCurrentThreadId();
+
+      // A thread always sees its own state so no lock is required here.
+      const U32 stateCount = gCompilerStateCount;
+      for(U32 i = 0; i < stateCount; i++)
+      {
+         if(ThreadManager::compare(gCompilerStates[i]->threadId, threadId))
+            return *gCompilerStates[i];
+      }
+
+      return registerState(threadId);
+   }
 
-   CodeBlock *getBreakCodeBlock()         { return gCurBreakBlock; }
-   void setBreakCodeBlock(CodeBlock *cb)  { gCurBreakBlock = cb;   }
+   //------------------------------------------------------------
+
+   CodeBlock *getBreakCodeBlock()         { return getState().breakBlock; }
+   void setBreakCodeBlock(CodeBlock *cb)  { getState().breakBlock = cb;   }
 
    //------------------------------------------------------------
    
@@ -89,38 +136,37 @@ namespace Compiler
       codeStream[ip+1] = 0;
    }
 
-   void (*STEtoCode)(StringTableEntry ste, U32 ip, U32 *codeStream) = evalSTEtoCode;
-
    //------------------------------------------------------------
 
    bool gSyntaxError = false;
 
    //------------------------------------------------------------
 
-   CompilerStringTable *getCurrentStringTable()  { return gCurrentStringTable;  }
-   CompilerStringTable &getGlobalStringTable()   { return gGlobalStringTable;   }
-   CompilerStringTable &getFunctionStringTable() { return gFunctionStringTable; }
+   CompilerStringTable *getCurrentStringTable()  { return getState().currentStringTable;  }
+   CompilerStringTable &getGlobalStringTable()   { return getState().globalStringTable;   }
+   CompilerStringTable &getFunctionStringTable() { return getState().functionStringTable; }
 
-   void setCurrentStringTable (CompilerStringTable* cst) { gCurrentStringTable  = cst; }
+   void setCurrentStringTable (CompilerStringTable* cst) { getState().currentStringTable  = cst; }
 
-   CompilerFloatTable *getCurrentFloatTable()    { return gCurrentFloatTable;   }
-   CompilerFloatTable &getGlobalFloatTable()     { return gGlobalFloatTable;    }
-   CompilerFloatTable &getFunctionFloatTable()   { return gFunctionFloatTable; }
+   CompilerFloatTable *getCurrentFloatTable()    { return getState().currentFloatTable;   }
+   CompilerFloatTable &getGlobalFloatTable()     { return getState().globalFloatTable;    }
+   CompilerFloatTable &getFunctionFloatTable()   { return getState().functionFloatTable; }
 
-   void setCurrentFloatTable (CompilerFloatTable* cst) { gCurrentFloatTable  = cst; }
+   void setCurrentFloatTable (CompilerFloatTable* cst) { getState().currentFloatTable  = cst; }
 
-   CompilerIdentTable &getIdentTable() { return gIdentTable; }
+   CompilerIdentTable &getIdentTable() { return getState().identTable; }
 
    void precompileIdent(StringTableEntry ident)
    {
       if(ident)
-         gGlobalStringTable.add(ident);
+         getGlobalStringTable().add(ident);
    }
 
    void resetTables()
    {
-      setCurrentStringTable(&gGlobalStringTable);
-      setCurrentFloatTable(&gGlobalFloatTable);
+      CompilerState &state = getState();
+      setCurrentStringTable(&state.globalStringTable);
+      setCurrentFloatTable(&state.globalFloatTable);
       getGlobalFloatTable().reset();
       getGlobalStringTable().reset();
       getFunctionFloatTable().reset();
@@ -128,8 +174,8 @@ namespace Compiler
       getIdentTable().reset();
    }
 
-   void *consoleAlloc(U32 size) { return gConsoleAllocator.alloc(size);  }
-   void consoleAllocReset()     { gConsoleAllocator.freeBlocks(); }
+   void *consoleAlloc(U32 size) { return getState().allocator.alloc(size);  }
+   void consoleAllocReset()     { getState().allocator.freeBlocks(); }
 
 }
 
@@ -209,7 +255,6 @@ char *CompilerStringTable::build()
 
 void CompilerStringTable::write(Stream &st)
 {
-   st.write(totalLen);
    for(Entry *walk = list; walk; walk = walk->next)
       st.write(walk->len, walk->string);
 }
@@ -246,7 +291,6 @@ F64 *CompilerFloatTable::build()
 
 void CompilerFloatTable::write(Stream &st)
 {
-   st.write(count);
    for(Entry *walk = list; walk; walk = walk->next)
       st.write(walk->val);
 }
@@ -260,7 +304,7 @@ void CompilerIdentTable::reset()
 
 void CompilerIdentTable::add(StringTableEntry ste, U32 ip)
 {
-   U32 index = gGlobalStringTable.add(ste, false);
+   U32 index = getGlobalStringTable().add(ste, false);
    Entry *newEntry = (Entry *) consoleAlloc(sizeof(Entry));
    newEntry->offset = index;
    newEntry->ip = ip;
@@ -273,18 +317,27 @@ void CompilerIdentTable::add(StringTableEntry ste, U32 ip)
          return;
       }
    }
+   newEntry->hash = _StringTable::hashString(ste);
    newEntry->next = list;
    list = newEntry;
    newEntry->nextIdent = NULL;
 }
 
+void CompilerIdentTable::getCounts(U32 &identCount, U32 &fixupCount)
+{
+   identCount = 0;
+   fixupCount = 0;
+   for(Entry *walk = list; walk; walk = walk->next)
+   {
+      identCount++;
+      for(Entry *el = walk; el; el = el->nextIdent)
+         fixupCount++;
+   }
+}
+
 void CompilerIdentTable::write(Stream &st)
 {
-   U32 count = 0;
    Entry * walk;
-   for(walk = list; walk; walk = walk->next)
-      count++;
-   st.write(count);
    for(walk = list; walk; walk = walk->next)
    {
       U32 ec = 0;
@@ -292,6 +345,7 @@ void CompilerIdentTable::write(Stream &st)
       for(el = walk; el; el = el->nextIdent)
          ec++;
       st.write(walk->offset);
+      st.write(walk->hash);
       st.write(ec);
       for(el = walk; el; el = el->nextIdent)
          st.write(el->ip);
@@ -25,9 +25,11 @@
 #define _COMPILER_H_
 
 class Stream;
-class DataChunker;
+class CodeBlock;
 
 #include "platform/platform.h"
+#include "platform/threads/thread.h"
+#include "memory/dataChunker.h"
 #include "console/ast.h"
 #include "console/codeBlock.h"
 
@@ -157,6 +159,7 @@ namespace Compiler
       struct Entry
       {
          U32 offset;
+         U32 hash;
          U32 ip;
          Entry *next;
          Entry *nextIdent;
@@ -164,6 +167,7 @@ namespace Compiler
       Entry *list;
       void add(StringTableEntry ste, U32 ip);
       void reset();
+      void getCounts(U32 &identCount, U32 &fixupCount);
       void write(Stream &st);
    };
 
@@ -221,11 +225,39 @@ namespace Compiler
 #endif
    }
    
-   extern void (*STEtoCode)(StringTableEntry ste, U32 ip, U32 *codeStream);
+   //------------------------------------------------------------
+
+   /// The state of a compilation.
+   ///
+   /// Each thread that compiles script has its own state, including the allocator
+   /// the syntax tree is built in, so several scripts can be compiled at once.  Only
+   /// parsing is serialized as the generated parsers aren't reentrant.
+   struct CompilerState
+   {
+      CompilerStringTable *currentStringTable, globalStringTable, functionStringTable;
+      CompilerFloatTable  *currentFloatTable,  globalFloatTable,  functionFloatTable;
+      CompilerIdentTable   identTable;
+      DataChunker          allocator;
+      CodeBlock           *breakBlock;
+      void               (*steToCode)(StringTableEntry ste, U32 ip, U32 *codeStream);
+      bool                 inFunction;
+      U32                  breakLineCount;
+      ThreadIdent          threadId;
+
+      CompilerState(ThreadIdent id);
+   };
+
+   /// Returns the calling thread's compiler state.
+   CompilerState &getState();
 
    void evalSTEtoCode(StringTableEntry ste, U32 ip, U32 *codeStream);
    void compileSTEtoCode(StringTableEntry ste, U32 ip, U32 *codeStream);
 
+   inline void STEtoCode(StringTableEntry ste, U32 ip, U32 *codeStream)
+   {
+      getState().steToCode(ste, ip, codeStream);
+   }
+
    CompilerStringTable *getCurrentStringTable();
    CompilerStringTable &getGlobalStringTable();
    CompilerStringTable &getFunctionStringTable();
@@ -252,6 +284,8 @@ namespace Compiler
    void *consoleAlloc(U32 size);
    void consoleAllocReset();
 
+   /// Set by the parsers when they find an error.  Only the thread that holds the
+   /// parser lock (see CodeBlock) may use it.
    extern bool gSyntaxError;
 };
 
@@ -253,6 +253,8 @@ void init()
    addVariable("Con::logBufferEnabled", TypeBool, &logBufferEnabled);
    addVariable("Con::printLevel", TypeS32, &printLevel);
    addVariable("Con::warnUndefinedVariables", TypeBool, &gWarnUndefinedScriptVariables);
+   addVariable("Con::callSiteCaching", TypeBool, &CodeBlock::smCallSiteCaching);
+   addVariable("Con::mapDSOs", TypeBool, &CodeBlock::smMapDSOs);
 
    // Current script file name and root
    Con::addVariable( "Con::File", TypeString, &gCurrentFile );
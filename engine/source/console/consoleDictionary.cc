@@ -340,6 +340,8 @@ Dictionary::Entry::Entry(StringTableEntry in_name)
    ival = 0;
    fval = 0;
    sval = typeValueEmpty;
+   bufferLen = 0;
+   numbersValid = true;
 }
 
 Dictionary::Entry::~Entry()
@@ -390,15 +392,18 @@ void Dictionary::Entry::setStringValue(const char * value)
       //
       // (This decision may come back to haunt you. Shame on you if it
       // does.)
+      //
+      // Shorter strings are only parsed if they're read as numbers (see
+      // parseNumbers()) as most never are.
       if(stringLen < 256)
       {
-         fval = dAtof(value);
-         ival = dAtoi(value);
+         numbersValid = false;
       }
       else
       {
          fval = 0.f;
          ival = 0;
+         numbersValid = true;
       }
 
       type = TypeInternalString;
@@ -407,11 +412,16 @@ void Dictionary::Entry::setStringValue(const char * value)
       U32 newLen = ((stringLen + 1) + 15) & ~15;
       
       if(sval == typeValueEmpty)
+      {
          sval = (char *) dMalloc(newLen);
+         bufferLen = newLen;
+      }
       else if(newLen > bufferLen)
+      {
          sval = (char *) dRealloc(sval, newLen);
+         bufferLen = newLen;
+      }
 
-      bufferLen = newLen;
       dStrcpy(sval, value);
    }
    else
@@ -62,21 +62,36 @@ public:
         F32 fval;
         U32 bufferLen;
         void *dataPtr;
+        bool numbersValid; // false until a string value is first read as a number
 
         Entry(StringTableEntry name);
         ~Entry();
 
+        void parseNumbers()
+        {
+            fval = dAtof(sval);
+            ival = dAtoi(sval);
+            numbersValid = true;
+        }
         U32 getIntValue()
         {
             if(type <= TypeInternalString)
+            {
+                if(!numbersValid)
+                    parseNumbers();
                 return ival;
+            }
             else
                 return dAtoi(Con::getData(type, dataPtr, 0));
         }
         F32 getFloatValue()
         {
             if(type <= TypeInternalString)
+            {
+                if(!numbersValid)
+                    parseNumbers();
                 return fval;
+            }
             else
                 return dAtof(Con::getData(type, dataPtr, 0));
         }
@@ -95,13 +110,10 @@ public:
         {
             if(type <= TypeInternalString)
             {
+                // The string buffer is kept for when the variable is next set to a string.
                 fval = (F32)val;
                 ival = val;
-                if(sval != typeValueEmpty)
-                {
-                    dFree(sval);
-                    sval = typeValueEmpty;
-                }
+                numbersValid = true;
                 type = TypeInternalInt;
                 return;
             }
@@ -117,11 +129,7 @@ public:
             {
                 fval = val;
                 ival = static_cast<U32>(val);
-                if(sval != typeValueEmpty)
-                {
-                    dFree(sval);
-                    sval = typeValueEmpty;
-                }
+                numbersValid = true;
                 type = TypeInternalFloat;
                 return;
             }
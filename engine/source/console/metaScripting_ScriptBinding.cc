@@ -27,6 +27,7 @@
 #include "io/resource/resourceManager.h"
 #include "io/fileStream.h"
 #include "console/compiler.h"
+#include "console/scriptCompileService.h"
 
 #if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_OSX)
 #include <ifaddrs.h>
@@ -384,6 +385,10 @@ ConsoleFunctionWithDocs(exec, ConsoleBool, 2, 4, ( fileName, [nocalls]?, [journa
    }
 #endif //TORQUE_ALLOW_JOURNALING
 
+   // If the script is being compiled in the background then wait for its DSO.
+   if(compiled)
+      ScriptCompileService::waitForScript(scriptFileName);
+
    // Ok, we let's try to load and compile the script.
    ResourceObject *rScr = ResourceManager->find(scriptFileName);
    ResourceObject *rCom = NULL;
@@ -560,10 +565,18 @@ ConsoleFunctionWithDocs(exec, ConsoleBool, 2, 4, ( fileName, [nocalls]?, [journa
       //Luma: Profile script executions 
       F32 st1 = (F32)Platform::getRealMilliseconds();
 
+      // Execute DSOs on disk in place, otherwise read them.
       CodeBlock *code = new CodeBlock;
-      code->read(scriptFileName, *compiledStream);
+      ResourceObject *rDso = ResourceManager->find(nameBuffer);
+      bool loaded = rDso && (rDso->flags & ResourceObject::File) && code->readMapped(scriptFileName, nameBuffer);
+      if(!loaded)
+         loaded = code->read(scriptFileName, *compiledStream);
       ResourceManager->closeStream(compiledStream);
-      code->exec(0, scriptFileName, NULL, 0, NULL, noCalls, NULL, 0);
+
+      if(loaded)
+         code->exec(0, scriptFileName, NULL, 0, NULL, noCalls, NULL, 0);
+      else
+         delete code;
 
         F32 et1 = (F32)Platform::getRealMilliseconds();
         
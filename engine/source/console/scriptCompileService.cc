@@ -0,0 +1,339 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "console/scriptCompileService.h"
+#include "console/console.h"
+#include "console/codeBlock.h"
+#include "io/fileStream.h"
+#include "io/resource/resourceManager.h"
+#include "module/moduleManager.h"
+#include "platform/platformFileIO.h"
+#include "platform/threads/jobSystem.h"
+#include "debug/profiler.h"
+
+// Script bindings.
+#include "scriptCompileService_ScriptBinding.h"
+
+//-----------------------------------------------------------------------------
+
+enum ScriptCompileState
+{
+   CompilePending,
+   CompileUpToDate,
+   CompileSucceeded,
+   CompileFailed,
+};
+
+/// A script queued to be compiled.
+struct ScriptCompileJob
+{
+   StringTableEntry mScriptPath;
+   StringTableEntry mDSOPath;
+   U8* mpImage;
+   U32 mImageSize;
+   U32 mState;
+};
+
+// The queued scripts (only used on the main thread).
+static Vector<ScriptCompileJob*> gCompileJobs;
+
+// The compile jobs.
+static JobSystem::JobGroup gCompileGroup;
+
+// Guards the state of the queued scripts.
+static Mutex gCompileMutex;
+
+static ScriptCompileService::Stats gCompileStats = { 0, 0, 0, 0, 0 };
+
+//-----------------------------------------------------------------------------
+
+static U32 compileScript( ScriptCompileJob* pJob )
+{
+   // Skip the script if its DSO is newer and of the current version.
+   FileTime scriptTime, dsoTime;
+   if ( Platform::getFileTimes( pJob->mDSOPath, NULL, &dsoTime ) &&
+        Platform::getFileTimes( pJob->mScriptPath, NULL, &scriptTime ) &&
+        Platform::compareFileTimes( dsoTime, scriptTime ) >= 0 )
+   {
+      FileStream dsoStream;
+      U32 version = 0;
+      if ( dsoStream.open( pJob->mDSOPath, FileStream::Read ) && dsoStream.read( &version ) && version == DSO_VERSION )
+         return CompileUpToDate;
+   }
+
+   // Read the script.
+   FileStream scriptStream;
+   if ( !scriptStream.open( pJob->mScriptPath, FileStream::Read ) )
+      return CompileFailed;
+
+   const U32 scriptSize = scriptStream.getStreamSize();
+   if ( scriptSize == 0 )
+      return CompileFailed;
+
+   char* pScript = new char[scriptSize + 1];
+   const bool scriptRead = scriptStream.read( scriptSize, pScript );
+   pScript[scriptSize] = 0;
+   scriptStream.close();
+
+   // Compile it to an image.
+   bool compiled = false;
+   if ( scriptRead )
+   {
+      CodeBlock* pCodeBlock = new CodeBlock;
+      compiled = pCodeBlock->compileToImage( pJob->mScriptPath, pScript, pJob->mpImage, pJob->mImageSize );
+      delete pCodeBlock;
+   }
+
+   delete [] pScript;
+
+   return compiled ? CompileSucceeded : CompileFailed;
+}
+
+//-----------------------------------------------------------------------------
+
+static void compileScriptJob( void* pContext, const U32 jobIndex )
+{
+   PROFILE_SCOPE(ScriptCompileService_CompileScript);
+
+   ScriptCompileJob* pJob = (ScriptCompileJob*)pContext;
+
+   const U32 state = compileScript( pJob );
+
+   // The job isn't touched once its state is set.
+   MutexHandle handle;
+   handle.lock( &gCompileMutex, true );
+   pJob->mState = state;
+}
+
+//-----------------------------------------------------------------------------
+
+static bool writeDSO( ScriptCompileJob* pJob )
+{
+   // Replace the DSO rather than overwriting it (see CodeBlock::compile()).
+   if ( FileView::isMappingSupported() && Platform::isFile( pJob->mDSOPath ) )
+      Platform::fileDelete( pJob->mDSOPath );
+
+   FileStream stream;
+   if ( !ResourceManager->openFileForWrite( stream, pJob->mDSOPath ) )
+   {
+      Con::warnf( "ScriptCompileService - Could not write the DSO '%s'.", pJob->mDSOPath );
+      return false;
+   }
+
+   stream.write( pJob->mImageSize, pJob->mpImage );
+   stream.close();
+
+   return true;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 ScriptCompileService::queueModules( const bool loadedOnly )
+{
+   PROFILE_SCOPE(ScriptCompileService_QueueModules);
+
+   ModuleManager::typeConstModuleDefinitionVector moduleDefinitions;
+   ModuleDatabase.findModules( loadedOnly, moduleDefinitions );
+
+   U32 queuedCount = 0;
+   char scriptPath[1024];
+
+   for ( ModuleManager::typeConstModuleDefinitionVector::iterator moduleItr = moduleDefinitions.begin(); moduleItr != moduleDefinitions.end(); ++moduleItr )
+   {
+      Vector<Platform::FileInfo> files;
+      if ( !Platform::dumpPath( (*moduleItr)->getModulePath(), files ) )
+         continue;
+
+      for ( Vector<Platform::FileInfo>::iterator fileItr = files.begin(); fileItr != files.end(); ++fileItr )
+      {
+         if ( !Platform::hasExtension( fileItr->pFileName, ".cs" ) && !Platform::hasExtension( fileItr->pFileName, ".gui" ) )
+            continue;
+
+         dSprintf( scriptPath, sizeof(scriptPath), "%s/%s", fileItr->pFullPath, fileItr->pFileName );
+         if ( queueScript( scriptPath ) )
+            queuedCount++;
+      }
+   }
+
+   return queuedCount;
+}
+
+//-----------------------------------------------------------------------------
+
+bool ScriptCompileService::queueScript( const char* pScriptPath )
+{
+   // No DSOs are generated on these platforms (see exec()).
+#if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_ANDROID) || defined(TORQUE_OS_EMSCRIPTEN)
+   return false;
+#else
+   if ( Con::getBoolVariable( "Scripts::ignoreDSOs" ) )
+      return false;
+
+   // Scripts in the prefs path aren't compiled.
+   const char* pPrefsPath = Platform::getPrefsPath();
+   if ( dStrlen( pPrefsPath ) > 0 && dStrnicmp( pScriptPath, pPrefsPath, dStrlen( pPrefsPath ) ) == 0 )
+      return false;
+
+   StringTableEntry scriptPath = StringTable->insert( pScriptPath );
+
+   // Ignore the script if it's already queued.
+   for ( U32 i = 0; i < (U32)gCompileJobs.size(); i++ )
+   {
+      if ( gCompileJobs[i]->mScriptPath == scriptPath )
+         return false;
+   }
+
+   // Editor scripts have a different DSO extension.
+   const bool isEditorScript = Platform::hasExtension( scriptPath, ".ed.cs" ) || Platform::hasExtension( scriptPath, ".ed.gui" );
+
+   char dsoPath[1024];
+   dStrcpyl( dsoPath, sizeof(dsoPath), scriptPath, isEditorScript ? ".edso" : ".dso", NULL );
+
+   ScriptCompileJob* pJob = new ScriptCompileJob;
+   pJob->mScriptPath = scriptPath;
+   pJob->mDSOPath = StringTable->insert( dsoPath );
+   pJob->mpImage = NULL;
+   pJob->mImageSize = 0;
+   pJob->mState = CompilePending;
+   gCompileJobs.push_back( pJob );
+
+   gCompileStats.mQueued++;
+
+   JobSystem::submit( compileScriptJob, pJob, 0, &gCompileGroup );
+
+   return true;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+U32 ScriptCompileService::process( void )
+{
+   if ( gCompileJobs.size() == 0 )
+      return 0;
+
+   PROFILE_SCOPE(ScriptCompileService_Process);
+
+   // Take the finished jobs.
+   Vector<ScriptCompileJob*> finishedJobs;
+   {
+      MutexHandle handle;
+      handle.lock( &gCompileMutex, true );
+
+      for ( U32 i = 0; i < (U32)gCompileJobs.size(); )
+      {
+         if ( gCompileJobs[i]->mState == CompilePending )
+         {
+            i++;
+            continue;
+         }
+
+         finishedJobs.push_back( gCompileJobs[i] );
+         gCompileJobs.erase_fast( i );
+      }
+   }
+
+   // Write their DSOs.
+   U32 writtenCount = 0;
+   for ( U32 i = 0; i < (U32)finishedJobs.size(); i++ )
+   {
+      ScriptCompileJob* pJob = finishedJobs[i];
+
+      if ( pJob->mState == CompileUpToDate )
+      {
+         gCompileStats.mUpToDate++;
+      }
+      else if ( pJob->mState == CompileSucceeded && writeDSO( pJob ) )
+      {
+         gCompileStats.mCompiled++;
+         writtenCount++;
+      }
+      else
+      {
+         gCompileStats.mFailed++;
+      }
+
+      delete [] pJob->mpImage;
+      delete pJob;
+   }
+
+   return writtenCount;
+}
+
+//-----------------------------------------------------------------------------
+
+void ScriptCompileService::waitForScript( StringTableEntry scriptPath )
+{
+   for ( U32 i = 0; i < (U32)gCompileJobs.size(); i++ )
+   {
+      if ( gCompileJobs[i]->mScriptPath != scriptPath )
+         continue;
+
+      // Jobs can't be waited on individually so wait for them all.
+      flush();
+      return;
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+U32 ScriptCompileService::flush( void )
+{
+   if ( gCompileJobs.size() == 0 )
+      return 0;
+
+   PROFILE_SCOPE(ScriptCompileService_Flush);
+
+   JobSystem::wait( &gCompileGroup );
+
+   return process();
+}
+
+//-----------------------------------------------------------------------------
+
+void ScriptCompileService::shutdown( void )
+{
+   JobSystem::wait( &gCompileGroup );
+
+   for ( U32 i = 0; i < (U32)gCompileJobs.size(); i++ )
+   {
+      delete [] gCompileJobs[i]->mpImage;
+      delete gCompileJobs[i];
+   }
+
+   gCompileJobs.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void ScriptCompileService::getStats( Stats& stats )
+{
+   stats = gCompileStats;
+   stats.mPending = gCompileJobs.size();
+}
+
+//-----------------------------------------------------------------------------
+
+void ScriptCompileService::resetStats( void )
+{
+   dMemset( &gCompileStats, 0, sizeof(gCompileStats) );
+}
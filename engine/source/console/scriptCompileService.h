@@ -0,0 +1,94 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SCRIPT_COMPILE_SERVICE_H_
+#define _SCRIPT_COMPILE_SERVICE_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _STRINGTABLE_H_
+#include "string/stringTable.h"
+#endif
+
+/// Compiles the scripts of modules to DSOs in the background.
+///
+/// The scripts are parsed and compiled to DSO images on the job system workers.
+/// Everything else stays on the main thread: finding the scripts, writing the
+/// compiled DSOs (through the resource manager) and, of course, executing them.
+/// exec() waits for a script that is still being compiled so it always finds
+/// the DSO up-to-date rather than compiling the script a second time.
+///
+/// Scripts with syntax errors produce no DSO, their errors are reported again
+/// when they are executed.
+///
+/// Examples of script use:
+/// @code
+/// compileModuleScripts();          // start compiling the scripts of all the modules.
+/// flushModuleScripts();            // wait for them to be compiled.
+/// @endcode
+class ScriptCompileService
+{
+public:
+   /// Compile statistics.
+   struct Stats
+   {
+      U32 mQueued;            ///< Scripts queued since the last reset.
+      U32 mUpToDate;          ///< Scripts whose DSO was already up-to-date.
+      U32 mCompiled;          ///< Scripts compiled (and written).
+      U32 mFailed;            ///< Scripts that failed to compile.
+      U32 mPending;           ///< Scripts still being compiled.
+   };
+
+public:
+   /// Queue the stale (or missing) DSOs of the module scripts to be compiled.
+   /// @param loadedOnly Whether only the loaded modules are compiled, otherwise all the modules are.
+   /// @return The number of scripts queued.
+   static U32 queueModules( const bool loadedOnly );
+
+   /// Queue a single script to be compiled.
+   /// @return Whether the script was queued.
+   static bool queueScript( const char* pScriptPath );
+
+   /// Write the DSOs of the scripts compiled so far.
+   /// @return The number of DSOs written.
+   static U32 process( void );
+
+   /// Wait for the specified script to be compiled (if it is queued) and write its DSO.
+   static void waitForScript( StringTableEntry scriptPath );
+
+   /// Wait for all the queued scripts to be compiled and write their DSOs.
+   /// @return The number of DSOs written.
+   static U32 flush( void );
+
+   /// Wait for the queued scripts, discarding them.  Must be called before the job system is destroyed.
+   static void shutdown( void );
+
+   /// Get the compile statistics.
+   static void getStats( Stats& stats );
+
+   /// Reset the compile statistics.
+   static void resetStats( void );
+};
+
+#endif // _SCRIPT_COMPILE_SERVICE_H_
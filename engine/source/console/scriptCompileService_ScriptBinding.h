@@ -0,0 +1,69 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+ConsoleFunctionGroupBegin( ScriptCompileService, "Background script compile functionality.");
+
+/*! @defgroup ScriptCompileFunctions Script Compiling
+	@ingroup TorqueScriptFunctions
+	@{
+*/
+
+/*! Starts compiling the scripts of the modules in the background.
+    Only scripts whose DSO is missing or out-of-date are compiled.  A script that is executed whilst it is being compiled waits for its DSO.
+    @param loadedOnly Whether only the scripts of the loaded modules are compiled (optional: default is false).
+    @return The number of scripts queued to be compiled.
+*/
+ConsoleFunctionWithDocs(compileModuleScripts, ConsoleInt, 1, 2, ([loadedOnly]?))
+{
+   const bool loadedOnly = argc >= 2 ? dAtob(argv[1]) : false;
+
+   return ScriptCompileService::queueModules( loadedOnly );
+}
+
+/*! Waits for the scripts being compiled in the background and writes their DSOs.
+    @return The number of DSOs written.
+*/
+ConsoleFunctionWithDocs(flushModuleScripts, ConsoleInt, 1, 1, ())
+{
+   return ScriptCompileService::flush();
+}
+
+/*! Gets the background script compile statistics.
+    @param reset Whether to reset the statistics after getting them (optional: default is false).
+    @return The statistics as "queued upToDate compiled failed pending".
+*/
+ConsoleFunctionWithDocs(getModuleScriptCompileStats, ConsoleString, 1, 2, ([reset]?))
+{
+   ScriptCompileService::Stats stats;
+   ScriptCompileService::getStats( stats );
+
+   if ( argc >= 2 && dAtob(argv[1]) )
+      ScriptCompileService::resetStats();
+
+   char* pBuffer = Con::getReturnBuffer( 64 );
+   dSprintf( pBuffer, 64, "%d %d %d %d %d", stats.mQueued, stats.mUpToDate, stats.mCompiled, stats.mFailed, stats.mPending );
+   return pBuffer;
+}
+
+ConsoleFunctionGroupEnd( ScriptCompileService );
+
+/*! @} */ // group ScriptCompileFunctions
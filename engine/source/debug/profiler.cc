@@ -22,6 +22,7 @@
 
 #include "platform/platform.h"
 #include "debug/profiler.h"
+#include "debug/profilerTrace.h"
 #include "string/stringTable.h"
 #include <stdlib.h> // gotta use malloc and free directly
 #include <string.h>
@@ -36,9 +37,7 @@
 ProfilerRootData *ProfilerRootData::sRootList = NULL;
 Profiler *gProfiler = NULL;
 
-#ifdef TORQUE_MULTITHREAD
 ThreadIdent gMainThread = 0;
-#endif
 
 #if defined(TORQUE_SUPPORTS_VC_INLINE_X86_ASM)
 // platform specific get hires times...
@@ -192,9 +191,7 @@ Profiler::Profiler()
    mDumpToFile      = false;
    mDumpFileName[0] = '\0';
 
-#ifdef TORQUE_MULTITHREAD
    gMainThread = ThreadManager::getCurrentThreadId();
-#endif
 }
 
 Profiler::~Profiler()
@@ -276,11 +273,13 @@ void Profiler::validate()
 
 void Profiler::hashPush(ProfilerRootData *root)
 {
-#ifdef TORQUE_MULTITHREAD
-   // Ignore non-main-thread profiler activity.
+   // Record the timeline on all threads.
+   if(ProfilerTrace::isEnabled())
+      ProfilerTrace::beginEvent(root->mName);
+
+   // Ignore non-main-thread profiler activity (e.g. job system workers).
    if(! ThreadManager::isCurrentThread(gMainThread) )
       return;
-#endif
 
    mStackDepth++;
    AssertFatal(mStackDepth <= (S32)mMaxStackDepth,
@@ -372,11 +371,13 @@ void Profiler::dumpToFile(const char* fileName)
 
 void Profiler::hashPop()
 {
-#ifdef TORQUE_MULTITHREAD
-   // Ignore non-main-thread profiler activity.
+   // Record the timeline on all threads.
+   if(ProfilerTrace::isEnabled())
+      ProfilerTrace::endEvent();
+
+   // Ignore non-main-thread profiler activity (e.g. job system workers).
    if(! ThreadManager::isCurrentThread(gMainThread) )
       return;
-#endif
 
    mStackDepth--;
    AssertFatal(mStackDepth >= 0, "Stack underflow in profiler.  You may have mismatched PROFILE_START and PROFILE_ENDs");
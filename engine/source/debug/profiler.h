@@ -43,6 +43,8 @@ struct ProfilerRootData;
 /// profilerMarkerEnable((string markerName, bool enable);  //enables or disables a given profile tag
 /// @endcode
 ///
+/// The same markers also feed the ProfilerTrace which records a per-thread timeline.
+///
 /// The C++ code side of the profiler uses pairs of PROFILE_START() and PROFILE_END().
 ///
 /// When using these macros, make sure there is a PROFILE_END() for every PROFILE_START
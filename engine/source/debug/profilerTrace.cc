@@ -0,0 +1,411 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "platform/platform.h"
+#include "debug/profilerTrace.h"
+
+#ifdef TORQUE_ENABLE_PROFILER
+
+#include <stdlib.h> // gotta use malloc and free directly
+#include "console/console.h"
+#include "collection/vector.h"
+#include "math/mMathFn.h"
+#include "io/fileStream.h"
+#include "platform/threads/thread.h"
+#include "platform/threads/mutex.h"
+#include "platform/threads/jobSystem.h"
+
+#if defined(TORQUE_OS_WIN32)
+#include <windows.h>
+#elif defined(TORQUE_OS_MAC) || defined(TORQUE_OS_IOS)
+#include <mach/mach_time.h>
+#else
+#include <time.h>
+#endif
+
+// x86 doesn't reorder stores with other stores (or loads with other loads) so only the
+// compiler needs fencing there; other architectures need a hardware barrier.
+#if defined(TORQUE_COMPILER_VISUALC)
+#include <intrin.h>
+#define PROFILER_TRACE_BARRIER() _ReadWriteBarrier()
+#elif defined(__i386__) || defined(__x86_64__)
+#define PROFILER_TRACE_BARRIER() __asm__ __volatile__( "" ::: "memory" )
+#else
+#define PROFILER_TRACE_BARRIER() __sync_synchronize()
+#endif
+
+//-----------------------------------------------------------------------------
+
+extern ThreadIdent gMainThread;
+
+volatile bool ProfilerTrace::smEnabled = false;
+
+/// A single thread's ring buffer of events.
+///
+/// Only the owning thread writes events and advances the write count.  Readers copy the
+/// events they need and then check the write count again to discard anything that was
+/// overwritten whilst they were copying.
+struct ProfilerTraceBuffer
+{
+   ThreadIdent mThreadId;
+   U32 mThreadIndex;
+   char mThreadName[32];
+   ProfilerTrace::Event *mEvents;
+   volatile U32 mWriteCount;  ///< Total events written (wraps).
+   volatile U32 mReadStart;   ///< Events before this have been discarded.
+   volatile bool mActive;     ///< Whether the thread is still running (otherwise the buffer can be reused).
+};
+
+static ProfilerTraceBuffer *gTraceBuffers[ProfilerTrace::MaxThreads];
+static volatile U32 gTraceBufferCount = 0;
+static Mutex gTraceRegisterMutex;
+
+//-----------------------------------------------------------------------------
+
+static ProfilerTraceBuffer *registerTraceBuffer(const ThreadIdent threadId)
+{
+   gTraceRegisterMutex.lock();
+
+   // Reuse the buffer of a thread that has exited.
+   const U32 count = gTraceBufferCount;
+   ProfilerTraceBuffer *buffer = NULL;
+   for(U32 i = 0; i < count; i++)
+   {
+      if(!gTraceBuffers[i]->mActive)
+      {
+         buffer = gTraceBuffers[i];
+         break;
+      }
+   }
+
+   const bool newBuffer = buffer == NULL;
+   if(newBuffer)
+   {
+      // Finish if there's no room for the thread.
+      if(count == ProfilerTrace::MaxThreads)
+      {
+         gTraceRegisterMutex.unlock();
+         return NULL;
+      }
+
+      buffer = (ProfilerTraceBuffer *) malloc(sizeof(ProfilerTraceBuffer));
+      buffer->mThreadIndex = count;
+      buffer->mEvents = (ProfilerTrace::Event *) malloc(sizeof(ProfilerTrace::Event) * ProfilerTrace::ThreadBufferEvents);
+      buffer->mWriteCount = 0;
+   }
+
+   // Discard the events of the thread that used the buffer before.
+   buffer->mThreadId = threadId;
+   buffer->mReadStart = buffer->mWriteCount;
+
+   const U32 threadIndex = buffer->mThreadIndex;
+   if(ThreadManager::compare(threadId, gMainThread))
+      dSprintf(buffer->mThreadName, sizeof(buffer->mThreadName), "Main Thread");
+   else if(JobSystem::isWorkerThread())
+      dSprintf(buffer->mThreadName, sizeof(buffer->mThreadName), "Job Worker %d", threadIndex);
+   else
+      dSprintf(buffer->mThreadName, sizeof(buffer->mThreadName), "Thread %d", threadIndex);
+
+   PROFILER_TRACE_BARRIER();
+   buffer->mActive = true;
+
+   // Publish a new buffer before the count so readers never see an unfinished buffer.
+   if(newBuffer)
+   {
+      gTraceBuffers[threadIndex] = buffer;
+      PROFILER_TRACE_BARRIER();
+      gTraceBufferCount = threadIndex + 1;
+   }
+
+   gTraceRegisterMutex.unlock();
+
+   return buffer;
+}
+
+//-----------------------------------------------------------------------------
+
+static inline ProfilerTraceBuffer *findTraceBuffer()
+{
+   const ThreadIdent threadId = ThreadManager::getCurrentThreadId();
+
+   // A thread always sees its own registration so no lock is required here.
+   const U32 count = gTraceBufferCount;
+   for(U32 i = 0; i < count; i++)
+   {
+      ProfilerTraceBuffer *buffer = gTraceBuffers[i];
+      if(buffer && buffer->mActive && ThreadManager::compare(buffer->mThreadId, threadId))
+         return buffer;
+   }
+
+   return registerTraceBuffer(threadId);
+}
+
+//-----------------------------------------------------------------------------
+
+static inline void recordEvent(const char *name, const U32 type)
+{
+   ProfilerTraceBuffer *buffer = findTraceBuffer();
+   if(!buffer)
+      return;
+
+   const U32 writeCount = buffer->mWriteCount;
+   ProfilerTrace::Event &event = buffer->mEvents[writeCount & (ProfilerTrace::ThreadBufferEvents - 1)];
+   event.mName = name;
+   event.mTime = ProfilerTrace::getTime();
+   event.mType = type;
+
+   // Publish the event.
+   PROFILER_TRACE_BARRIER();
+   buffer->mWriteCount = writeCount + 1;
+}
+
+//-----------------------------------------------------------------------------
+
+static void copyTraceEvents(ProfilerTraceBuffer *buffer, Vector<ProfilerTrace::Event> &events)
+{
+   const U32 writeCount = buffer->mWriteCount;
+   PROFILER_TRACE_BARRIER();
+
+   // Only the most recent events are still available.
+   U32 available = writeCount - buffer->mReadStart;
+   if(available > ProfilerTrace::ThreadBufferEvents)
+      available = ProfilerTrace::ThreadBufferEvents;
+
+   const U32 start = events.size();
+   events.setSize(start + available);
+   for(U32 i = 0; i < available; i++)
+      events[start + i] = buffer->mEvents[(writeCount - available + i) & (ProfilerTrace::ThreadBufferEvents - 1)];
+
+   // Discard any events that were overwritten whilst copying.
+   PROFILER_TRACE_BARRIER();
+   const U32 overwritten = available + (buffer->mWriteCount - writeCount);
+   if(overwritten > ProfilerTrace::ThreadBufferEvents)
+   {
+      const U32 discard = getMin(overwritten - (U32)ProfilerTrace::ThreadBufferEvents, available);
+      dMemmove(events.address() + start, events.address() + start + discard, (available - discard) * sizeof(ProfilerTrace::Event));
+      events.setSize(start + available - discard);
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+void ProfilerTrace::enable(const bool enabled)
+{
+   smEnabled = enabled;
+
+   if(enabled)
+      Con::printf("Profiler trace is on.");
+   else
+      Con::printf("Profiler trace is off.");
+}
+
+//-----------------------------------------------------------------------------
+
+void ProfilerTrace::reset()
+{
+   const U32 count = gTraceBufferCount;
+   PROFILER_TRACE_BARRIER();
+
+   for(U32 i = 0; i < count; i++)
+      gTraceBuffers[i]->mReadStart = gTraceBuffers[i]->mWriteCount;
+}
+
+//-----------------------------------------------------------------------------
+
+void ProfilerTrace::beginEvent(const char *name)
+{
+   recordEvent(name, BeginEvent);
+}
+
+//-----------------------------------------------------------------------------
+
+void ProfilerTrace::endEvent()
+{
+   recordEvent(NULL, EndEvent);
+}
+
+//-----------------------------------------------------------------------------
+
+void ProfilerTrace::releaseThread()
+{
+   const ThreadIdent threadId = ThreadManager::getCurrentThreadId();
+
+   gTraceRegisterMutex.lock();
+
+   // The events are kept until another thread reuses the buffer.
+   const U32 count = gTraceBufferCount;
+   for(U32 i = 0; i < count; i++)
+   {
+      ProfilerTraceBuffer *buffer = gTraceBuffers[i];
+      if(buffer->mActive && ThreadManager::compare(buffer->mThreadId, threadId))
+      {
+         buffer->mActive = false;
+         break;
+      }
+   }
+
+   gTraceRegisterMutex.unlock();
+}
+
+//-----------------------------------------------------------------------------
+
+U32 ProfilerTrace::getThreadCount()
+{
+   return gTraceBufferCount;
+}
+
+//-----------------------------------------------------------------------------
+
+U64 ProfilerTrace::getTime()
+{
+#if defined(TORQUE_OS_WIN32)
+   static LARGE_INTEGER frequency = { 0 };
+   if(frequency.QuadPart == 0)
+      QueryPerformanceFrequency(&frequency);
+
+   LARGE_INTEGER counter;
+   QueryPerformanceCounter(&counter);
+
+   // Split the conversion to avoid overflowing.
+   const U64 ticks = (U64)counter.QuadPart;
+   const U64 ticksPerSecond = (U64)frequency.QuadPart;
+   return (ticks / ticksPerSecond) * 1000000 + ((ticks % ticksPerSecond) * 1000000) / ticksPerSecond;
+#elif defined(TORQUE_OS_MAC) || defined(TORQUE_OS_IOS)
+   static mach_timebase_info_data_t timebase = { 0, 0 };
+   if(timebase.denom == 0)
+      mach_timebase_info(&timebase);
+
+   return (mach_absolute_time() * timebase.numer / timebase.denom) / 1000;
+#else
+   struct timespec now;
+   clock_gettime(CLOCK_MONOTONIC, &now);
+   return (U64)now.tv_sec * 1000000 + (U64)now.tv_nsec / 1000;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+U32 ProfilerTrace::exportChromeTrace(Stream &stream)
+{
+   // Copy the events of all the threads.
+   const U32 count = gTraceBufferCount;
+   PROFILER_TRACE_BARRIER();
+
+   // The events of each thread are stored consecutively.
+   Vector<Event> events;
+   Vector<U32> threadStarts;
+   threadStarts.setSize(count + 1);
+
+   U64 baseTime = 0;
+   bool baseTimeSet = false;
+   for(U32 i = 0; i < count; i++)
+   {
+      threadStarts[i] = events.size();
+      copyTraceEvents(gTraceBuffers[i], events);
+
+      if((U32)events.size() > threadStarts[i] && (!baseTimeSet || events[threadStarts[i]].mTime < baseTime))
+      {
+         baseTime = events[threadStarts[i]].mTime;
+         baseTimeSet = true;
+      }
+   }
+   threadStarts[count] = events.size();
+
+   char buffer[1024];
+   U32 exportCount = 0;
+
+   dStrcpy(buffer, "{\"traceEvents\":[\n");
+   stream.write(dStrlen(buffer), buffer);
+
+   const char *separator = "";
+   for(U32 i = 0; i < count; i++)
+   {
+      const U32 threadIndex = gTraceBuffers[i]->mThreadIndex;
+
+      // Name the thread.
+      dSprintf(buffer, sizeof(buffer), "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+         separator, threadIndex, gTraceBuffers[i]->mThreadName);
+      stream.write(dStrlen(buffer), buffer);
+      separator = ",\n";
+
+      // The oldest events may have been overwritten so skip any unmatched end events.
+      U32 depth = 0;
+      F64 time = 0.0;
+      for(U32 n = threadStarts[i]; n < threadStarts[i + 1]; n++)
+      {
+         const Event &event = events[n];
+         time = (F64)(event.mTime - baseTime);
+
+         if(event.mType == BeginEvent)
+         {
+            depth++;
+            dSprintf(buffer, sizeof(buffer), ",\n{\"name\":\"%s\",\"ph\":\"B\",\"pid\":1,\"tid\":%d,\"ts\":%.0f}",
+               event.mName, threadIndex, time);
+         }
+         else
+         {
+            if(depth == 0)
+               continue;
+
+            depth--;
+            dSprintf(buffer, sizeof(buffer), ",\n{\"ph\":\"E\",\"pid\":1,\"tid\":%d,\"ts\":%.0f}", threadIndex, time);
+         }
+
+         stream.write(dStrlen(buffer), buffer);
+         exportCount++;
+      }
+
+      // Close any markers that are still open.
+      while(depth)
+      {
+         depth--;
+         dSprintf(buffer, sizeof(buffer), ",\n{\"ph\":\"E\",\"pid\":1,\"tid\":%d,\"ts\":%.0f}", threadIndex, time);
+         stream.write(dStrlen(buffer), buffer);
+         exportCount++;
+      }
+   }
+
+   dStrcpy(buffer, "\n],\"displayTimeUnit\":\"ms\"}\n");
+   stream.write(dStrlen(buffer), buffer);
+
+   return exportCount;
+}
+
+//-----------------------------------------------------------------------------
+
+bool ProfilerTrace::dumpChromeTrace(const char *fileName)
+{
+   FileStream fws;
+   if(!fws.open(fileName, FileStream::Write))
+   {
+      Con::warnf("ProfilerTrace::dumpChromeTrace() - Could not open file '%s' for writing.", fileName);
+      return false;
+   }
+
+   const U32 exportCount = exportChromeTrace(fws);
+   fws.close();
+
+   Con::printf("Profiler trace exported %d events to '%s'.", exportCount, fileName);
+   return true;
+}
+
+#endif
@@ -0,0 +1,119 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _PROFILER_TRACE_H_
+#define _PROFILER_TRACE_H_
+
+#include "torqueConfig.h"
+
+#ifdef TORQUE_ENABLE_PROFILER
+
+#ifndef _TORQUE_TYPES_H_
+#include "platform/types.h"
+#endif
+
+class Stream;
+
+/// The ProfilerTrace records a timeline of the PROFILE_START/PROFILE_END (and PROFILE_SCOPE)
+/// markers on every thread, as opposed to the Profiler which aggregates the main thread only.
+///
+/// Each thread records timestamped begin/end events into its own ring buffer.  A thread only
+/// ever writes to its own buffer so recording takes no locks; a lock is only taken the first
+/// time a thread records an event, to register its buffer.  When a buffer is full the oldest
+/// events are overwritten so a capture always holds the most recent events of each thread.
+/// When a thread exits its buffer is released (keeping its events) for the next new thread
+/// to reuse so threads that come and go don't use up the buffers.
+///
+/// The recorded events can be exported in the Chrome trace-event JSON format which can be
+/// loaded into "chrome://tracing" (or any compatible viewer).
+///
+/// Examples of script use:
+/// @code
+/// profilerTraceEnable(true);                  // start recording the timeline.
+/// profilerTraceDump("trace.json");            // export the recorded timeline.
+/// profilerTraceReset();                       // discard the recorded timeline.
+/// @endcode
+class ProfilerTrace
+{
+public:
+   enum
+   {
+      /// The number of events each thread can record before the oldest events are overwritten.
+      ThreadBufferEvents = 1 << 16,
+
+      /// The maximum number of threads that can record events at the same time.
+      MaxThreads = 64,
+   };
+
+   enum EventType
+   {
+      BeginEvent,
+      EndEvent,
+   };
+
+   /// A recorded event.
+   struct Event
+   {
+      const char* mName;   ///< Marker name (NULL for end events).
+      U64 mTime;           ///< Time in microseconds.
+      U32 mType;           ///< EventType.
+   };
+
+public:
+   /// Enable (or disable) recording.
+   static void enable( const bool enabled );
+
+   /// Whether recording is enabled.
+   static inline bool isEnabled( void ) { return smEnabled; }
+
+   /// Discard all recorded events.
+   static void reset( void );
+
+   /// Record the start of the named marker on the calling thread.
+   static void beginEvent( const char* pName );
+
+   /// Record the end of the most recently started marker on the calling thread.
+   static void endEvent( void );
+
+   /// Release the calling thread's buffer for reuse by a new thread (called as a thread exits).
+   static void releaseThread( void );
+
+   /// Export the recorded events in the Chrome trace-event JSON format.
+   /// @return The number of events exported.
+   static U32 exportChromeTrace( Stream& stream );
+
+   /// Export the recorded events in the Chrome trace-event JSON format to the specified file.
+   static bool dumpChromeTrace( const char* pFileName );
+
+   /// Get the number of thread buffers (each holds the events of a running or exited thread).
+   static U32 getThreadCount( void );
+
+   /// Get the current trace time in microseconds.
+   static U64 getTime( void );
+
+private:
+   static volatile bool smEnabled;
+};
+
+#endif // TORQUE_ENABLE_PROFILER
+
+#endif // _PROFILER_TRACE_H_
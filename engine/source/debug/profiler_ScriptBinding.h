@@ -77,6 +77,35 @@ ConsoleFunctionWithDocs(profilerReset, ConsoleVoid, 1, 1, ())
       gProfiler->reset();
 }
 
+/*! Enables (or disables) recording of the profiler timeline on all threads.
+    @param enable Boolean value. Recording is enabled if true, disabled if false.
+    @return No Return Value
+*/
+ConsoleFunctionWithDocs(profilerTraceEnable, ConsoleVoid, 2, 2, (bool enable))
+{
+   ProfilerTrace::enable(dAtob(argv[1]));
+}
+
+/*! Dumps the recorded profiler timeline to a file in the Chrome trace-event JSON format.
+    The file can be viewed using "chrome://tracing".
+    @param filename The file to dump the timeline to.
+    @return Whether the timeline was dumped or not.
+*/
+ConsoleFunctionWithDocs(profilerTraceDump, ConsoleBool, 2, 2, (string filename))
+{
+   char fileName[1024];
+   Con::expandPath(fileName, sizeof(fileName), argv[1]);
+   return ProfilerTrace::dumpChromeTrace(fileName);
+}
+
+/*! Discards the recorded profiler timeline.
+    @return No Return Value
+*/
+ConsoleFunctionWithDocs(profilerTraceReset, ConsoleVoid, 1, 1, ())
+{
+   ProfilerTrace::reset();
+}
+
 ConsoleFunctionGroupEnd( Profiler );
 
 /*! @} */ // group ProfilerFunctions
@@ -51,6 +51,10 @@
 #include "platform/platformVideo.h"
 #include "network/netStringTable.h"
 #include "memory/frameAllocator.h"
+#include "platform/threads/jobSystem.h"
+#include "console/scriptCompileService.h"
+#include "persistence/taml/tamlAsyncReader.h"
+#include "assets/assetAsyncAcquirer.h"
 #include "game/version.h"
 #include "debug/profiler.h"
 #include "network/serverQuery.h"
@@ -81,6 +85,10 @@
 #include "2d/core/ParticleSystem.h"
 #endif
 
+#ifndef _SCENE_RENDER_FACTORIES_H_
+#include "2d/scene/SceneRenderFactories.h"
+#endif
+
 #ifdef TORQUE_OS_IOS
 #include "platformiOS/iOSProfiler.h"
 #endif
@@ -162,6 +170,9 @@ bool initializeLibraries()
 
     Platform::init();    // platform specific initialization
 
+    // Start the job system workers.
+    JobSystem::init();
+
     // Initialize the particle system.
     ParticleSystem::Init();
     
@@ -183,6 +194,18 @@ void shutdownLibraries()
     TelnetDebugger::destroy();
     TelnetConsole::destroy();
 
+    // Stop compiling scripts in the background.
+    ScriptCompileService::shutdown();
+
+    // Stop reading Taml files in the background.
+    TamlAsyncReader::shutdown();
+
+    // Stop acquiring assets in the background.
+    AssetAsyncAcquirer::shutdown();
+
+    // Stop the job system workers.
+    JobSystem::destroy();
+
     Sim::shutdown();
     Platform::shutdown();
 
@@ -618,7 +641,10 @@ AndroidProfilerStart("SERVER_PROC");
    PROFILE_START(ServerNetProcess);
    // only send packets if a tick happened
    if(tickPass)
+   {
       GNet->processServer();
+      Net::flushPackets();
+   }
    PROFILE_END();
     
    PROFILE_START(SimAdvanceTime);
@@ -637,6 +663,12 @@ AndroidProfilerStart("SERVER_PROC");
 #endif
     PROFILE_END();
 
+   // Create the objects of the Taml files read in the background.
+   TamlAsyncReader::process();
+
+   // Upload and acquire the assets loaded in the background.
+   AssetAsyncAcquirer::process();
+
    PROFILE_START(ClientProcess);
 #ifdef TORQUE_OS_IOS_PROFILE
     iPhoneProfilerStart("CLIENT_PROC");
@@ -671,6 +703,7 @@ AndroidProfilerStart("SERVER_PROC");
     PROFILE_END();
    PROFILE_START(ClientNetProcess);
       GNet->processClient();
+      Net::flushPackets();
    PROFILE_END();
     
    if(Canvas && TextureManager::mDGLRender)
@@ -688,6 +721,10 @@ AndroidProfilerStart("GL_RENDER");
       PROFILE_START(RenderFrame);
       Canvas->renderFrame(preRenderOnly);
       PROFILE_END();
+
+      // Release the transient render requests and queues of the frame.
+      SceneRenderFrameArena.reset();
+
       gFrameCount++;
 #ifdef TORQUE_OS_IOS_PROFILE
 iPhoneProfilerEnd("GL_RENDER");
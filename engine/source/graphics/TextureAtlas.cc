@@ -0,0 +1,614 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "graphics/TextureAtlas.h"
+#include "graphics/TextureManager.h"
+#include "graphics/gBitmap.h"
+#include "console/console.h"
+#include "console/consoleTypes.h"
+#include "math/mMathFn.h"
+
+#include "TextureAtlas_ScriptBinding.h"
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+Vector<TextureAtlas::Page*> TextureAtlas::mPages;
+Vector<TextureAtlas::Entry> TextureAtlas::mEntries;
+Vector<TextureAtlas::StagedBitmap> TextureAtlas::mStagedBitmaps;
+Vector<StringTableEntry> TextureAtlas::mRejectedImages;
+U32 TextureAtlas::mLastEntryId = 0;
+U32 TextureAtlas::mUploadCount = 0;
+
+bool TextureAtlas::mEnabled = false;
+S32 TextureAtlas::mPageSize = TEXTURE_ATLAS_DEFAULT_PAGE_SIZE;
+S32 TextureAtlas::mMaxImageSize = TEXTURE_ATLAS_DEFAULT_MAX_IMAGE_SIZE;
+S32 TextureAtlas::mPadding = TEXTURE_ATLAS_DEFAULT_PADDING;
+
+//-----------------------------------------------------------------------------
+
+RectanglePacker::RectanglePacker() :
+    mWidth( 0 ),
+    mHeight( 0 ),
+    mUsedArea( 0 )
+{
+}
+
+//-----------------------------------------------------------------------------
+
+void RectanglePacker::reset( const U32 width, const U32 height )
+{
+    mWidth = width;
+    mHeight = height;
+    mUsedArea = 0;
+
+    // Start with a single node along the top.
+    SkylineNode node;
+    node.mX = 0;
+    node.mY = 0;
+    node.mWidth = (S32)width;
+    mSkyline.clear();
+    mSkyline.push_back( node );
+}
+
+//-----------------------------------------------------------------------------
+
+S32 RectanglePacker::findPosition( const U32 nodeIndex, const S32 width, const S32 height ) const
+{
+    // Finish if the rectangle would be off the right-hand-side.
+    const SkylineNode& node = mSkyline[nodeIndex];
+    if ( node.mX + width > (S32)mWidth )
+        return -1;
+
+    // Rest the rectangle on the highest node it spans.
+    S32 y = node.mY;
+    S32 widthLeft = width;
+    for ( U32 index = nodeIndex; widthLeft > 0; ++index )
+    {
+        y = getMax( y, mSkyline[index].mY );
+
+        // Finish if the rectangle would be off the bottom.
+        if ( y + height > (S32)mHeight )
+            return -1;
+
+        widthLeft -= mSkyline[index].mWidth;
+    }
+
+    return y;
+}
+
+//-----------------------------------------------------------------------------
+
+void RectanglePacker::addSkylineNode( const U32 nodeIndex, const S32 x, const S32 y, const S32 width, const S32 height )
+{
+    // Insert the top of the rectangle.
+    SkylineNode newNode;
+    newNode.mX = x;
+    newNode.mY = y + height;
+    newNode.mWidth = width;
+    mSkyline.insert( nodeIndex );
+    mSkyline[nodeIndex] = newNode;
+
+    // Shrink or remove the nodes that are now under the rectangle.
+    for ( U32 index = nodeIndex + 1; index < (U32)mSkyline.size(); )
+    {
+        const SkylineNode& previousNode = mSkyline[index-1];
+        SkylineNode& node = mSkyline[index];
+
+        const S32 overlap = previousNode.mX + previousNode.mWidth - node.mX;
+        if ( overlap <= 0 )
+            break;
+
+        node.mX += overlap;
+        node.mWidth -= overlap;
+        if ( node.mWidth > 0 )
+            break;
+
+        mSkyline.erase( index );
+    }
+
+    // Merge neighbouring nodes at the same height.
+    for ( U32 index = 1; index < (U32)mSkyline.size(); )
+    {
+        if ( mSkyline[index-1].mY == mSkyline[index].mY )
+        {
+            mSkyline[index-1].mWidth += mSkyline[index].mWidth;
+            mSkyline.erase( index );
+        }
+        else
+        {
+            ++index;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+bool RectanglePacker::insert( const U32 width, const U32 height, Point2I& position )
+{
+    // Sanity!
+    AssertFatal( width > 0 && height > 0, "RectanglePacker::insert() - Cannot pack an empty rectangle." );
+
+    // Find the position that keeps the skyline lowest, preferring the narrowest node on a tie.
+    S32 bestIndex = -1;
+    S32 bestY = 0;
+    S32 bestTop = S32_MAX;
+    S32 bestWidth = S32_MAX;
+    for ( U32 index = 0; index < (U32)mSkyline.size(); ++index )
+    {
+        const S32 y = findPosition( index, (S32)width, (S32)height );
+        if ( y < 0 )
+            continue;
+
+        const S32 top = y + (S32)height;
+        if ( top < bestTop || (top == bestTop && mSkyline[index].mWidth < bestWidth) )
+        {
+            bestIndex = (S32)index;
+            bestY = y;
+            bestTop = top;
+            bestWidth = mSkyline[index].mWidth;
+        }
+    }
+
+    // Finish if there's no space.
+    if ( bestIndex < 0 )
+        return false;
+
+    position.set( mSkyline[bestIndex].mX, bestY );
+    addSkylineNode( (U32)bestIndex, position.x, position.y, (S32)width, (S32)height );
+    mUsedArea += width * height;
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void TextureAtlas::create( void )
+{
+    Con::addVariable( TEXTURE_ATLAS_ENABLED_VARIABLE, TypeBool, &mEnabled );
+    Con::addVariable( TEXTURE_ATLAS_PAGE_SIZE_VARIABLE, TypeS32, &mPageSize );
+    Con::addVariable( TEXTURE_ATLAS_MAX_IMAGE_SIZE_VARIABLE, TypeS32, &mMaxImageSize );
+    Con::addVariable( TEXTURE_ATLAS_PADDING_VARIABLE, TypeS32, &mPadding );
+}
+
+//-----------------------------------------------------------------------------
+
+void TextureAtlas::destroy( void )
+{
+    clearStagedBitmaps();
+
+    // Free the pages.
+    // NOTE: Any images still acquired are ignored when they are released.
+    for ( U32 index = 0; index < (U32)mPages.size(); ++index )
+        delete mPages[index];
+
+    mPages.clear();
+    mEntries.clear();
+    mRejectedImages.clear();
+    mUploadCount = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+GBitmap* TextureAtlas::takeBitmap( StringTableEntry imageFile )
+{
+    for ( U32 index = 0; index < (U32)mStagedBitmaps.size(); ++index )
+    {
+        if ( mStagedBitmaps[index].mImageFile == imageFile )
+        {
+            GBitmap* pBitmap = mStagedBitmaps[index].mpBitmap;
+            mStagedBitmaps.erase_fast( index );
+            return pBitmap;
+        }
+    }
+
+    return NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+TextureAtlas::Page* TextureAtlas::createPage( const GLuint filter, const U32 pageSize )
+{
+    // Create a clear bitmap.
+    GBitmap* pBitmap = new GBitmap( pageSize, pageSize, false, GBitmap::RGBA );
+    dMemset( pBitmap->getWritableBits(), 0, pBitmap->byteSize );
+
+    // Create the page texture.
+    // NOTE: The bitmap is kept so images can be copied into it and it can be restored without them.
+    Page* pPage = new Page();
+    pPage->mTexture = TextureHandle( TextureManager::getUniqueTextureKey(), pBitmap, TextureHandle::BitmapKeepTexture, true );
+    pPage->mTexture.setFilter( filter );
+    pPage->mPacker.reset( pageSize, pageSize );
+    pPage->mFilter = filter;
+    pPage->mImageCount = 0;
+    mPages.push_back( pPage );
+
+    return pPage;
+}
+
+//-----------------------------------------------------------------------------
+
+void TextureAtlas::freePage( Page* pPage )
+{
+    for ( U32 index = 0; index < (U32)mPages.size(); ++index )
+    {
+        if ( mPages[index] == pPage )
+        {
+            mPages.erase( index );
+            break;
+        }
+    }
+
+    delete pPage;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 TextureAtlas::acquire( const char* pImageFile, const GLuint filter, TextureHandle& texture, RectI& imageArea, GBitmap*& pUnpackedBitmap )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TextureAtlas_Acquire);
+
+    // Sanity!
+    AssertFatal( pImageFile != NULL, "TextureAtlas::acquire() - Cannot acquire a NULL image file." );
+
+    pUnpackedBitmap = NULL;
+
+    // Fetch image file.
+    StringTableEntry imageFile = StringTable->insert( pImageFile );
+
+    // Is the image already packed with this filter?
+    for ( U32 index = 0; index < (U32)mEntries.size(); ++index )
+    {
+        Entry& entry = mEntries[index];
+        if ( entry.mImageFile == imageFile && entry.mpPage->mFilter == filter )
+        {
+            // Yes, so share it.
+            entry.mRefCount++;
+            texture = entry.mpPage->mTexture;
+            imageArea = entry.mImageArea;
+            return entry.mEntryId;
+        }
+    }
+
+    // Finish if the textures aren't being managed.
+    if ( TextureManager::getManagerState() != TextureManager::Alive )
+        return 0;
+
+    // Fetch any staged bitmap for the image.
+    GBitmap* pBitmap = takeBitmap( imageFile );
+
+    // Finish if the image isn't suitable for packing.
+    for ( U32 index = 0; index < (U32)mRejectedImages.size(); ++index )
+    {
+        if ( mRejectedImages[index] == imageFile )
+        {
+            pUnpackedBitmap = pBitmap;
+            return 0;
+        }
+    }
+
+    // Load the image if it wasn't staged.
+    if ( pBitmap == NULL )
+        pBitmap = TextureManager::loadBitmap( imageFile );
+
+    // Finish if the image could not be loaded.
+    if ( pBitmap == NULL )
+        return 0;
+
+    // Calculate the padded image size.
+    const U32 padding = (U32)mClamp( mPadding, 0, 16 );
+    const U32 pageSize = getNextPow2( (U32)mClamp( mPageSize, 64, MaximumProductSupportedTextureWidth ) );
+    const U32 paddedWidth = pBitmap->getWidth() + padding * 2;
+    const U32 paddedHeight = pBitmap->getHeight() + padding * 2;
+
+    // Can the image be packed?
+    const GBitmap::BitmapFormat format = pBitmap->getFormat();
+    if ( (format != GBitmap::RGB && format != GBitmap::RGBA) ||
+        pBitmap->getWidth() > (U32)mMaxImageSize || pBitmap->getHeight() > (U32)mMaxImageSize ||
+        paddedWidth > pageSize || paddedHeight > pageSize )
+    {
+        // No, so hand the bitmap back to be used as its own texture.
+        mRejectedImages.push_back( imageFile );
+        pUnpackedBitmap = pBitmap;
+        return 0;
+    }
+
+    // Find a page with space for the image.
+    Page* pPage = NULL;
+    Point2I position;
+    for ( U32 index = 0; index < (U32)mPages.size(); ++index )
+    {
+        Page* pCandidatePage = mPages[index];
+        if ( pCandidatePage->mFilter == filter && pCandidatePage->mPacker.insert( paddedWidth, paddedHeight, position ) )
+        {
+            pPage = pCandidatePage;
+            break;
+        }
+    }
+
+    // Create a page if none had space.
+    if ( pPage == NULL )
+    {
+        pPage = createPage( filter, pageSize );
+        const bool packed = pPage->mPacker.insert( paddedWidth, paddedHeight, position );
+
+        // Sanity!
+        AssertFatal( packed, "TextureAtlas::acquire() - Failed to pack an image into an empty page." );
+    }
+
+    // Copy the image into the page.
+    copyImage( pBitmap, pPage->mTexture.getBitmap(), position, padding );
+    delete pBitmap;
+
+    // Upload the padded image.
+    TextureManager::refreshRegion( (TextureObject*)pPage->mTexture, RectI( position, Point2I( paddedWidth, paddedHeight ) ) );
+    mUploadCount++;
+
+    // Add the entry.
+    Entry entry;
+    entry.mEntryId = ++mLastEntryId;
+    entry.mImageFile = imageFile;
+    entry.mpPage = pPage;
+    entry.mImageArea.set( position + Point2I( padding, padding ), Point2I( paddedWidth - padding * 2, paddedHeight - padding * 2 ) );
+    entry.mPadding = padding;
+    entry.mRefCount = 1;
+    mEntries.push_back( entry );
+    pPage->mImageCount++;
+
+    texture = pPage->mTexture;
+    imageArea = entry.mImageArea;
+    return entry.mEntryId;
+}
+
+//-----------------------------------------------------------------------------
+
+void TextureAtlas::release( const U32 entryId )
+{
+    for ( U32 index = 0; index < (U32)mEntries.size(); ++index )
+    {
+        Entry& entry = mEntries[index];
+        if ( entry.mEntryId != entryId )
+            continue;
+
+        // Finish if the image is still referenced.
+        if ( --entry.mRefCount > 0 )
+            return;
+
+        // Remove the entry.
+        Page* pPage = entry.mpPage;
+        mEntries.erase_fast( index );
+
+        // Free the page if it's empty.
+        if ( --pPage->mImageCount == 0 )
+            freePage( pPage );
+
+        return;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void TextureAtlas::refresh( const char* pImageFile )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TextureAtlas_Refresh);
+
+    // Sanity!
+    AssertFatal( pImageFile != NULL, "TextureAtlas::refresh() - Cannot refresh a NULL image file." );
+
+    // Fetch image file.
+    StringTableEntry imageFile = StringTable->insert( pImageFile );
+
+    // The image may be suitable for packing now.
+    for ( U32 index = 0; index < (U32)mRejectedImages.size(); ++index )
+    {
+        if ( mRejectedImages[index] == imageFile )
+        {
+            mRejectedImages.erase_fast( index );
+            break;
+        }
+    }
+
+    // Reload the image into any pages it's packed into.
+    GBitmap* pBitmap = NULL;
+    bool loaded = false;
+    for ( U32 index = 0; index < (U32)mEntries.size(); ++index )
+    {
+        Entry& entry = mEntries[index];
+        if ( entry.mImageFile != imageFile )
+            continue;
+
+        // Load the image once for all the filters it's packed with.
+        if ( !loaded )
+        {
+            pBitmap = takeBitmap( imageFile );
+            if ( pBitmap == NULL && TextureManager::getManagerState() == TextureManager::Alive )
+                pBitmap = TextureManager::loadBitmap( imageFile );
+
+            loaded = true;
+        }
+
+        // Can the image be copied into its existing area?
+        if ( pBitmap == NULL ||
+            (pBitmap->getFormat() != GBitmap::RGB && pBitmap->getFormat() != GBitmap::RGBA) ||
+            pBitmap->getWidth() != (U32)entry.mImageArea.extent.x || pBitmap->getHeight() != (U32)entry.mImageArea.extent.y )
+        {
+            // No, so stop sharing the entry.  It's freed when its users release it.
+            entry.mImageFile = StringTable->EmptyString;
+            continue;
+        }
+
+        // Copy the image into the page again.
+        const Point2I position = entry.mImageArea.point - Point2I( entry.mPadding, entry.mPadding );
+        copyImage( pBitmap, entry.mpPage->mTexture.getBitmap(), position, entry.mPadding );
+
+        // Upload the padded image.
+        TextureManager::refreshRegion( (TextureObject*)entry.mpPage->mTexture, RectI( position, entry.mImageArea.extent + Point2I( entry.mPadding * 2, entry.mPadding * 2 ) ) );
+        mUploadCount++;
+    }
+
+    delete pBitmap;
+}
+
+//-----------------------------------------------------------------------------
+
+StringTableEntry TextureAtlas::getImageFile( const U32 entryId )
+{
+    for ( U32 index = 0; index < (U32)mEntries.size(); ++index )
+    {
+        if ( mEntries[index].mEntryId == entryId )
+            return mEntries[index].mImageFile;
+    }
+
+    return StringTable->EmptyString;
+}
+
+//-----------------------------------------------------------------------------
+
+void TextureAtlas::stageBitmap( const char* pImageFile, GBitmap* pBitmap )
+{
+    // Sanity!
+    AssertFatal( pImageFile != NULL, "TextureAtlas::stageBitmap() - Cannot stage a NULL image file." );
+    AssertFatal( pBitmap != NULL, "TextureAtlas::stageBitmap() - Cannot stage a NULL bitmap." );
+
+    // Fetch image file.
+    StringTableEntry imageFile = StringTable->insert( pImageFile );
+
+    // Keep the first bitmap staged for the image.
+    for ( U32 index = 0; index < (U32)mStagedBitmaps.size(); ++index )
+    {
+        if ( mStagedBitmaps[index].mImageFile == imageFile )
+        {
+            delete pBitmap;
+            return;
+        }
+    }
+
+    StagedBitmap stagedBitmap;
+    stagedBitmap.mImageFile = imageFile;
+    stagedBitmap.mpBitmap = pBitmap;
+    mStagedBitmaps.push_back( stagedBitmap );
+}
+
+//-----------------------------------------------------------------------------
+
+void TextureAtlas::clearStagedBitmaps( void )
+{
+    for ( U32 index = 0; index < (U32)mStagedBitmaps.size(); ++index )
+        delete mStagedBitmaps[index].mpBitmap;
+
+    mStagedBitmaps.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void TextureAtlas::copyImage( const GBitmap* pImageBitmap, GBitmap* pPageBitmap, const Point2I& position, const U32 padding )
+{
+    // Sanity!
+    AssertFatal( pImageBitmap->getFormat() == GBitmap::RGB || pImageBitmap->getFormat() == GBitmap::RGBA, "TextureAtlas::copyImage() - Only RGB and RGBA images can be copied." );
+    AssertFatal( pPageBitmap->getFormat() == GBitmap::RGBA, "TextureAtlas::copyImage() - The page must be RGBA." );
+
+    const S32 imageWidth = (S32)pImageBitmap->getWidth();
+    const S32 imageHeight = (S32)pImageBitmap->getHeight();
+    const S32 extrusion = (S32)padding;
+    const U32 sourceBytesPerPixel = pImageBitmap->bytesPerPixel;
+    const bool sourceAlpha = pImageBitmap->getFormat() == GBitmap::RGBA;
+
+    // Copy the rows, repeating the edge texels into the padding.
+    for ( S32 y = -extrusion; y < imageHeight + extrusion; ++y )
+    {
+        const U8* pSourceRow = pImageBitmap->getAddress( 0, mClamp( y, 0, imageHeight - 1 ) );
+        U8* pDestination = pPageBitmap->getAddress( position.x, position.y + extrusion + y );
+
+        for ( S32 x = -extrusion; x < imageWidth + extrusion; ++x )
+        {
+            const U8* pSource = pSourceRow + mClamp( x, 0, imageWidth - 1 ) * sourceBytesPerPixel;
+            pDestination[0] = pSource[0];
+            pDestination[1] = pSource[1];
+            pDestination[2] = pSource[2];
+            pDestination[3] = sourceAlpha ? pSource[3] : 0xFF;
+            pDestination += 4;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void TextureAtlas::getMetrics( Metrics& metrics )
+{
+    dMemset( &metrics, 0, sizeof(metrics) );
+
+    for ( U32 index = 0; index < (U32)mPages.size(); ++index )
+    {
+        const RectanglePacker& packer = mPages[index]->mPacker;
+        metrics.mPackedArea += packer.getUsedArea();
+        metrics.mPageArea += packer.getWidth() * packer.getHeight();
+    }
+
+    metrics.mPageCount = (U32)mPages.size();
+    metrics.mImageCount = (U32)mEntries.size();
+    metrics.mRejectedCount = (U32)mRejectedImages.size();
+    metrics.mUploadCount = mUploadCount;
+}
+
+//-----------------------------------------------------------------------------
+
+void TextureAtlas::dumpMetrics( void )
+{
+    Con::printSeparator();
+    Con::printBlankLine();
+    Con::printf( "Dumping texture atlas metrics:" );
+
+    for ( U32 index = 0; index < (U32)mPages.size(); ++index )
+    {
+        Page* pPage = mPages[index];
+
+        // Info.
+        Con::printf( "Page=%d, Key=%s, PageArea: (%d-%d), Filter=%s, Images=%d, Occupancy=%g",
+            index,
+            pPage->mTexture.getTextureKey(),
+            pPage->mPacker.getWidth(), pPage->mPacker.getHeight(),
+            pPage->mFilter == GL_NEAREST ? "NEAREST" : "BILINEAR",
+            pPage->mImageCount,
+            pPage->mPacker.getOccupancy() );
+    }
+
+    Metrics metrics;
+    getMetrics( metrics );
+
+    // Info.
+    Con::printf( "Metrics Totals:" );
+    Con::printf( "PageCount: %d, ImageCount: %d, PackedArea: %d, PageArea: %d, Occupancy: %g, Rejected: %d, Uploads: %d",
+        metrics.mPageCount,
+        metrics.mImageCount,
+        metrics.mPackedArea,
+        metrics.mPageArea,
+        metrics.mPageArea == 0 ? 0.0f : (F32)metrics.mPackedArea / (F32)metrics.mPageArea,
+        metrics.mRejectedCount,
+        metrics.mUploadCount );
+
+    Con::printBlankLine();
+    Con::printSeparator();
+}
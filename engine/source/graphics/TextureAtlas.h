@@ -0,0 +1,205 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _TEXTURE_ATLAS_H_
+#define _TEXTURE_ATLAS_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _TEXTURE_HANDLE_H_
+#include "graphics/TextureHandle.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+#ifndef _MRECT_H_
+#include "math/mRect.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define TEXTURE_ATLAS_ENABLED_VARIABLE          "$pref::T2D::imageAssetAtlas"
+#define TEXTURE_ATLAS_PAGE_SIZE_VARIABLE        "$pref::T2D::imageAssetAtlasPageSize"
+#define TEXTURE_ATLAS_MAX_IMAGE_SIZE_VARIABLE   "$pref::T2D::imageAssetAtlasMaxImageSize"
+#define TEXTURE_ATLAS_PADDING_VARIABLE          "$pref::T2D::imageAssetAtlasPadding"
+
+#define TEXTURE_ATLAS_DEFAULT_PAGE_SIZE         1024
+#define TEXTURE_ATLAS_DEFAULT_MAX_IMAGE_SIZE    256
+#define TEXTURE_ATLAS_DEFAULT_PADDING           2
+
+class GBitmap;
+
+//-----------------------------------------------------------------------------
+
+/// A skyline rectangle packer.
+///
+/// Rectangles are placed bottom-left on a skyline which is the top edge of everything
+/// packed so far, choosing the position that keeps the skyline lowest.  Space under the
+/// skyline is never reused so rectangles are not removed individually; the packer is
+/// reset instead.
+class RectanglePacker
+{
+private:
+    struct SkylineNode
+    {
+        S32 mX;
+        S32 mY;
+        S32 mWidth;
+    };
+
+    Vector<SkylineNode> mSkyline;
+    U32 mWidth;
+    U32 mHeight;
+    U32 mUsedArea;
+
+    S32 findPosition( const U32 nodeIndex, const S32 width, const S32 height ) const;
+    void addSkylineNode( const U32 nodeIndex, const S32 x, const S32 y, const S32 width, const S32 height );
+
+public:
+    RectanglePacker();
+
+    /// Remove all the rectangles and set the area to pack into.
+    void reset( const U32 width, const U32 height );
+
+    /// Pack a rectangle.
+    /// @param position The top-left position of the packed rectangle.
+    /// @return Whether the rectangle could be packed.
+    bool insert( const U32 width, const U32 height, Point2I& position );
+
+    inline U32 getWidth( void ) const { return mWidth; }
+    inline U32 getHeight( void ) const { return mHeight; }
+    inline U32 getUsedArea( void ) const { return mUsedArea; }
+    inline F32 getOccupancy( void ) const { return mWidth == 0 || mHeight == 0 ? 0.0f : (F32)mUsedArea / (F32)(mWidth * mHeight); }
+};
+
+//-----------------------------------------------------------------------------
+
+/// Packs small images into shared atlas pages.
+///
+/// Each page is a single texture so everything drawn from a page batches together rather than
+/// flushing on every image change.  Images are padded and their edge texels extruded into the
+/// padding so filtering never samples a neighbouring image.
+///
+/// Pages only hold images with the same filter mode as filtering is a texture state.  Images are
+/// shared by file so an image packed once is referenced by all its users.  The space of a released
+/// image is only reclaimed when its page is empty at which point the page is freed.
+///
+/// The pages keep their bitmaps so they can be restored without reloading their images.
+class TextureAtlas
+{
+public:
+    /// Atlas metrics.
+    struct Metrics
+    {
+        U32 mPageCount;         ///< The number of pages.
+        U32 mImageCount;        ///< The number of packed images.
+        U32 mPackedArea;        ///< The area used by the packed images (including padding).
+        U32 mPageArea;          ///< The area of all the pages.
+        U32 mRejectedCount;     ///< Images that are not suitable for packing.
+        U32 mUploadCount;       ///< Images uploaded into pages.
+    };
+
+private:
+    struct Page
+    {
+        TextureHandle       mTexture;
+        RectanglePacker     mPacker;
+        GLuint              mFilter;
+        U32                 mImageCount;
+    };
+
+    struct Entry
+    {
+        U32                 mEntryId;
+        StringTableEntry    mImageFile;
+        Page*               mpPage;
+        RectI               mImageArea;
+        U32                 mPadding;
+        U32                 mRefCount;
+    };
+
+    struct StagedBitmap
+    {
+        StringTableEntry    mImageFile;
+        GBitmap*            mpBitmap;
+    };
+
+    static Vector<Page*> mPages;
+    static Vector<Entry> mEntries;
+    static Vector<StagedBitmap> mStagedBitmaps;
+    static Vector<StringTableEntry> mRejectedImages;
+    static U32 mLastEntryId;
+    static U32 mUploadCount;
+
+    static bool mEnabled;
+    static S32 mPageSize;
+    static S32 mMaxImageSize;
+    static S32 mPadding;
+
+    static GBitmap* takeBitmap( StringTableEntry imageFile );
+    static Page* createPage( const GLuint filter, const U32 pageSize );
+    static void freePage( Page* pPage );
+
+public:
+    static void create( void );
+    static void destroy( void );
+
+    /// Whether images should be packed.
+    static inline bool getEnabled( void ) { return mEnabled; }
+
+    /// Pack an image into a page with the specified filter.
+    /// @param texture Set to the page texture if the image is packed.
+    /// @param imageArea Set to the area of the image in the page if the image is packed.
+    /// @param pUnpackedBitmap Set to the loaded bitmap if the image is not packed (owned by the caller) or NULL if it was not loaded.
+    /// Images that are not suitable for packing are remembered so they are only loaded here once.
+    /// @return The entry Id or zero if the image is not packed.
+    static U32 acquire( const char* pImageFile, const GLuint filter, TextureHandle& texture, RectI& imageArea, GBitmap*& pUnpackedBitmap );
+
+    /// Release an image acquired from the atlas.
+    static void release( const U32 entryId );
+
+    /// Reload an image that may have changed on disk.
+    /// Packed images that keep their size are copied into their page again.  Any others are no
+    /// longer shared so acquiring the image packs it again.
+    static void refresh( const char* pImageFile );
+
+    /// Gets the image file of an acquired entry or an empty string if there is no such entry.
+    static StringTableEntry getImageFile( const U32 entryId );
+
+    /// Provide an already loaded bitmap for an image so acquiring it doesn't load it again.
+    /// The atlas owns the bitmap until the staged bitmaps are cleared.
+    static void stageBitmap( const char* pImageFile, GBitmap* pBitmap );
+    static void clearStagedBitmaps( void );
+
+    /// Copy an image into a page bitmap with its edges extruded into the padding around it.
+    /// @param position The top-left position of the padded image.
+    static void copyImage( const GBitmap* pImageBitmap, GBitmap* pPageBitmap, const Point2I& position, const U32 padding );
+
+    static void getMetrics( Metrics& metrics );
+    static void dumpMetrics( void );
+};
+
+#endif // _TEXTURE_ATLAS_H_
@@ -0,0 +1,56 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+/*! @defgroup TextureAtlasFunctions Texture Atlas
+	@ingroup TorqueScriptFunctions
+	@{
+*/
+
+/*! Dump the texture atlas metrics.
+*/
+ConsoleFunctionWithDocs( dumpTextureAtlasMetrics, ConsoleVoid, 1, 1, ())
+{
+    TextureAtlas::dumpMetrics();
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+/*! Gets the texture atlas metrics.
+    @return The metrics in the format "pageCount imageCount occupancy rejectedCount uploadCount".
+*/
+ConsoleFunctionWithDocs( getTextureAtlasMetrics, ConsoleString, 1, 1, ())
+{
+    TextureAtlas::Metrics metrics;
+    TextureAtlas::getMetrics( metrics );
+
+    // Format the metrics.
+    char* pBuffer = Con::getReturnBuffer( 64 );
+    dSprintf( pBuffer, 64, "%d %d %g %d %d",
+        metrics.mPageCount,
+        metrics.mImageCount,
+        metrics.mPageArea == 0 ? 0.0f : (F32)metrics.mPackedArea / (F32)metrics.mPageArea,
+        metrics.mRejectedCount,
+        metrics.mUploadCount );
+    return pBuffer;
+}
+
+/*! @} */ // group TextureAtlasFunctions
@@ -21,6 +21,7 @@
 //-----------------------------------------------------------------------------
 
 #include "graphics/TextureManager.h"
+#include "graphics/TextureAtlas.h"
 
 #include "platform/platformAssert.h"
 #include "platform/platformGL.h"
@@ -156,6 +157,13 @@ void TextureManager::create()
     Con::addVariable("$pref::OpenGL::allowTextureCompression", TypeBool, &TextureManager::mAllowTextureCompression);
     Con::addVariable("$pref::OpenGL::disableTextureSubImageUpdates", TypeBool, &TextureManager::mDisableTextureSubImageUpdates);
 
+    // Bind the palettized PNG conversion so bitmaps can be read on any thread.
+    extern bool sgForcePalletedPNGsTo16Bit;
+    Con::addVariable("$pref::iPhone::ForcePalletedPNGsTo16Bit", TypeBool, &sgForcePalletedPNGsTo16Bit);
+
+    // Create the texture atlas.
+    TextureAtlas::create();
+
     // Flag as alive.
     mManagerState = Alive;
 }
@@ -166,6 +174,9 @@ void TextureManager::destroy()
 {
     AssertISV(mManagerState != NotInitialized, "TextureManager::destroy - nothing to destroy!");
 
+    // Destroy the texture atlas pages.
+    TextureAtlas::destroy();
+
     // Destroy the texture dictionary.
     TextureDictionary::destroy();
 
@@ -707,6 +718,64 @@ void TextureManager::refresh( TextureObject* pTextureObject )
 
 //--------------------------------------------------------------------------------------------------------------------
 
+void TextureManager::refreshRegion( TextureObject* pTextureObject, const RectI& region )
+{
+    // Finish if refresh not appropriate.
+    if (!(mDGLRender || mManagerState == Resurrecting))
+        return;
+
+    // Finish if the texture hasn't been created yet; the whole bitmap is uploaded when it is.
+    if ( pTextureObject->mGLTextureName == 0 )
+        return;
+
+    // Sanity!
+    AssertISV( pTextureObject->mpBitmap != 0, "Refreshing texture region but no bitmap available." );
+
+    GBitmap* pBitmap = pTextureObject->mpBitmap;
+
+    // Sanity!
+    AssertFatal( region.point.x >= 0 && region.point.y >= 0 &&
+        (U32)(region.point.x + region.extent.x) <= pBitmap->getWidth() &&
+        (U32)(region.point.y + region.extent.y) <= pBitmap->getHeight(), "Refreshing texture region outside of the bitmap." );
+
+    // Refresh the whole texture if the region can't be updated on its own.
+    if ( mDisableTextureSubImageUpdates ||
+        pBitmap->mForce16Bit ||
+        (pBitmap->getFormat() != GBitmap::RGB && pBitmap->getFormat() != GBitmap::RGBA) ||
+        pBitmap->getWidth() != pTextureObject->mTextureWidth ||
+        pBitmap->getHeight() != pTextureObject->mTextureHeight )
+    {
+        refresh( pTextureObject );
+        return;
+    }
+
+    // Fetch source/dest formats.
+    U32 sourceFormat, destFormat, byteFormat, texelSize;
+    getSourceDestByteFormat(pBitmap, &sourceFormat, &destFormat, &byteFormat, &texelSize);
+
+    // Copy the region rows together as the unpack row length isn't available everywhere.
+    const U32 rowSize = region.extent.x * pBitmap->bytesPerPixel;
+    U8* pRegionBits = new U8[rowSize * region.extent.y];
+    for ( S32 y = 0; y < region.extent.y; ++y )
+    {
+        dMemcpy( pRegionBits + y * rowSize, pBitmap->getAddress( region.point.x, region.point.y + y ), rowSize );
+    }
+
+    // Upload the region.
+    glBindTexture( GL_TEXTURE_2D, pTextureObject->mGLTextureName );
+    glTexSubImage2D(GL_TEXTURE_2D,
+        0,
+        region.point.x, region.point.y,
+        region.extent.x, region.extent.y,
+        sourceFormat,
+        byteFormat,
+        pRegionBits);
+
+    delete [] pRegionBits;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
 void TextureManager::refresh( const char *textureName )
 {
     // Finish if no texture name specified.
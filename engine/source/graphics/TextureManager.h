@@ -40,6 +40,10 @@
 #include "graphics/TextureDictionary.h"
 #endif
 
+#ifndef _MRECT_H_
+#include "math/mRect.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
 #define MaximumProductSupportedTextureWidth 2048
@@ -49,6 +53,7 @@ class TextureManager
 {
    friend class TextureHandle;
    friend class TextureDictionary;
+   friend class TextureAtlas;
 
 public:
     /// Texture manager event codes.
@@ -114,6 +119,7 @@ private:
     static TextureObject* loadTexture(const char *textureName, TextureHandle::TextureHandleType type, bool clampToEdge, bool checkOnly = false, bool force16Bit = false );
     static void freeTexture( TextureObject* pTextureObject );
     static void refresh(TextureObject* pTextureObject);
+    static void refreshRegion(TextureObject* pTextureObject, const RectI& region);
 
     static GBitmap* loadBitmap(const char *textureName, bool recurse = true, bool nocompression = false);
     static GBitmap* createPowerOfTwoBitmap( GBitmap* pBitmap );
@@ -30,6 +30,7 @@
 
 //-Mat used when checking for palleted textures
 #include "console/console.h"
+// NOTE: Bound to "$pref::iPhone::ForcePalletedPNGsTo16Bit" by the texture manager so reading doesn't touch the console.
 bool sgForcePalletedPNGsTo16Bit= false;
 
 
@@ -45,28 +46,24 @@ bool sgForcePalletedPNGsTo16Bit= false;
 
 // Our chunk signatures...
 
-static const U32 csgMaxRowPointers = (1 << GBitmap::c_maxMipLevels) - 1; ///< 2^11 = 2048, 12 mip levels (see c_maxMipLievels)
-static png_bytep sRowPointers[csgMaxRowPointers];
-
-//-------------------------------------- Instead of using the user_ptr,
-//                                        we use a global pointer, we
-//                                        need to ensure that only one thread
-//                                        at once may be using the variable.
-//                                       NOTE: Removed mutex for g_varAccess.
-//                                        may have to re-thread safe this.
+//-------------------------------------- Writing uses a global pointer rather
+//                                        than the user_ptr so only one thread
+//                                        at once may be writing.  Reading uses
+//                                        the io_ptr so any thread can read.
 static Stream* sg_pStream = NULL;
 
 //-------------------------------------- Replacement I/O for standard LIBPng
 //                                        functions.  we don't wanna use
 //                                        FILE*'s...
-static void pngReadDataFn(png_structp  /*png_ptr*/,
+static void pngReadDataFn(png_structp  png_ptr,
                           png_bytep   data,
                           png_size_t  length)
 {
-   AssertFatal(sg_pStream != NULL, "No stream?");
+   Stream* pStream = (Stream*)png_get_io_ptr(png_ptr);
+   AssertFatal(pStream != NULL, "No stream?");
 
    bool success;
-   success = sg_pStream->read((U32)length, data);
+   success = pStream->read((U32)length, data);
     
    AssertFatal(success, "PNG read catastrophic error!");
 }
@@ -105,6 +102,18 @@ static void pngFreeFn(png_structp /*png_ptr*/, png_voidp mem)
 #endif
 }
 
+//-------------------------------------- The frame allocator is only for the main
+//                                        thread so reading uses the heap.
+static png_voidp pngReadMallocFn(png_structp /*png_ptr*/, png_size_t size)
+{
+   return (png_voidp)dMalloc(size);
+}
+
+static void pngReadFreeFn(png_structp /*png_ptr*/, png_voidp mem)
+{
+   dFree(mem);
+}
+
 
 //--------------------------------------
 static void pngFatalErrorFn(png_structp     /*png_ptr*/,
@@ -136,16 +145,14 @@ bool GBitmap::readPNG(Stream& io_rStream)
       return false;
    }
 
-   U32 prevWaterMark = FrameAllocator::getWaterMark();
-
 #if defined(PNG_USER_MEM_SUPPORTED)
    png_structp png_ptr = png_create_read_struct_2(PNG_LIBPNG_VER_STRING,
                                                 NULL,
                                                 pngFatalErrorFn,
                                                 pngWarningFn,
                                                 NULL,
-                                                pngMallocFn,
-                                                pngFreeFn);
+                                                pngReadMallocFn,
+                                                pngReadFreeFn);
 #else
    png_structp png_ptr = png_create_read_struct(PNG_LIBPNG_VER_STRING,
                                                 NULL,
@@ -155,7 +162,6 @@ bool GBitmap::readPNG(Stream& io_rStream)
 
    if (png_ptr == NULL) 
    {
-      FrameAllocator::setWaterMark(prevWaterMark);
       return false;
    }
 
@@ -164,7 +170,6 @@ bool GBitmap::readPNG(Stream& io_rStream)
       png_destroy_read_struct(&png_ptr,
                               (png_infopp)NULL,
                               (png_infopp)NULL);
-      FrameAllocator::setWaterMark(prevWaterMark);
       return false;
    }
 
@@ -173,12 +178,10 @@ bool GBitmap::readPNG(Stream& io_rStream)
       png_destroy_read_struct(&png_ptr,
                               &info_ptr,
                               (png_infopp)NULL);
-      FrameAllocator::setWaterMark(prevWaterMark);
       return false;
    }
 
-   sg_pStream = &io_rStream;
-   png_set_read_fn(png_ptr, NULL, pngReadDataFn);
+   png_set_read_fn(png_ptr, &io_rStream, pngReadDataFn);
 
    // Read off the info on the image.
    png_set_sig_bytes(png_ptr, cs_headerBytesChecked);
@@ -270,8 +273,7 @@ bool GBitmap::readPNG(Stream& io_rStream)
                   format);          // use determined format...
 
    // Set up the row pointers...
-   AssertISV(height <= csgMaxRowPointers, "Error, cannot load pngs taller than 2048 pixels!");
-   png_bytep* rowPointers = sRowPointers;
+   png_bytep* rowPointers = new png_bytep[height];
    U8* pBase = (U8*)getBits();
    for (U32 i = 0; i < height; i++)
       rowPointers[i] = pBase + (i * rowBytes);
@@ -285,7 +287,7 @@ bool GBitmap::readPNG(Stream& io_rStream)
    png_read_end(png_ptr, NULL);
    png_destroy_read_struct(&png_ptr, &info_ptr, &end_info);
 
-   sg_pStream = NULL;
+   delete [] rowPointers;
 
    // Ok, the image is read in, now we need to finish up the initialization,
    //  which means: setting up the detailing members, init'ing the palette
@@ -293,12 +295,10 @@ bool GBitmap::readPNG(Stream& io_rStream)
    //
    // actually, all of that was handled by allocateBitmap, so we're outta here
    //
-   FrameAllocator::setWaterMark(prevWaterMark);
 
     //
    //-Mat if all palleted images are to be converted, set mForce16bit
    if( color_type == PNG_COLOR_TYPE_PALETTE ) {
-       sgForcePalletedPNGsTo16Bit = dAtob( Con::getVariable("$pref::iPhone::ForcePalletedPNGsTo16Bit") );
        if( sgForcePalletedPNGsTo16Bit ) {
            mForce16Bit = true;
        }
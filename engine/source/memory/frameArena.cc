@@ -0,0 +1,278 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "memory/frameArena.h"
+#include "math/mMathFn.h"
+
+// x86 doesn't reorder stores with other stores (or loads with other loads) so only the
+// compiler needs fencing there; other architectures need a hardware barrier.
+#if defined(TORQUE_COMPILER_VISUALC)
+#include <intrin.h>
+#define FRAME_ARENA_BARRIER() _ReadWriteBarrier()
+#elif defined(__i386__) || defined(__x86_64__)
+#define FRAME_ARENA_BARRIER() __asm__ __volatile__( "" ::: "memory" )
+#else
+#define FRAME_ARENA_BARRIER() __sync_synchronize()
+#endif
+
+//-----------------------------------------------------------------------------
+
+static inline void* alignArenaAddress( U8* pAddress, const U32 alignment )
+{
+   return (void*)( ((size_t)pAddress + (alignment - 1)) & ~(size_t)(alignment - 1) );
+}
+
+//-----------------------------------------------------------------------------
+
+FrameArena::FrameArena( const U32 blockSize ) :
+   mBlockSize( blockSize ),
+   mLaneCount( 0 ),
+   mPeakFrameBytes( 0 ),
+   mPeakFrameAllocations( 0 ),
+   mResetCount( 0 )
+{
+   AssertFatal( blockSize > 0, "FrameArena() - Invalid block size." );
+
+   // The creating thread owns the arena.
+   mOwnerThreadId = ThreadManager::getCurrentThreadId();
+
+   for ( U32 i = 0; i < MaxLanes; i++ )
+      mLanes[i] = NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+FrameArena::~FrameArena()
+{
+   purge();
+
+   for ( U32 i = 0; i < mLaneCount; i++ )
+      delete mLanes[i];
+}
+
+//-----------------------------------------------------------------------------
+
+FrameArena::Lane* FrameArena::findLane( void )
+{
+   const ThreadIdent threadId = ThreadManager::getCurrentThreadId();
+
+   // A thread always sees its own lane so no lock is required here.
+   const U32 laneCount = mLaneCount;
+   FRAME_ARENA_BARRIER();
+   for ( U32 i = 0; i < laneCount; i++ )
+   {
+      Lane* pLane = mLanes[i];
+      if ( !ThreadManager::compare( pLane->mThreadId, threadId ) || !pLane->mActive )
+         continue;
+
+      // The lane may have been released by this thread and just reused by another so check its owner again.
+      FRAME_ARENA_BARRIER();
+      if ( ThreadManager::compare( pLane->mThreadId, threadId ) )
+         return pLane;
+   }
+
+   return registerLane( threadId );
+}
+
+//-----------------------------------------------------------------------------
+
+FrameArena::Lane* FrameArena::registerLane( const ThreadIdent threadId )
+{
+   MutexHandle handle;
+   handle.lock( &mLaneMutex, true );
+
+   // Reuse a released lane (and its blocks).
+   const U32 laneCount = mLaneCount;
+   for ( U32 i = 0; i < laneCount; i++ )
+   {
+      Lane* pLane = mLanes[i];
+      if ( pLane->mActive )
+         continue;
+
+      // Set the owner before activating the lane so searching threads never match a stale owner.
+      pLane->mThreadId = threadId;
+      FRAME_ARENA_BARRIER();
+      pLane->mActive = true;
+      return pLane;
+   }
+
+   AssertISV( laneCount < MaxLanes, "FrameArena::registerLane() - Too many threads are allocating from the arena in one frame." );
+
+   Lane* pLane = new Lane;
+   pLane->mThreadId = threadId;
+   pLane->mActive = true;
+   pLane->mpFirstBlock = NULL;
+   pLane->mpCurrentBlock = NULL;
+   pLane->mBlockOffset = 0;
+   pLane->mFrameBytes = 0;
+   pLane->mFrameAllocations = 0;
+
+   // Publish the lane before the count so searching threads never see an unfinished lane.
+   mLanes[laneCount] = pLane;
+   FRAME_ARENA_BARRIER();
+   mLaneCount = laneCount + 1;
+
+   return pLane;
+}
+
+//-----------------------------------------------------------------------------
+
+void* FrameArena::alloc( const U32 size, const U32 alignment )
+{
+   AssertFatal( isPow2( alignment ), "FrameArena::alloc() - Alignment must be a power of two." );
+
+   Lane* pLane = findLane();
+
+   pLane->mFrameBytes += size;
+   pLane->mFrameAllocations++;
+
+   // Allocate from the current block if it fits.
+   Block* pBlock = pLane->mpCurrentBlock;
+   if ( pBlock != NULL )
+   {
+      U8* pData = (U8*)(pBlock + 1);
+      void* pAddress = alignArenaAddress( pData + pLane->mBlockOffset, alignment );
+      const U32 endOffset = (U32)((U8*)pAddress - pData) + size;
+      if ( endOffset <= pBlock->mSize )
+      {
+         pLane->mBlockOffset = endOffset;
+         return pAddress;
+      }
+   }
+
+   return allocBlock( pLane, size, alignment );
+}
+
+//-----------------------------------------------------------------------------
+
+void* FrameArena::allocBlock( Lane* pLane, const U32 size, const U32 alignment )
+{
+   // The allocation must fit whatever the alignment of the block.
+   const U32 requiredSize = size + alignment;
+
+   // Use the next block (kept from previous frames) if it's big enough, otherwise insert a new one.
+   Block* pCurrentBlock = pLane->mpCurrentBlock;
+   Block* pBlock = pCurrentBlock == NULL ? pLane->mpFirstBlock : pCurrentBlock->mpNext;
+   if ( pBlock == NULL || pBlock->mSize < requiredSize )
+   {
+      const U32 blockSize = getMax( mBlockSize, requiredSize );
+      Block* pNewBlock = (Block*)dMalloc( sizeof(Block) + blockSize );
+      pNewBlock->mSize = blockSize;
+      pNewBlock->mpNext = pBlock;
+
+      if ( pCurrentBlock == NULL )
+         pLane->mpFirstBlock = pNewBlock;
+      else
+         pCurrentBlock->mpNext = pNewBlock;
+
+      pBlock = pNewBlock;
+   }
+
+   // Allocate from the start of the block.
+   U8* pData = (U8*)(pBlock + 1);
+   void* pAddress = alignArenaAddress( pData, alignment );
+   pLane->mpCurrentBlock = pBlock;
+   pLane->mBlockOffset = (U32)((U8*)pAddress - pData) + size;
+
+   return pAddress;
+}
+
+//-----------------------------------------------------------------------------
+
+void FrameArena::reset( void )
+{
+   AssertFatal( ThreadManager::isCurrentThread( mOwnerThreadId ), "FrameArena::reset() - The arena can only be reset by the thread that created it." );
+
+   U32 frameBytes = 0;
+   U32 frameAllocations = 0;
+
+   // Rewind the lanes to their first block.
+   for ( U32 i = 0; i < mLaneCount; i++ )
+   {
+      Lane* pLane = mLanes[i];
+      frameBytes += pLane->mFrameBytes;
+      frameAllocations += pLane->mFrameAllocations;
+
+      // Release the lane if its thread didn't allocate this frame (it may have exited).
+      if ( pLane->mFrameAllocations == 0 )
+         pLane->mActive = false;
+
+      pLane->mpCurrentBlock = NULL;
+      pLane->mBlockOffset = 0;
+      pLane->mFrameBytes = 0;
+      pLane->mFrameAllocations = 0;
+   }
+
+   // Update the peaks.
+   mPeakFrameBytes = getMax( mPeakFrameBytes, frameBytes );
+   mPeakFrameAllocations = getMax( mPeakFrameAllocations, frameAllocations );
+
+   mResetCount++;
+}
+
+//-----------------------------------------------------------------------------
+
+void FrameArena::purge( void )
+{
+   reset();
+
+   // Free the blocks.
+   for ( U32 i = 0; i < mLaneCount; i++ )
+   {
+      Lane* pLane = mLanes[i];
+
+      Block* pBlock = pLane->mpFirstBlock;
+      while ( pBlock != NULL )
+      {
+         Block* pNextBlock = pBlock->mpNext;
+         dFree( pBlock );
+         pBlock = pNextBlock;
+      }
+
+      pLane->mpFirstBlock = NULL;
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+void FrameArena::getStats( Stats& stats ) const
+{
+   dMemset( &stats, 0, sizeof(stats) );
+
+   for ( U32 i = 0; i < mLaneCount; i++ )
+   {
+      const Lane* pLane = mLanes[i];
+      stats.mFrameBytes += pLane->mFrameBytes;
+      stats.mFrameAllocations += pLane->mFrameAllocations;
+
+      for ( const Block* pBlock = pLane->mpFirstBlock; pBlock != NULL; pBlock = pBlock->mpNext )
+      {
+         stats.mReservedBytes += pBlock->mSize;
+         stats.mBlockCount++;
+      }
+   }
+
+   stats.mPeakFrameBytes = getMax( mPeakFrameBytes, stats.mFrameBytes );
+   stats.mPeakFrameAllocations = getMax( mPeakFrameAllocations, stats.mFrameAllocations );
+   stats.mLaneCount = mLaneCount;
+   stats.mResetCount = mResetCount;
+}
@@ -0,0 +1,153 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _FRAME_ARENA_H_
+#define _FRAME_ARENA_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_THREAD_H_
+#include "platform/threads/thread.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_MUTEX_H_
+#include "platform/threads/mutex.h"
+#endif
+
+/// A frame-scoped bump allocator.
+///
+/// Like the FrameAllocator, the FrameArena hands out memory by bumping a pointer and
+/// releases everything at once, but rather than using a single fixed buffer and
+/// watermarks it grows in blocks and is reset once per frame.  The blocks are kept
+/// when the arena is reset so a steady frame doesn't allocate any memory at all.
+///
+/// The arena is thread-aware: each thread that allocates gets its own lane of blocks
+/// so allocating never takes a lock (a lock is only taken the first time a thread
+/// allocates in a frame, to register its lane).  Lanes that weren't used in a frame
+/// are released when the arena is reset and reused (with their blocks) by the next
+/// thread to register, so threads that come and go don't use up the lanes.  The arena
+/// must only be reset by the thread that created it and only when no other thread is
+/// allocating from it.
+///
+/// Objects created in the arena never have their destructors called so they must
+/// not own any resources of their own.
+///
+/// @code
+/// FrameArena arena;
+///
+/// MyRecord* pRecord = arena.create<MyRecord>();
+/// U8* pBytes = (U8*)arena.alloc( 100 );
+///
+/// ... at the end of the frame ...
+/// arena.reset();
+/// @endcode
+class FrameArena
+{
+public:
+   enum
+   {
+      /// The default size of each block.
+      DefaultBlockSize = 64 * 1024,
+
+      /// The default alignment of allocations.
+      DefaultAlignment = 16,
+
+      /// The maximum number of threads that can allocate from an arena in a single frame.
+      MaxLanes = 64,
+   };
+
+   /// Arena statistics.
+   struct Stats
+   {
+      U32 mFrameBytes;              ///< Bytes allocated since the last reset.
+      U32 mPeakFrameBytes;          ///< The most bytes allocated in a single frame.
+      U32 mFrameAllocations;        ///< Allocations since the last reset.
+      U32 mPeakFrameAllocations;    ///< The most allocations in a single frame.
+      U32 mReservedBytes;           ///< Bytes reserved in blocks.
+      U32 mBlockCount;              ///< The number of blocks.
+      U32 mLaneCount;               ///< The number of lanes (threads allocating at once).
+      U32 mResetCount;              ///< The number of resets.
+   };
+
+private:
+   /// A block of memory.
+   struct Block
+   {
+      Block* mpNext;
+      U32 mSize;
+   };
+
+   /// A single thread's blocks.
+   struct Lane
+   {
+      ThreadIdent mThreadId;
+      volatile bool mActive;        ///< Whether the lane belongs to a thread (otherwise it can be reused).
+      Block* mpFirstBlock;
+      Block* mpCurrentBlock;
+      U32 mBlockOffset;
+      U32 mFrameBytes;
+      U32 mFrameAllocations;
+   };
+
+   U32 mBlockSize;
+   ThreadIdent mOwnerThreadId;
+   Lane* mLanes[MaxLanes];
+   volatile U32 mLaneCount;
+   Mutex mLaneMutex;
+
+   U32 mPeakFrameBytes;
+   U32 mPeakFrameAllocations;
+   U32 mResetCount;
+
+   Lane* findLane( void );
+   Lane* registerLane( const ThreadIdent threadId );
+   void* allocBlock( Lane* pLane, const U32 size, const U32 alignment );
+
+public:
+   FrameArena( const U32 blockSize = DefaultBlockSize );
+   ~FrameArena();
+
+   /// Allocate memory which is valid until the arena is reset.
+   /// @param size The size of the allocation in bytes.
+   /// @param alignment The alignment of the allocation (a power of two).
+   void* alloc( const U32 size, const U32 alignment = DefaultAlignment );
+
+   /// Allocate and construct an object which is valid until the arena is reset.
+   /// @note The object's destructor is never called.
+   template<class T> inline T* create( void )
+   {
+      return constructInPlace<T>( (T*)alloc( sizeof(T) ) );
+   }
+
+   /// Release all the allocations (keeping the blocks).
+   void reset( void );
+
+   /// Release all the allocations and the blocks.
+   void purge( void );
+
+   /// Get the arena statistics.
+   void getStats( Stats& stats ) const;
+};
+
+#endif // _FRAME_ARENA_H_
@@ -286,9 +286,18 @@ NetConnection::NetConnection()
    mGhostRefs = NULL;
    mGhostLookupTable = NULL;
    mLocalGhosts = NULL;
+   mLocalGhostDeltas = NULL;
 
    mGhostsActive = 0;
 
+   for(U32 i = 0; i <= GhostDirtyBucket; i++)
+      mGhostBucketHead[i] = mGhostBucketTail[i] = NULL;
+   mGhostPacketSequence = 0;
+
+   mPackingGhost = NULL;
+   mPackingGhostRef = NULL;
+   mUnpackingGhostIndex = -1;
+
    mMissionPathsSent = false;
    mDemoWriteStream = NULL;
    mDemoReadStream = NULL;
@@ -313,7 +322,19 @@ NetConnection::~NetConnection()
    if(mCurrentDownloadingFile)
       ResourceManager->closeStream(mCurrentDownloadingFile);
 
+   if(mLocalGhostDeltas)
+   {
+      for(U32 i = 0; i < MaxGhostCount; i++)
+         delete mLocalGhostDeltas[i];
+   }
+   if(mGhostRefs)
+   {
+      for(U32 i = 0; i < MaxGhostCount; i++)
+         delete mGhostRefs[i].deltaState;
+   }
+
    delete[] mLocalGhosts;
+   delete[] mLocalGhostDeltas;
    delete[] mGhostLookupTable;
    delete[] mGhostRefs;
    delete[] mGhostArray;
@@ -54,6 +54,7 @@ class Stream;
 class Point3F;
 
 struct GhostInfo;
+struct GhostDeltaState;
 struct SubPacketRef; // defined in NetConnection subclass
 
 //#define DEBUG_NET
@@ -407,6 +408,17 @@ class NetConnection : public ConnectionProtocol, public SimGroup
     typedef SimGroup Parent;
 
 public:
+    /// Structure to track delta compressed fields in packets.
+    ///
+    /// The value of each field sent with packDeltaInt() is kept until the packet is
+    /// acknowledged, at which point it becomes the base that later values are sent against.
+    struct GhostDeltaRef
+    {
+        U32 field;                 ///< Index of the field.
+        U32 value;                 ///< Value we transmitted.
+        GhostDeltaRef *nextRef;    ///< Next field in this update.
+    };
+
     /// Structure to track ghost references in packets.
     ///
     /// Every packet we send out with an update from a ghost causes one of these to be
@@ -421,6 +433,7 @@ public:
         GhostInfo *ghost;          ///< Reference to the GhostInfo we're from.
         GhostRef *nextRef;         ///< Next GhostRef in this packet.
         GhostRef *nextUpdateChain; ///< Next update we sent for this ghost.
+        GhostDeltaRef *deltaList;  ///< Delta compressed fields we transmitted.
     };
 
     enum Constants
@@ -798,6 +811,9 @@ protected:
     void ghostWriteStartBlock(ResizeBitStream *stream);
     void ghostReadStartBlock(BitStream *stream);
 
+    void ghostDeltaNotify(GhostRef *ref, bool received);
+    U32 getGhostPriorityBucket(GhostInfo *info, CameraScopeQuery *camInfo);
+
 public:
     /// Some configuration values.
     enum GhostConstants
@@ -805,9 +821,41 @@ public:
         GhostIdBitSize = 12,
         MaxGhostCount = 1 << GhostIdBitSize, //4096,
         GhostLookupTableSize = 1 << GhostIdBitSize, //4096
-        GhostIndexBitSize = 4 // number of bits GhostIdBitSize-3 fits into
+        GhostIndexBitSize = 4, // number of bits GhostIdBitSize-3 fits into
+
+        GhostPriorityBucketCount = 32,   ///< Number of update priority buckets.
+        GhostPriorityBucketScale = 5,    ///< Buckets per unit of update priority.
+        GhostPriorityAgingPackets = 2,   ///< Packets a ghost waits in a bucket before it moves up to the next.
+        GhostDirtyBucket = GhostPriorityBucketCount,       ///< Ghosts whose update mask changed since their priority was found.
+        GhostNoBucket = GhostPriorityBucketCount + 1,      ///< Ghosts with a zero update mask.
+
+        MaxDeltaFields = 32,             ///< Number of delta compressed fields per object.
+        DeltaSizeBitSize = 5,            ///< Number of bits used to send the size of a delta.
     };
 
+protected:
+    /// @name Update Priority
+    ///
+    /// Rather than finding the priority of every ghost and sorting them for each packet,
+    /// ghosts with a non-zero update mask are kept in buckets of similar priority.  A ghost's
+    /// priority is only found when its update mask changes; while it waits it moves up a
+    /// bucket every GhostPriorityAgingPackets packets.  Within a bucket, ghosts are kept in
+    /// the order they entered it so the ghost that has waited longest is sent first.
+    /// @{
+
+    GhostInfo *mGhostBucketHead[GhostPriorityBucketCount + 1];   ///< First ghost in each bucket (and the dirty list).
+    GhostInfo *mGhostBucketTail[GhostPriorityBucketCount + 1];   ///< Last ghost in each bucket (and the dirty list).
+    U32 mGhostPacketSequence;                                   ///< Number of ghost packets written.
+
+    /// @}
+
+    GhostInfo *mPackingGhost;                ///< Ghost being packed by ghostWritePacket().
+    GhostRef *mPackingGhostRef;              ///< Reference tracking the update being packed.
+    GhostDeltaState **mLocalGhostDeltas;     ///< Delta compression state of each local ghost (if ghosting to).
+    S32 mUnpackingGhostIndex;                ///< Index of the ghost being unpacked, or -1.
+
+public:
+
     U32 getGhostsActive() { return mGhostsActive;};
 
     /// Are we ghosting to someone?
@@ -868,6 +916,47 @@ public:
     /// Move a GhostInfo from the free portion of the list to the zero portion.
     inline void ghostPushFreeToZero(GhostInfo *info);
 
+    /// Add a GhostInfo to the end of a priority bucket.
+    inline void ghostLinkBucket(GhostInfo *info, U32 bucket);
+
+    /// Remove a GhostInfo from its priority bucket.
+    inline void ghostUnlinkBucket(GhostInfo *info);
+
+    /// Mark that the update mask of a GhostInfo has changed (so that its priority is found again).
+    inline void ghostMarkPriorityDirty(GhostInfo *info);
+
+    /// @name Delta Compression
+    ///
+    /// An object's packUpdate() can send integer fields with packDeltaInt() so that a field is
+    /// sent as the difference from the value last acknowledged by the other side of the
+    /// connection, when that is smaller than the full value.  The matching unpackUpdate()
+    /// must read the fields back with unpackDeltaInt().
+    ///
+    /// @code
+    ///    U32 packUpdate(NetConnection *conn, U32 mask, BitStream *stream)
+    ///    {
+    ///       if(stream->writeFlag(mask & PositionMask))
+    ///       {
+    ///          conn->packDeltaInt(stream, 0, mX, 16);
+    ///          conn->packDeltaInt(stream, 1, mY, 16);
+    ///       }
+    ///       return 0;
+    ///    }
+    /// @endcode
+    /// @{
+
+    /// Write a field value.
+    ///
+    /// @param  stream      Stream to write to.
+    /// @param  field       Index of the field within the object (less than MaxDeltaFields).
+    /// @param  value       Value of the field.
+    /// @param  bitCount    Number of bits needed to send the value in full.
+    void packDeltaInt(BitStream *stream, U32 field, U32 value, U32 bitCount);
+
+    /// Read a field value written with packDeltaInt().
+    U32 unpackDeltaInt(BitStream *stream, U32 field, U32 bitCount);
+    /// @}
+
     /// Stop all ghosting activity and inform the other side about this.
     ///
     /// Turns off ghosting.
@@ -1057,6 +1146,18 @@ public:  // required for MSVC
     U32 index;
     U32 arrayIndex;
 
+    /// @name Update Priority
+    /// @{
+
+    U32 priorityBucket;                    ///< Priority bucket we're in (NetConnection::GhostNoBucket if none).
+    U32 bucketSequence;                    ///< Ghost packet sequence when we entered the bucket.
+    GhostInfo *nextBucketInfo;             ///< Next ghost in the bucket.
+    GhostInfo *prevBucketInfo;             ///< Previous ghost in the bucket.
+
+    /// @}
+
+    GhostDeltaState *deltaState;           ///< Acknowledged values of delta compressed fields.
+
     /// Flags relating to the state of the object.
     enum Flags
     {
@@ -1072,6 +1173,55 @@ public:  // required for MSVC
     };
 };
 
+/// The delta compression state of an object's fields.
+///
+/// On the ghosting side, the values are those last acknowledged by the other side; on the
+/// receiving side, they are the values last received.
+struct GhostDeltaState
+{
+    U32 ackedMask;                                      ///< Fields that have a value.
+    U32 values[NetConnection::MaxDeltaFields];          ///< Field values.
+    U8 inFlight[NetConnection::MaxDeltaFields];         ///< Updates of each field not yet acknowledged or dropped.
+};
+
+inline void NetConnection::ghostLinkBucket(GhostInfo *info, U32 bucket)
+{
+    AssertFatal(info->priorityBucket == GhostNoBucket, "Ghost already in a bucket.");
+    info->priorityBucket = bucket;
+    info->bucketSequence = mGhostPacketSequence;
+    info->nextBucketInfo = NULL;
+    info->prevBucketInfo = mGhostBucketTail[bucket];
+    if(mGhostBucketTail[bucket])
+        mGhostBucketTail[bucket]->nextBucketInfo = info;
+    else
+        mGhostBucketHead[bucket] = info;
+    mGhostBucketTail[bucket] = info;
+}
+
+inline void NetConnection::ghostUnlinkBucket(GhostInfo *info)
+{
+    if(info->priorityBucket == GhostNoBucket)
+        return;
+    if(info->prevBucketInfo)
+        info->prevBucketInfo->nextBucketInfo = info->nextBucketInfo;
+    else
+        mGhostBucketHead[info->priorityBucket] = info->nextBucketInfo;
+    if(info->nextBucketInfo)
+        info->nextBucketInfo->prevBucketInfo = info->prevBucketInfo;
+    else
+        mGhostBucketTail[info->priorityBucket] = info->prevBucketInfo;
+    info->nextBucketInfo = info->prevBucketInfo = NULL;
+    info->priorityBucket = GhostNoBucket;
+}
+
+inline void NetConnection::ghostMarkPriorityDirty(GhostInfo *info)
+{
+    if(info->priorityBucket == GhostDirtyBucket)
+        return;
+    ghostUnlinkBucket(info);
+    ghostLinkBucket(info, GhostDirtyBucket);
+}
+
 inline void NetConnection::ghostPushNonZero(GhostInfo *info)
 {
     AssertFatal(info->arrayIndex >= mGhostZeroUpdateIndex && info->arrayIndex < mGhostFreeIndex, "Out of range arrayIndex.");
@@ -1084,6 +1234,7 @@ inline void NetConnection::ghostPushNonZero(GhostInfo *info)
         info->arrayIndex = mGhostZeroUpdateIndex;
     }
     mGhostZeroUpdateIndex++;
+    ghostMarkPriorityDirty(info);
     //AssertFatal(validateGhostArray(), "Invalid ghost array!");
 }
 
@@ -1091,6 +1242,7 @@ inline void NetConnection::ghostPushToZero(GhostInfo *info)
 {
     AssertFatal(info->arrayIndex < mGhostZeroUpdateIndex, "Out of range arrayIndex.");
     AssertFatal(mGhostArray[info->arrayIndex] == info, "Invalid array object.");
+    ghostUnlinkBucket(info);
     mGhostZeroUpdateIndex--;
     if(info->arrayIndex != mGhostZeroUpdateIndex)
     {
@@ -124,8 +124,12 @@ void NetConnection::setGhostTo(bool ghostTo)
    if(ghostTo)
    {
       mLocalGhosts = new NetObject *[MaxGhostCount];
+      mLocalGhostDeltas = new GhostDeltaState *[MaxGhostCount];
       for(S32 i = 0; i < MaxGhostCount; i++)
+      {
          mLocalGhosts[i] = NULL;
+         mLocalGhostDeltas[i] = NULL;
+      }
    }
 }
 
@@ -145,6 +149,11 @@ void NetConnection::setGhostFrom(bool ghostFrom)
          mGhostRefs[i].obj = NULL;
          mGhostRefs[i].index = i;
          mGhostRefs[i].updateMask = 0;
+         mGhostRefs[i].priorityBucket = GhostNoBucket;
+         mGhostRefs[i].bucketSequence = 0;
+         mGhostRefs[i].nextBucketInfo = NULL;
+         mGhostRefs[i].prevBucketInfo = NULL;
+         mGhostRefs[i].deltaState = NULL;
       }
       mGhostLookupTable = new GhostInfo *[GhostLookupTableSize];
       for(i = 0; i < GhostLookupTableSize; i++)
@@ -215,6 +224,13 @@ void NetConnection::ghostPacketDropped(PacketNotify *notify)
          packRef->ghost->flags &= ~GhostInfo::KillingGhost;
       }
 
+      // the update mask or state of the ghost has changed,
+      // so its priority needs to be found again
+
+      if(packRef->ghost->updateMask)
+         ghostMarkPriorityDirty(packRef->ghost);
+
+      ghostDeltaNotify(packRef, false);
       delete packRef;
       packRef = temp;
    }
@@ -241,10 +257,20 @@ void NetConnection::ghostPacketReceived(PacketNotify *notify)
 
       *walk = 0;
 
+      // the fields sent in this packet are now the base for
+      // delta compression
+
+      ghostDeltaNotify(packRef, true);
+
       // if this object was ghosting , it is now ghosted
+      // and any pending update can be prioritized
 
       if(packRef->ghostInfoFlags & GhostInfo::Ghosting)
+      {
          packRef->ghost->flags &= ~GhostInfo::Ghosting;
+         if(packRef->ghost->updateMask)
+            ghostMarkPriorityDirty(packRef->ghost);
+      }
 
       // otherwise, if it was dieing, free the ghost
 
@@ -256,22 +282,149 @@ void NetConnection::ghostPacketReceived(PacketNotify *notify)
    }
 }
 
-struct UpdateQueueEntry
+void NetConnection::ghostDeltaNotify(GhostRef *ref, bool received)
 {
-   F32 priority;
-   GhostInfo *obj;
+   GhostDeltaRef *walk = ref->deltaList;
+   while(walk)
+   {
+      GhostDeltaRef *temp = walk->nextRef;
+      GhostDeltaState *state = ref->ghost->deltaState;
 
-   UpdateQueueEntry(F32 in_priority, GhostInfo *in_obj)
-      { priority = in_priority; obj = in_obj; }
-};
+      AssertFatal(state->inFlight[walk->field] > 0, "Invalid delta field state.");
+      state->inFlight[walk->field]--;
+
+      if(received)
+      {
+         state->values[walk->field] = walk->value;
+         state->ackedMask |= BIT(walk->field);
+      }
+
+      delete walk;
+      walk = temp;
+   }
+   ref->deltaList = NULL;
+}
+
+U32 NetConnection::getGhostPriorityBucket(GhostInfo *info, CameraScopeQuery *camInfo)
+{
+   // A removed ghost is assumed to have a high priority; ghosts that are
+   // being killed or ghosted aren't updated until that's acknowledged.
+   if(info->flags & GhostInfo::KillGhost)
+      info->priority = 10000;
+   else if(info->flags & (GhostInfo::KillingGhost | GhostInfo::Ghosting))
+      info->priority = 0;
+   else
+      info->priority = info->obj->getUpdatePriority(camInfo, info->updateMask, info->updateSkipCount);
+
+   return (U32)mClampF(info->priority * GhostPriorityBucketScale, 0.0f, F32(GhostPriorityBucketCount - 1));
+}
+
+void NetConnection::packDeltaInt(BitStream *stream, U32 field, U32 value, U32 bitCount)
+{
+   AssertFatal(field < MaxDeltaFields, "NetConnection::packDeltaInt - Invalid field index.");
+   AssertFatal(bitCount > 0 && bitCount <= 32, "NetConnection::packDeltaInt - Invalid bit count.");
+
+   const U32 valueMask = bitCount == 32 ? 0xFFFFFFFF : BIT(bitCount) - 1;
+   value &= valueMask;
+
+   // only updates written by ghostWritePacket are acknowledged,
+   // anything else (ghost always events, demo blocks) is sent in full
+   GhostDeltaState *state = NULL;
+   if(mPackingGhost)
+   {
+      if(!mPackingGhost->deltaState)
+      {
+         mPackingGhost->deltaState = new GhostDeltaState;
+         dMemset(mPackingGhost->deltaState, 0, sizeof(GhostDeltaState));
+      }
+      state = mPackingGhost->deltaState;
+   }
+
+   // a delta can only be sent against a value the other side is known to
+   // have, so not while another update of the field may be in flight
+   bool sent = false;
+   if(state && (state->ackedMask & BIT(field)) && !state->inFlight[field])
+   {
+      // sign extend the difference and zig-zag encode it so small
+      // differences either way need few bits
+      U32 delta = (value - state->values[field]) & valueMask;
+      if(bitCount < 32 && (delta & BIT(bitCount - 1)))
+         delta |= ~valueMask;
+      const U32 zigzag = (delta << 1) ^ U32(S32(delta) >> 31);
+
+      U32 deltaBits = 0;
+      for(U32 bits = zigzag; bits; bits >>= 1)
+         deltaBits++;
+
+      if(DeltaSizeBitSize + deltaBits < bitCount)
+      {
+         stream->writeFlag(true);
+         stream->writeInt(deltaBits, DeltaSizeBitSize);
+         stream->writeInt(zigzag, deltaBits);
+         sent = true;
+      }
+   }
+
+   if(!sent)
+   {
+      stream->writeFlag(false);
+      stream->writeInt(value, bitCount);
+   }
 
-static S32 QSORT_CALLBACK UQECompare(const void *a,const void *b)
+   // remember what was sent until the packet is acknowledged or dropped
+   if(state && mPackingGhostRef)
+   {
+      AssertFatal(state->inFlight[field] < 0xFF, "NetConnection::packDeltaInt - Too many updates in flight.");
+
+      GhostDeltaRef *ref = new GhostDeltaRef;
+      ref->field = field;
+      ref->value = value;
+      ref->nextRef = mPackingGhostRef->deltaList;
+      mPackingGhostRef->deltaList = ref;
+      state->inFlight[field]++;
+   }
+}
+
+U32 NetConnection::unpackDeltaInt(BitStream *stream, U32 field, U32 bitCount)
 {
-   GhostInfo *ga = *((GhostInfo **) a);
-   GhostInfo *gb = *((GhostInfo **) b);
+   AssertFatal(field < MaxDeltaFields, "NetConnection::unpackDeltaInt - Invalid field index.");
+   AssertFatal(bitCount > 0 && bitCount <= 32, "NetConnection::unpackDeltaInt - Invalid bit count.");
+
+   const U32 valueMask = bitCount == 32 ? 0xFFFFFFFF : BIT(bitCount) - 1;
+
+   GhostDeltaState *state = NULL;
+   if(mUnpackingGhostIndex >= 0 && mLocalGhostDeltas)
+   {
+      if(!mLocalGhostDeltas[mUnpackingGhostIndex])
+      {
+         mLocalGhostDeltas[mUnpackingGhostIndex] = new GhostDeltaState;
+         dMemset(mLocalGhostDeltas[mUnpackingGhostIndex], 0, sizeof(GhostDeltaState));
+      }
+      state = mLocalGhostDeltas[mUnpackingGhostIndex];
+   }
 
-   F32 ret = ga->priority - gb->priority;
-   return (ret < 0) ? -1 : ((ret > 0) ? 1 : 0);
+   U32 value;
+   if(stream->readFlag())
+   {
+      const U32 deltaBits = stream->readInt(DeltaSizeBitSize);
+      const U32 zigzag = stream->readInt(deltaBits);
+      if(!state || !(state->ackedMask & BIT(field)))
+      {
+         setLastError("Invalid packet.");
+         return 0;
+      }
+      const U32 delta = (zigzag >> 1) ^ (0 - (zigzag & 1));
+      value = (state->values[field] + delta) & valueMask;
+   }
+   else
+      value = U32(stream->readInt(bitCount)) & valueMask;
+
+   if(state)
+   {
+      state->values[field] = value;
+      state->ackedMask |= BIT(field);
+   }
+   return value;
 }
 
 void NetConnection::ghostWritePacket(BitStream *bstream, PacketNotify *notify)
@@ -294,10 +447,11 @@ void NetConnection::ghostWritePacket(BitStream *bstream, PacketNotify *notify)
 
    // 1. Scope query - find if any new objects have come into
    //    scope and if any have gone out.
-   // 2. call scoped objects' priority functions if the flag set is nonzero
-   //    A removed ghost is assumed to have a high priority
-   // 3. call updates based on sorted priority until the packet is
-   //    full.  set flags to zero for all updated objects
+   // 2. call the priority functions of objects whose update mask has
+   //    changed and put them in a priority bucket.  Objects that have
+   //    waited long enough move up a bucket.
+   // 3. call updates from the highest priority bucket down until the
+   //    packet is full.  set flags to zero for all updated objects
 
    CameraScopeQuery camInfo;
 
@@ -340,28 +494,29 @@ void NetConnection::ghostWritePacket(BitStream *bstream, PacketNotify *notify)
 
       // clear out any kill objects that haven't been ghosted yet
       if((walk->flags & GhostInfo::KillGhost) && (walk->flags & GhostInfo::NotYetGhosted))
-      {
          freeGhostInfo(walk);
-         continue;
-      }
-      // don't do any ghost processing on objects that are being killed
-      // or in the process of ghosting
-      else if(!(walk->flags & (GhostInfo::KillingGhost | GhostInfo::Ghosting)))
+   }
+
+   // prioritize the ghosts whose update mask has changed...
+   while((walk = mGhostBucketHead[GhostDirtyBucket]) != NULL)
+   {
+      ghostUnlinkBucket(walk);
+      ghostLinkBucket(walk, getGhostPriorityBucket(walk, &camInfo));
+   }
+
+   // and age the others.  Ghosts enter a bucket in order so only the
+   // start of each bucket needs checking.
+   mGhostPacketSequence++;
+   for(i = GhostPriorityBucketCount - 2; i >= 0; i--)
+   {
+      while((walk = mGhostBucketHead[i]) != NULL && mGhostPacketSequence - walk->bucketSequence >= GhostPriorityAgingPackets)
       {
-         if(walk->flags & GhostInfo::KillGhost)
-            walk->priority = 10000;
-         else
-            walk->priority = walk->obj->getUpdatePriority(&camInfo, walk->updateMask, walk->updateSkipCount);
+         ghostUnlinkBucket(walk);
+         ghostLinkBucket(walk, i + 1);
       }
-      else
-         walk->priority = 0;
    }
-   GhostRef *updateList = NULL;
-   dQsort(mGhostArray, mGhostZeroUpdateIndex, sizeof(GhostInfo *), UQECompare);
 
-   // reset the array indices...
-   for(i = mGhostZeroUpdateIndex - 1; i >= 0; i--)
-      mGhostArray[i]->arrayIndex = i;
+   GhostRef *updateList = NULL;
 
    S32 sendSize = 1;
    while(maxIndex >>= 1)
@@ -373,10 +528,19 @@ void NetConnection::ghostWritePacket(BitStream *bstream, PacketNotify *notify)
    bstream->writeInt(sendSize - 3, GhostIndexBitSize);
 
    U32 count = 0;
+   i = GhostPriorityBucketCount - 1;
+   GhostInfo *next = mGhostBucketHead[i];
    //
-   for(i = mGhostZeroUpdateIndex - 1; i >= 0 && !bstream->isFull(); i--)
+   while(!bstream->isFull())
    {
-      GhostInfo *walk = mGhostArray[i];
+      // work down from the highest priority bucket
+      while(!next && i > 0)
+         next = mGhostBucketHead[--i];
+      if(!next)
+         break;
+
+      GhostInfo *walk = next;
+      next = walk->nextBucketInfo;
         if(walk->flags & (GhostInfo::KillingGhost | GhostInfo::Ghosting))
            continue;
         
@@ -394,6 +558,7 @@ void NetConnection::ghostWritePacket(BitStream *bstream, PacketNotify *notify)
 
       upd->ghost = walk;
       upd->ghostInfoFlags = 0;
+      upd->deltaList = NULL;
 
       if(walk->flags & GhostInfo::KillGhost)
       {
@@ -428,7 +593,11 @@ void NetConnection::ghostWritePacket(BitStream *bstream, PacketNotify *notify)
          }
 #endif
          // update the object
+         mPackingGhost = walk;
+         mPackingGhostRef = upd;
          U32 retMask = walk->obj->packUpdate(this, updateMask, bstream);
+         mPackingGhost = NULL;
+         mPackingGhostRef = NULL;
          DEBUG_LOG(("PKLOG %d GHOST %d: %s", getId(), bstream->getCurPos() - 16 - startPos, walk->obj->getClassName()));
 
          AssertFatal((retMask & (~updateMask)) == 0, "Cannot set new bits in packUpdate return");
@@ -436,6 +605,8 @@ void NetConnection::ghostWritePacket(BitStream *bstream, PacketNotify *notify)
          walk->updateMask = retMask;
          if(!retMask)
             ghostPushToZero(walk);
+         else
+            ghostMarkPriorityDirty(walk);
 
          upd->mask = updateMask & ~retMask;
 
@@ -518,7 +689,9 @@ void NetConnection::ghostReadPacket(BitStream *bstream)
                avar("class id mismatch for dest class %s.",
                   mLocalGhosts[index]->getClassName()) );
 #endif
+            mUnpackingGhostIndex = index;
             mLocalGhosts[index]->unpackUpdate(this, bstream);
+            mUnpackingGhostIndex = -1;
 
             if(!obj->registerObject())
             {
@@ -542,7 +715,9 @@ void NetConnection::ghostReadPacket(BitStream *bstream)
                avar("class id mismatch for dest class %s.",
                   mLocalGhosts[index]->getClassName()) );
 #endif
+            mUnpackingGhostIndex = index;
             mLocalGhosts[index]->unpackUpdate(this, bstream);
+            mUnpackingGhostIndex = -1;
          }
          //PacketStream::getStats()->addBits(PacketStats::Receive, bstream->getCurPos() - startPos, ghostRefs[index].localGhost->getPersistTag());
 #ifdef TORQUE_DEBUG_NET
@@ -581,6 +756,8 @@ void NetConnection::detachObject(GhostInfo *info)
       info->updateMask = 0xFFFFFFFF;
       ghostPushNonZero(info);
    }
+   else
+      ghostMarkPriorityDirty(info);
    if(info->obj)
    {
       if(info->prevObjectRef)
@@ -711,6 +888,10 @@ void NetConnection::objectInScope(NetObject *obj)
    giptr->updateChain = NULL;
    giptr->updateSkipCount = 0;
 
+   // the other side knows nothing about a new ghost
+   if(giptr->deltaState)
+      dMemset(giptr->deltaState, 0, sizeof(GhostDeltaState));
+
    giptr->connection = this;
 
    giptr->nextObjectRef = obj->mFirstObjectRef;
@@ -1098,7 +1279,9 @@ void NetConnection::ghostReadStartBlock(BitStream *stream)
    {
       if(mLocalGhosts[i])
       {
+         mUnpackingGhostIndex = i;
          mLocalGhosts[i]->unpackUpdate(this, stream);
+         mUnpackingGhostIndex = -1;
          if(!mLocalGhosts[i]->registerObject())
          {
             if(mErrorBuffer[0])
@@ -96,13 +96,16 @@ void NetObject::clearMaskBits(U32 orMask)
 
    for(GhostInfo *walk = mFirstObjectRef; walk; walk = walk->nextObjectRef)
    {
-      if(walk->updateMask && walk->updateMask == orMask)
+      if(walk->updateMask && !(walk->updateMask & ~orMask))
       {
          walk->updateMask = 0;
          walk->connection->ghostPushToZero(walk);
       }
-      else
+      else if(walk->updateMask & orMask)
+      {
          walk->updateMask &= ~orMask;
+         walk->connection->ghostMarkPriorityDirty(walk);
+      }
    }
 }
 
@@ -130,8 +133,11 @@ void NetObject::collapseDirtyList()
                walk->updateMask = orMask;
                walk->connection->ghostPushNonZero(walk);
             }
-            else
+            else if((walk->updateMask | orMask) != walk->updateMask)
+            {
                walk->updateMask |= orMask;
+               walk->connection->ghostMarkPriorityDirty(walk);
+            }
          }
       }
       obj = next;
@@ -329,6 +329,9 @@ public:
    /// In subclasses, this can be adjusted. For instance, ShapeBase provides priority
    /// based on proximity to the camera.
    ///
+   /// @note The priority is only found again when the update mask changes; while an
+   ///       update waits to be sent, NetConnection raises its priority over time itself.
+   ///
    /// @param  focusObject    Information from a previous call to onCameraScopeQuery.
    /// @param  updateMask     Current update mask.
    /// @param  updateSkips    Number of ticks we haven't been updated for.
@@ -31,11 +31,90 @@
 
 //-----------------------------------------------------------------------------
 
+// The size of the chunks that compressed data is decompressed in.
+#define TAML_BINARY_DECOMPRESS_CHUNK_SIZE   (64 * 1024)
+
+//-----------------------------------------------------------------------------
+
+TamlBinaryReader::~TamlBinaryReader()
+{
+    // Delete the type fields.
+    for( typeTypeFieldsHash::iterator typeItr = mTypeFields.begin(); typeItr != mTypeFields.end(); ++typeItr )
+    {
+        delete typeItr->value;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 SimObject* TamlBinaryReader::read( FileStream& stream )
 {
     // Debug Profiling.
     PROFILE_SCOPE(TamlBinaryReader_Read);
 
+    // Read the header.
+    U32 versionId;
+    bool compressed;
+    if ( !readHeader( stream, versionId, compressed ) )
+        return NULL;
+
+    // Read the element data.
+    char* pData;
+    U32 dataSize;
+    if ( !readData( stream, compressed, pData, dataSize ) )
+    {
+        // Warn.
+        Con::warnf("Taml: Cannot read binary file as the element data could not be read." );
+        return NULL;
+    }
+
+    // Parse element.
+    DataView view( pData, dataSize );
+    SimObject* pSimObject = parseElement( view, versionId );
+
+    // Free the element data.
+    dFree( pData );
+
+    return pSimObject;
+}
+
+//-----------------------------------------------------------------------------
+
+TamlReadNode* TamlBinaryReader::readNodes( FileStream& stream )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlBinaryReader_ReadNodes);
+
+    // Read the header.
+    U32 versionId;
+    bool compressed;
+    if ( !readHeader( stream, versionId, compressed ) )
+        return NULL;
+
+    // Read the element data.
+    char* pData;
+    U32 dataSize;
+    if ( !readData( stream, compressed, pData, dataSize ) )
+    {
+        // Warn.
+        Con::warnf("Taml: Cannot read binary file as the element data could not be read." );
+        return NULL;
+    }
+
+    // Parse element.
+    DataView view( pData, dataSize );
+    TamlReadNode* pReadNode = parseReadNode( view, versionId );
+
+    // Free the element data.
+    dFree( pData );
+
+    return pReadNode;
+}
+
+//-----------------------------------------------------------------------------
+
+bool TamlBinaryReader::readHeader( FileStream& stream, U32& versionId, bool& compressed )
+{
     // Read Taml signature.
     StringTableEntry tamlSignature = stream.readSTString();
 
@@ -44,39 +123,79 @@ SimObject* TamlBinaryReader::read( FileStream& stream )
     {
         // Warn.
         Con::warnf("Taml: Cannot read binary file as signature is incorrect '%s'.", tamlSignature );
-        return NULL;
+        return false;
     }
 
     // Read version Id.
-    U32 versionId;
     stream.read( &versionId );
 
     // Read compressed flag.
-    bool compressed;
     stream.read( &compressed );
 
-    SimObject* pSimObject = NULL;
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool TamlBinaryReader::readData( FileStream& stream, const bool compressed, char*& pData, U32& dataSize )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlBinaryReader_ReadData);
+
+    // NOTE: The data always has an extra byte so that the last string in it can be terminated in place.
 
     // Is the stream compressed?
-    if ( compressed )
+    if ( !compressed )
     {
-        // Yes, so attach zip stream.
-        ZipSubRStream zipStream;
-        zipStream.attachStream( &stream );
+        // No, so read the remainder of the file in one go.
+        const U32 position = stream.getPosition();
+        const U32 streamSize = stream.getStreamSize();
+        dataSize = streamSize > position ? streamSize - position : 0;
+        pData = (char*)dMalloc( dataSize + 1 );
 
-        // Parse element.
-        pSimObject = parseElement( zipStream, versionId );
+        if ( !stream.read( dataSize, pData ) )
+        {
+            dFree( pData );
+            return false;
+        }
 
-        // Detach zip stream.
-        zipStream.detachStream();
+        return true;
     }
-    else
+
+    // Yes, so attach zip stream.
+    ZipSubRStream zipStream;
+    zipStream.attachStream( &stream );
+
+    // Decompress in chunks until a chunk is short.
+    U32 capacity = TAML_BINARY_DECOMPRESS_CHUNK_SIZE;
+    pData = (char*)dMalloc( capacity + 1 );
+    dataSize = 0;
+    while( true )
     {
-        // No, so parse element.
-        pSimObject = parseElement( stream, versionId );
+        // Grow the data if it's full.
+        if ( dataSize == capacity )
+        {
+            capacity *= 2;
+            pData = (char*)dRealloc( pData, capacity + 1 );
+        }
+
+        // Decompress the next chunk.
+        const U32 chunkSize = capacity - dataSize;
+        const U32 position = zipStream.getPosition();
+        if ( !zipStream.read( chunkSize, pData + dataSize ) )
+            break;
+
+        // Finish if the chunk was short.
+        const U32 readSize = zipStream.getPosition() - position;
+        dataSize += readSize;
+        if ( readSize < chunkSize )
+            break;
     }
 
-    return pSimObject;
+    // Detach zip stream.
+    zipStream.detachStream();
+
+    return true;
 }
 
 //-----------------------------------------------------------------------------
@@ -92,7 +211,59 @@ void TamlBinaryReader::resetParse( void )
 
 //-----------------------------------------------------------------------------
 
-SimObject* TamlBinaryReader::parseElement( Stream& stream, const U32 versionId )
+TamlBinaryReader::typeTypeFieldVector* TamlBinaryReader::findTypeFields( AbstractClassRep* pClassRep )
+{
+    // Find the type fields.
+    typeTypeFieldsHash::iterator typeItr = mTypeFields.find( pClassRep );
+
+    // Return the type fields if found.
+    if ( typeItr != mTypeFields.end() )
+        return typeItr->value;
+
+    // Add the type fields.
+    typeTypeFieldVector* pTypeFields = new typeTypeFieldVector();
+    mTypeFields.insert( pClassRep, pTypeFields );
+
+    return pTypeFields;
+}
+
+//-----------------------------------------------------------------------------
+
+const TamlBinaryReader::TypeField& TamlBinaryReader::findTypeField( typeTypeFieldVector* pTypeFields, AbstractClassRep* pClassRep, const char* pFieldName, const U32 fieldNameLength )
+{
+    // Find the field without interning the field name.
+    for( typeTypeFieldVector::iterator fieldItr = pTypeFields->begin(); fieldItr != pTypeFields->end(); ++fieldItr )
+    {
+        if ( fieldItr->mFieldNameLength == fieldNameLength && dMemcmp( fieldItr->mFieldName, pFieldName, fieldNameLength ) == 0 )
+            return *fieldItr;
+    }
+
+    // Not found so add the field.
+    TypeField typeField;
+    typeField.mFieldName = StringTable->insertn( pFieldName, fieldNameLength );
+    typeField.mFieldNameLength = fieldNameLength;
+    typeField.mpField = pClassRep->findField( typeField.mFieldName );
+    typeField.mFieldPrefix = StringTable->EmptyString;
+
+    // Is this a static field?
+    if ( typeField.mpField != NULL )
+    {
+        // Yes, so fetch the field prefix.
+        ConsoleBaseType* pConsoleBaseType = ConsoleBaseType::getType( typeField.mpField->type );
+        if ( pConsoleBaseType != NULL )
+            typeField.mFieldPrefix = pConsoleBaseType->getTypePrefix();
+    }
+
+    typeField.mFieldPrefixLength = dStrlen( typeField.mFieldPrefix );
+
+    pTypeFields->push_back( typeField );
+
+    return pTypeFields->last();
+}
+
+//-----------------------------------------------------------------------------
+
+SimObject* TamlBinaryReader::parseElement( DataView& view, const U32 versionId )
 {
     // Debug Profiling.
     PROFILE_SCOPE(TamlBinaryReader_ParseElement);
@@ -102,20 +273,18 @@ SimObject* TamlBinaryReader::parseElement( Stream& stream, const U32 versionId )
 #ifdef TORQUE_DEBUG
     // Format the type location.
     char typeLocationBuffer[64];
-    dSprintf( typeLocationBuffer, sizeof(typeLocationBuffer), "Taml [format='binary' offset=%u]", stream.getPosition() );
+    dSprintf( typeLocationBuffer, sizeof(typeLocationBuffer), "Taml [format='binary' offset=%u]", view.getPosition() );
 #endif
 
     // Fetch element name.    
-    StringTableEntry typeName = stream.readSTString();
+    StringTableEntry typeName = view.readSTString();
 
     // Fetch object name.
-    StringTableEntry objectName = stream.readSTString();
+    StringTableEntry objectName = view.readSTString();
 
     // Read references.
-    U32 tamlRefId;
-    U32 tamlRefToId;
-    stream.read( &tamlRefId );
-    stream.read( &tamlRefToId );
+    const U32 tamlRefId = view.readU32();
+    const U32 tamlRefToId = view.readU32();
 
     // Do we have a reference to Id?
     if ( tamlRefToId != 0 )
@@ -158,7 +327,7 @@ SimObject* TamlBinaryReader::parseElement( Stream& stream, const U32 versionId )
     }
 
     // Parse attributes.
-    parseAttributes( stream, pSimObject, versionId );
+    parseAttributes( view, pSimObject, versionId );
 
     // Does the object require a name?
     if ( objectName == StringTable->EmptyString )
@@ -194,10 +363,10 @@ SimObject* TamlBinaryReader::parseElement( Stream& stream, const U32 versionId )
     TamlCustomNodes customProperties;
 
     // Parse children.
-    parseChildren( stream, pCallbacks, pSimObject, versionId );
+    parseChildren( view, pCallbacks, pSimObject, versionId );
 
     // Parse custom elements.
-    parseCustomElements( stream, pCallbacks, customProperties, versionId );
+    parseCustomElements( view, pCallbacks, customProperties, versionId );
 
     // Are there any Taml callbacks?
     if ( pCallbacks != NULL )
@@ -212,7 +381,7 @@ SimObject* TamlBinaryReader::parseElement( Stream& stream, const U32 versionId )
 
 //-----------------------------------------------------------------------------
 
-void TamlBinaryReader::parseAttributes( Stream& stream, SimObject* pSimObject, const U32 versionId )
+void TamlBinaryReader::parseAttributes( DataView& view, SimObject* pSimObject, const U32 versionId )
 {
     // Debug Profiling.
     PROFILE_SCOPE(TamlBinaryReader_ParseAttributes);
@@ -221,30 +390,53 @@ void TamlBinaryReader::parseAttributes( Stream& stream, SimObject* pSimObject, c
     AssertFatal( pSimObject != NULL, "Taml: Cannot parse attributes on a NULL object." );
 
     // Fetch attribute count.
-    U32 attributeCount;
-    stream.read( &attributeCount );
+    const U32 attributeCount = view.readU32();
 
     // Finish if no attributes.
     if ( attributeCount == 0 )
         return;
 
-    char valueBuffer[4096];
+    // Fetch the type fields.
+    AbstractClassRep* pClassRep = pSimObject->getClassRep();
+    typeTypeFieldVector* pTypeFields = findTypeFields( pClassRep );
+
+    // Can static fields be set directly?
+    const bool modStaticFields = pSimObject->isModStaticFields();
 
     // Iterate attributes.
     for ( U32 index = 0; index < attributeCount; ++index )
     {
         // Fetch attribute.
-        StringTableEntry attributeName = stream.readSTString();
-        stream.readLongString( 4096, valueBuffer );
+        U32 attributeNameLength;
+        const char* pAttributeName = view.readString( attributeNameLength );
+        const TypeField& typeField = findTypeField( pTypeFields, pClassRep, pAttributeName, attributeNameLength );
+
+        // Fetch the value in place.
+        U32 valueLength;
+        char* pValue = view.readLongString( valueLength );
+        ViewString value( pValue, valueLength );
+
+        // Is this a static field that can be set directly?
+        if ( typeField.mpField == NULL || !modStaticFields )
+        {
+            // No, so we can assume this is a field for now.
+            pSimObject->setPrefixedDataField( typeField.mFieldName, NULL, value );
+            continue;
+        }
 
-        // We can assume this is a field for now.
-        pSimObject->setPrefixedDataField( attributeName, NULL, valueBuffer );
+        // Yes, so skip any field prefix.
+        const char* pFieldValue = value;
+        if ( typeField.mFieldPrefixLength > 0 && valueLength > 0 && dStrnicmp( pFieldValue, typeField.mFieldPrefix, typeField.mFieldPrefixLength ) == 0 )
+            pFieldValue += typeField.mFieldPrefixLength;
+
+        // Set the field.
+        pSimObject->setStaticDataField( typeField.mpField, 0, pFieldValue );
     }
 }
 
 //-----------------------------------------------------------------------------
 
-void TamlBinaryReader::parseChildren( Stream& stream, TamlCallbacks* pCallbacks, SimObject* pSimObject, const U32 versionId )
+void TamlBinaryReader::parseChildren( DataView& view, TamlCallbacks* pCallbacks, SimObject* pSimObject, const U32 versionId )
 {
     // Debug Profiling.
     PROFILE_SCOPE(TamlBinaryReader_ParseChildren);
@@ -253,8 +445,7 @@ void TamlBinaryReader::parseChildren( Stream& stream, TamlCallbacks* pCallbacks,
     AssertFatal( pSimObject != NULL, "Taml: Cannot parse children on a NULL object." );
 
     // Fetch children count.
-    U32 childrenCount;
-    stream.read( &childrenCount );
+    const U32 childrenCount = view.readU32();
 
     // Finish if no children.
     if ( childrenCount == 0 )
@@ -278,7 +469,7 @@ void TamlBinaryReader::parseChildren( Stream& stream, TamlCallbacks* pCallbacks,
     for ( U32 index = 0; index < childrenCount; ++ index )
     {
         // Parse child element.
-        SimObject* pChildSimObject = parseElement( stream, versionId );
+        SimObject* pChildSimObject = parseElement( view, versionId );
 
         // Finish if child failed.
         if ( pChildSimObject == NULL )
@@ -321,14 +512,13 @@ void TamlBinaryReader::parseChildren( Stream& stream, TamlCallbacks* pCallbacks,
 
 //-----------------------------------------------------------------------------
 
-void TamlBinaryReader::parseCustomElements( Stream& stream, TamlCallbacks* pCallbacks, TamlCustomNodes& customNodes, const U32 versionId )
+void TamlBinaryReader::parseCustomElements( DataView& view, TamlCallbacks* pCallbacks, TamlCustomNodes& customNodes, const U32 versionId )
 {
     // Debug Profiling.
     PROFILE_SCOPE(TamlBinaryReader_ParseCustomElement);
 
     // Read custom node count.
-    U32 customNodeCount;
-    stream.read( &customNodeCount );
+    const U32 customNodeCount = view.readU32();
 
     // Finish if no custom nodes.
     if ( customNodeCount == 0 )
@@ -338,13 +528,13 @@ void TamlBinaryReader::parseCustomElements( Stream& stream, TamlCallbacks* pCall
     for ( U32 nodeIndex = 0; nodeIndex < customNodeCount; ++nodeIndex )
     {
         //Read custom node name.
-        StringTableEntry nodeName = stream.readSTString();
+        StringTableEntry nodeName = view.readSTString();
 
         // Add custom node.
         TamlCustomNode* pCustomNode = customNodes.addNode( nodeName );
 
         // Parse the custom node.
-        parseCustomNode( stream, pCustomNode, versionId );
+        parseCustomNode( view, pCustomNode, versionId );
     }
 
     // Do we have callbacks?
@@ -361,17 +551,16 @@ void TamlBinaryReader::parseCustomElements( Stream& stream, TamlCallbacks* pCall
 
 //-----------------------------------------------------------------------------
 
-void TamlBinaryReader::parseCustomNode( Stream& stream, TamlCustomNode* pCustomNode, const U32 versionId )
+void TamlBinaryReader::parseCustomNode( DataView& view, TamlCustomNode* pCustomNode, const U32 versionId )
 {
     // Fetch if a proxy object.
-    bool isProxyObject;
-    stream.read( &isProxyObject );
+    const bool isProxyObject = view.readBool();
 
     // Is this a proxy object?
     if ( isProxyObject )
     {
         // Yes, so parse proxy object.
-        SimObject* pProxyObject = parseElement( stream, versionId );
+        SimObject* pProxyObject = parseElement( view, versionId );
 
         // Add child node.
         pCustomNode->addNode( pProxyObject );
@@ -380,19 +569,18 @@ void TamlBinaryReader::parseCustomNode( Stream& stream, TamlCustomNode* pCustomN
     }
 
     // No, so read custom node name.
-    StringTableEntry nodeName = stream.readSTString();
+    StringTableEntry nodeName = view.readSTString();
 
     // Add child node.
     TamlCustomNode* pChildNode = pCustomNode->addNode( nodeName );
 
     // Read child node text.
-    char childNodeTextBuffer[MAX_TAML_NODE_FIELDVALUE_LENGTH];
-    stream.readLongString( MAX_TAML_NODE_FIELDVALUE_LENGTH, childNodeTextBuffer );
-    pChildNode->setNodeText( childNodeTextBuffer );
+    U32 childNodeTextLength;
+    char* pChildNodeText = view.readLongString( childNodeTextLength );
+    pChildNode->setNodeText( ViewString( pChildNodeText, childNodeTextLength ) );
 
     // Read child node count.
-    U32 childNodeCount;
-    stream.read( &childNodeCount );
+    const U32 childNodeCount = view.readU32();
 
     // Do we have any children nodes?
     if ( childNodeCount > 0 )
@@ -401,13 +589,12 @@ void TamlBinaryReader::parseCustomNode( Stream& stream, TamlCustomNode* pCustomN
         for( U32 childIndex = 0; childIndex < childNodeCount; ++childIndex )
         {
             // Parse child node.
-            parseCustomNode( stream, pChildNode, versionId );
+            parseCustomNode( view, pChildNode, versionId );
         }
     }
 
     // Read child field count.
-    U32 childFieldCount;
-    stream.read( &childFieldCount );
+    const U32 childFieldCount = view.readU32();
 
     // Do we have any child fields?
     if ( childFieldCount > 0 )
@@ -416,14 +603,109 @@ void TamlBinaryReader::parseCustomNode( Stream& stream, TamlCustomNode* pCustomN
         for( U32 childFieldIndex = 0; childFieldIndex < childFieldCount; ++childFieldIndex )
         {
             // Read field name.
-            StringTableEntry fieldName = stream.readSTString();
+            StringTableEntry fieldName = view.readSTString();
 
             // Read field value.
-            char valueBuffer[MAX_TAML_NODE_FIELDVALUE_LENGTH];
-            stream.readLongString( MAX_TAML_NODE_FIELDVALUE_LENGTH, valueBuffer );
+            U32 valueLength;
+            char* pValue = view.readLongString( valueLength );
 
             // Add field.
-            pChildNode->addField( fieldName, valueBuffer );
+            pChildNode->addField( fieldName, ViewString( pValue, valueLength ) );
         }
     }
+}
+
+//-----------------------------------------------------------------------------
+
+TamlReadNode* TamlBinaryReader::parseReadNode( DataView& view, const U32 versionId )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlBinaryReader_ParseReadNode);
+
+    TamlReadNode* pReadNode = new TamlReadNode();
+
+    // Format the type location.
+    dSprintf( pReadNode->mTypeLocation, sizeof(pReadNode->mTypeLocation), "Taml [format='binary' offset=%u]", view.getPosition() );
+
+    // Fetch element and object name.
+    pReadNode->mTypeName = view.readSTString();
+    pReadNode->mObjectName = view.readSTString();
+
+    // Read references.
+    pReadNode->mRefId = view.readU32();
+    pReadNode->mRefToId = view.readU32();
+
+    // Finish if this is a reference.
+    if ( pReadNode->mRefToId != 0 )
+        return pReadNode;
+
+    // Read attributes.
+    const U32 attributeCount = view.readU32();
+    for ( U32 index = 0; index < attributeCount; ++index )
+    {
+        StringTableEntry attributeName = view.readSTString();
+        U32 valueLength;
+        const char* pValue = view.readLongString( valueLength );
+        pReadNode->addField( attributeName, pValue, valueLength );
+    }
+
+    // Read children.
+    const U32 childrenCount = view.readU32();
+    for ( U32 index = 0; index < childrenCount; ++index )
+    {
+        pReadNode->mChildren.push_back( parseReadNode( view, versionId ) );
+    }
+
+    // Read custom nodes.
+    const U32 customNodeCount = view.readU32();
+    for ( U32 nodeIndex = 0; nodeIndex < customNodeCount; ++nodeIndex )
+    {
+        TamlReadNode::CustomNode* pCustomNode = new TamlReadNode::CustomNode( view.readSTString() );
+        pReadNode->mCustomNodes.push_back( pCustomNode );
+
+        parseCustomReadNode( view, pCustomNode, versionId );
+    }
+
+    return pReadNode;
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlBinaryReader::parseCustomReadNode( DataView& view, TamlReadNode::CustomNode* pCustomNode, const U32 versionId )
+{
+    // Is this a proxy object?
+    if ( view.readBool() )
+    {
+        // Yes, so parse proxy object.
+        TamlReadNode::CustomNode* pProxyNode = new TamlReadNode::CustomNode( StringTable->EmptyString );
+        pProxyNode->mpProxyNode = parseReadNode( view, versionId );
+        pCustomNode->mChildren.push_back( pProxyNode );
+        return;
+    }
+
+    // No, so add child node.
+    TamlReadNode::CustomNode* pChildNode = new TamlReadNode::CustomNode( view.readSTString() );
+    pCustomNode->mChildren.push_back( pChildNode );
+
+    // Read child node text.
+    U32 childNodeTextLength;
+    const char* pChildNodeText = view.readLongString( childNodeTextLength );
+    pChildNode->setNodeText( pChildNodeText, childNodeTextLength );
+
+    // Read child nodes.
+    const U32 childNodeCount = view.readU32();
+    for( U32 childIndex = 0; childIndex < childNodeCount; ++childIndex )
+    {
+        parseCustomReadNode( view, pChildNode, versionId );
+    }
+
+    // Read child fields.
+    const U32 childFieldCount = view.readU32();
+    for( U32 childFieldIndex = 0; childFieldIndex < childFieldCount; ++childFieldIndex )
+    {
+        StringTableEntry fieldName = view.readSTString();
+        U32 valueLength;
+        const char* pValue = view.readLongString( valueLength );
+        pChildNode->mFields.push_back( new TamlReadNode::FieldValuePair( fieldName, pValue, valueLength ) );
+    }
 }
\ No newline at end of file
@@ -31,6 +31,10 @@
 #include "persistence/taml/taml.h"
 #endif
 
+#ifndef _TAML_READ_NODE_H_
+#include "persistence/taml/tamlReadNode.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
 /// @ingroup tamlGroup
@@ -43,26 +47,155 @@ public:
     {
     }
 
-    virtual ~TamlBinaryReader() {}
+    virtual ~TamlBinaryReader();
 
     /// Read.
     SimObject* read( FileStream& stream );
 
+    /// Read the elements without instantiating them.  This can be called on any thread.
+    TamlReadNode* readNodes( FileStream& stream );
+
 private:
-    Taml* mpTaml;
+    /// A view of the data being decoded.
+    ///
+    /// The data is read (and decompressed) in one go so decoding doesn't make any stream
+    /// calls.  Strings are used in place in the view rather than being copied out of it.
+    class DataView
+    {
+    public:
+        DataView( char* pData, const U32 size ) :
+            mpData( pData ),
+            mSize( size ),
+            mPosition( 0 )
+        {
+        }
+
+        inline U32 getPosition( void ) const { return mPosition; }
+
+        inline U32 readU32( void )
+        {
+            U32 value = 0;
+            if ( reserve( sizeof(value) ) )
+            {
+                dMemcpy( &value, mpData + mPosition, sizeof(value) );
+                mPosition += sizeof(value);
+            }
+            return convertLEndianToHost( value );
+        }
+
+        inline bool readBool( void )
+        {
+            if ( !reserve( 1 ) )
+                return false;
+
+            return mpData[mPosition++] != 0;
+        }
+
+        /// Read a string (of up to 255 characters).
+        inline char* readString( U32& length )
+        {
+            length = reserve( 1 ) ? (U8)mpData[mPosition++] : 0;
+            return readChars( length );
+        }
+
+        /// Read a long string.
+        inline char* readLongString( U32& length )
+        {
+            length = readU32();
+            return readChars( length );
+        }
+
+        /// Read a string into the string table.
+        inline StringTableEntry readSTString( void )
+        {
+            U32 length;
+            const char* pString = readString( length );
+            return length == 0 ? StringTable->EmptyString : StringTable->insertn( pString, length );
+        }
+
+    private:
+        inline bool reserve( const U32 size )
+        {
+            if ( size <= mSize - mPosition )
+                return true;
+
+            // The data is truncated so read nothing more.
+            mPosition = mSize;
+            return false;
+        }
 
+        inline char* readChars( U32& length )
+        {
+            if ( !reserve( length ) )
+                length = 0;
+
+            char* pChars = mpData + mPosition;
+            mPosition += length;
+            return pChars;
+        }
+
+        char* mpData;
+        U32 mSize;
+        U32 mPosition;
+    };
+
+    /// Terminates a string in a data view whilst it's in scope so it can be used in place.
+    /// The view data always has room for the terminator of its last string.
+    class ViewString
+    {
+    public:
+        ViewString( char* pString, const U32 length ) :
+            mpString( pString ),
+            mTerminator( pString[length] )
+        {
+            mpString[length] = 0;
+            mpEnd = mpString + length;
+        }
+
+        ~ViewString() { *mpEnd = mTerminator; }
+
+        inline operator const char*( void ) const { return mpString; }
+
+    private:
+        char* mpString;
+        char* mpEnd;
+        char mTerminator;
+    };
+
+    /// A field of a type, found once per type rather than once per object.
+    struct TypeField
+    {
+        StringTableEntry mFieldName;
+        U32 mFieldNameLength;
+        const AbstractClassRep::Field* mpField;
+        StringTableEntry mFieldPrefix;
+        U32 mFieldPrefixLength;
+    };
+
+    typedef Vector<TypeField> typeTypeFieldVector;
+    typedef HashMap<AbstractClassRep*, typeTypeFieldVector*> typeTypeFieldsHash;
     typedef HashMap<SimObjectId, SimObject*> typeObjectReferenceHash;
 
+    Taml* mpTaml;
     typeObjectReferenceHash mObjectReferenceMap;
+    typeTypeFieldsHash mTypeFields;
 
 private:
     void resetParse( void );
 
-    SimObject* parseElement( Stream& stream, const U32 versionId );
-    void parseAttributes( Stream& stream, SimObject* pSimObject, const U32 versionId );
-    void parseChildren( Stream& stream, TamlCallbacks* pCallbacks, SimObject* pSimObject, const U32 versionId );
-    void parseCustomElements( Stream& stream, TamlCallbacks* pCallbacks, TamlCustomNodes& customNodes, const U32 versionId );
-    void parseCustomNode( Stream& stream, TamlCustomNode* pCustomNode, const U32 versionId );
+    bool readHeader( FileStream& stream, U32& versionId, bool& compressed );
+    bool readData( FileStream& stream, const bool compressed, char*& pData, U32& dataSize );
+    typeTypeFieldVector* findTypeFields( AbstractClassRep* pClassRep );
+    const TypeField& findTypeField( typeTypeFieldVector* pTypeFields, AbstractClassRep* pClassRep, const char* pFieldName, const U32 fieldNameLength );
+
+    SimObject* parseElement( DataView& view, const U32 versionId );
+    void parseAttributes( DataView& view, SimObject* pSimObject, const U32 versionId );
+    void parseChildren( DataView& view, TamlCallbacks* pCallbacks, SimObject* pSimObject, const U32 versionId );
+    void parseCustomElements( DataView& view, TamlCallbacks* pCallbacks, TamlCustomNodes& customNodes, const U32 versionId );
+    void parseCustomNode( DataView& view, TamlCustomNode* pCustomNode, const U32 versionId );
+
+    TamlReadNode* parseReadNode( DataView& view, const U32 versionId );
+    void parseCustomReadNode( DataView& view, TamlReadNode::CustomNode* pCustomNode, const U32 versionId );
 };
 
 #endif // _TAML_BINARYREADER_H_
\ No newline at end of file
@@ -70,6 +70,49 @@ SimObject* TamlJSONReader::read( FileStream& stream )
 
 //-----------------------------------------------------------------------------
 
+TamlReadNode* TamlJSONReader::readNodes( FileStream& stream )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlJSONReader_ReadNodes);
+
+    // Read JSON file.
+    // NOTE: The frame allocator is only used on the main thread so the text is allocated here.
+    const U32 streamSize = stream.getStreamSize();
+    char* pJsonText = new char[ streamSize + 1 ];
+    if ( !stream.read( streamSize, pJsonText ) )
+    {
+        // Warn!
+        Con::warnf("TamlJSONReader::readNodes() -  Could not load Taml JSON file from stream.");
+        delete [] pJsonText;
+        return NULL;
+    }
+    pJsonText[streamSize] = 0;
+
+    // Create JSON document.
+    rapidjson::Document document;
+    document.Parse<0>( pJsonText );
+
+    TamlReadNode* pReadNode = NULL;
+
+    // Check the document is valid.
+    if ( document.GetType() == rapidjson::kObjectType && document.MemberBegin() != document.MemberEnd() )
+    {
+        // Parse root value.
+        pReadNode = parseReadType( document.MemberBegin() );
+    }
+    else
+    {
+        // Warn!
+        Con::warnf("TamlJSONReader::readNodes() -  Load Taml JSON file from stream but was invalid.");
+    }
+
+    delete [] pJsonText;
+
+    return pReadNode;
+}
+
+//-----------------------------------------------------------------------------
+
 void TamlJSONReader::resetParse( void )
 {
     // Debug Profiling.
@@ -484,20 +527,248 @@ inline void TamlJSONReader::parseCustomNode( rapidjson::Value::ConstMemberIterat
 
 //-----------------------------------------------------------------------------
 
-inline StringTableEntry TamlJSONReader::getDemangledName( const char* pMangledName )
+TamlReadNode* TamlJSONReader::parseReadType( const rapidjson::Value::ConstMemberIterator& memberItr )
 {
     // Debug Profiling.
-    PROFILE_SCOPE(TamlJSONReader_GetDemangledName);
+    PROFILE_SCOPE(TamlJSONReader_ParseReadType);
+
+    // Fetch name and value.
+    const rapidjson::Value& typeName = memberItr->name;
+    const rapidjson::Value& typeValue = memberItr->value;
+
+    // Is value an object?
+    if ( !typeValue.IsObject() )
+    {
+        // No, so warn.
+        Con::warnf( "TamlJSONReader::parseReadType() -  Cannot process type '%s' as it is not an object.", typeName.GetString() );
+        return NULL;
+    }
+
+    TamlReadNode* pReadNode = new TamlReadNode();
+
+    // Fetch engine type name (demangled).
+    pReadNode->mTypeName = getDemangledName( typeName.GetString() );
+
+    // Fetch reference to Id.
+    pReadNode->mRefToId = getTamlRefToId( typeValue );
+
+    // Finish if this is a reference.
+    if ( pReadNode->mRefToId != 0 )
+        return pReadNode;
+
+    // Fetch reference Id and object name.
+    pReadNode->mRefId = getTamlRefId( typeValue );
+    pReadNode->mObjectName = StringTable->insert( getTamlObjectName( typeValue ) );
+
+    char valueBuffer[4096];
+
+    // Parse members.
+    for( rapidjson::Value::ConstMemberIterator objectMemberItr = typeValue.MemberBegin(); objectMemberItr != typeValue.MemberEnd(); ++objectMemberItr )
+    {
+        // Fetch name and value.
+        const rapidjson::Value& memberName = objectMemberItr->name;
+        const rapidjson::Value& memberValue = objectMemberItr->value;
+
+        // Is this a field?
+        if ( !memberValue.IsObject() )
+        {
+            // Yes, so insert the field name.
+            StringTableEntry fieldName = StringTable->insert( memberName.GetString() );
+
+            // Ignore if this is a Taml attribute.
+            if (    fieldName == tamlRefIdName ||
+                    fieldName == tamlRefToIdName ||
+                    fieldName == tamlNamedObjectName )
+                    continue;
+
+            // Get field value.
+            if ( !parseStringValue( valueBuffer, sizeof(valueBuffer), memberValue, fieldName ) )
+            {
+                // Warn.
+                Con::warnf( "Taml::parseReadType() Could not interpret value for field '%s'", fieldName );
+                continue;
+            }
+
+            // Add field.
+            pReadNode->addField( fieldName, valueBuffer );
+            continue;
+        }
+
+        // Find the period character in the name.
+        const char* pPeriod = dStrchr( memberName.GetString(), '.' );
+
+        // Did we find the period?
+        if ( pPeriod == NULL )
+        {
+            // No, so parse child object.
+            TamlReadNode* pChildNode = parseReadType( objectMemberItr );
+            if ( pChildNode != NULL )
+                pReadNode->mChildren.push_back( pChildNode );
+
+            continue;
+        }
+
+        // Yes, so add custom node.
+        TamlReadNode::CustomNode* pCustomNode = new TamlReadNode::CustomNode( StringTable->insert( pPeriod+1 ) );
+        pReadNode->mCustomNodes.push_back( pCustomNode );
+
+        // Iterate custom members.
+        for( rapidjson::Value::ConstMemberIterator customMemberItr = memberValue.MemberBegin(); customMemberItr != memberValue.MemberEnd(); ++customMemberItr )
+        {
+            // Fetch value.
+            const rapidjson::Value& customValue = customMemberItr->value;
+
+            // Is the member an object?
+            if ( !customValue.IsObject() && !customValue.IsArray() )
+            {
+                // No, so warn.
+                Con::warnf( "Taml::parseReadType() - Cannot process custom node name '%s' member as child value is not an object or array.", pPeriod+1 );
+                break;
+            }
+
+            // Parse custom node.
+            parseCustomReadNode( customMemberItr, pCustomNode );
+        }
+    }
+
+    return pReadNode;
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlJSONReader::parseCustomReadNode( rapidjson::Value::ConstMemberIterator& memberItr, TamlReadNode::CustomNode* pCustomNode )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlJSONReader_ParseCustomReadNode);
+
+    // Fetch name and value.
+    const rapidjson::Value& name = memberItr->name;
+    const rapidjson::Value& value = memberItr->value;
+
+    // Is the value an object?
+    if ( value.IsObject() )
+    {
+        // Yes, so is the node a proxy object?
+        if (  getTamlRefId( value ) != 0 || getTamlRefToId( value ) != 0 )
+        {
+            // Yes, so parse proxy object.
+            TamlReadNode::CustomNode* pProxyNode = new TamlReadNode::CustomNode( StringTable->EmptyString );
+            pProxyNode->mpProxyNode = parseReadType( memberItr );
+            pCustomNode->mChildren.push_back( pProxyNode );
+            return;
+        }
+    }
+
+    char valueBuffer[4096];
+
+    // Fetch the node name.
+    StringTableEntry nodeName = getDemangledName( name.GetString() );
 
-    // Is the type name mangled?
-    if ( StringUnit::getUnitCount( pMangledName, JSON_RFC4627_NAME_MANGLING_CHARACTERS ) > 1 )
+    // Add child node.
+    TamlReadNode::CustomNode* pChildNode = new TamlReadNode::CustomNode( nodeName );
+    pCustomNode->mChildren.push_back( pChildNode );
+
+    // Is the value an array?
+    if ( value.IsArray() )
     {
-        // Yes, so fetch type name portion.
-        return StringTable->insert( StringUnit::getUnit( pMangledName, 0, JSON_RFC4627_NAME_MANGLING_CHARACTERS ) );
+        // Yes, so does it have a single entry?
+        if ( value.Size() == 1 )
+        {
+            // Yes, so parse the node text.
+            if ( parseStringValue( valueBuffer, sizeof(valueBuffer), value.Begin(), nodeName ) )
+            {
+                pChildNode->setNodeText( valueBuffer, dStrlen(valueBuffer) );
+            }
+            else
+            {
+                // Warn.
+                Con::warnf( "Taml::parseCustomReadNode() - Encountered text in the custom node '%s' but could not interpret the value.", nodeName );
+            }
+        }
+        else
+        {
+            // No, so warn.
+            Con::warnf( "Taml::parseCustomReadNode() - Encountered text in the custom node '%s' but more than a single element was found in the array.", nodeName );
+        }
+
+        return;
+    }
+
+    // Iterate child members.
+    for( rapidjson::Value::ConstMemberIterator childMemberItr = value.MemberBegin(); childMemberItr != value.MemberEnd(); ++childMemberItr )
+    {
+        // Fetch name and value.
+        const rapidjson::Value& childName = childMemberItr->name;
+        const rapidjson::Value& childValue = childMemberItr->value;
+
+        // Fetch the field name.
+        StringTableEntry fieldName = StringTable->insert( childName.GetString() );
+
+        // Is the value an array?
+        if ( childValue.IsArray() )
+        {
+            // Yes, so does it have a single entry?
+            if ( childValue.Size() == 1 )
+            {
+                // Yes, so parse the node text.
+                if ( parseStringValue( valueBuffer, sizeof(valueBuffer), *childValue.Begin(), fieldName ) )
+                {
+                    // Yes, so add sub-child node.
+                    TamlReadNode::CustomNode* pSubChildNode = new TamlReadNode::CustomNode( fieldName );
+                    pChildNode->mChildren.push_back( pSubChildNode );
+
+                    // Set sub-child text.
+                    pSubChildNode->setNodeText( valueBuffer, dStrlen(valueBuffer) );
+                    continue;
+                }
+
+                // Warn.
+                Con::warnf( "Taml::parseCustomReadNode() - Encountered text in the custom node '%s' but could not interpret the value.", fieldName );
+                return;
+            }
+
+            // No, so warn.
+            Con::warnf( "Taml::parseCustomReadNode() - Encountered text in the custom node '%s' but more than a single element was found in the array.", fieldName );
+            return;
+        }
+
+        // Is the member an object?
+        if ( childValue.IsObject() )
+        {
+            // Yes, so parse custom node.
+            parseCustomReadNode( childMemberItr, pChildNode );
+            continue;
+        }
+
+        // Ignore if this is a Taml attribute.
+        if (    fieldName == tamlRefIdName ||
+                fieldName == tamlRefToIdName ||
+                fieldName == tamlNamedObjectName )
+                continue;
+
+        // Parse string value.
+        if ( !parseStringValue( valueBuffer, sizeof(valueBuffer), childValue, childName.GetString() ) )
+        {
+            // Warn.
+            Con::warnf( "Taml::parseCustomReadNode() - Could not interpret value for field '%s'", fieldName );
+            continue;
+        }
+
+        // Add node field.
+        pChildNode->mFields.push_back( new TamlReadNode::FieldValuePair( fieldName, valueBuffer, dStrlen(valueBuffer) ) );
     }
+}
+
+//-----------------------------------------------------------------------------
+
+inline StringTableEntry TamlJSONReader::getDemangledName( const char* pMangledName )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlJSONReader_GetDemangledName);
 
-    // No, so use all the type name.
-    return StringTable->insert( pMangledName );
+    // Fetch the type name portion (all of it if the name isn't mangled).
+    // NOTE: The string units aren't used as names are also demangled on other threads.
+    return StringTable->insertn( pMangledName, dStrcspn( pMangledName, JSON_RFC4627_NAME_MANGLING_CHARACTERS ) );
 }
 
 //-----------------------------------------------------------------------------
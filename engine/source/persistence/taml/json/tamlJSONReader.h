@@ -31,6 +31,10 @@
 #include "persistence/taml/taml.h"
 #endif
 
+#ifndef _TAML_READ_NODE_H_
+#include "persistence/taml/tamlReadNode.h"
+#endif
+
 /// RapidJson.
 #include "rapidjson/document.h"
 #include "rapidjson/prettywriter.h"
@@ -51,6 +55,9 @@ public:
     /// Read.
     SimObject* read( FileStream& stream );
 
+    /// Read the elements without instantiating them.  This can be called on any thread.
+    TamlReadNode* readNodes( FileStream& stream );
+
 private:
     Taml* mpTaml;
 
@@ -66,6 +73,9 @@ private:
     inline void parseCustom( rapidjson::Value::ConstMemberIterator& memberItr, SimObject* pSimObject, const char* pCustomNodeName, TamlCustomNodes& customNodes );
     inline void parseCustomNode( rapidjson::Value::ConstMemberIterator& memberItr, TamlCustomNode* pCustomNode );
 
+    TamlReadNode* parseReadType( const rapidjson::Value::ConstMemberIterator& memberItr );
+    void parseCustomReadNode( rapidjson::Value::ConstMemberIterator& memberItr, TamlReadNode::CustomNode* pCustomNode );
+
     inline StringTableEntry getDemangledName( const char* pMangledName );
     inline bool parseStringValue( char* pBuffer, const S32 bufferSize, const rapidjson::Value& value, const char* pName );
     inline U32 getTamlRefId( const rapidjson::Value& value );
@@ -54,6 +54,10 @@
 #include "persistence/taml/json/tamlJSONParser.h"
 #endif
 
+#ifndef _TAML_ASYNC_READER_H_
+#include "persistence/taml/tamlAsyncReader.h"
+#endif
+
 #ifndef _FRAMEALLOCATOR_H_
 #include "memory/frameAllocator.h"
 #endif
@@ -189,6 +193,14 @@ void Taml::initPersistFields()
 
 //-----------------------------------------------------------------------------
 
+Taml::~Taml()
+{
+    // Abandon any asynchronous reads.
+    TamlAsyncReader::cancel( this );
+}
+
+//-----------------------------------------------------------------------------
+
 bool Taml::onAdd()
 {
     // Call parent.
@@ -307,6 +319,26 @@ SimObject* Taml::read( const char* pFilename )
 
 //-----------------------------------------------------------------------------
 
+U32 Taml::readAsync( const char* pFilename )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Taml_ReadAsync);
+
+    // Sanity!
+    AssertFatal( pFilename != NULL, "Cannot read from a NULL filename." );
+
+    return TamlAsyncReader::queue( this, pFilename );
+}
+
+//-----------------------------------------------------------------------------
+
+void Taml::flushAsyncReads( void )
+{
+    TamlAsyncReader::flush( this );
+}
+
+//-----------------------------------------------------------------------------
+
 bool Taml::write( FileStream& stream, SimObject* pSimObject, const TamlFormatMode formatMode )
 {
     // Sanity!
@@ -768,7 +800,7 @@ void Taml::compileDynamicFields( TamlWriteNode* pTamlWriteNode )
                 continue;
 
             // Skip if not writing field.
-            if ( !pSimObject->writeField( pEntry->slotName, pEntry->value) )
+            if ( !pSimObject->writeField( pEntry->slotName, pEntry->getValue() ) )
                 continue;
 
             dynamicFieldList.push_back( pEntry );
@@ -786,7 +818,7 @@ void Taml::compileDynamicFields( TamlWriteNode* pTamlWriteNode )
         SimFieldDictionary::Entry* pEntry = *entryItr;
 
         // Save field/value.
-        TamlWriteNode::FieldValuePair*  pFieldValuePair = new TamlWriteNode::FieldValuePair( pEntry->slotName, pEntry->value );
+        TamlWriteNode::FieldValuePair*  pFieldValuePair = new TamlWriteNode::FieldValuePair( pEntry->slotName, pEntry->getValue() );
         pTamlWriteNode->mFields.push_back( pFieldValuePair );
     }
 }
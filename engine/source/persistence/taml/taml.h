@@ -127,7 +127,7 @@ private:
 
 public:
     Taml();
-    virtual ~Taml() {}
+    virtual ~Taml();
 
     virtual bool onAdd();
     virtual void onRemove();
@@ -184,6 +184,13 @@ public:
     }
     SimObject* read( const char* pFilename );
 
+    /// Read asynchronously (see TamlAsyncReader).
+    /// @return The read Id or zero if the read could not be started.
+    U32 readAsync( const char* pFilename );
+
+    /// Complete the asynchronous reads immediately.
+    void flushAsyncReads( void );
+
     /// Parse.
     bool parse( const char* pFilename, TamlVisitor& visitor );
 
@@ -0,0 +1,717 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "persistence/taml/tamlAsyncReader.h"
+#include "persistence/taml/taml.h"
+#include "persistence/taml/tamlReadNode.h"
+#include "persistence/taml/tamlReadNodeParser.h"
+#include "platform/threads/jobSystem.h"
+#include "platform/threads/mutex.h"
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+/// An element being committed.
+struct TamlCommitFrame
+{
+    TamlReadNode*   mpReadNode;
+    SimObject*      mpSimObject;
+    TamlCallbacks*  mpCallbacks;
+    U32             mChildIndex;
+};
+
+//-----------------------------------------------------------------------------
+
+/// A read that is being parsed or committed.
+class TamlAsyncRead
+{
+public:
+    TamlAsyncRead() :
+        mReadId( 0 ),
+        mpTaml( NULL ),
+        mFormatMode( Taml::InvalidFormat ),
+        mpRootNode( NULL ),
+        mParsed( false ),
+        mElementCount( 0 ),
+        mCommittedCount( 0 ),
+        mCommitStarted( false ),
+        mpRootObject( NULL )
+    {
+        mFilePath[0] = 0;
+    }
+
+    ~TamlAsyncRead()
+    {
+        delete mpRootNode;
+    }
+
+    /// Commit the next element.
+    /// @return Whether the read has been committed.
+    bool commitStep( void );
+
+    /// Get the progress of the commit (from zero to one).
+    F32 getProgress( void ) const { return mElementCount == 0 ? 1.0f : getMin( (F32)mCommittedCount / (F32)mElementCount, 1.0f ); }
+
+    U32                     mReadId;
+    Taml*                   mpTaml;
+    char                    mFilePath[1024];
+    Taml::TamlFormatMode    mFormatMode;
+    TamlReadNode*           mpRootNode;
+    bool                    mParsed;
+    U32                     mElementCount;
+    U32                     mCommittedCount;
+
+private:
+    SimObject* beginElement( TamlReadNode* pReadNode, TamlCallbacks*& pCallbacks );
+    void endElement( const TamlCommitFrame& frame );
+    SimObject* commitElement( TamlReadNode* pReadNode );
+    SimObject* findReference( TamlReadNode* pReadNode );
+    void addChild( SimObject* pSimObject, SimObject* pChildSimObject );
+    void commitCustomNode( TamlReadNode::CustomNode* pReadCustomNode, TamlCustomNode* pParentNode );
+
+    typedef HashMap<SimObjectId, SimObject*> typeObjectReferenceHash;
+
+    bool                    mCommitStarted;
+    SimObject*              mpRootObject;
+    Vector<TamlCommitFrame> mCommitStack;
+    typeObjectReferenceHash mObjectReferenceMap;
+
+public:
+    inline SimObject* getRootObject( void ) const { return mpRootObject; }
+};
+
+//-----------------------------------------------------------------------------
+
+// The reads in the order they were started (only used on the main thread).
+static Vector<TamlAsyncRead*> gAsyncReads;
+
+// The parse jobs.
+static JobSystem::JobGroup gParseGroup;
+
+// Guards the parsed state of the reads.
+static Mutex gParseMutex;
+
+// The read being committed (callbacks can flush the reads while it is).
+static TamlAsyncRead* gpCommittingRead = NULL;
+
+// The last read Id.
+static U32 gLastReadId = 0;
+
+//-----------------------------------------------------------------------------
+
+static void parseReadJob( void* pContext, const U32 jobIndex )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlAsyncReader_Parse);
+
+    TamlAsyncRead* pRead = (TamlAsyncRead*)pContext;
+
+    // Parse the elements.
+    TamlReadNode* pRootNode = TamlReadNodeParser::readNodes( pRead->mFilePath, pRead->mFormatMode );
+
+    const U32 elementCount = pRootNode == NULL ? 0 : pRootNode->getElementCount();
+
+    // The read isn't touched by the job once it's parsed.
+    MutexHandle handle;
+    handle.lock( &gParseMutex, true );
+    pRead->mpRootNode = pRootNode;
+    pRead->mElementCount = elementCount;
+    pRead->mParsed = true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool TamlAsyncRead::commitStep( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlAsyncReader_CommitStep);
+
+    // Start with the root element.
+    if ( !mCommitStarted )
+    {
+        mCommitStarted = true;
+
+        // Finish if the file couldn't be parsed.
+        if ( mpRootNode == NULL )
+            return true;
+
+        TamlCommitFrame frame;
+        frame.mpReadNode = mpRootNode;
+        frame.mpSimObject = beginElement( mpRootNode, frame.mpCallbacks );
+        frame.mChildIndex = 0;
+
+        // Finish if the root couldn't be created.
+        if ( frame.mpSimObject == NULL )
+            return true;
+
+        mCommitStack.push_back( frame );
+        return false;
+    }
+
+    TamlCommitFrame& frame = mCommitStack.last();
+    TamlReadNode* pReadNode = frame.mpReadNode;
+
+    // Are there any children left?
+    if ( frame.mChildIndex < (U32)pReadNode->mChildren.size() )
+    {
+        // Yes, so can the object have children?
+        if ( dynamic_cast<TamlChildren*>( frame.mpSimObject ) == NULL )
+        {
+            // No, so warn.
+            Con::warnf( "Taml: Child element '%s' found under parent '%s' but object cannot have children.",
+                pReadNode->mChildren[frame.mChildIndex]->mTypeName,
+                pReadNode->mTypeName );
+
+            // Skip the children.
+            mCommittedCount += pReadNode->getElementCount() - 1;
+            frame.mChildIndex = pReadNode->mChildren.size();
+            return false;
+        }
+
+        // Fetch the next child.
+        TamlReadNode* pChildReadNode = pReadNode->mChildren[frame.mChildIndex++];
+
+        // Is the child a reference?
+        if ( pChildReadNode->mRefToId != 0 )
+        {
+            // Yes, so add the referenced object.
+            SimObject* pChildSimObject = findReference( pChildReadNode );
+            if ( pChildSimObject != NULL )
+                addChild( frame.mpSimObject, pChildSimObject );
+
+            return false;
+        }
+
+        // Start the child.
+        TamlCommitFrame childFrame;
+        childFrame.mpReadNode = pChildReadNode;
+        childFrame.mpSimObject = beginElement( pChildReadNode, childFrame.mpCallbacks );
+        childFrame.mChildIndex = 0;
+
+        // Skip the child if it couldn't be created.
+        if ( childFrame.mpSimObject == NULL )
+        {
+            mCommittedCount += pChildReadNode->getElementCount() - 1;
+            return false;
+        }
+
+        // NOTE: This invalidates the frame.
+        mCommitStack.push_back( childFrame );
+        return false;
+    }
+
+    // Finish the element.
+    const TamlCommitFrame finishedFrame = frame;
+    mCommitStack.pop_back();
+    endElement( finishedFrame );
+
+    // Was that the root element?
+    if ( mCommitStack.size() == 0 )
+    {
+        // Yes, so the read is complete.
+        mpRootObject = finishedFrame.mpSimObject;
+        return true;
+    }
+
+    // No, so add the element to its parent.
+    addChild( mCommitStack.last().mpSimObject, finishedFrame.mpSimObject );
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+
+SimObject* TamlAsyncRead::beginElement( TamlReadNode* pReadNode, TamlCallbacks*& pCallbacks )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlAsyncReader_BeginElement);
+
+    mCommittedCount++;
+
+    pCallbacks = NULL;
+
+#ifdef TORQUE_DEBUG
+    // Create type.
+    SimObject* pSimObject = Taml::createType( pReadNode->mTypeName, mpTaml, pReadNode->mTypeLocation );
+#else
+    // Create type.
+    SimObject* pSimObject = Taml::createType( pReadNode->mTypeName, mpTaml );
+#endif
+
+    // Finish if we couldn't create the type.
+    if ( pSimObject == NULL )
+        return NULL;
+
+    // Find Taml callbacks.
+    pCallbacks = dynamic_cast<TamlCallbacks*>( pSimObject );
+
+    // Are there any Taml callbacks?
+    if ( pCallbacks != NULL )
+    {
+        // Yes, so call it.
+        mpTaml->tamlPreRead( pCallbacks );
+    }
+
+    // Set the fields.
+    for( Vector<TamlReadNode::FieldValuePair*>::iterator fieldItr = pReadNode->mFields.begin(); fieldItr != pReadNode->mFields.end(); ++fieldItr )
+    {
+        pSimObject->setPrefixedDataField( (*fieldItr)->mName, NULL, (*fieldItr)->mpValue );
+    }
+
+    // Does the object require a name?
+    if ( pReadNode->mObjectName == StringTable->EmptyString )
+    {
+        // No, so just register anonymously.
+        pSimObject->registerObject();
+    }
+    else
+    {
+        // Yes, so register a named object.
+        pSimObject->registerObject( pReadNode->mObjectName );
+
+        // Was the name assigned?
+        if ( pSimObject->getName() != pReadNode->mObjectName )
+        {
+            // No, so warn that the name was rejected.
+            Con::warnf( "TamlAsyncReader - Registered an instance of type '%s' but a request to name it '%s' was rejected.  This is typically because an object of that name already exists.  '%s'",
+                pReadNode->mTypeName, pReadNode->mObjectName, pReadNode->mTypeLocation );
+        }
+    }
+
+    // Do we have a reference Id?
+    if ( pReadNode->mRefId != 0 )
+    {
+        // Yes, so insert reference.
+        mObjectReferenceMap.insert( pReadNode->mRefId, pSimObject );
+    }
+
+    return pSimObject;
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlAsyncRead::endElement( const TamlCommitFrame& frame )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlAsyncReader_EndElement);
+
+    TamlReadNode* pReadNode = frame.mpReadNode;
+
+    // Commit the custom nodes.
+    TamlCustomNodes customNodes;
+    for( Vector<TamlReadNode::CustomNode*>::iterator nodeItr = pReadNode->mCustomNodes.begin(); nodeItr != pReadNode->mCustomNodes.end(); ++nodeItr )
+    {
+        TamlCustomNode* pCustomNode = customNodes.addNode( (*nodeItr)->mNodeName );
+
+        for( Vector<TamlReadNode::CustomNode*>::iterator childItr = (*nodeItr)->mChildren.begin(); childItr != (*nodeItr)->mChildren.end(); ++childItr )
+        {
+            commitCustomNode( *childItr, pCustomNode );
+        }
+    }
+
+    // Do we have callbacks?
+    if ( frame.mpCallbacks == NULL )
+    {
+        // No, so warn if there's custom data.
+        if ( pReadNode->mCustomNodes.size() > 0 )
+            Con::warnf( "Taml: Encountered custom data but object does not support custom data." );
+
+        return;
+    }
+
+    // Custom read callback.
+    mpTaml->tamlCustomRead( frame.mpCallbacks, customNodes );
+
+    // Post read callback.
+    mpTaml->tamlPostRead( frame.mpCallbacks, customNodes );
+}
+
+//-----------------------------------------------------------------------------
+
+SimObject* TamlAsyncRead::commitElement( TamlReadNode* pReadNode )
+{
+    // Is this a reference?
+    if ( pReadNode->mRefToId != 0 )
+    {
+        // Yes, so find it.
+        mCommittedCount++;
+        return findReference( pReadNode );
+    }
+
+    // Start the element.
+    TamlCommitFrame frame;
+    frame.mpReadNode = pReadNode;
+    frame.mpSimObject = beginElement( pReadNode, frame.mpCallbacks );
+    frame.mChildIndex = 0;
+
+    // Finish if the element couldn't be created.
+    if ( frame.mpSimObject == NULL )
+        return NULL;
+
+    // Commit the children.
+    for( Vector<TamlReadNode*>::iterator childItr = pReadNode->mChildren.begin(); childItr != pReadNode->mChildren.end(); ++childItr )
+    {
+        SimObject* pChildSimObject = commitElement( *childItr );
+        if ( pChildSimObject != NULL )
+            addChild( frame.mpSimObject, pChildSimObject );
+    }
+
+    // Finish the element.
+    endElement( frame );
+
+    return frame.mpSimObject;
+}
+
+//-----------------------------------------------------------------------------
+
+SimObject* TamlAsyncRead::findReference( TamlReadNode* pReadNode )
+{
+    // Fetch reference.
+    typeObjectReferenceHash::iterator referenceItr = mObjectReferenceMap.find( pReadNode->mRefToId );
+
+    // Did we find the reference?
+    if ( referenceItr == mObjectReferenceMap.end() )
+    {
+        // No, so warn.
+        Con::warnf( "Taml: Could not find a reference Id of '%d'", pReadNode->mRefToId );
+        return NULL;
+    }
+
+    return referenceItr->value;
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlAsyncRead::addChild( SimObject* pSimObject, SimObject* pChildSimObject )
+{
+    // Fetch the Taml children.
+    TamlChildren* pChildren = dynamic_cast<TamlChildren*>( pSimObject );
+
+    // Is this a Taml child?
+    if ( pChildren == NULL )
+    {
+        // No, so warn.
+        Con::warnf("Taml: Child element '%s' found under parent '%s' but object cannot have children.",
+            pChildSimObject->getClassName(),
+            pSimObject->getClassName() );
+        return;
+    }
+
+    // Fetch any container child class specifier.
+    AbstractClassRep* pContainerChildClass = pSimObject->getClassRep()->getContainerChildClass( true );
+
+    // Is the child object the correctly derived type?
+    if ( pContainerChildClass != NULL && !pChildSimObject->getClassRep()->isClass( pContainerChildClass ) )
+    {
+        // No, so warn.
+        Con::warnf("Taml: Child element '%s' found under parent '%s' but object is restricted to children of type '%s'.",
+            pChildSimObject->getClassName(),
+            pSimObject->getClassName(),
+            pContainerChildClass->getClassName() );
+
+        // NOTE: We can't delete the object as it may be referenced elsewhere!
+        return;
+    }
+
+    // Add child.
+    pChildren->addTamlChild( pChildSimObject );
+
+    // Find Taml callbacks for child.
+    TamlCallbacks* pChildCallbacks = dynamic_cast<TamlCallbacks*>( pChildSimObject );
+
+    // Do we have callbacks on the child?
+    if ( pChildCallbacks != NULL )
+    {
+        // Yes, so perform callback.
+        mpTaml->tamlAddParent( pChildCallbacks, pSimObject );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlAsyncRead::commitCustomNode( TamlReadNode::CustomNode* pReadCustomNode, TamlCustomNode* pParentNode )
+{
+    // Is this a proxy object?
+    if ( pReadCustomNode->mpProxyNode != NULL )
+    {
+        // Yes, so commit the proxy object now.
+        SimObject* pProxyObject = commitElement( pReadCustomNode->mpProxyNode );
+
+        // Add child node.
+        if ( pProxyObject != NULL )
+            pParentNode->addNode( pProxyObject );
+
+        return;
+    }
+
+    // No, so add child node.
+    TamlCustomNode* pChildNode = pParentNode->addNode( pReadCustomNode->mNodeName );
+
+    // Set any node text.
+    if ( pReadCustomNode->mpNodeText != NULL )
+        pChildNode->setNodeText( pReadCustomNode->mpNodeText );
+
+    // Add fields.
+    for( Vector<TamlReadNode::FieldValuePair*>::iterator fieldItr = pReadCustomNode->mFields.begin(); fieldItr != pReadCustomNode->mFields.end(); ++fieldItr )
+    {
+        pChildNode->addField( (*fieldItr)->mName, (const char*)(*fieldItr)->mpValue );
+    }
+
+    // Add children.
+    for( Vector<TamlReadNode::CustomNode*>::iterator childItr = pReadCustomNode->mChildren.begin(); childItr != pReadCustomNode->mChildren.end(); ++childItr )
+    {
+        commitCustomNode( *childItr, pChildNode );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static void completeRead( TamlAsyncRead* pRead )
+{
+    SimObject* pSimObject = pRead->getRootObject();
+
+    // Did we generate an object?
+    if ( pSimObject == NULL )
+    {
+        // No, so warn.
+        Con::warnf( "TamlAsyncReader - Failed to load an object from the file '%s'.", pRead->mFilePath );
+    }
+
+    // Notify the Taml object.
+    char readIdBuffer[16];
+    dSprintf( readIdBuffer, sizeof(readIdBuffer), "%d", pRead->mReadId );
+    Con::executef( pRead->mpTaml, 3, "onAsyncReadComplete", readIdBuffer, pSimObject == NULL ? "" : pSimObject->getIdString() );
+}
+
+//-----------------------------------------------------------------------------
+
+static void notifyProgress( TamlAsyncRead* pRead )
+{
+    char readIdBuffer[16];
+    char progressBuffer[16];
+    dSprintf( readIdBuffer, sizeof(readIdBuffer), "%d", pRead->mReadId );
+    dSprintf( progressBuffer, sizeof(progressBuffer), "%g", pRead->getProgress() );
+    Con::executef( pRead->mpTaml, 3, "onAsyncReadProgress", readIdBuffer, progressBuffer );
+}
+
+//-----------------------------------------------------------------------------
+
+static bool isParsed( TamlAsyncRead* pRead )
+{
+    MutexHandle handle;
+    handle.lock( &gParseMutex, true );
+    return pRead->mParsed;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 TamlAsyncReader::queue( Taml* pTaml, const char* pFilename )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlAsyncReader_Queue);
+
+    // Sanity!
+    AssertFatal( pTaml != NULL, "TamlAsyncReader::queue() - Cannot read with a NULL Taml object." );
+    AssertFatal( pFilename != NULL, "TamlAsyncReader::queue() - Cannot read from a NULL filename." );
+
+    TamlAsyncRead* pRead = new TamlAsyncRead();
+
+    // Expand the file-name.
+    Con::expandPath( pRead->mFilePath, sizeof(pRead->mFilePath), pFilename );
+
+    // Does the file exist?
+    if ( !Platform::isFile( pRead->mFilePath ) )
+    {
+        // No, so warn.
+        Con::warnf( "TamlAsyncReader::queue() - Could not find filename '%s' to read.", pRead->mFilePath );
+        delete pRead;
+        return 0;
+    }
+
+    pRead->mReadId = ++gLastReadId;
+    pRead->mpTaml = pTaml;
+    pRead->mFormatMode = pTaml->getFileAutoFormatMode( pRead->mFilePath );
+    gAsyncReads.push_back( pRead );
+
+    // Parse the file in the background.
+    JobSystem::submit( parseReadJob, pRead, 0, &gParseGroup );
+
+    return pRead->mReadId;
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlAsyncReader::process( void )
+{
+    if ( gAsyncReads.size() == 0 )
+        return;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlAsyncReader_Process);
+
+    // Fetch the budget.
+    const U32 budget = (U32)getMax( Con::getIntVariable( TAML_ASYNC_READ_BUDGET_VARIABLE, TAML_ASYNC_READ_DEFAULT_BUDGET ), 0 );
+    const U32 startTime = Platform::getRealMilliseconds();
+
+    // Commit the reads in the order they were started.
+    // NOTE: At least one element is committed each frame however small the budget.
+    bool budgetUsed = false;
+    while( gAsyncReads.size() > 0 && !budgetUsed )
+    {
+        TamlAsyncRead* pRead = gAsyncReads.first();
+
+        // Discard the read if it was abandoned once it's parsed.
+        if ( pRead->mpTaml == NULL )
+        {
+            if ( !isParsed( pRead ) )
+                break;
+
+            gAsyncReads.pop_front();
+            delete pRead;
+            continue;
+        }
+
+        // Finish if the read is still being parsed.
+        if ( !isParsed( pRead ) )
+            break;
+
+        // Commit until the read is complete or the budget is used.
+        bool committed = false;
+        gpCommittingRead = pRead;
+        while( !committed && !budgetUsed && pRead->mpTaml != NULL )
+        {
+            committed = pRead->commitStep();
+            budgetUsed = Platform::getRealMilliseconds() - startTime >= budget;
+        }
+        gpCommittingRead = NULL;
+
+        // Was the Taml object deleted by a callback?
+        if ( pRead->mpTaml == NULL )
+            continue;
+
+        // Notify the Taml object.
+        if ( !committed )
+        {
+            notifyProgress( pRead );
+            break;
+        }
+
+        gAsyncReads.pop_front();
+        completeRead( pRead );
+        delete pRead;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlAsyncReader::flush( Taml* pTaml )
+{
+    if ( gAsyncReads.size() == 0 )
+        return;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlAsyncReader_Flush);
+
+    // Wait for the files to be parsed.
+    JobSystem::wait( &gParseGroup );
+
+    // Commit the reads.
+    for( U32 index = 0; index < (U32)gAsyncReads.size(); )
+    {
+        TamlAsyncRead* pRead = gAsyncReads[index];
+
+        // Skip the reads of other Taml objects and the read already being committed.
+        if ( ( pTaml != NULL && pRead->mpTaml != pTaml ) || pRead == gpCommittingRead )
+        {
+            index++;
+            continue;
+        }
+
+        gAsyncReads.erase( index );
+
+        // Commit the read if it wasn't abandoned.
+        if ( pRead->mpTaml != NULL )
+        {
+            TamlAsyncRead* pCommittingRead = gpCommittingRead;
+            gpCommittingRead = pRead;
+
+            bool committed = false;
+            while( !committed && pRead->mpTaml != NULL )
+            {
+                committed = pRead->commitStep();
+            }
+
+            gpCommittingRead = pCommittingRead;
+
+            if ( pRead->mpTaml != NULL )
+                completeRead( pRead );
+        }
+
+        delete pRead;
+
+        // The callbacks may have changed the reads so start again.
+        index = 0;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlAsyncReader::cancel( Taml* pTaml )
+{
+    // Abandon the reads of the Taml object.
+    // NOTE: The reads are deleted once they're parsed.
+    for( U32 index = 0; index < (U32)gAsyncReads.size(); ++index )
+    {
+        if ( gAsyncReads[index]->mpTaml == pTaml )
+            gAsyncReads[index]->mpTaml = NULL;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+U32 TamlAsyncReader::getPendingCount( void )
+{
+    U32 pendingCount = 0;
+    for( U32 index = 0; index < (U32)gAsyncReads.size(); ++index )
+    {
+        if ( gAsyncReads[index]->mpTaml != NULL )
+            pendingCount++;
+    }
+
+    return pendingCount;
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlAsyncReader::shutdown( void )
+{
+    JobSystem::wait( &gParseGroup );
+
+    for( U32 index = 0; index < (U32)gAsyncReads.size(); ++index )
+    {
+        delete gAsyncReads[index];
+    }
+
+    gAsyncReads.clear();
+}
@@ -0,0 +1,91 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _TAML_ASYNC_READER_H_
+#define _TAML_ASYNC_READER_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+class Taml;
+
+//-----------------------------------------------------------------------------
+
+#define TAML_ASYNC_READ_BUDGET_VARIABLE     "$pref::T2D::TAMLAsyncReadBudget"
+#define TAML_ASYNC_READ_DEFAULT_BUDGET      4
+
+//-----------------------------------------------------------------------------
+
+/// Reads Taml files without blocking the main thread.
+///
+/// A read happens in two phases.  The file is parsed (in any format) into a tree of
+/// TamlReadNode on a job system worker.  The main thread then commits the tree: it
+/// creates the objects, sets their fields, registers them and performs the Taml
+/// callbacks (including onTamlPostRead) in the same order as a synchronous read.
+/// The commit is spread over frames, instantiating objects until the budget of the
+/// frame (in milliseconds) is used up.  The budget is the "$pref::T2D::TAMLAsyncReadBudget"
+/// variable.
+///
+/// The Taml object that started a read is notified of its progress and completion
+/// with the script callbacks "onAsyncReadProgress(%readId, %progress)" and
+/// "onAsyncReadComplete(%readId, %object)".  The object is an empty string if the
+/// read failed.
+///
+/// Deleting the Taml object abandons its reads.  Objects that were already committed
+/// are not deleted, as with a synchronous read that fails part way.
+///
+/// @code
+/// %taml = new Taml();
+/// %readId = %taml.readAsync("level.taml");
+///
+/// function Taml::onAsyncReadComplete(%this, %readId, %object) { ... }
+/// @endcode
+///
+/// @ingroup tamlGroup
+/// @see tamlGroup
+class TamlAsyncReader
+{
+public:
+    /// Start reading a file.
+    /// @return The read Id or zero if the file could not be found.
+    static U32 queue( Taml* pTaml, const char* pFilename );
+
+    /// Commit the parsed reads within the frame budget.  Called once a frame.
+    static void process( void );
+
+    /// Complete the reads of the specified Taml object (or all reads) immediately.
+    static void flush( Taml* pTaml = NULL );
+
+    /// Abandon the reads of the specified Taml object.
+    static void cancel( Taml* pTaml );
+
+    /// Get the number of reads that have not completed.
+    static U32 getPendingCount( void );
+
+    /// Wait for the reads being parsed and abandon all the reads.  Must be called before the job system is destroyed.
+    static void shutdown( void );
+};
+
+#endif // _TAML_ASYNC_READER_H_
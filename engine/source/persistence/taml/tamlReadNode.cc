@@ -0,0 +1,123 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "persistence/taml/tamlReadNode.h"
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+TamlReadNode::~TamlReadNode()
+{
+    // Delete fields.
+    for( Vector<FieldValuePair*>::iterator itr = mFields.begin(); itr != mFields.end(); ++itr )
+    {
+        delete (*itr);
+    }
+
+    // Delete children.
+    for( Vector<TamlReadNode*>::iterator itr = mChildren.begin(); itr != mChildren.end(); ++itr )
+    {
+        delete (*itr);
+    }
+
+    // Delete custom nodes.
+    for( Vector<CustomNode*>::iterator itr = mCustomNodes.begin(); itr != mCustomNodes.end(); ++itr )
+    {
+        delete (*itr);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+U32 TamlReadNode::getElementCount( void ) const
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlReadNode_GetElementCount);
+
+    U32 elementCount = 1;
+
+    // Count children.
+    for( Vector<TamlReadNode*>::const_iterator itr = mChildren.begin(); itr != mChildren.end(); ++itr )
+    {
+        elementCount += (*itr)->getElementCount();
+    }
+
+    // Count proxy objects.
+    Vector<const CustomNode*> customNodes;
+    for( Vector<CustomNode*>::const_iterator itr = mCustomNodes.begin(); itr != mCustomNodes.end(); ++itr )
+    {
+        customNodes.push_back( *itr );
+    }
+
+    while( customNodes.size() > 0 )
+    {
+        const CustomNode* pCustomNode = customNodes.last();
+        customNodes.pop_back();
+
+        if ( pCustomNode->mpProxyNode != NULL )
+            elementCount += pCustomNode->mpProxyNode->getElementCount();
+
+        for( Vector<CustomNode*>::const_iterator itr = pCustomNode->mChildren.begin(); itr != pCustomNode->mChildren.end(); ++itr )
+        {
+            customNodes.push_back( *itr );
+        }
+    }
+
+    return elementCount;
+}
+
+//-----------------------------------------------------------------------------
+
+TamlReadNode::CustomNode::~CustomNode()
+{
+    // Delete text.
+    delete [] mpNodeText;
+
+    // Delete fields.
+    for( Vector<FieldValuePair*>::iterator itr = mFields.begin(); itr != mFields.end(); ++itr )
+    {
+        delete (*itr);
+    }
+
+    // Delete children.
+    for( Vector<CustomNode*>::iterator itr = mChildren.begin(); itr != mChildren.end(); ++itr )
+    {
+        delete (*itr);
+    }
+
+    // Delete any proxy object.
+    delete mpProxyNode;
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlReadNode::CustomNode::setNodeText( const char* pNodeText, const U32 nodeTextLength )
+{
+    // Replace any existing text.
+    delete [] mpNodeText;
+
+    mpNodeText = new char[ nodeTextLength+1 ];
+    dMemcpy( mpNodeText, pNodeText, nodeTextLength );
+    mpNodeText[nodeTextLength] = 0;
+}
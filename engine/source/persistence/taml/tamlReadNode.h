@@ -0,0 +1,127 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _TAML_READ_NODE_H_
+#define _TAML_READ_NODE_H_
+
+#ifndef _STRINGTABLE_H_
+#include "string/stringTable.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// A parsed element that has not been instantiated yet.
+///
+/// The readers normally instantiate objects as they parse.  An asynchronous read
+/// instead parses the file into a tree of these nodes on a worker thread and the
+/// main thread then instantiates the tree (see TamlAsyncReader).  The nodes only
+/// hold text so they can be built without touching any objects.
+///
+/// @ingroup tamlGroup
+/// @see tamlGroup
+class TamlReadNode
+{
+public:
+    class FieldValuePair
+    {
+    public:
+        FieldValuePair( StringTableEntry name, const char* pValue, const U32 valueLength )
+        {
+            // Set the field name.
+            mName = name;
+
+            // Allocate and copy the value.
+            mpValue = new char[ valueLength+1 ];
+            dMemcpy( mpValue, pValue, valueLength );
+            mpValue[valueLength] = 0;
+        }
+
+        ~FieldValuePair()
+        {
+            delete [] mpValue;
+        }
+
+        StringTableEntry    mName;
+        char*               mpValue;
+    };
+
+    /// A parsed custom node.
+    class CustomNode
+    {
+    public:
+        CustomNode( StringTableEntry nodeName ) :
+            mNodeName( nodeName ),
+            mpNodeText( NULL ),
+            mpProxyNode( NULL )
+        {
+        }
+
+        ~CustomNode();
+
+        /// Set the node text.
+        void setNodeText( const char* pNodeText, const U32 nodeTextLength );
+
+        StringTableEntry                mNodeName;
+        char*                           mpNodeText;
+        Vector<FieldValuePair*>         mFields;
+        Vector<CustomNode*>             mChildren;
+
+        /// The element of a proxy object (if the node is one).
+        TamlReadNode*                   mpProxyNode;
+    };
+
+public:
+    TamlReadNode() :
+        mTypeName( StringTable->EmptyString ),
+        mObjectName( StringTable->EmptyString ),
+        mRefId( 0 ),
+        mRefToId( 0 )
+    {
+        mTypeLocation[0] = 0;
+    }
+
+    ~TamlReadNode();
+
+    /// Add a field.
+    inline void addField( StringTableEntry name, const char* pValue ) { addField( name, pValue, dStrlen(pValue) ); }
+    inline void addField( StringTableEntry name, const char* pValue, const U32 valueLength ) { mFields.push_back( new FieldValuePair( name, pValue, valueLength ) ); }
+
+    /// Get the number of elements in the tree (including this one).
+    U32 getElementCount( void ) const;
+
+    StringTableEntry                mTypeName;
+    StringTableEntry                mObjectName;
+    U32                             mRefId;
+    U32                             mRefToId;
+    Vector<FieldValuePair*>         mFields;
+    Vector<TamlReadNode*>           mChildren;
+    Vector<CustomNode*>             mCustomNodes;
+
+    /// Where the element was found, used when warning about it.
+    char                            mTypeLocation[64];
+};
+
+#endif // _TAML_READ_NODE_H_
@@ -0,0 +1,205 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+
+#include "persistence/taml/tamlReadNodeParser.h"
+#include "persistence/taml/tamlVisitor.h"
+#include "persistence/taml/xml/tamlXmlReader.h"
+#include "persistence/taml/binary/tamlBinaryReader.h"
+#include "persistence/taml/json/tamlJSONReader.h"
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+bool TamlReadNodeParser::accept( const char* pFilename, TamlVisitor& visitor )
+{
+    // Read the nodes.
+    TamlReadNode* pRootNode = readNodes( pFilename, mFormatMode );
+
+    // Finish if the nodes could not be read.
+    if ( pRootNode == NULL )
+        return false;
+
+    // Visit the nodes.
+    const bool status = accept( pRootNode, pFilename, visitor );
+
+    delete pRootNode;
+
+    return status;
+}
+
+//-----------------------------------------------------------------------------
+
+bool TamlReadNodeParser::accept( const TamlReadNode* pRootNode, const char* pFilename, TamlVisitor& visitor )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlReadNodeParser_Accept);
+
+    // Sanity!
+    AssertFatal( pRootNode != NULL, "Cannot accept a NULL root node." );
+    AssertFatal( pFilename != NULL, "Cannot accept a NULL filename." );
+
+    // Set parsing filename.
+    setParsingFilename( pFilename );
+
+    // Parse root node.
+    parseNode( pRootNode, true, visitor );
+
+    // Reset parsing filename.
+    setParsingFilename( StringTable->EmptyString );
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+TamlReadNode* TamlReadNodeParser::readNodes( const char* pFilename, const Taml::TamlFormatMode formatMode )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlReadNodeParser_ReadNodes);
+
+    // Sanity!
+    AssertFatal( pFilename != NULL, "Cannot read nodes from a NULL filename." );
+
+    // Open the file.
+    FileStream stream;
+    if ( !stream.open( pFilename, FileStream::Read ) )
+    {
+        // Warn.
+        Con::warnf( "TamlReadNodeParser::readNodes() - Could not open filename '%s' for read.", pFilename );
+        return NULL;
+    }
+
+    TamlReadNode* pRootNode = NULL;
+
+    // Parse the elements.
+    // NOTE: The readers don't use the Taml object when only reading nodes.
+    switch( formatMode )
+    {
+        case Taml::XmlFormat:
+        {
+            TamlXmlReader reader( NULL );
+            pRootNode = reader.readNodes( stream );
+            break;
+        }
+
+        case Taml::BinaryFormat:
+        {
+            TamlBinaryReader reader( NULL );
+            pRootNode = reader.readNodes( stream );
+            break;
+        }
+
+        case Taml::JSONFormat:
+        {
+            TamlJSONReader reader( NULL );
+            pRootNode = reader.readNodes( stream );
+            break;
+        }
+
+        default:
+            break;
+    }
+
+    stream.close();
+
+    return pRootNode;
+}
+
+//-----------------------------------------------------------------------------
+
+bool TamlReadNodeParser::parseNode( const TamlReadNode* pReadNode, const bool isRoot, TamlVisitor& visitor )
+{
+    // Parse fields (stop processing if instructed).
+    if ( !parseFields( pReadNode->mTypeName, pReadNode->mFields, isRoot, visitor ) )
+        return false;
+
+    // Finish if only the root is needed.
+    if ( visitor.wantsRootOnly() )
+        return false;
+
+    // Parse the children (stop processing if instructed).
+    for ( Vector<TamlReadNode*>::const_iterator childItr = pReadNode->mChildren.begin(); childItr != pReadNode->mChildren.end(); ++childItr )
+    {
+        if ( !parseNode( *childItr, false, visitor ) )
+            return false;
+    }
+
+    // Parse the custom nodes (stop processing if instructed).
+    for ( Vector<TamlReadNode::CustomNode*>::const_iterator customItr = pReadNode->mCustomNodes.begin(); customItr != pReadNode->mCustomNodes.end(); ++customItr )
+    {
+        if ( !parseCustomNode( *customItr, visitor ) )
+            return false;
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool TamlReadNodeParser::parseCustomNode( const TamlReadNode::CustomNode* pCustomNode, TamlVisitor& visitor )
+{
+    // Is the custom node a proxy object?
+    if ( pCustomNode->mpProxyNode != NULL )
+    {
+        // Yes, so parse it as an element.
+        return parseNode( pCustomNode->mpProxyNode, false, visitor );
+    }
+
+    // Parse fields (stop processing if instructed).
+    if ( !parseFields( pCustomNode->mNodeName, pCustomNode->mFields, false, visitor ) )
+        return false;
+
+    // Parse the children (stop processing if instructed).
+    for ( Vector<TamlReadNode::CustomNode*>::const_iterator childItr = pCustomNode->mChildren.begin(); childItr != pCustomNode->mChildren.end(); ++childItr )
+    {
+        if ( !parseCustomNode( *childItr, visitor ) )
+            return false;
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool TamlReadNodeParser::parseFields( const char* pObjectName, const Vector<TamlReadNode::FieldValuePair*>& fields, const bool isRoot, TamlVisitor& visitor )
+{
+    // Create a visitor property state.
+    TamlVisitor::PropertyState propertyState;
+    propertyState.setObjectName( pObjectName, isRoot );
+
+    // Iterate fields.
+    for ( Vector<TamlReadNode::FieldValuePair*>::const_iterator fieldItr = fields.begin(); fieldItr != fields.end(); ++fieldItr )
+    {
+        // Configure property state.
+        propertyState.setProperty( (*fieldItr)->mName, (*fieldItr)->mpValue );
+
+        // Visit this field (stop processing if instructed).
+        if ( !visitor.visit( *this, propertyState ) )
+            return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,78 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+
+#ifndef _TAML_READ_NODE_PARSER_H_
+#define _TAML_READ_NODE_PARSER_H_
+
+#ifndef _TAML_PARSER_H_
+#include "persistence/taml/tamlParser.h"
+#endif
+
+#ifndef _TAML_READ_NODE_H_
+#include "persistence/taml/tamlReadNode.h"
+#endif
+
+#ifndef _TAML_H_
+#include "persistence/taml/taml.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// Visits a tree of TamlReadNode.
+///
+/// Unlike the format parsers, reading the nodes and visiting them are separate so
+/// the (expensive) read can happen on a worker thread and the visit on the main
+/// thread.  The elements, their fields and their custom nodes are visited in the
+/// order they were read.  Property changes are not supported.
+///
+/// @ingroup tamlGroup
+/// @see tamlGroup
+class TamlReadNodeParser : public TamlParser
+{
+public:
+    TamlReadNodeParser( const Taml::TamlFormatMode formatMode ) : mFormatMode( formatMode ) {}
+    virtual ~TamlReadNodeParser() {}
+
+    /// Whether the parser can change a property or not.
+    virtual bool canChangeProperty( void ) { return false; }
+
+    /// Accept visitor.
+    virtual bool accept( const char* pFilename, TamlVisitor& visitor );
+
+    /// Accept visitor for nodes that have already been read from the specified file.
+    bool accept( const TamlReadNode* pRootNode, const char* pFilename, TamlVisitor& visitor );
+
+    /// Read the nodes of a file in the specified format.  This can be called from any thread.
+    /// @return The root node (owned by the caller) or NULL if the file could not be read.
+    static TamlReadNode* readNodes( const char* pFilename, const Taml::TamlFormatMode formatMode );
+
+private:
+    bool parseNode( const TamlReadNode* pReadNode, const bool isRoot, TamlVisitor& visitor );
+    bool parseCustomNode( const TamlReadNode::CustomNode* pCustomNode, TamlVisitor& visitor );
+    bool parseFields( const char* pObjectName, const Vector<TamlReadNode::FieldValuePair*>& fields, const bool isRoot, TamlVisitor& visitor );
+
+    Taml::TamlFormatMode mFormatMode;
+};
+
+#endif // _TAML_READ_NODE_PARSER_H_
@@ -258,6 +258,31 @@ ConsoleMethodWithDocs(Taml, read, ConsoleString, 3, 3, (filename))
 
 //-----------------------------------------------------------------------------
 
+/*! Read an object from a file using Taml without blocking.
+    The file is parsed in the background and the objects are created over the following frames.
+    The progress is reported with the callback "onAsyncReadProgress(%readId, %progress)" and the
+    completion with the callback "onAsyncReadComplete(%readId, %object)" where the object is an
+    empty string if the read failed.
+    @param filename The filename to read from.
+    @return The read Id or zero if the read could not be started.
+*/
+ConsoleMethodWithDocs(Taml, readAsync, ConsoleInt, 3, 3, (filename))
+{
+    return object->readAsync( argv[2] );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Complete any asynchronous reads immediately.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Taml, flushAsyncReads, ConsoleVoid, 2, 2, ())
+{
+    object->flushAsyncReads();
+}
+
+//-----------------------------------------------------------------------------
+
 ConsoleMethodGroupEndWithDocs(Taml)
 
 
@@ -54,6 +54,28 @@ SimObject* TamlXmlReader::read( FileStream& stream )
 
 //-----------------------------------------------------------------------------
 
+TamlReadNode* TamlXmlReader::readNodes( FileStream& stream )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlXmlReader_ReadNodes);
+
+    // Create document.
+    TiXmlDocument xmlDocument;
+
+    // Load document from stream.
+    if ( !xmlDocument.LoadFile( stream ) || xmlDocument.RootElement() == NULL )
+    {
+        // Warn!
+        Con::warnf("Taml: Could not load Taml XML file from stream.");
+        return NULL;
+    }
+
+    // Parse root element.
+    return parseReadNode( xmlDocument.RootElement() );
+}
+
+//-----------------------------------------------------------------------------
+
 void TamlXmlReader::resetParse( void )
 {
     // Debug Profiling.
@@ -406,6 +428,173 @@ void TamlXmlReader::parseCustomNode( TiXmlElement* pXmlElement, TamlCustomNode*
 
 //-----------------------------------------------------------------------------
 
+TamlReadNode* TamlXmlReader::parseReadNode( TiXmlElement* pXmlElement )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlXmlReader_ParseReadNode);
+
+    TamlReadNode* pReadNode = new TamlReadNode();
+
+    // Fetch element name.
+    pReadNode->mTypeName = StringTable->insert( pXmlElement->Value() );
+
+    // Fetch reference to Id.
+    pReadNode->mRefToId = getTamlRefToId( pXmlElement );
+
+    // Finish if this is a reference.
+    if ( pReadNode->mRefToId != 0 )
+        return pReadNode;
+
+    // Fetch reference Id.
+    pReadNode->mRefId = getTamlRefId( pXmlElement );
+
+    // Format the type location.
+    dSprintf( pReadNode->mTypeLocation, sizeof(pReadNode->mTypeLocation), "Taml [format='xml' row=%d column=%d]", pXmlElement->Row(), pXmlElement->Column() );
+
+    // Iterate attributes.
+    for ( TiXmlAttribute* pAttribute = pXmlElement->FirstAttribute(); pAttribute; pAttribute = pAttribute->Next() )
+    {
+        // Insert attribute name.
+        StringTableEntry attributeName = StringTable->insert( pAttribute->Name() );
+
+        // Is this the object name?
+        if ( attributeName == tamlNamedObjectName )
+        {
+            // Yes, so fetch it.
+            pReadNode->mObjectName = StringTable->insert( pAttribute->Value() );
+            continue;
+        }
+
+        // Ignore if this is a Taml attribute.
+        if (    attributeName == tamlRefIdName ||
+                attributeName == tamlRefToIdName )
+            continue;
+
+        // Add the field.
+        pReadNode->addField( attributeName, pAttribute->Value() );
+    }
+
+    // Iterate siblings.
+    for ( TiXmlNode* pChildXmlNode = pXmlElement->FirstChild(); pChildXmlNode != NULL; pChildXmlNode = pChildXmlNode->NextSibling() )
+    {
+        // Fetch element.
+        TiXmlElement* pChildXmlElement = dynamic_cast<TiXmlElement*>( pChildXmlNode );
+
+        // Skip if this is not an element?
+        if ( pChildXmlElement == NULL )
+            continue;
+
+        // Is this a standard child element?
+        if ( dStrchr( pChildXmlElement->Value(), '.' ) == NULL )
+        {
+            // Yes, so parse child element.
+            pReadNode->mChildren.push_back( parseReadNode( pChildXmlElement ) );
+        }
+        else
+        {
+            // No, so parse custom element.
+            parseCustomReadElement( pChildXmlElement, pReadNode );
+        }
+    }
+
+    return pReadNode;
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlXmlReader::parseCustomReadElement( TiXmlElement* pXmlElement, TamlReadNode* pReadNode )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlXmlReader_ParseCustomReadElement);
+
+    // Fetch the period.
+    const char* pPeriod = dStrchr( pXmlElement->Value(), '.' );
+
+    // Sanity!
+    AssertFatal( pPeriod != NULL, "Parsing extended element but no period character found." );
+
+    // Finish is no XML node exists.
+    if ( pXmlElement->FirstChild() == NULL )
+        return;
+
+    // Add custom node.
+    TamlReadNode::CustomNode* pCustomNode = new TamlReadNode::CustomNode( StringTable->insert( pPeriod+1 ) );
+    pReadNode->mCustomNodes.push_back( pCustomNode );
+
+    // Iterate custom nodes.
+    for ( TiXmlNode* pCustomXmlNode = pXmlElement->FirstChild(); pCustomXmlNode != NULL; pCustomXmlNode = pCustomXmlNode->NextSibling() )
+    {
+        // Fetch element.
+        TiXmlElement* pCustomXmlElement = dynamic_cast<TiXmlElement*>( pCustomXmlNode );
+
+        // Skip if this is not an element.
+        if ( pCustomXmlElement == NULL )
+            continue;
+
+        // Parse custom node.
+        parseCustomReadNode( pCustomXmlElement, pCustomNode );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlXmlReader::parseCustomReadNode( TiXmlElement* pXmlElement, TamlReadNode::CustomNode* pCustomNode )
+{
+    // Is the node a proxy object?
+    if (  getTamlRefId( pXmlElement ) != 0 || getTamlRefToId( pXmlElement ) != 0 )
+    {
+        // Yes, so parse proxy object.
+        TamlReadNode::CustomNode* pProxyNode = new TamlReadNode::CustomNode( StringTable->EmptyString );
+        pProxyNode->mpProxyNode = parseReadNode( pXmlElement );
+        pCustomNode->mChildren.push_back( pProxyNode );
+        return;
+    }
+
+    // No, so add child node.
+    TamlReadNode::CustomNode* pChildNode = new TamlReadNode::CustomNode( StringTable->insert( pXmlElement->Value() ) );
+    pCustomNode->mChildren.push_back( pChildNode );
+
+    // Iterate attributes.
+    for ( TiXmlAttribute* pAttribute = pXmlElement->FirstAttribute(); pAttribute; pAttribute = pAttribute->Next() )
+    {
+        // Insert attribute name.
+        StringTableEntry attributeName = StringTable->insert( pAttribute->Name() );
+
+        // Skip if a Taml reference attribute.
+        if ( attributeName == tamlRefIdName || attributeName == tamlRefToIdName )
+            continue;
+
+        // Add node field.
+        pChildNode->mFields.push_back( new TamlReadNode::FieldValuePair( attributeName, pAttribute->Value(), dStrlen(pAttribute->Value()) ) );
+    }
+
+    // Fetch any element text.
+    const char* pElementText = pXmlElement->GetText();
+
+    // Do we have any element text?
+    if ( pElementText != NULL )
+    {
+        // Yes, so store it.
+        pChildNode->setNodeText( pElementText, dStrlen(pElementText) );
+    }
+
+    // Iterate children.
+    for ( TiXmlNode* pChildXmlNode = pXmlElement->FirstChild(); pChildXmlNode != NULL; pChildXmlNode = pChildXmlNode->NextSibling() )
+    {
+        // Fetch child element.
+        TiXmlElement* pChildXmlElement = dynamic_cast<TiXmlElement*>( pChildXmlNode );
+
+        // Skip if this is not an element.
+        if ( pChildXmlElement == NULL )
+            continue;
+
+        // Parse custom node.
+        parseCustomReadNode( pChildXmlElement, pChildNode );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 U32 TamlXmlReader::getTamlRefId( TiXmlElement* pXmlElement )
 {
     // Debug Profiling.
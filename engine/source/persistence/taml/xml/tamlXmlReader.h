@@ -35,6 +35,10 @@
 #include "persistence/tinyXML/tinyxml.h"
 #endif
 
+#ifndef _TAML_READ_NODE_H_
+#include "persistence/taml/tamlReadNode.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
 /// @ingroup tamlGroup
@@ -51,6 +55,9 @@ public:
     /// Read.
     SimObject* read( FileStream& stream );
 
+    /// Read the elements without instantiating them.  This can be called on any thread.
+    TamlReadNode* readNodes( FileStream& stream );
+
 private:
     Taml* mpTaml;
 
@@ -65,6 +72,10 @@ private:
     void parseCustomElement( TiXmlElement* pXmlElement, TamlCustomNodes& pCustomNode );
     void parseCustomNode( TiXmlElement* pXmlElement, TamlCustomNode* pCustomNode );
 
+    TamlReadNode* parseReadNode( TiXmlElement* pXmlElement );
+    void parseCustomReadElement( TiXmlElement* pXmlElement, TamlReadNode* pReadNode );
+    void parseCustomReadNode( TiXmlElement* pXmlElement, TamlReadNode::CustomNode* pCustomNode );
+
     U32 getTamlRefId( TiXmlElement* pXmlElement );
     U32 getTamlRefToId( TiXmlElement* pXmlElement );
     const char* getTamlObjectName( TiXmlElement* pXmlElement );   
@@ -121,6 +121,23 @@ GL_GROUP_BEGIN(EXT_blend_minmax)
 GL_FUNCTION(void,       glBlendEquationEXT, (GLenum mode), return; )
 GL_GROUP_END()
 
+// ARB_vertex_buffer_object (core in OpenGL 1.5)
+#ifndef GL_ARRAY_BUFFER
+#define GL_ARRAY_BUFFER                      0x8892
+#define GL_ELEMENT_ARRAY_BUFFER              0x8893
+#define GL_STREAM_DRAW                       0x88E0
+#define GL_STATIC_DRAW                       0x88E4
+#define GL_DYNAMIC_DRAW                      0x88E8
+#endif
+
+GL_GROUP_BEGIN(ARB_vertex_buffer_object)
+GL_FUNCTION(void,       glBindBuffer, (GLenum target, GLuint buffer), return; )
+GL_FUNCTION(void,       glDeleteBuffers, (GLsizei n, const GLuint* buffers), return; )
+GL_FUNCTION(void,       glGenBuffers, (GLsizei n, GLuint* buffers), return; )
+GL_FUNCTION(void,       glBufferData, (GLenum target, GLsizeiptr size, const void* data, GLenum usage), return; )
+GL_FUNCTION(void,       glBufferSubData, (GLenum target, GLintptr offset, GLsizeiptr size, const void* data), return; )
+GL_GROUP_END()
+
 //NV_vertex_array_range
 #ifdef TORQUE_OS_WIN32
 GL_GROUP_BEGIN(NV_vertex_array_range)
@@ -27,6 +27,14 @@
 #include "string/stringTable.h"
 #include "io/resource/resourceManager.h"
 
+#if defined(TORQUE_OS_LINUX) || defined(TORQUE_OS_OPENBSD) || defined(TORQUE_OS_FREEBSD) || defined(TORQUE_OS_OSX) || defined(TORQUE_OS_IOS)
+#define TORQUE_FILE_VIEW_MMAP
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 #include "platformFileIO_ScriptBinding.h"
 
 //-----------------------------------------------------------------------------
@@ -454,3 +462,75 @@ StringTableEntry Platform::getPrefsPath(const char *file /* = NULL */)
 }
 
 //-----------------------------------------------------------------------------
+
+FileView::FileView() :
+   mpData( NULL ),
+   mSize( 0 )
+{
+}
+
+//-----------------------------------------------------------------------------
+
+FileView::~FileView()
+{
+   close();
+}
+
+//-----------------------------------------------------------------------------
+
+bool FileView::isMappingSupported()
+{
+#ifdef TORQUE_FILE_VIEW_MMAP
+   return true;
+#else
+   return false;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+bool FileView::open(const char *filename)
+{
+   close();
+
+#ifdef TORQUE_FILE_VIEW_MMAP
+   const int fd = ::open(filename, O_RDONLY);
+   if(fd < 0)
+      return false;
+
+   struct stat fileStat;
+   if(fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0)
+   {
+      ::close(fd);
+      return false;
+   }
+
+   // The mapping keeps the file alive (even if it's deleted) so the descriptor isn't needed.
+   void *pData = mmap(NULL, (size_t)fileStat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+   ::close(fd);
+
+   if(pData == MAP_FAILED)
+      return false;
+
+   mpData = pData;
+   mSize = (U32)fileStat.st_size;
+   return true;
+#else
+   return false;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+void FileView::close()
+{
+   if(mpData == NULL)
+      return;
+
+#ifdef TORQUE_FILE_VIEW_MMAP
+   munmap(mpData, mSize);
+#endif
+
+   mpData = NULL;
+   mSize = 0;
+}
@@ -145,4 +145,41 @@ protected:
    Status setStatus(Status status);    ///< Setter for the current status.
 };
 
+/// A private, writable view of the whole of a file mapped into memory.
+///
+/// Pages are only read from the file when they are first touched and are only
+/// copied when they are first written to; writes are never written back to the
+/// file.  Mapping is only supported on platforms where a mapped file can be
+/// replaced while it is mapped, elsewhere open() always fails and the file
+/// should be read instead.
+class FileView
+{
+private:
+   void *mpData;
+   U32 mSize;
+
+   FileView(const FileView&);              ///< This is here to disable the copy constructor.
+   FileView& operator=(const FileView&);   ///< This is here to disable assignment.
+
+public:
+   FileView();
+   ~FileView();
+
+   /// Whether files can be mapped on this platform.
+   static bool isMappingSupported();
+
+   /// Map the specified file.
+   /// @returns Whether the file was mapped.
+   bool open(const char *filename);
+
+   /// Unmap the file.
+   void close();
+
+   /// Gets the mapped file data.
+   inline U8* getData() const { return (U8*)mpData; }
+
+   /// Gets the size of the mapped file.
+   inline U32 getSize() const { return mSize; }
+};
+
 #endif // _FILE_IO_H_
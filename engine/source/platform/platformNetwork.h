@@ -62,7 +62,12 @@ struct Net
    // Unreliable network functions (UDP)
    static bool openPort(S32 connectPort);
    static void closePort();
+   /// The port opened by openPort(), or 0 when no port is open.
+   static S32 getPort();
    static Error sendto(const NetAddress *address, const U8 *buffer, S32 bufferSize);
+   /// Write any datagrams queued by sendto().  Platforms which write datagrams
+   /// immediately (rather than in batches) do nothing here.
+   static void flushPackets();
 
    // Reliable network functions (TCP)
    static NetSocket openListenPort(U16 port);
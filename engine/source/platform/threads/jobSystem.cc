@@ -0,0 +1,421 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "platform/platform.h"
+#include "platform/threads/jobSystem.h"
+#include "platform/threads/thread.h"
+#include "platform/threads/semaphore.h"
+#include "collection/vector.h"
+#include "math/mMathFn.h"
+#include "console/console.h"
+
+#include "jobSystem_ScriptBinding.h"
+
+#if defined(TORQUE_COMPILER_VISUALC)
+#include <intrin.h>
+#define JOB_SYSTEM_ATOMIC_INCREMENT( value ) ( (U32)_InterlockedIncrement( (volatile long*)&(value) ) )
+#define JOB_SYSTEM_ATOMIC_DECREMENT( value ) ( (U32)_InterlockedDecrement( (volatile long*)&(value) ) )
+#else
+#define JOB_SYSTEM_ATOMIC_INCREMENT( value ) ( (U32)__sync_add_and_fetch( &(value), 1 ) )
+#define JOB_SYSTEM_ATOMIC_DECREMENT( value ) ( (U32)__sync_sub_and_fetch( &(value), 1 ) )
+#endif
+
+//-----------------------------------------------------------------------------
+
+struct JobEntry
+{
+    JobSystem::JobFunction  mFunction;
+    void*                   mpContext;
+    U32                     mJobIndex;
+    JobSystem::JobGroup*    mpGroup;
+};
+
+/// A worker's jobs held in a ring so both the owner (back) and thieves (front) pop in constant time.
+struct JobWorkerQueue
+{
+    JobWorkerQueue() : mHead( 0 ), mCount( 0 ) {}
+
+    inline bool isEmpty( void ) const { return mCount == 0; }
+
+    void pushBack( const JobEntry& job )
+    {
+        // Grow the full ring, moving the jobs that wrapped around to follow the others.
+        const U32 capacity = (U32)mJobs.size();
+        if ( mCount == capacity )
+        {
+            mJobs.setSize( getMax( capacity * 2, (U32)16 ) );
+            for ( U32 index = 0; index < mHead; ++index )
+                mJobs[capacity + index] = mJobs[index];
+        }
+
+        mJobs[(mHead + mCount) % (U32)mJobs.size()] = job;
+        mCount++;
+    }
+
+    JobEntry popBack( void )
+    {
+        mCount--;
+        return mJobs[(mHead + mCount) % (U32)mJobs.size()];
+    }
+
+    JobEntry popFront( void )
+    {
+        const JobEntry job = mJobs[mHead];
+        mHead = (mHead + 1) % (U32)mJobs.size();
+        mCount--;
+        return job;
+    }
+
+    Mutex               mLock;
+    Vector<JobEntry>    mJobs;
+    U32                 mHead;
+    U32                 mCount;
+};
+
+struct JobWorkerState
+{
+    U32             mWorkerIndex;
+    Thread*         mpThread;
+};
+
+static JobWorkerQueue* gWorkerQueues = NULL;
+static JobWorkerState* gWorkerStates = NULL;
+static U32          gWorkerCount = 0;
+static volatile U32 gNextQueue = 0;
+static volatile U32 gPendingJobs = 0;
+static Semaphore*   gJobSignal = NULL;
+static volatile bool gShutdown = false;
+
+//-----------------------------------------------------------------------------
+
+static S32 findWorkerIndex( void )
+{
+    if ( gWorkerCount == 0 )
+        return -1;
+
+    const ThreadIdent currentThreadId = ThreadManager::getCurrentThreadId();
+
+    for ( U32 index = 0; index < gWorkerCount; ++index )
+    {
+        Thread* pThread = gWorkerStates[index].mpThread;
+
+        if ( pThread != NULL && ThreadManager::compare( pThread->getId(), currentThreadId ) )
+            return (S32)index;
+    }
+
+    return -1;
+}
+
+//-----------------------------------------------------------------------------
+
+static bool popJob( const S32 workerIndex, JobEntry& job )
+{
+    // Try our own queue first (newest job first as it is likely to be hot in cache).
+    if ( workerIndex >= 0 )
+    {
+        JobWorkerQueue& queue = gWorkerQueues[workerIndex];
+        queue.mLock.lock();
+        if ( !queue.isEmpty() )
+        {
+            job = queue.popBack();
+            queue.mLock.unlock();
+            return true;
+        }
+        queue.mLock.unlock();
+    }
+
+    // Steal from the other queues (oldest job first).
+    const U32 startIndex = workerIndex >= 0 ? (U32)workerIndex + 1 : 0;
+    for ( U32 offset = 0; offset < gWorkerCount; ++offset )
+    {
+        const U32 victimIndex = (startIndex + offset) % gWorkerCount;
+
+        if ( (S32)victimIndex == workerIndex )
+            continue;
+
+        JobWorkerQueue& queue = gWorkerQueues[victimIndex];
+        queue.mLock.lock();
+        if ( !queue.isEmpty() )
+        {
+            job = queue.popFront();
+            queue.mLock.unlock();
+            return true;
+        }
+        queue.mLock.unlock();
+    }
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+
+static void executeJob( const JobEntry& job )
+{
+    job.mFunction( job.mpContext, job.mJobIndex );
+
+    if ( job.mpGroup != NULL )
+        job.mpGroup->removePending();
+
+    JOB_SYSTEM_ATOMIC_DECREMENT( gPendingJobs );
+}
+
+//-----------------------------------------------------------------------------
+
+static void workerThreadFunction( void* pData )
+{
+    JobWorkerState* pState = static_cast<JobWorkerState*>( pData );
+
+    while( true )
+    {
+        // Wait for work.
+        gJobSignal->acquire();
+
+        // Drain any available work.
+        JobEntry job;
+        while( popJob( (S32)pState->mWorkerIndex, job ) )
+        {
+            executeJob( job );
+        }
+
+        // Finish if shutting down.
+        if ( gShutdown )
+            break;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+bool JobSystem::JobGroup::isComplete( void )
+{
+    mLock.lock();
+    const bool complete = mPendingCount == 0;
+    mLock.unlock();
+
+    return complete;
+}
+
+//-----------------------------------------------------------------------------
+
+void JobSystem::JobGroup::addPending( void )
+{
+    mLock.lock();
+    mPendingCount++;
+    mLock.unlock();
+}
+
+//-----------------------------------------------------------------------------
+
+void JobSystem::JobGroup::removePending( void )
+{
+    mLock.lock();
+    AssertFatal( mPendingCount > 0, "JobSystem::JobGroup::removePending() - Pending count underflow." );
+    mPendingCount--;
+    mLock.unlock();
+}
+
+//-----------------------------------------------------------------------------
+
+void JobSystem::init( const U32 workerCount )
+{
+    AssertFatal( gWorkerCount == 0, "JobSystem::init() - Already initialized." );
+
+    // Clamp the worker count.
+    gWorkerCount = getMin( workerCount, (U32)MAX_WORKER_COUNT );
+
+    // Finish if no workers requested.
+    if ( gWorkerCount == 0 )
+        return;
+
+    gShutdown = false;
+    gNextQueue = 0;
+    gPendingJobs = 0;
+    gJobSignal = new Semaphore( 0 );
+    gWorkerQueues = new JobWorkerQueue[gWorkerCount];
+    gWorkerStates = new JobWorkerState[gWorkerCount];
+
+    // Start the workers.
+    for ( U32 index = 0; index < gWorkerCount; ++index )
+    {
+        gWorkerStates[index].mWorkerIndex = index;
+        gWorkerStates[index].mpThread = new Thread( workerThreadFunction, &gWorkerStates[index], false );
+    }
+
+    for ( U32 index = 0; index < gWorkerCount; ++index )
+    {
+        gWorkerStates[index].mpThread->start();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void JobSystem::destroy( void )
+{
+    // Finish if no workers.
+    if ( gWorkerCount == 0 )
+        return;
+
+    // Signal shutdown and wake all the workers.
+    gShutdown = true;
+    for ( U32 index = 0; index < gWorkerCount; ++index )
+        gJobSignal->release();
+
+    // Wait for the workers to finish.
+    for ( U32 index = 0; index < gWorkerCount; ++index )
+    {
+        gWorkerStates[index].mpThread->join();
+        delete gWorkerStates[index].mpThread;
+    }
+
+    delete [] gWorkerStates;
+    delete [] gWorkerQueues;
+    delete gJobSignal;
+
+    gWorkerStates = NULL;
+    gWorkerQueues = NULL;
+    gJobSignal = NULL;
+    gWorkerCount = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 JobSystem::getWorkerCount( void )
+{
+    return gWorkerCount;
+}
+
+//-----------------------------------------------------------------------------
+
+bool JobSystem::isWorkerThread( void )
+{
+    return findWorkerIndex() >= 0;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 JobSystem::getPendingJobCount( void )
+{
+    return gPendingJobs;
+}
+
+//-----------------------------------------------------------------------------
+
+void JobSystem::drain( void )
+{
+    // Sanity!
+    AssertFatal( !isWorkerThread(), "JobSystem::drain() - Cannot drain the job system from a worker thread." );
+
+    // Help out until every submitted job has completed.
+    while( gPendingJobs > 0 )
+    {
+        JobEntry job;
+        if ( popJob( -1, job ) )
+        {
+            executeJob( job );
+            continue;
+        }
+
+        // Nothing left to steal so the remaining jobs are in-flight.
+        Platform::sleep( 0 );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void JobSystem::submit( JobFunction function, void* pContext, const U32 jobIndex, JobGroup* pGroup )
+{
+    // Sanity!
+    AssertFatal( function != NULL, "JobSystem::submit() - Cannot submit a NULL job function." );
+
+    JobEntry job;
+    job.mFunction = function;
+    job.mpContext = pContext;
+    job.mJobIndex = jobIndex;
+    job.mpGroup = pGroup;
+
+    // Execute immediately if we've no workers.
+    if ( gWorkerCount == 0 )
+    {
+        function( pContext, jobIndex );
+        return;
+    }
+
+    if ( pGroup != NULL )
+        pGroup->addPending();
+
+    JOB_SYSTEM_ATOMIC_INCREMENT( gPendingJobs );
+
+    // Workers push onto their own queue, other threads distribute across the workers.
+    const S32 workerIndex = findWorkerIndex();
+    JobWorkerQueue& queue = gWorkerQueues[ workerIndex >= 0 ? (U32)workerIndex : (JOB_SYSTEM_ATOMIC_INCREMENT( gNextQueue ) % gWorkerCount) ];
+
+    queue.mLock.lock();
+    queue.pushBack( job );
+    queue.mLock.unlock();
+
+    // Wake a worker.
+    gJobSignal->release();
+}
+
+//-----------------------------------------------------------------------------
+
+void JobSystem::wait( JobGroup* pGroup )
+{
+    // Sanity!
+    AssertFatal( pGroup != NULL, "JobSystem::wait() - Cannot wait on a NULL group." );
+
+    const S32 workerIndex = findWorkerIndex();
+
+    // Help out until the group has completed.
+    while( !pGroup->isComplete() )
+    {
+        JobEntry job;
+        if ( popJob( workerIndex, job ) )
+        {
+            executeJob( job );
+            continue;
+        }
+
+        // Nothing left to steal so the remaining jobs are in-flight.
+        Platform::sleep( 0 );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void JobSystem::parallelFor( JobFunction function, void* pContext, const U32 jobCount )
+{
+    // Execute inline if there's no benefit from the workers.
+    if ( gWorkerCount == 0 || jobCount <= 1 )
+    {
+        for ( U32 jobIndex = 0; jobIndex < jobCount; ++jobIndex )
+            function( pContext, jobIndex );
+
+        return;
+    }
+
+    JobGroup group;
+
+    for ( U32 jobIndex = 0; jobIndex < jobCount; ++jobIndex )
+        submit( function, pContext, jobIndex, &group );
+
+    wait( &group );
+}
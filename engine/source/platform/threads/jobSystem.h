@@ -0,0 +1,117 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _JOB_SYSTEM_H_
+#define _JOB_SYSTEM_H_
+
+#ifndef _TORQUE_TYPES_H_
+#include "platform/types.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_MUTEX_H_
+#include "platform/threads/mutex.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// A small work-stealing job system.
+///
+/// A fixed pool of worker threads is created at start-up.  Each worker owns a
+/// queue of jobs; a worker takes jobs from the back of its own queue and, when
+/// that is empty, steals from the front of the other workers' queues.  A thread
+/// waiting on a job group helps by executing queued jobs itself so waiting never
+/// idles a core.
+///
+/// If the job system has no workers (not initialized or a worker count of zero)
+/// then all jobs are executed immediately on the submitting thread.
+///
+/// @code
+///   static void integrateChunk( void* pContext, const U32 jobIndex ) { ... }
+///
+///   // Run "chunkCount" jobs and wait for them all to complete.
+///   JobSystem::parallelFor( integrateChunk, pContext, chunkCount );
+/// @endcode
+class JobSystem
+{
+public:
+    /// Job entry point.
+    typedef void (*JobFunction)( void* pContext, const U32 jobIndex );
+
+    /// A group of jobs that can be waited upon.
+    class JobGroup
+    {
+    public:
+        JobGroup() : mPendingCount( 0 ) {}
+        ~JobGroup() { AssertFatal( mPendingCount == 0, "JobSystem::JobGroup - Group destroyed with pending jobs." ); }
+
+        /// Whether all jobs submitted to the group have completed.
+        bool isComplete( void );
+
+        /// Pending job accounting (used by the job system).
+        void addPending( void );
+        void removePending( void );
+
+    private:
+        Mutex   mLock;
+        U32     mPendingCount;
+    };
+
+    enum
+    {
+        /// Default number of worker threads.
+        DEFAULT_WORKER_COUNT = 3,
+
+        /// Maximum number of worker threads.
+        MAX_WORKER_COUNT = 32,
+    };
+
+public:
+    /// Start the worker pool.
+    static void init( const U32 workerCount = DEFAULT_WORKER_COUNT );
+
+    /// Stop the worker pool, waiting for all queued jobs to finish.
+    static void destroy( void );
+
+    /// The number of worker threads (the calling thread is not included).
+    static U32 getWorkerCount( void );
+
+    /// Whether the calling thread is one of the job system workers.
+    static bool isWorkerThread( void );
+
+    /// The number of submitted jobs that have not yet completed.
+    static U32 getPendingJobCount( void );
+
+    /// Block until all submitted jobs have completed, executing queued jobs whilst waiting.
+    /// This must not be called from a worker thread.
+    static void drain( void );
+
+    /// Submit a job for asynchronous execution.  The group may be NULL.
+    static void submit( JobFunction function, void* pContext, const U32 jobIndex, JobGroup* pGroup );
+
+    /// Block until all jobs in the group have completed, executing queued jobs whilst waiting.
+    static void wait( JobGroup* pGroup );
+
+    /// Execute "jobCount" jobs (with indices 0 to jobCount-1) and block until they have all completed.
+    static void parallelFor( JobFunction function, void* pContext, const U32 jobCount );
+};
+
+#endif // _JOB_SYSTEM_H_
@@ -0,0 +1,69 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+ConsoleFunctionGroupBegin( JobSystem, "Job system functionality.");
+
+/*! @defgroup JobSystemFunctions Job System
+	@ingroup TorqueScriptFunctions
+	@{
+*/
+
+/*! Gets the number of job system worker threads.
+    @return The number of worker threads (not including the main thread).
+*/
+ConsoleFunctionWithDocs(getJobSystemWorkerCount, ConsoleInt, 1, 1, ())
+{
+   return JobSystem::getWorkerCount();
+}
+
+/*! Restarts the job system with the specified number of worker threads.
+    Any jobs that are pending are completed before the workers are stopped.
+    @param workerCount The number of worker threads to use.  Zero executes all jobs on the main thread.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs(setJobSystemWorkerCount, ConsoleVoid, 2, 2, (workerCount))
+{
+   const S32 workerCount = dAtoi(argv[1]);
+
+   if ( workerCount < 0 || workerCount > JobSystem::MAX_WORKER_COUNT )
+   {
+      Con::warnf( "setJobSystemWorkerCount() - Invalid worker count '%d' (0-%d).", workerCount, JobSystem::MAX_WORKER_COUNT );
+      return;
+   }
+
+   // Jobs submitted by a worker would be lost so only allow a restart from elsewhere.
+   if ( JobSystem::isWorkerThread() )
+   {
+      Con::warnf( "setJobSystemWorkerCount() - Cannot restart the job system from a worker thread." );
+      return;
+   }
+
+   // Complete any pending jobs before stopping the workers.
+   JobSystem::drain();
+
+   JobSystem::destroy();
+   JobSystem::init( (U32)workerCount );
+}
+
+ConsoleFunctionGroupEnd( JobSystem );
+
+/*! @} */ // group JobSystemFunctions
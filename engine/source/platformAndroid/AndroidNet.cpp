@@ -408,6 +408,16 @@ void Net::closePort()
       close(ipxSocket);
    if(udpSocket != InvalidSocket)
       close(udpSocket);
+   netPort = 0;
+}
+
+S32 Net::getPort()
+{
+   return netPort;
+}
+
+void Net::flushPackets()
+{
 }
 
 Net::Error Net::sendto(const NetAddress *address, const U8 *buffer, S32  bufferSize)
@@ -112,6 +112,7 @@ struct GLState
 
    bool suppPalettedTexture;
    bool suppVertexBuffer;
+   bool suppVertexBufferObject;
    bool suppSwapInterval;
 
    GLint maxFSAASamples;
@@ -225,6 +226,11 @@ inline bool dglDoesSupportVertexBuffer()
    return false;
 }
 
+inline bool dglDoesSupportVertexBufferObject()
+{
+   return gGLState.suppVertexBufferObject;
+}
+
 inline GLfloat dglGetMaxAnisotropy()
 {
    return gGLState.maxAnisotropy;
@@ -135,6 +135,10 @@ void getGLCapabilities( )
       if (dStrstr(pExtString, (const char*)"GL_EXT_vertex_buffer") != NULL)
          gGLState.suppVertexBuffer = true;
 
+     // Buffer objects ========================================
+     // Core since OpenGL 1.5 and OpenGL ES 1.1.
+     gGLState.suppVertexBufferObject = true;
+
       // Anisotropic filtering ========================================
       gGLState.suppTexAnisotropic    = (dStrstr(pExtString, (const char*)"GL_EXT_texture_filter_anisotropic") != NULL);
 
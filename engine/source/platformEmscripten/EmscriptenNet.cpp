@@ -103,6 +103,15 @@ void Net::closePort()
 {
 }
 
+S32 Net::getPort()
+{
+   return netPort;
+}
+
+void Net::flushPackets()
+{
+}
+
 Net::Error Net::sendto(const NetAddress *address, const U8 *buffer, S32  bufferSize)
 {
    return NoError;
@@ -113,6 +113,7 @@ struct GLState
 
    bool suppPalettedTexture;
    bool suppVertexBuffer;
+   bool suppVertexBufferObject;
    bool suppSwapInterval;
 
    GLint maxFSAASamples;
@@ -226,6 +227,11 @@ inline bool dglDoesSupportVertexBuffer()
    return false;
 }
 
+inline bool dglDoesSupportVertexBufferObject()
+{
+   return gGLState.suppVertexBufferObject;
+}
+
 inline GLfloat dglGetMaxAnisotropy()
 {
    return gGLState.maxAnisotropy;
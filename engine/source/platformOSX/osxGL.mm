@@ -225,6 +225,10 @@ void getGLCapabilities()
         // The new extension has a different API, so TGE should be updated to use it.
         if (dStrstr(pExtString, (const char*)"GL_EXT_vertex_buffer") != NULL)
             gGLState.suppVertexBuffer = true;
+
+        // Buffer objects ========================================
+        // Core since OpenGL 1.5 and OpenGL ES 1.1.
+        gGLState.suppVertexBufferObject = true;
         
         // Anisotropic filtering ========================================
         gGLState.suppTexAnisotropic    = (dStrstr(pExtString, (const char*)"GL_EXT_texture_filter_anisotropic") != NULL);
@@ -28,6 +28,7 @@
 #import "platform/platformSemaphore.h"
 #import "platform/threads/mutex.h"
 #import "console/console.h"
+#import "debug/profilerTrace.h"
 
 //-----------------------------------------------------------------------------
 
@@ -60,6 +61,11 @@ static void *ThreadRunHandler( void* arg )
     NSAutoreleasePool *pool = [[NSAutoreleasePool alloc] init];
     thread->run(mData->mRunArg);
     [pool drain];
+
+#ifdef TORQUE_ENABLE_PROFILER
+    // Release the thread's profiler trace buffer.
+    ProfilerTrace::releaseThread();
+#endif
     
     // Release the thread.
     mData->mGateway.release();
@@ -75,6 +75,7 @@ struct GLState
    bool suppTexAnisotropic;
    bool suppPalettedTexture;
    bool suppVertexBuffer;
+   bool suppVertexBufferObject;
    bool suppSwapInterval;
 
    unsigned int triCount[4];
@@ -185,6 +186,11 @@ inline bool dglDoesSupportVertexBuffer()
    return gGLState.suppVertexBuffer;
 }
 
+inline bool dglDoesSupportVertexBufferObject()
+{
+   return gGLState.suppVertexBufferObject;
+}
+
 inline GLfloat dglGetMaxAnisotropy()
 {
    return gGLState.maxAnisotropy;
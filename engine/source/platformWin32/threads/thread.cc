@@ -24,6 +24,7 @@
 #include "platform/threads/semaphore.h"
 #include "platformWin32/platformWin32.h"
 #include "memory/safeDelete.h"
+#include "debug/profilerTrace.h"
 
 #include <process.h> // [tom, 4/20/2006] for _beginthread()
 
@@ -67,6 +68,9 @@ static void ThreadRunHandler(void * arg)
    
    ThreadManager::addThread(mData->mThread);
    mData->mThread->run(mData->mRunArg);
+#ifdef TORQUE_ENABLE_PROFILER
+   ProfilerTrace::releaseThread();
+#endif
    ThreadManager::removeThread(mData->mThread);
 
    // we could delete the Thread here, if it wants to be auto-deleted...
@@ -54,7 +54,8 @@ enum {
    EXT_paletted_texture          = BIT(4),
    NV_vertex_array_range         = BIT(5),
    EXT_blend_color               = BIT(6),
-   EXT_blend_minmax              = BIT(7)
+   EXT_blend_minmax              = BIT(7),
+   ARB_vertex_buffer_object      = BIT(8)
 };
 
 //WGL_ARB
@@ -460,6 +461,19 @@ bool GL_EXT_Init( )
       gGLState.suppEXTblendminmax = false;
    }
 
+   // ARB_vertex_buffer_object (only the core OpenGL 1.5 entry points are bound)
+   const char* pVersionString = (const char*)glGetString(GL_VERSION);
+   S32 glMajorVersion = 0, glMinorVersion = 0;
+   if (pVersionString)
+      dSscanf(pVersionString, "%d.%d", &glMajorVersion, &glMinorVersion);
+   if (glMajorVersion > 1 || (glMajorVersion == 1 && glMinorVersion >= 5))
+   {
+      extBitMask |= ARB_vertex_buffer_object;
+      gGLState.suppVertexBufferObject = true;
+   } else {
+      gGLState.suppVertexBufferObject = false;
+   }
+
    // EXT_fog_coord
    if (pExtString && dStrstr(pExtString, (const char*)"GL_EXT_fog_coord") != NULL)
    {
@@ -550,6 +564,7 @@ bool GL_EXT_Init( )
    if (gGLState.suppEXTblendminmax)       Con::printf("  EXT_blend_minmax");
    if (gGLState.suppPalettedTexture)      Con::printf("  EXT_paletted_texture");
    if (gGLState.suppLockedArrays)         Con::printf("  EXT_compiled_vertex_array");
+   if (gGLState.suppVertexBufferObject)   Con::printf("  ARB_vertex_buffer_object");
    if (gGLState.suppVertexArrayRange)     Con::printf("  NV_vertex_array_range");
    if (gGLState.suppTextureEnvCombine)    Con::printf("  EXT_texture_env_combine");
    if (gGLState.suppPackedPixels)         Con::printf("  EXT_packed_pixels");
@@ -567,6 +582,7 @@ bool GL_EXT_Init( )
    if (!gGLState.suppEXTblendminmax)     Con::warnf("  EXT_blend_minmax");
    if (!gGLState.suppPalettedTexture)    Con::warnf("  EXT_paletted_texture");
    if (!gGLState.suppLockedArrays)       Con::warnf("  EXT_compiled_vertex_array");
+   if (!gGLState.suppVertexBufferObject) Con::warnf("  ARB_vertex_buffer_object");
    if (!gGLState.suppVertexArrayRange)   Con::warnf("  NV_vertex_array_range");
    if (!gGLState.suppTextureEnvCombine)  Con::warnf("  EXT_texture_env_combine");
    if (!gGLState.suppPackedPixels)       Con::warnf("  EXT_packed_pixels");
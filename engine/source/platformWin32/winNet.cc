@@ -510,6 +510,16 @@ void Net::closePort()
       closesocket(ipxSocket);
    if(udpSocket != INVALID_SOCKET)
       closesocket(udpSocket);
+   netPort = 0;
+}
+
+S32 Net::getPort()
+{
+   return netPort;
+}
+
+void Net::flushPackets()
+{
 }
 
 Net::Error Net::sendto(const NetAddress *address, const U8 *buffer, S32 bufferSize)
@@ -25,6 +25,8 @@
 #ifndef _X86UNIX_GL_TYPES_H_
 #define _X86UNIX_GL_TYPES_H_
 
+#include <stddef.h>
+
 // added by JMQ:
 #define GL_TEXTURE_MAX_ANISOTROPY_EXT     0x84FE
 #define GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT 0x84FF
@@ -171,6 +173,8 @@ typedef float		GLfloat;	/* single precision float */
 typedef float		GLclampf;	/* single precision float in [0,1] */
 typedef double		GLdouble;	/* double precision float */
 typedef double		GLclampd;	/* double precision float in [0,1] */
+typedef ptrdiff_t	GLsizeiptr;	/* buffer object size */
+typedef ptrdiff_t	GLintptr;	/* buffer object offset */
 
 
 
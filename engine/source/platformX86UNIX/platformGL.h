@@ -81,6 +81,7 @@ struct GLState
    bool suppTexAnisotropic;
    bool suppPalettedTexture;
         bool suppVertexBuffer;
+        bool suppVertexBufferObject;
    bool suppSwapInterval;
    unsigned int triCount[4];
    unsigned int primCount[4];
@@ -188,6 +189,11 @@ inline bool dglDoesSupportVertexBuffer()
         return gGLState.suppVertexBuffer;
 }
 
+inline bool dglDoesSupportVertexBufferObject()
+{
+        return gGLState.suppVertexBufferObject;
+}
+
 inline GLfloat dglGetMaxAnisotropy()
 {
    return gGLState.maxAnisotropy;
@@ -47,6 +47,11 @@
 #include <netipx/ipx.h>
 #include <stdlib.h>
 
+/* for recvmmsg()/sendmmsg() */
+#if defined(__linux__)
+#define TORQUE_NET_BATCHED_IO
+#endif
+
 #include "console/console.h"
 #include "game/gameInterface.h"
 #include "io/fileStream.h"
@@ -58,6 +63,31 @@ static S32 netPort = 0;
 static int ipxSocket = InvalidSocket;
 static int udpSocket = InvalidSocket;
 
+#ifdef TORQUE_NET_BATCHED_IO
+// The UDP socket is drained (and written) in batches of datagrams per system call.
+// The receive batch is a ring of packet events which are filled in place by recvmmsg()
+// and dispatched without being copied onto the event queue.  Outgoing datagrams are
+// queued into the send batch and written by sendmmsg() when Net::flushPackets() is
+// called or the batch is full.
+enum { PacketBatchSize = 64 };
+
+// The socket buffer holds the bursts of datagrams that arrive between frames.
+static const S32 UDPBufferSize = 256 * 1024;
+
+static PacketReceiveEvent gReceiveBatch[PacketBatchSize];
+static sockaddr_in gReceiveAddresses[PacketBatchSize];
+static iovec gReceiveVectors[PacketBatchSize];
+static mmsghdr gReceiveHeaders[PacketBatchSize];
+
+static U8 gSendBuffers[PacketBatchSize][MaxPacketDataSize];
+static sockaddr_in gSendAddresses[PacketBatchSize];
+static iovec gSendVectors[PacketBatchSize];
+static mmsghdr gSendHeaders[PacketBatchSize];
+static U32 gSendCount = 0;
+#else
+static const S32 UDPBufferSize = 32768;
+#endif
+
 // local enum for socket states for polled sockets
 enum SocketState
 {
@@ -142,32 +172,99 @@ static void netToIPSocketAddress(const NetAddress *address, struct sockaddr_in *
    dMemset(sockAddr, 0, sizeof(struct sockaddr_in));
    sockAddr->sin_family = AF_INET;
    sockAddr->sin_port = htons(address->port);
-   char tAddr[20];
-   dSprintf(tAddr, 20, "%d.%d.%d.%d\n", address->netNum[0], address->netNum[1], address->netNum[2], address->netNum[3]);
-//fprintf(stdout,"netToIPSocketAddress(): %s\n",tAddr);fflush(NULL);
-   sockAddr->sin_addr.s_addr = inet_addr(tAddr);
-//   sockAddr->sin_addr.s_addr = address->netNum[0];  // hopefully this will work.
+   // The address is stored in network order, the same as the net number.
+   dMemcpy(&sockAddr->sin_addr.s_addr, address->netNum, 4);
 }
 
 static void IPSocketToNetAddress(const struct sockaddr_in *sockAddr, NetAddress *address)
 {
    address->type = NetAddress::IPAddress;
    address->port = htons(sockAddr->sin_port);
-   char *tAddr;
-   tAddr = inet_ntoa(sockAddr->sin_addr);
-//fprintf(stdout,"IPSocketToNetAddress(): %s\n",tAddr);fflush(NULL);
-   U8 nets[4];
-   nets[0] = atoi(strtok(tAddr, "."));
-   nets[1] = atoi(strtok(NULL, "."));
-   nets[2] = atoi(strtok(NULL, "."));
-   nets[3] = atoi(strtok(NULL, "."));
-//fprintf(stdout,"0 = %d, 1 = %d, 2 = %d, 3 = %d\n", nets[0], nets[1], nets[2], nets[3]);
-   address->netNum[0] = nets[0];
-   address->netNum[1] = nets[1];
-   address->netNum[2] = nets[2];
-   address->netNum[3] = nets[3];
+   // The address is stored in network order, the same as the net number.
+   dMemcpy(address->netNum, &sockAddr->sin_addr.s_addr, 4);
+}
+
+static bool isOwnAddress(const NetAddress *address)
+{
+   return address->type == NetAddress::IPAddress &&
+      address->netNum[0] == 127 &&
+      address->netNum[1] == 0 &&
+      address->netNum[2] == 0 &&
+      address->netNum[3] == 1 &&
+      address->port == netPort;
+}
+
+#ifdef TORQUE_NET_BATCHED_IO
+static void initPacketBatches()
+{
+   for(U32 i = 0; i < PacketBatchSize; i++)
+   {
+      gReceiveVectors[i].iov_base = gReceiveBatch[i].data;
+      gReceiveVectors[i].iov_len = MaxPacketDataSize;
+      dMemset(&gReceiveHeaders[i], 0, sizeof(mmsghdr));
+      gReceiveHeaders[i].msg_hdr.msg_name = &gReceiveAddresses[i];
+      gReceiveHeaders[i].msg_hdr.msg_iov = &gReceiveVectors[i];
+      gReceiveHeaders[i].msg_hdr.msg_iovlen = 1;
+
+      gSendVectors[i].iov_base = gSendBuffers[i];
+      dMemset(&gSendHeaders[i], 0, sizeof(mmsghdr));
+      gSendHeaders[i].msg_hdr.msg_name = &gSendAddresses[i];
+      gSendHeaders[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+      gSendHeaders[i].msg_hdr.msg_iov = &gSendVectors[i];
+      gSendHeaders[i].msg_hdr.msg_iovlen = 1;
+   }
+   gSendCount = 0;
+}
+
+static void dispatchPacket(PacketReceiveEvent &event)
+{
+#ifdef TORQUE_ALLOW_JOURNALING
+   // The journal records (and plays back) packets from the event queue.
+   if(Game->isJournalWriting() || Game->isJournalReading())
+   {
+      Game->postEvent(event);
+      return;
+   }
+#endif //TORQUE_ALLOW_JOURNALING
+
+   Game->processPacketReceiveEvent(&event);
 }
 
+static void processBatchedReceive()
+{
+   PROFILE_SCOPE(NetBatchedReceive);
+
+   for(;;)
+   {
+      for(U32 i = 0; i < PacketBatchSize; i++)
+         gReceiveHeaders[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+
+      S32 packetCount = recvmmsg(udpSocket, gReceiveHeaders, PacketBatchSize, MSG_DONTWAIT, NULL);
+      if(packetCount <= 0)
+         break;
+
+      for(S32 i = 0; i < packetCount; i++)
+      {
+         PacketReceiveEvent &event = gReceiveBatch[i];
+         const U32 bytesRead = gReceiveHeaders[i].msg_len;
+         if(bytesRead == 0 || gReceiveAddresses[i].sin_family != AF_INET)
+            continue;
+
+         IPSocketToNetAddress(&gReceiveAddresses[i], &event.sourceAddress);
+         if(isOwnAddress(&event.sourceAddress))
+            continue;
+
+         event.size = PacketReceiveEventHeaderSize + bytesRead;
+         dispatchPacket(event);
+      }
+
+      // A partial batch means the socket is drained.
+      if(packetCount < PacketBatchSize)
+         break;
+   }
+}
+#endif
+
 static void netToIPXSocketAddress(const NetAddress *address, sockaddr_ipx *sockAddr)
 {
 #if !defined(__FreeBSD__)
@@ -363,7 +460,7 @@ bool Net::openPort(S32 port)
       Net::Error error;
       error = bind(udpSocket, port);
       if(error == NoError)
-         error = setBufferSize(udpSocket, 32768);
+         error = setBufferSize(udpSocket, UDPBufferSize);
       if(error == NoError)
          error = setBroadcast(udpSocket, true);
       if(error == NoError)
@@ -403,15 +500,53 @@ bool Net::openPort(S32 port)
       }
    }
    netPort = port;
+#ifdef TORQUE_NET_BATCHED_IO
+   initPacketBatches();
+#endif
    return ipxSocket != InvalidSocket || udpSocket != InvalidSocket;
 }
 
 void Net::closePort()
 {
+   // Write any queued datagrams (such as disconnect packets) before the socket goes.
+   flushPackets();
    if(ipxSocket != InvalidSocket)
       close(ipxSocket);
    if(udpSocket != InvalidSocket)
       close(udpSocket);
+   ipxSocket = InvalidSocket;
+   udpSocket = InvalidSocket;
+   netPort = 0;
+}
+
+S32 Net::getPort()
+{
+   return netPort;
+}
+
+void Net::flushPackets()
+{
+#ifdef TORQUE_NET_BATCHED_IO
+   if(gSendCount == 0)
+      return;
+
+   PROFILE_SCOPE(NetFlushPackets);
+
+   U32 sent = 0;
+   while(sent < gSendCount && udpSocket != InvalidSocket)
+   {
+      S32 count = sendmmsg(udpSocket, gSendHeaders + sent, gSendCount - sent, 0);
+      if(count > 0)
+         sent += count;
+      else if(count == -1 && errno == EINTR)
+         continue;
+      else
+         break;
+   }
+
+   // Unreliable datagrams that couldn't be written are dropped, the same as a failed sendto().
+   gSendCount = 0;
+#endif
 }
 
 Net::Error Net::sendto(const NetAddress *address, const U8 *buffer, S32 bufferSize)
@@ -433,6 +568,20 @@ Net::Error Net::sendto(const NetAddress *address, const U8 *buffer, S32 bufferSi
    }
    else
    {
+#ifdef TORQUE_NET_BATCHED_IO
+      if(bufferSize <= MaxPacketDataSize)
+      {
+         // Queue the datagram to be written with the rest of the batch.
+         if(gSendCount == PacketBatchSize)
+            flushPackets();
+
+         netToIPSocketAddress(address, &gSendAddresses[gSendCount]);
+         dMemcpy(gSendBuffers[gSendCount], buffer, bufferSize);
+         gSendVectors[gSendCount].iov_len = bufferSize;
+         gSendCount++;
+         return NoError;
+      }
+#endif
       sockaddr_in ipAddr;
       netToIPSocketAddress(address, &ipAddr);
       if(::sendto(udpSocket, (const char*)buffer, bufferSize, 0,
@@ -447,13 +596,20 @@ void Net::process()
 {
    sockaddr sa;
 
+#ifdef TORQUE_NET_BATCHED_IO
+   if(udpSocket != InvalidSocket)
+      processBatchedReceive();
+#endif
+
    PacketReceiveEvent receiveEvent;
    for(;;)
    {
       U32 addrLen = sizeof(sa);
       S32 bytesRead = -1;
+#ifndef TORQUE_NET_BATCHED_IO
       if(udpSocket != InvalidSocket)
          bytesRead = recvfrom(udpSocket, (char *) receiveEvent.data, MaxPacketDataSize, 0, &sa, &addrLen);
+#endif
       if(bytesRead == -1 && ipxSocket != InvalidSocket)
       {
          addrLen = sizeof(sa);
@@ -470,13 +626,7 @@ void Net::process()
       else
          continue;
          
-      NetAddress &na = receiveEvent.sourceAddress;
-      if(na.type == NetAddress::IPAddress &&
-         na.netNum[0] == 127 &&
-         na.netNum[1] == 0 &&
-         na.netNum[2] == 0 &&
-         na.netNum[3] == 1 &&
-         na.port == netPort)
+      if(isOwnAddress(&receiveEvent.sourceAddress))
          continue;
       if(bytesRead <= 0)
          continue;
@@ -484,6 +634,9 @@ void Net::process()
       Game->postEvent(receiveEvent);
    }
 
+   // Write any replies queued while processing the packets.
+   flushPackets();
+
    // process the polled sockets.  This blob of code performs functions
    // similar to WinsockProc in winNet.cc
 
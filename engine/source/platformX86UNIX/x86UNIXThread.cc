@@ -24,6 +24,7 @@
 #include "platform/threads/thread.h"
 #include "platformX86UNIX/platformX86UNIX.h"
 #include "platform/platformSemaphore.h"
+#include "debug/profilerTrace.h"
 
 //--------------------------------------------------------------------------
 struct PlatformThreadData
@@ -79,6 +80,9 @@ static void *ThreadRunHandler(void * arg)
    
    ThreadManager::addThread(thread);
    thread->run(mData->mRunArg);
+#ifdef TORQUE_ENABLE_PROFILER
+   ProfilerTrace::releaseThread();
+#endif
    ThreadManager::removeThread(thread);
 
    bool autoDelete = thread->autoDelete;
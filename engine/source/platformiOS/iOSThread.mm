@@ -26,6 +26,7 @@
 #include "platform/threads/mutex.h"
 #include "platform/platformTLS.h"
 #include "memory/safeDelete.h"
+#include "debug/profilerTrace.h"
 #include <stdlib.h>
 
 struct PlatformThreadData
@@ -51,6 +52,9 @@ static void *ThreadRunHandler(void * arg)
       mData->mThreadID = ThreadManager::getCurrentThreadId();
       ThreadManager::addThread(thread);
       thread->run(mData->mRunArg);
+#ifdef TORQUE_ENABLE_PROFILER
+      ProfilerTrace::releaseThread();
+#endif
    	}
 	mData->mGateway.release();
    // we could delete the Thread here, if it wants to be auto-deleted...
@@ -127,6 +127,7 @@ struct GLState
 
    bool suppPalettedTexture;
    bool suppVertexBuffer;
+   bool suppVertexBufferObject;
    bool suppSwapInterval;
 
    GLint maxFSAASamples;
@@ -240,6 +241,11 @@ inline bool dglDoesSupportVertexBuffer()
    return false;
 }
 
+inline bool dglDoesSupportVertexBufferObject()
+{
+   return gGLState.suppVertexBufferObject;
+}
+
 inline GLfloat dglGetMaxAnisotropy()
 {
    return gGLState.maxAnisotropy;
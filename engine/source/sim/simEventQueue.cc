@@ -0,0 +1,219 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "platform/platform.h"
+#include "sim/simEventQueue.h"
+
+//---------------------------------------------------------------------------
+
+SimEventQueue::SimEventQueue()
+{
+   VECTOR_SET_ASSOCIATION( mHeap );
+}
+
+//---------------------------------------------------------------------------
+
+SimEventQueue::~SimEventQueue()
+{
+   clear();
+}
+
+//---------------------------------------------------------------------------
+
+void SimEventQueue::setHeapEntry( const U32 index, SimEvent* pEvent )
+{
+   mHeap[index] = pEvent;
+   pEvent->queueIndex = (S32)index;
+}
+
+//---------------------------------------------------------------------------
+
+void SimEventQueue::siftUp( U32 index )
+{
+   SimEvent* pEvent = mHeap[index];
+
+   while( index > 0 )
+   {
+      const U32 parentIndex = (index - 1) >> 1;
+      SimEvent* pParent = mHeap[parentIndex];
+
+      if ( !isBefore( pEvent, pParent ) )
+         break;
+
+      setHeapEntry( index, pParent );
+      index = parentIndex;
+   }
+
+   setHeapEntry( index, pEvent );
+}
+
+//---------------------------------------------------------------------------
+
+void SimEventQueue::siftDown( U32 index )
+{
+   const U32 count = (U32)mHeap.size();
+   SimEvent* pEvent = mHeap[index];
+
+   while( true )
+   {
+      U32 childIndex = (index << 1) + 1;
+      if ( childIndex >= count )
+         break;
+
+      // Pick the earliest child.
+      if ( childIndex + 1 < count && isBefore( mHeap[childIndex + 1], mHeap[childIndex] ) )
+         childIndex++;
+
+      if ( !isBefore( mHeap[childIndex], pEvent ) )
+         break;
+
+      setHeapEntry( index, mHeap[childIndex] );
+      index = childIndex;
+   }
+
+   setHeapEntry( index, pEvent );
+}
+
+//---------------------------------------------------------------------------
+
+void SimEventQueue::removeAt( const U32 index )
+{
+   SimEvent* pEvent = mHeap[index];
+
+   // Remove the event lookups.
+   mSequenceLookup.erase( pEvent->sequenceCount );
+
+   typeObjectCountHash::iterator countItr = mObjectEventCounts.find( pEvent->destObject );
+   AssertFatal( countItr != mObjectEventCounts.end(), "SimEventQueue::removeAt() - Object event count is missing." );
+   if ( --countItr->value == 0 )
+      mObjectEventCounts.erase( countItr );
+
+   pEvent->queueIndex = -1;
+
+   // Move the last event into the vacated slot.
+   const U32 lastIndex = (U32)mHeap.size() - 1;
+   SimEvent* pLastEvent = mHeap[lastIndex];
+   mHeap.pop_back();
+
+   if ( index == lastIndex )
+      return;
+
+   setHeapEntry( index, pLastEvent );
+
+   // Restore the heap order.
+   if ( index > 0 && isBefore( pLastEvent, mHeap[(index - 1) >> 1] ) )
+      siftUp( index );
+   else
+      siftDown( index );
+}
+
+//---------------------------------------------------------------------------
+
+void SimEventQueue::push( SimEvent* pEvent )
+{
+   // Sanity!
+   AssertFatal( pEvent != NULL, "SimEventQueue::push() - Cannot push a NULL event." );
+   AssertFatal( pEvent->queueIndex == -1, "SimEventQueue::push() - Event is already queued." );
+
+   mSequenceLookup.insertUnique( pEvent->sequenceCount, pEvent );
+   mObjectEventCounts.findOrInsert( pEvent->destObject )->value++;
+
+   mHeap.push_back( pEvent );
+   siftUp( (U32)mHeap.size() - 1 );
+}
+
+//---------------------------------------------------------------------------
+
+SimEvent* SimEventQueue::pop( void )
+{
+   if ( mHeap.size() == 0 )
+      return NULL;
+
+   SimEvent* pEvent = mHeap[0];
+   removeAt( 0 );
+
+   return pEvent;
+}
+
+//---------------------------------------------------------------------------
+
+SimEvent* SimEventQueue::find( const U32 sequenceCount )
+{
+   typeSequenceHash::iterator itr = mSequenceLookup.find( sequenceCount );
+
+   return itr == mSequenceLookup.end() ? NULL : itr->value;
+}
+
+//---------------------------------------------------------------------------
+
+void SimEventQueue::remove( SimEvent* pEvent )
+{
+   // Sanity!
+   AssertFatal( pEvent != NULL, "SimEventQueue::remove() - Cannot remove a NULL event." );
+   AssertFatal( pEvent->queueIndex >= 0 && pEvent->queueIndex < mHeap.size() && mHeap[pEvent->queueIndex] == pEvent,
+      "SimEventQueue::remove() - Event is not in the queue." );
+
+   removeAt( (U32)pEvent->queueIndex );
+}
+
+//---------------------------------------------------------------------------
+
+void SimEventQueue::deleteObjectEvents( SimObject* pObject )
+{
+   // Finish if the object has no pending events.
+   if ( mObjectEventCounts.find( pObject ) == mObjectEventCounts.end() )
+      return;
+
+   // Remove the object events.
+   // NOTE: Iterate backwards as removal only ever moves events from later in the heap.
+   for( S32 index = mHeap.size() - 1; index >= 0; --index )
+   {
+      if ( index >= mHeap.size() )
+         continue;
+
+      SimEvent* pEvent = mHeap[index];
+
+      if ( pEvent->destObject != pObject )
+         continue;
+
+      removeAt( (U32)index );
+      delete pEvent;
+
+      // Revisit this slot as another event may have moved into it.
+      index++;
+   }
+}
+
+//---------------------------------------------------------------------------
+
+void SimEventQueue::clear( void )
+{
+   for( S32 index = 0; index < mHeap.size(); ++index )
+   {
+      mHeap[index]->queueIndex = -1;
+      delete mHeap[index];
+   }
+
+   mHeap.clear();
+   mSequenceLookup.clear();
+   mObjectEventCounts.clear();
+}
@@ -0,0 +1,104 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SIM_EVENT_QUEUE_H_
+#define _SIM_EVENT_QUEUE_H_
+
+#ifndef _SIM_EVENT_H_
+#include "sim/simEvent.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+#ifndef _HASHTABLE_H
+#include "collection/hashTable.h"
+#endif
+
+//---------------------------------------------------------------------------
+
+/// Priority queue of pending SimEvents.
+///
+/// Events are ordered by their scheduled time and then by their sequence
+/// count so events scheduled for the same time are dispatched in the order
+/// they were posted.  The queue is an indexed binary heap; each event stores
+/// its heap position so posting, popping and cancelling are all O(log n).
+/// Events are also indexed by sequence count so they can be found without
+/// walking the queue.
+///
+/// The queue owns the events it holds and deletes any remaining events when
+/// it is cleared or destroyed.  It does no locking of its own.
+class SimEventQueue
+{
+private:
+   typedef HashTable<U32, SimEvent*> typeSequenceHash;
+   typedef HashTable<SimObject*, U32> typeObjectCountHash;
+
+   Vector<SimEvent*>    mHeap;
+   typeSequenceHash     mSequenceLookup;
+   typeObjectCountHash  mObjectEventCounts;
+
+   static inline bool isBefore( const SimEvent* pEventA, const SimEvent* pEventB )
+   {
+      if ( pEventA->time != pEventB->time )
+         return pEventA->time < pEventB->time;
+
+      // Compare sequence counts allowing for them wrapping.
+      return (S32)(pEventA->sequenceCount - pEventB->sequenceCount) < 0;
+   }
+
+   void siftUp( U32 index );
+   void siftDown( U32 index );
+   void setHeapEntry( const U32 index, SimEvent* pEvent );
+   void removeAt( const U32 index );
+
+public:
+   SimEventQueue();
+   ~SimEventQueue();
+
+   /// Add an event to the queue.  The event time and sequence count must already be set.
+   void push( SimEvent* pEvent );
+
+   /// The next event to be dispatched or NULL if the queue is empty.
+   inline SimEvent* peek( void ) const { return mHeap.size() > 0 ? mHeap[0] : NULL; }
+
+   /// Remove and return the next event to be dispatched or NULL if the queue is empty.
+   SimEvent* pop( void );
+
+   /// Find a pending event by its sequence count.
+   SimEvent* find( const U32 sequenceCount );
+
+   /// Remove a pending event from the queue.  The event is not deleted.
+   void remove( SimEvent* pEvent );
+
+   /// Remove and delete all the pending events for the specified object.
+   void deleteObjectEvents( SimObject* pObject );
+
+   /// Remove and delete all the pending events.
+   void clear( void );
+
+   inline U32 size( void ) const { return (U32)mHeap.size(); }
+   inline bool isEmpty( void ) const { return mHeap.size() == 0; }
+};
+
+#endif // _SIM_EVENT_QUEUE_H_
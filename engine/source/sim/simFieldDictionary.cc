@@ -49,6 +49,61 @@ void SimFieldDictionary::freeEntry(SimFieldDictionary::Entry *ent)
    mFreeList = ent;
 }
 
+//-----------------------------------------------------------------------------
+
+// The size of the text buffer of a field set from a number.
+static const U32 NumberTextSize = 32;
+
+static void reserveEntryText(SimFieldDictionary::Entry *entry, U32 size)
+{
+   if(entry->valueSize >= size)
+      return;
+
+   dFree(entry->value);
+   entry->value = (char *) dMalloc(size);
+   entry->valueSize = size;
+}
+
+const char *SimFieldDictionary::Entry::getValue()
+{
+   if(!(validFlags & TextValid))
+   {
+      // Format the number the same way the string stack does.
+      reserveEntryText(this, NumberTextSize);
+      if(validFlags & IntValid)
+         dSprintf(value, valueSize, "%d", intValue);
+      else
+         dSprintf(value, valueSize, "%.9g", floatValue);
+
+      validFlags |= TextValid;
+   }
+
+   return value;
+}
+
+S32 SimFieldDictionary::Entry::getIntValue()
+{
+   if(!(validFlags & IntValid))
+   {
+      // Always go through the text so a float value converts as it always has.
+      intValue = dAtoi(getValue());
+      validFlags |= IntValid;
+   }
+
+   return intValue;
+}
+
+F32 SimFieldDictionary::Entry::getFloatValue()
+{
+   if(!(validFlags & FloatValid))
+   {
+      floatValue = dAtof(getValue());
+      validFlags |= FloatValid;
+   }
+
+   return (F32)floatValue;
+}
+
 SimFieldDictionary::SimFieldDictionary()
 {
    for(U32 i = 0; i < HashTableSize; i++)
@@ -72,16 +127,49 @@ SimFieldDictionary::~SimFieldDictionary()
    }
 }
 
-void SimFieldDictionary::setFieldValue(StringTableEntry slotName, const char *value)
+SimFieldDictionary::Entry *SimFieldDictionary::findEntry(StringTableEntry slotName)
+{
+   U32 bucket = HashPointer(slotName) % HashTableSize;
+
+   for(Entry *walk = mHashTable[bucket];walk;walk = walk->next)
+      if(walk->slotName == slotName)
+         return walk;
+
+   return NULL;
+}
+
+SimFieldDictionary::Entry *SimFieldDictionary::findOrCreateEntry(StringTableEntry slotName)
 {
    U32 bucket = HashPointer(slotName) % HashTableSize;
    Entry **walk = &mHashTable[bucket];
    while(*walk && (*walk)->slotName != slotName)
       walk = &((*walk)->next);
 
-   Entry *field = *walk;
+   if(*walk)
+      return *walk;
+
+   mVersion++;
+
+   Entry *field = allocEntry();
+   field->slotName = slotName;
+   field->value = NULL;
+   field->valueSize = 0;
+   field->validFlags = 0;
+   field->next = NULL;
+   *walk = field;
+   return field;
+}
+
+void SimFieldDictionary::setFieldValue(StringTableEntry slotName, const char *value)
+{
    if(!*value)
    {
+      U32 bucket = HashPointer(slotName) % HashTableSize;
+      Entry **walk = &mHashTable[bucket];
+      while(*walk && (*walk)->slotName != slotName)
+         walk = &((*walk)->next);
+
+      Entry *field = *walk;
       if(field)
       {
          mVersion++;
@@ -93,35 +181,47 @@ void SimFieldDictionary::setFieldValue(StringTableEntry slotName, const char *va
    }
    else
    {
-      if(field)
-      {
-         dFree(field->value);
-         field->value = dStrdup(value);
-      }
-      else
-      {
-         mVersion++;
+      Entry *field = findOrCreateEntry(slotName);
 
-         field = allocEntry();
-         field->value = dStrdup(value);
-         field->slotName = slotName;
-         field->next = NULL;
-         *walk = field;
-      }
+      // Keep the text buffer if the value fits.
+      reserveEntryText(field, dStrlen(value) + 1);
+      dStrcpy(field->value, value);
+      field->validFlags = Entry::TextValid;
    }
 }
 
-const char *SimFieldDictionary::getFieldValue(StringTableEntry slotName)
+void SimFieldDictionary::setFieldIntValue(StringTableEntry slotName, const S32 value)
 {
-   U32 bucket = HashPointer(slotName) % HashTableSize;
+   Entry *field = findOrCreateEntry(slotName);
+   field->intValue = value;
+   field->floatValue = (F64)value;
+   field->validFlags = Entry::IntValid | Entry::FloatValid;
+}
 
-   for(Entry *walk = mHashTable[bucket];walk;walk = walk->next)
-      if(walk->slotName == slotName)
-         return walk->value;
+void SimFieldDictionary::setFieldFloatValue(StringTableEntry slotName, const F64 value)
+{
+   Entry *field = findOrCreateEntry(slotName);
+   field->floatValue = value;
+   field->validFlags = Entry::FloatValid;
+}
 
-   return NULL;
+const char *SimFieldDictionary::getFieldValue(StringTableEntry slotName)
+{
+   Entry *field = findEntry(slotName);
+   return field ? field->getValue() : NULL;
+}
+
+S32 SimFieldDictionary::getFieldIntValue(StringTableEntry slotName)
+{
+   Entry *field = findEntry(slotName);
+   return field ? field->getIntValue() : 0;
 }
 
+F32 SimFieldDictionary::getFieldFloatValue(StringTableEntry slotName)
+{
+   Entry *field = findEntry(slotName);
+   return field ? field->getFloatValue() : 0.0f;
+}
 
 void SimFieldDictionary::assignFrom(SimFieldDictionary *dict)
 {
@@ -129,7 +229,7 @@ void SimFieldDictionary::assignFrom(SimFieldDictionary *dict)
 
    for(U32 i = 0; i < HashTableSize; i++)
       for(Entry *walk = dict->mHashTable[i];walk; walk = walk->next)
-         setFieldValue(walk->slotName, walk->value);
+         setFieldValue(walk->slotName, walk->getValue());
 }
 
 static S32 QSORT_CALLBACK compareEntries(const void* a,const void* b)
@@ -159,7 +259,7 @@ void SimFieldDictionary::writeFields(SimObject *obj, Stream &stream, U32 tabStop
             continue;
 
 
-         if (!obj->writeField(walk->slotName, walk->value))
+         if (!obj->writeField(walk->slotName, walk->getValue()))
             continue;
 
          flist.push_back(walk);
@@ -172,13 +272,13 @@ void SimFieldDictionary::writeFields(SimObject *obj, Stream &stream, U32 tabStop
    // Save them out
    for(Vector<Entry *>::iterator itr = flist.begin(); itr != flist.end(); itr++)
    {
-      U32 nBufferSize = (dStrlen( (*itr)->value ) * 2) + dStrlen( (*itr)->slotName ) + 16;
+      U32 nBufferSize = (dStrlen( (*itr)->getValue() ) * 2) + dStrlen( (*itr)->slotName ) + 16;
       FrameTemp<char> expandedBuffer( nBufferSize );
 
       stream.writeTabs(tabStop+1);
 
       dSprintf(expandedBuffer, nBufferSize, "%s = \"", (*itr)->slotName);
-      expandEscape((char*)expandedBuffer + dStrlen(expandedBuffer), (*itr)->value);
+      expandEscape((char*)expandedBuffer + dStrlen(expandedBuffer), (*itr)->getValue());
       dStrcat(expandedBuffer, "\";\r\n");
 
       stream.write(dStrlen(expandedBuffer),expandedBuffer);
@@ -212,7 +312,7 @@ void SimFieldDictionary::printFields(SimObject *obj)
    for(Vector<Entry *>::iterator itr = flist.begin(); itr != flist.end(); itr++)
    {
       dSprintf(expandedBuffer, sizeof(expandedBuffer), "  %s = \"", (*itr)->slotName);
-      expandEscape(expandedBuffer + dStrlen(expandedBuffer), (*itr)->value);
+      expandEscape(expandedBuffer + dStrlen(expandedBuffer), (*itr)->getValue());
       Con::printf("%s\"", expandedBuffer);
    }
 }
@@ -243,5 +343,9 @@ SimFieldDictionary::Entry* SimFieldDictionaryIterator::operator++()
 
 SimFieldDictionary::Entry* SimFieldDictionaryIterator::operator*()
 {
+   // Make sure the text of the entry is available.
+   if(mEntry)
+      mEntry->getValue();
+
    return(mEntry);
 }
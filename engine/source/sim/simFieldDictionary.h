@@ -40,11 +40,30 @@ class SimFieldDictionary
    friend class SimFieldDictionaryIterator;
 
   public:
+   /// A dynamic field.
+   ///
+   /// Fields set from numbers keep the number and only format their text when
+   /// it's asked for, so use getValue() rather than reading the text directly.
    struct Entry
    {
+      enum
+      {
+         TextValid  = BIT(0),    ///< The text value is up to date.
+         IntValid   = BIT(1),    ///< The integer value is up to date.
+         FloatValid = BIT(2),    ///< The float value is up to date.
+      };
+
       StringTableEntry slotName;
       char *value;
       Entry *next;
+      U32 valueSize;
+      U32 validFlags;
+      S32 intValue;
+      F64 floatValue;
+
+      const char *getValue();
+      S32 getIntValue();
+      F32 getFloatValue();
    };
    enum
    {
@@ -57,6 +76,9 @@ class SimFieldDictionary
    static void freeEntry(Entry *entry);
    static Entry *allocEntry();
 
+   Entry *findEntry(StringTableEntry slotName);
+   Entry *findOrCreateEntry(StringTableEntry slotName);
+
    /// In order to efficiently detect when a dynamic field has been
    /// added or deleted, we increment this every time we add or
    /// remove a field.
@@ -68,7 +90,11 @@ public:
    SimFieldDictionary();
    ~SimFieldDictionary();
    void setFieldValue(StringTableEntry slotName, const char *value);
+   void setFieldIntValue(StringTableEntry slotName, const S32 value);
+   void setFieldFloatValue(StringTableEntry slotName, const F64 value);
    const char *getFieldValue(StringTableEntry slotName);
+   S32 getFieldIntValue(StringTableEntry slotName);
+   F32 getFieldFloatValue(StringTableEntry slotName);
    void writeFields(SimObject *obj, Stream &strem, U32 tabStop);
    void printFields(SimObject *obj);
    void assignFrom(SimFieldDictionary *dict);
@@ -23,6 +23,7 @@
 #include "platform/platform.h"
 #include "platform/threads/mutex.h"
 #include "sim/simBase.h"
+#include "sim/simEventQueue.h"
 #include "string/stringTable.h"
 #include "console/console.h"
 #include "io/fileStream.h"
@@ -44,7 +45,7 @@ SimTime gCurrentTime;
 SimTime gTargetTime;
 
 void *gEventQueueMutex;
-SimEvent *gEventQueue;
+SimEventQueue *gEventQueue;
 U32 gEventSequence;
 
 //---------------------------------------------------------------------------
@@ -55,7 +56,7 @@ void initEventQueue()
    gCurrentTime = 0;
    gTargetTime = 0;
    gEventSequence = 1;
-   gEventQueue = NULL;
+   gEventQueue = new SimEventQueue;
    gEventQueueMutex = Mutex::createMutex();
 }
 
@@ -63,13 +64,7 @@ void shutdownEventQueue()
 {
    // Delete all pending events
    Mutex::lockMutex(gEventQueueMutex);
-   SimEvent *walk = gEventQueue;
-   while(walk)
-   {
-      SimEvent *temp = walk->nextEvent;
-      delete walk;
-      walk = temp;
-   }
+   SAFE_DELETE(gEventQueue);
    Mutex::unlockMutex(gEventQueueMutex);
    Mutex::destroyMutex(gEventQueueMutex);
 }
@@ -101,19 +96,11 @@ U32 postEvent(SimObject *destObject, SimEvent* event,U32 time)
       return InvalidEventId;
    }
    event->sequenceCount = gEventSequence++;
-   SimEvent **walk = &gEventQueue;
-   SimEvent *current;
-   
-   while((current = *walk) != NULL && (current->time < event->time))
-      walk = &(current->nextEvent);
-   
-   // [tom, 6/24/2005] This ensures that SimEvents are dispatched in the same order that they are posted.
+
+   // [tom, 6/24/2005] The queue orders events with the same time by their sequence count.
+   // This ensures that SimEvents are dispatched in the same order that they are posted.
    // This is needed to ensure Con::threadSafeExecute() executes script code in the correct order.
-   while((current = *walk) != NULL && (current->time == event->time))
-      walk = &(current->nextEvent);
-   
-   event->nextEvent = current;
-   *walk = event;
+   gEventQueue->push(event);
 
    U32 seqCount = event->sequenceCount;
 
@@ -134,20 +121,11 @@ void cancelEvent(U32 eventSequence)
 {
    Mutex::lockMutex(gEventQueueMutex);
 
-   SimEvent **walk = &gEventQueue;
-   SimEvent *current;
-   
-   while((current = *walk) != NULL)
+   SimEvent *current = gEventQueue->find(eventSequence);
+   if(current)
    {
-      if(current->sequenceCount == eventSequence)
-      {
-         *walk = current->nextEvent;
-         delete current;
-         Mutex::unlockMutex(gEventQueueMutex);
-         return;
-      }
-      else
-         walk = &(current->nextEvent);
+      gEventQueue->remove(current);
+      delete current;
    }
 
    Mutex::unlockMutex(gEventQueueMutex);
@@ -156,20 +134,7 @@ void cancelEvent(U32 eventSequence)
 void cancelPendingEvents(SimObject *obj)
 {
    Mutex::lockMutex(gEventQueueMutex);
-
-   SimEvent **walk = &gEventQueue;
-   SimEvent *current;
-   
-   while((current = *walk) != NULL)
-   {
-      if(current->destObject == obj)
-      {
-         *walk = current->nextEvent;
-         delete current;
-      }
-      else
-         walk = &(current->nextEvent);
-   }
+   gEventQueue->deleteObjectEvents(obj);
    Mutex::unlockMutex(gEventQueueMutex);
 }
 
@@ -187,15 +152,9 @@ void cancelPendingEvents(SimObject *obj)
 bool isEventPending(U32 eventSequence)
 {
    Mutex::lockMutex(gEventQueueMutex);
-
-   for(SimEvent *walk = gEventQueue; walk; walk = walk->nextEvent)
-      if(walk->sequenceCount == eventSequence)
-      {
-         Mutex::unlockMutex(gEventQueueMutex);
-         return true;
-      }
+   const bool pending = gEventQueue->find(eventSequence) != NULL;
    Mutex::unlockMutex(gEventQueueMutex);
-   return false;
+   return pending;
 }
 
 /*!
@@ -209,17 +168,12 @@ U32 getEventTimeLeft(U32 eventSequence)
 {
    Mutex::lockMutex(gEventQueueMutex);
 
-   for(SimEvent *walk = gEventQueue; walk; walk = walk->nextEvent)
-      if(walk->sequenceCount == eventSequence)
-      {
-         SimTime t = walk->time - getCurrentTime();
-         Mutex::unlockMutex(gEventQueueMutex);
-         return t;
-      }
+   SimEvent *walk = gEventQueue->find(eventSequence);
+   SimTime t = walk ? walk->time - getCurrentTime() : 0;
 
    Mutex::unlockMutex(gEventQueueMutex);
 
-   return 0;   
+   return t;
 }
 
 /*!
@@ -231,10 +185,11 @@ U32 getEventTimeLeft(U32 eventSequence)
 */
 U32 getScheduleDuration(U32 eventSequence)
 {
-   for(SimEvent *walk = gEventQueue; walk; walk = walk->nextEvent)
-      if(walk->sequenceCount == eventSequence)
-         return (walk->time-walk->startTime);
-   return 0;
+   Mutex::lockMutex(gEventQueueMutex);
+   SimEvent *walk = gEventQueue->find(eventSequence);
+   SimTime t = walk ? walk->time - walk->startTime : 0;
+   Mutex::unlockMutex(gEventQueueMutex);
+   return t;
 }
 
 /*!
@@ -246,10 +201,11 @@ U32 getScheduleDuration(U32 eventSequence)
 */
 U32 getTimeSinceStart(U32 eventSequence)
 {
-   for(SimEvent *walk = gEventQueue; walk; walk = walk->nextEvent)
-      if(walk->sequenceCount == eventSequence)
-         return (getCurrentTime()-walk->startTime);
-   return 0;
+   Mutex::lockMutex(gEventQueueMutex);
+   SimEvent *walk = gEventQueue->find(eventSequence);
+   SimTime t = walk ? getCurrentTime() - walk->startTime : 0;
+   Mutex::unlockMutex(gEventQueueMutex);
+   return t;
 }
 
 //---------------------------------------------------------------------------
@@ -261,10 +217,9 @@ void advanceToTime(SimTime targetTime)
 
    Mutex::lockMutex(gEventQueueMutex);
    gTargetTime = targetTime;
-   while(gEventQueue && gEventQueue->time <= targetTime)
+   while(!gEventQueue->isEmpty() && gEventQueue->peek()->time <= targetTime)
    {
-      SimEvent *event = gEventQueue;
-      gEventQueue = gEventQueue->nextEvent;
+      SimEvent *event = gEventQueue->pop();
       AssertFatal(event->time >= gCurrentTime,
             "SimEventQueue::pop: Cannot go back in time (flux capacitor not installed - BJG).");
       gCurrentTime = event->time;
@@ -512,62 +512,119 @@ void SimObject::setDataField(StringTableEntry slotName, const char *array, const
       const AbstractClassRep::Field *fld = findField(slotName);
       if(fld)
       {
-         if( fld->type == AbstractClassRep::DepricatedFieldType ||
-            fld->type == AbstractClassRep::StartGroupFieldType ||
-            fld->type == AbstractClassRep::EndGroupFieldType) 
-            return;
+         setStaticDataField(fld, array ? dAtoi(array) : 0, value);
+         return;
+      }
+   }
 
-         S32 array1 = array ? dAtoi(array) : 0;
+   if(mFlags.test(ModDynamicFields))
+   {
+      if(!mFieldDictionary)
+         mFieldDictionary = new SimFieldDictionary;
 
-         if(array1 >= 0 && array1 < fld->elementCount && fld->elementCount >= 1)
-         {
-            // If the set data notify callback returns true, then go ahead and
-            // set the data, otherwise, assume the set notify callback has either
-            // already set the data, or has deemed that the data should not
-            // be set at all.
-            FrameTemp<char> buffer(2048);
-            FrameTemp<char> bufferSecure(2048); // This buffer is used to make a copy of the data 
-            // so that if the prep functions or any other functions use the string stack, the data
-            // is not corrupted.
+      mFieldDictionary->setFieldValue(getDynamicFieldSlotName(slotName, array), value);
+   }
+}
 
-            ConsoleBaseType *cbt = ConsoleBaseType::getType( fld->type );
-            AssertFatal( cbt != NULL, "Could not resolve Type Id." );
+//-----------------------------------------------------------------------------
 
-            const char* szBuffer = cbt->prepData( value, buffer, 2048 );
-            dMemset( bufferSecure, 0, 2048 );
-            dMemcpy( bufferSecure, szBuffer, dStrlen( szBuffer ) );
+void SimObject::setStaticDataField(const AbstractClassRep::Field *fld, S32 array1, const char *value)
+{
+   if( fld->type == AbstractClassRep::DepricatedFieldType ||
+      fld->type == AbstractClassRep::StartGroupFieldType ||
+      fld->type == AbstractClassRep::EndGroupFieldType) 
+      return;
 
-            if( (*fld->setDataFn)( this, bufferSecure ) )
-               Con::setData(fld->type, (void *) (((const char *)this) + fld->offset), array1, 1, &value, fld->table);
+   if(array1 >= 0 && array1 < fld->elementCount && fld->elementCount >= 1)
+   {
+      // If the set data notify callback returns true, then go ahead and
+      // set the data, otherwise, assume the set notify callback has either
+      // already set the data, or has deemed that the data should not
+      // be set at all.
+      FrameTemp<char> buffer(2048);
+      FrameTemp<char> bufferSecure(2048); // This buffer is used to make a copy of the data 
+      // so that if the prep functions or any other functions use the string stack, the data
+      // is not corrupted.
 
-            onStaticModified( slotName, value );
+      ConsoleBaseType *cbt = ConsoleBaseType::getType( fld->type );
+      AssertFatal( cbt != NULL, "Could not resolve Type Id." );
 
-            return;
-         }
+      // Copy the prepared data and terminate it (the rest of the buffer is never read).
+      const char* szBuffer = cbt->prepData( value, buffer, 2048 );
+      const U32 length = getMin( (U32)dStrlen( szBuffer ), (U32)2047 );
+      dMemcpy( bufferSecure, szBuffer, length );
+      bufferSecure[length] = 0;
 
-         if(fld->validator)
-            fld->validator->validateType(this, (void *) (((const char *)this) + fld->offset));
+      if( (*fld->setDataFn)( this, bufferSecure ) )
+         Con::setData(fld->type, (void *) (((const char *)this) + fld->offset), array1, 1, &value, fld->table);
 
-         onStaticModified( slotName, value );
-         return;
-      }
+      onStaticModified( fld->pFieldname, value );
+
+      return;
    }
 
-   if(mFlags.test(ModDynamicFields))
+   if(fld->validator)
+      fld->validator->validateType(this, (void *) (((const char *)this) + fld->offset));
+
+   onStaticModified( fld->pFieldname, value );
+}
+
+//-----------------------------------------------------------------------------
+
+StringTableEntry SimObject::getDynamicFieldSlotName(StringTableEntry slotName, const char *array)
+{
+   // The script interpreter passes an empty array for fields that aren't arrays.
+   if(!array || !*array)
+      return slotName;
+
+   char buf[256];
+   dStrcpy(buf, slotName);
+   dStrcat(buf, array);
+   return StringTable->insert(buf);
+}
+
+//-----------------------------------------------------------------------------
+
+void SimObject::setDataFieldInt(StringTableEntry slotName, const char *array, S32 value)
+{
+   // Static fields are always set from text.
+   if(!mFlags.test(ModStaticFields) || !findField(slotName))
    {
-      if(!mFieldDictionary)
-         mFieldDictionary = new SimFieldDictionary;
+      if(mFlags.test(ModDynamicFields))
+      {
+         if(!mFieldDictionary)
+            mFieldDictionary = new SimFieldDictionary;
 
-      if(!array)
-         mFieldDictionary->setFieldValue(slotName, value);
-      else
+         mFieldDictionary->setFieldIntValue(getDynamicFieldSlotName(slotName, array), value);
+      }
+      return;
+   }
+
+   char buf[32];
+   dSprintf(buf, sizeof(buf), "%d", value);
+   setDataField(slotName, array, buf);
+}
+
+//-----------------------------------------------------------------------------
+
+void SimObject::setDataFieldFloat(StringTableEntry slotName, const char *array, F64 value)
+{
+   // Static fields are always set from text.
+   if(!mFlags.test(ModStaticFields) || !findField(slotName))
+   {
+      if(mFlags.test(ModDynamicFields))
       {
-         char buf[256];
-         dStrcpy(buf, slotName);
-         dStrcat(buf, array);
-         mFieldDictionary->setFieldValue(StringTable->insert(buf), value);
+         if(!mFieldDictionary)
+            mFieldDictionary = new SimFieldDictionary;
+
+         mFieldDictionary->setFieldFloatValue(getDynamicFieldSlotName(slotName, array), value);
       }
+      return;
    }
+
+   char buf[32];
+   dSprintf(buf, sizeof(buf), "%.9g", value);
+   setDataField(slotName, array, buf);
 }
 
 //-----------------------------------------------------------------------------
@@ -594,19 +651,8 @@ const char *SimObject::getDataField(StringTableEntry slotName, const char *array
       if(!mFieldDictionary)
          return "";
 
-      if(!array) 
-      {
-         if (const char* val = mFieldDictionary->getFieldValue(slotName))
-            return val;
-      }
-      else
-      {
-         static char buf[256];
-         dStrcpy(buf, slotName);
-         dStrcat(buf, array);
-         if (const char* val = mFieldDictionary->getFieldValue(StringTable->insert(buf)))
-            return val;
-      }
+      if (const char* val = mFieldDictionary->getFieldValue(getDynamicFieldSlotName(slotName, array)))
+         return val;
    }
 
    return "";
@@ -614,6 +660,34 @@ const char *SimObject::getDataField(StringTableEntry slotName, const char *array
 
 //-----------------------------------------------------------------------------
 
+S32 SimObject::getDataFieldInt(StringTableEntry slotName, const char *array)
+{
+   // Static fields are always read as text.
+   if(mFlags.test(ModStaticFields) && findField(slotName))
+      return dAtoi(getDataField(slotName, array));
+
+   if(!mFlags.test(ModDynamicFields) || !mFieldDictionary)
+      return 0;
+
+   return mFieldDictionary->getFieldIntValue(getDynamicFieldSlotName(slotName, array));
+}
+
+//-----------------------------------------------------------------------------
+
+F32 SimObject::getDataFieldFloat(StringTableEntry slotName, const char *array)
+{
+   // Static fields are always read as text.
+   if(mFlags.test(ModStaticFields) && findField(slotName))
+      return dAtof(getDataField(slotName, array));
+
+   if(!mFlags.test(ModDynamicFields) || !mFieldDictionary)
+      return 0.0f;
+
+   return mFieldDictionary->getFieldFloatValue(getDynamicFieldSlotName(slotName, array));
+}
+
+//-----------------------------------------------------------------------------
+
 const char *SimObject::getPrefixedDataField(StringTableEntry fieldName, const char *array)
 {
     // Sanity!
@@ -359,6 +359,9 @@ protected:
     void linkNamespaces();
     void unlinkNamespaces();
 
+    /// Get the dynamic field slot name of a (possibly array) field.
+    static StringTableEntry getDynamicFieldSlotName(StringTableEntry slotName, const char *array);
+
 public:
     /// @name Accessors
     /// @{
@@ -383,6 +386,31 @@ public:
     /// @param   value       Value to store.
     void setDataField(StringTableEntry slotName, const char *array, const char *value);
 
+    /// Set the value of a static field that has already been found on the object's class.
+    ///
+    /// This is what setDataField() does for a static field, for callers such as the
+    /// TAML readers that set many objects of the same class and find the fields once.
+    ///
+    /// @param   pField      Field to set.
+    /// @param   arrayIndex  Index into the field (if it is an array).
+    /// @param   value       Value to store.
+    void setStaticDataField(const AbstractClassRep::Field *pField, S32 arrayIndex, const char *value);
+
+    /// Get the value of a field on the object as an integer.
+    ///
+    /// Dynamic fields keep the numbers they are set from so this avoids formatting
+    /// and parsing text when numbers are read and written by script.
+    S32 getDataFieldInt(StringTableEntry slotName, const char *array);
+
+    /// Get the value of a field on the object as a float.
+    F32 getDataFieldFloat(StringTableEntry slotName, const char *array);
+
+    /// Set the value of a field on the object from an integer.
+    void setDataFieldInt(StringTableEntry slotName, const char *array, S32 value);
+
+    /// Set the value of a field on the object from a float.
+    void setDataFieldFloat(StringTableEntry slotName, const char *array, F64 value);
+
     const char *getPrefixedDataField(StringTableEntry fieldName, const char *array);
 
     void setPrefixedDataField(StringTableEntry fieldName, const char *array, const char *value);
@@ -702,6 +730,7 @@ public:
     void setExpanded(bool exp) { if(exp) mFlags.set(Expanded); else mFlags.clear(Expanded); }
     void setModDynamicFields(bool dyn) { if(dyn) mFlags.set(ModDynamicFields); else mFlags.clear(ModDynamicFields); }
     void setModStaticFields(bool sta) { if(sta) mFlags.set(ModStaticFields); else mFlags.clear(ModStaticFields); }
+    bool isModStaticFields() const { return mFlags.test(ModStaticFields); }
 
     /// @}
 
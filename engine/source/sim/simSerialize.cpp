@@ -76,7 +76,7 @@ bool SimObject::writeObject(Stream *stream)
             continue;
 
          stream->writeString(entry->slotName);
-         stream->writeString(entry->value);
+         stream->writeString(entry->getValue());
          numFields++;
       }
    }
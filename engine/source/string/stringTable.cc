@@ -123,11 +123,21 @@ StringTableEntry _StringTable::insert(const char* val, const bool  caseSens)
    if ( val == NULL )
        return StringTable->EmptyString;
 
+   return insertHashed(val, hashString(val), caseSens);
+}
+
+//--------------------------------------
+StringTableEntry _StringTable::insertHashed(const char* val, const U32 key, const bool  caseSens)
+{
+   if ( val == NULL )
+       return StringTable->EmptyString;
+
+   AssertFatal(key == hashString(val), "_StringTable::insertHashed - Incorrect hash.");
+
    MutexHandle mutex;
    mutex.lock(&mMutex, true);
 
    Node **walk, *temp;
-   U32 key = hashString(val);
    walk = &buckets[key % numBuckets];
    while((temp = *walk) != NULL)   {
       if(caseSens && !dStrcmp(temp->val, val))
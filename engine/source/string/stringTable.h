@@ -129,6 +129,14 @@ private:
    /// @param  caseSens Determines whether case matters.
    StringTableEntry insertn(const char *string, S32 len, bool caseSens = false);
 
+   /// Get a pointer from the string table, adding the string to the table
+   /// if it was not already present.
+   ///
+   /// @param  string   String to check in the table (and add).
+   /// @param  hash     The hash of the string from hashString().
+   /// @param  caseSens Determines whether case matters.
+   StringTableEntry insertHashed(const char *string, const U32 hash, bool caseSens = false);
+
    /// Get a pointer from the string table, NOT adding the string to the table
    /// if it was not already present.
    ///
@@ -0,0 +1,696 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _GBITMAP_H_
+#include "graphics/gBitmap.h"
+#endif
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+#ifndef _JOB_SYSTEM_H_
+#include "platform/threads/jobSystem.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_MUTEX_H_
+#include "platform/threads/mutex.h"
+#endif
+
+#ifndef _ASSET_ASYNC_ACQUIRER_H_
+#include "assets/assetAsyncAcquirer.h"
+#endif
+
+#ifndef _ASSET_MANAGER_H_
+#include "assets/assetManager.h"
+#endif
+
+#ifndef _ASSET_PTR_H_
+#include "assets/assetPtr.h"
+#endif
+
+#ifndef _MODULE_DEFINITION_H
+#include "module/moduleDefinition.h"
+#endif
+
+#ifndef _IMAGE_ASSET_H_
+#include "2d/assets/ImageAsset.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define ASSET_ASYNC_UNITTEST_DECODE_JOBS    16
+#define ASSET_ASYNC_UNITTEST_IMAGE_WIDTH    61
+#define ASSET_ASYNC_UNITTEST_IMAGE_HEIGHT   37
+#define ASSET_ASYNC_UNITTEST_MODULE_ID      "AssetAsyncTest"
+#define ASSET_ASYNC_UNITTEST_MAX_FRAMES     1000
+
+//-----------------------------------------------------------------------------
+
+struct DecodeTestContext
+{
+    char        mFilename[1024];
+    GBitmap*    mBitmaps[ASSET_ASYNC_UNITTEST_DECODE_JOBS];
+};
+
+//-----------------------------------------------------------------------------
+
+static void decodeTestJob( void* pContext, const U32 jobIndex )
+{
+    DecodeTestContext* pDecodeContext = (DecodeTestContext*)pContext;
+
+    // Decode the image as an asynchronous acquisition does.
+    FileStream stream;
+    if ( !stream.open( pDecodeContext->mFilename, FileStream::Read ) )
+        return;
+
+    GBitmap* pBitmap = new GBitmap();
+    if ( pBitmap->readPNG( stream ) )
+        pDecodeContext->mBitmaps[jobIndex] = pBitmap;
+    else
+        delete pBitmap;
+
+    stream.close();
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( AssetAsyncAcquirerTests, parallelDecodeTest )
+{
+    // Create an image with a pattern.
+    GBitmap sourceBitmap;
+    sourceBitmap.allocateBitmap( ASSET_ASYNC_UNITTEST_IMAGE_WIDTH, ASSET_ASYNC_UNITTEST_IMAGE_HEIGHT, false, GBitmap::RGBA );
+    for ( U32 y = 0; y < ASSET_ASYNC_UNITTEST_IMAGE_HEIGHT; ++y )
+    {
+        for ( U32 x = 0; x < ASSET_ASYNC_UNITTEST_IMAGE_WIDTH; ++x )
+        {
+            U8* pPixel = sourceBitmap.getAddress( x, y );
+            pPixel[0] = (U8)(x * 4);
+            pPixel[1] = (U8)(y * 6);
+            pPixel[2] = (U8)(x + y);
+            pPixel[3] = (U8)(255 - x);
+        }
+    }
+
+    // Write the image.
+    DecodeTestContext context;
+    dSprintf( context.mFilename, sizeof(context.mFilename), "%s/assetAsyncTest.png", Platform::getTemporaryDirectory() );
+
+    FileStream stream;
+    ASSERT_TRUE( stream.open( context.mFilename, FileStream::Write ) ) << "Could not write the test image.";
+    ASSERT_TRUE( sourceBitmap.writePNG( stream ) ) << "Could not encode the test image.";
+    stream.close();
+
+    // Decode the image on all the workers at once.
+    for ( U32 index = 0; index < ASSET_ASYNC_UNITTEST_DECODE_JOBS; ++index )
+        context.mBitmaps[index] = NULL;
+
+    JobSystem::parallelFor( decodeTestJob, &context, ASSET_ASYNC_UNITTEST_DECODE_JOBS );
+
+    // Check each decode is identical to the image.
+    const U32 byteSize = ASSET_ASYNC_UNITTEST_IMAGE_WIDTH * ASSET_ASYNC_UNITTEST_IMAGE_HEIGHT * 4;
+    for ( U32 index = 0; index < ASSET_ASYNC_UNITTEST_DECODE_JOBS; ++index )
+    {
+        GBitmap* pBitmap = context.mBitmaps[index];
+        ASSERT_TRUE( pBitmap != NULL ) << "Decode " << index << " failed.";
+        ASSERT_EQ( (U32)ASSET_ASYNC_UNITTEST_IMAGE_WIDTH, pBitmap->getWidth() ) << "Incorrect width of decode " << index;
+        ASSERT_EQ( (U32)ASSET_ASYNC_UNITTEST_IMAGE_HEIGHT, pBitmap->getHeight() ) << "Incorrect height of decode " << index;
+        ASSERT_EQ( GBitmap::RGBA, pBitmap->getFormat() ) << "Incorrect format of decode " << index;
+        ASSERT_EQ( 0, dMemcmp( sourceBitmap.getBits(), pBitmap->getBits(), byteSize ) ) << "Incorrect pixels in decode " << index;
+    }
+
+    for ( U32 index = 0; index < ASSET_ASYNC_UNITTEST_DECODE_JOBS; ++index )
+        delete context.mBitmaps[index];
+
+    Platform::fileDelete( context.mFilename );
+}
+
+//-----------------------------------------------------------------------------
+
+/// The completions seen by the test callback.
+struct AssetAsyncTestResults
+{
+    AssetAsyncTestResults() :
+        mReleaseAssets( true ),
+        mCancelRequestId( 0 ),
+        mCancelled( false )
+    {
+    }
+
+    Vector<U32>         mRequestIds;
+    Vector<AssetBase*>  mAssets;
+    bool                mReleaseAssets;
+    U32                 mCancelRequestId;
+    bool                mCancelled;
+};
+
+//-----------------------------------------------------------------------------
+
+static void assetAsyncTestCallback( void* pUserData, const U32 requestId, StringTableEntry assetId, AssetBase* pAsset )
+{
+    AssetAsyncTestResults* pResults = (AssetAsyncTestResults*)pUserData;
+
+    pResults->mRequestIds.push_back( requestId );
+    pResults->mAssets.push_back( pAsset );
+
+    // Cancel another request from the callback if asked to.
+    if ( pResults->mCancelRequestId != 0 )
+    {
+        pResults->mCancelled = AssetAsyncAcquirer::cancel( pResults->mCancelRequestId );
+        pResults->mCancelRequestId = 0;
+    }
+
+    // The callback owns the reference.
+    if ( pResults->mReleaseAssets && pAsset != NULL )
+        AssetDatabase.releaseAsset( assetId );
+}
+
+//-----------------------------------------------------------------------------
+
+/// Declares test image assets in a module and discards them (and any requests for them) when it goes out of scope.
+class AssetAsyncTestScope
+{
+public:
+    AssetAsyncTestScope()
+    {
+        // Define the script callbacks used by the tests.
+        Con::evaluate(
+            "function AssetAsyncTestNotify::onAssetAcquired(%this, %requestId, %assetId, %asset)"
+            "{"
+            "   %this.notifyCount++;"
+            "   %this.requestId = %requestId;"
+            "   %this.asset = %asset;"
+            "}"
+            "function AssetAsyncTestCancel::onAdd(%this)"
+            "{"
+            "   $AssetAsyncTest::Cancelled = AssetDatabase.cancelAcquireAssetAsync($AssetAsyncTest::CancelRequestId);"
+            "}"
+            );
+
+        // The assets are declared in the temporary directory.
+        mpModuleDefinition = new ModuleDefinition();
+        mpModuleDefinition->setModuleId( ASSET_ASYNC_UNITTEST_MODULE_ID );
+        mpModuleDefinition->setVersionId( 1 );
+        mpModuleDefinition->setModulePath( Platform::getTemporaryDirectory() );
+    }
+
+    ~AssetAsyncTestScope()
+    {
+        // Discard the requests that haven't completed.
+        for( U32 index = 0; index < (U32)mRequestIds.size(); ++index )
+            AssetAsyncAcquirer::cancel( mRequestIds[index] );
+
+        // Wait for any cancelled requests that are still being loaded.
+        AssetAsyncAcquirer::flush();
+
+        AssetDatabase.removeDeclaredAssets( mpModuleDefinition );
+        delete mpModuleDefinition;
+
+        for( U32 index = 0; index < (U32)mFilenames.size(); ++index )
+            Platform::fileDelete( mFilenames[index] );
+    }
+
+    /// Declare an image asset with its own image.
+    /// @return The asset Id or an empty string if the asset could not be declared.
+    StringTableEntry addImageAsset( const char* pAssetName, const char* pClassName = NULL )
+    {
+        // Write the image.
+        GBitmap image( 8, 8, false, GBitmap::RGBA );
+        dMemset( image.getWritableBits(), 0x80, image.byteSize );
+
+        char imageFilename[1024];
+        dSprintf( imageFilename, sizeof(imageFilename), "%s/%s.png", Platform::getTemporaryDirectory(), pAssetName );
+
+        FileStream stream;
+        if ( !stream.open( imageFilename, FileStream::Write ) || !image.writePNG( stream ) )
+            return StringTable->EmptyString;
+
+        stream.close();
+        mFilenames.push_back( StringTable->insert( imageFilename ) );
+
+        // Write the asset file.
+        char classBuffer[256];
+        classBuffer[0] = 0;
+        if ( pClassName != NULL )
+            dSprintf( classBuffer, sizeof(classBuffer), " class=\"%s\"", pClassName );
+
+        char buffer[512];
+        dSprintf( buffer, sizeof(buffer),
+            "<ImageAsset AssetName=\"%s\"%s ImageFile=\"@assetFile=%s.png\" />\n",
+            pAssetName, classBuffer, pAssetName );
+
+        char assetFilename[1024];
+        dSprintf( assetFilename, sizeof(assetFilename), "%s/%s.asset.taml", Platform::getTemporaryDirectory(), pAssetName );
+
+        if ( !stream.open( assetFilename, FileStream::Write ) )
+            return StringTable->EmptyString;
+
+        stream.writeStringBuffer( buffer );
+        stream.close();
+        mFilenames.push_back( StringTable->insert( assetFilename ) );
+
+        // Declare the asset.
+        if ( !AssetDatabase.addDeclaredAsset( mpModuleDefinition, assetFilename ) )
+            return StringTable->EmptyString;
+
+        char assetId[256];
+        dSprintf( assetId, sizeof(assetId), "%s:%s", ASSET_ASYNC_UNITTEST_MODULE_ID, pAssetName );
+        return StringTable->insert( assetId );
+    }
+
+    /// Add a private image asset.
+    /// NOTE: Private assets are removed when they are released so the caller must hold a reference.
+    /// @return The asset Id or an empty string if the asset could not be added.
+    StringTableEntry addPrivateImageAsset( const char* pName )
+    {
+        // Write the image.
+        GBitmap image( 8, 8, false, GBitmap::RGBA );
+        dMemset( image.getWritableBits(), 0x40, image.byteSize );
+
+        char imageFilename[1024];
+        dSprintf( imageFilename, sizeof(imageFilename), "%s/%s.png", Platform::getTemporaryDirectory(), pName );
+
+        FileStream stream;
+        if ( !stream.open( imageFilename, FileStream::Write ) || !image.writePNG( stream ) )
+            return StringTable->EmptyString;
+
+        stream.close();
+        mFilenames.push_back( StringTable->insert( imageFilename ) );
+
+        // Add an image asset that uses it.
+        ImageAsset* pImageAsset = new ImageAsset();
+        pImageAsset->setImageFile( imageFilename );
+        return AssetDatabase.addPrivateAsset( pImageAsset );
+    }
+
+    /// Start acquiring an asset.
+    U32 queue( const char* pAssetId, const S32 priority, AssetAsyncTestResults* pResults, SimObject* pNotifyObject = NULL )
+    {
+        const U32 requestId = AssetAsyncAcquirer::queue( &AssetDatabase, pAssetId, priority, pResults == NULL ? NULL : assetAsyncTestCallback, pResults, pNotifyObject );
+        mRequestIds.push_back( requestId );
+        return requestId;
+    }
+
+private:
+    ModuleDefinition*           mpModuleDefinition;
+    Vector<StringTableEntry>    mFilenames;
+    Vector<U32>                 mRequestIds;
+};
+
+//-----------------------------------------------------------------------------
+
+/// Keeps all the job system workers busy so submitted jobs wait until it is released.
+class AssetAsyncTestWorkerBlock
+{
+public:
+    AssetAsyncTestWorkerBlock() :
+        mWorkerCount( JobSystem::getWorkerCount() ),
+        mStartedCount( 0 ),
+        mReleased( false )
+    {
+        // Jobs are executed immediately without workers so there's nothing to block.
+        if ( mWorkerCount == 0 )
+            return;
+
+        for( U32 index = 0; index < mWorkerCount; ++index )
+            JobSystem::submit( blockJob, this, index, &mGroup );
+
+        // Wait for every worker to be blocked.
+        while( getStartedCount() < mWorkerCount )
+            Platform::sleep( 1 );
+    }
+
+    ~AssetAsyncTestWorkerBlock()
+    {
+        release();
+    }
+
+    /// Let the workers continue.
+    void release( void )
+    {
+        {
+            MutexHandle handle;
+            handle.lock( &mMutex, true );
+            mReleased = true;
+        }
+
+        JobSystem::wait( &mGroup );
+    }
+
+private:
+    U32 getStartedCount( void )
+    {
+        MutexHandle handle;
+        handle.lock( &mMutex, true );
+        return mStartedCount;
+    }
+
+    bool getReleased( void )
+    {
+        MutexHandle handle;
+        handle.lock( &mMutex, true );
+        return mReleased;
+    }
+
+    static void blockJob( void* pContext, const U32 jobIndex )
+    {
+        AssetAsyncTestWorkerBlock* pBlock = (AssetAsyncTestWorkerBlock*)pContext;
+
+        {
+            MutexHandle handle;
+            handle.lock( &pBlock->mMutex, true );
+            pBlock->mStartedCount++;
+        }
+
+        while( !pBlock->getReleased() )
+            Platform::sleep( 1 );
+    }
+
+    JobSystem::JobGroup mGroup;
+    Mutex               mMutex;
+    U32                 mWorkerCount;
+    U32                 mStartedCount;
+    bool                mReleased;
+};
+
+//-----------------------------------------------------------------------------
+
+static void processAssetAsyncRequests( void )
+{
+    // Process frames until all the requests have completed.
+    for( U32 frame = 0; frame < ASSET_ASYNC_UNITTEST_MAX_FRAMES && AssetAsyncAcquirer::getPendingCount() > 0; ++frame )
+    {
+        AssetAsyncAcquirer::process();
+        Platform::sleep( 1 );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static SimObject* createNotifyObject( void )
+{
+    return Sim::findObject( Con::evaluate( "return new ScriptObject() { class = \"AssetAsyncTestNotify\"; };" ) );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( AssetAsyncAcquirerTests, priorityTest )
+{
+    ASSERT_EQ( 0U, AssetAsyncAcquirer::getPendingCount() ) << "Requests are pending before the test.";
+
+    // Use assets that are already loaded so the requests are ready to commit in the order they're kept.
+    AssetAsyncTestScope scope;
+    AssetPtr<ImageAsset> imageAssetA( scope.addPrivateImageAsset( "asyncPriorityA" ) );
+    AssetPtr<ImageAsset> imageAssetB( scope.addPrivateImageAsset( "asyncPriorityB" ) );
+    ASSERT_FALSE( imageAssetA.isNull() ) << "Could not add the test asset.";
+    ASSERT_FALSE( imageAssetB.isNull() ) << "Could not add the test asset.";
+
+    // An unknown asset isn't queued.
+    AssetAsyncTestResults results;
+    ASSERT_EQ( 0U, AssetAsyncAcquirer::queue( &AssetDatabase, ASSET_ASYNC_UNITTEST_MODULE_ID ":missing", 0, assetAsyncTestCallback, &results, NULL ) ) << "Queued an unknown asset.";
+
+    // Queue requests with mixed priorities.
+    const U32 requestLow = scope.queue( imageAssetA.getAssetId(), 0, &results );
+    const U32 requestHigh = scope.queue( imageAssetB.getAssetId(), 10, &results );
+    const U32 requestMiddle = scope.queue( imageAssetA.getAssetId(), 5, &results );
+    const U32 requestHighLater = scope.queue( imageAssetA.getAssetId(), 10, &results );
+    const U32 requestLowest = scope.queue( imageAssetB.getAssetId(), -1, &results );
+    ASSERT_EQ( 5U, AssetAsyncAcquirer::getPendingCount() ) << "Incorrect pending count.";
+
+    // Nothing completes until the requests are processed.
+    ASSERT_EQ( 0, results.mRequestIds.size() ) << "Request completed before being processed.";
+
+    processAssetAsyncRequests();
+    ASSERT_EQ( 0U, AssetAsyncAcquirer::getPendingCount() ) << "Requests did not complete.";
+
+    // Check they completed by priority and then in the order they were made.
+    ASSERT_EQ( 5, results.mRequestIds.size() ) << "Incorrect completion count.";
+    ASSERT_EQ( requestHigh, results.mRequestIds[0] ) << "Incorrect completion order.";
+    ASSERT_EQ( requestHighLater, results.mRequestIds[1] ) << "Incorrect completion order.";
+    ASSERT_EQ( requestMiddle, results.mRequestIds[2] ) << "Incorrect completion order.";
+    ASSERT_EQ( requestLow, results.mRequestIds[3] ) << "Incorrect completion order.";
+    ASSERT_EQ( requestLowest, results.mRequestIds[4] ) << "Incorrect completion order.";
+
+    // Check each acquired its asset.
+    ASSERT_TRUE( results.mAssets[0] == imageAssetB ) << "Request acquired the wrong asset.";
+    ASSERT_TRUE( results.mAssets[1] == imageAssetA ) << "Request acquired the wrong asset.";
+    ASSERT_TRUE( results.mAssets[2] == imageAssetA ) << "Request acquired the wrong asset.";
+    ASSERT_TRUE( results.mAssets[3] == imageAssetA ) << "Request acquired the wrong asset.";
+    ASSERT_TRUE( results.mAssets[4] == imageAssetB ) << "Request acquired the wrong asset.";
+
+    // The callbacks released their references.
+    ASSERT_EQ( 1, imageAssetA->getAcquiredReferenceCount() ) << "Asset is still acquired by a request.";
+    ASSERT_EQ( 1, imageAssetB->getAcquiredReferenceCount() ) << "Asset is still acquired by a request.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( AssetAsyncAcquirerTests, cancelQueuedTest )
+{
+    ASSERT_EQ( 0U, AssetAsyncAcquirer::getPendingCount() ) << "Requests are pending before the test.";
+
+    AssetAsyncTestScope scope;
+    AssetPtr<ImageAsset> imageAsset( scope.addPrivateImageAsset( "asyncCancelQueued" ) );
+    ASSERT_FALSE( imageAsset.isNull() ) << "Could not add the test asset.";
+
+    AssetAsyncTestResults results;
+    const U32 requestA = scope.queue( imageAsset.getAssetId(), 0, &results );
+    const U32 requestB = scope.queue( imageAsset.getAssetId(), 0, &results );
+    const U32 requestC = scope.queue( imageAsset.getAssetId(), 0, &results );
+
+    // Cancel a request before it's processed.
+    ASSERT_TRUE( AssetAsyncAcquirer::cancel( requestB ) ) << "Could not cancel the request.";
+    ASSERT_FALSE( AssetAsyncAcquirer::cancel( requestB ) ) << "Cancelled the request twice.";
+    ASSERT_FALSE( AssetAsyncAcquirer::cancel( 0 ) ) << "Cancelled an unknown request.";
+    ASSERT_EQ( 2U, AssetAsyncAcquirer::getPendingCount() ) << "Incorrect pending count.";
+
+    // Cancel the last request from the callback of the first.
+    results.mCancelRequestId = requestC;
+
+    processAssetAsyncRequests();
+    ASSERT_EQ( 0U, AssetAsyncAcquirer::getPendingCount() ) << "Requests did not complete.";
+
+    // Only the first request completed.
+    ASSERT_EQ( 1, results.mRequestIds.size() ) << "Cancelled request completed.";
+    ASSERT_EQ( requestA, results.mRequestIds[0] ) << "Incorrect request completed.";
+    ASSERT_TRUE( results.mCancelled ) << "Could not cancel the request from the callback.";
+
+    // The cancelled requests didn't keep any references.
+    ASSERT_EQ( 1, imageAsset->getAcquiredReferenceCount() ) << "Asset is still acquired by a request.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( AssetAsyncAcquirerTests, cancelLoadingTest )
+{
+    ASSERT_EQ( 0U, AssetAsyncAcquirer::getPendingCount() ) << "Requests are pending before the test.";
+    ASSERT_LT( 0U, JobSystem::getWorkerCount() ) << "The job system has no workers to load with.";
+    ASSERT_EQ( TextureManager::Alive, TextureManager::getManagerState() ) << "Textures are not being managed so nothing is loaded.";
+
+    AssetAsyncTestScope scope;
+    StringTableEntry assetIds[ASSET_ASYNC_ACQUIRE_MAX_LOADING + 1];
+    for( U32 index = 0; index <= ASSET_ASYNC_ACQUIRE_MAX_LOADING; ++index )
+    {
+        char assetName[64];
+        dSprintf( assetName, sizeof(assetName), "asyncCancelLoading%d", index );
+        assetIds[index] = scope.addImageAsset( assetName );
+        ASSERT_NE( StringTable->EmptyString, assetIds[index] ) << "Could not declare the test asset.";
+    }
+
+    AssetAsyncTestResults results;
+    U32 requestIds[ASSET_ASYNC_ACQUIRE_MAX_LOADING + 1];
+    {
+        // Stop the images being decoded.
+        AssetAsyncTestWorkerBlock workerBlock;
+
+        // Fill the loading requests so the last request stays queued.
+        for( U32 index = 0; index <= ASSET_ASYNC_ACQUIRE_MAX_LOADING; ++index )
+            requestIds[index] = scope.queue( assetIds[index], 0, &results );
+
+        // Nothing completes while the images are being decoded.
+        AssetAsyncAcquirer::process();
+        ASSERT_EQ( 0, results.mRequestIds.size() ) << "Request completed while it was loading.";
+        ASSERT_EQ( (U32)ASSET_ASYNC_ACQUIRE_MAX_LOADING + 1, AssetAsyncAcquirer::getPendingCount() ) << "Incorrect pending count.";
+
+        // Cancel a loading request and the queued request.
+        ASSERT_TRUE( AssetAsyncAcquirer::cancel( requestIds[1] ) ) << "Could not cancel the loading request.";
+        ASSERT_FALSE( AssetAsyncAcquirer::cancel( requestIds[1] ) ) << "Cancelled the loading request twice.";
+        ASSERT_TRUE( AssetAsyncAcquirer::cancel( requestIds[ASSET_ASYNC_ACQUIRE_MAX_LOADING] ) ) << "Could not cancel the queued request.";
+        ASSERT_EQ( (U32)ASSET_ASYNC_ACQUIRE_MAX_LOADING - 1, AssetAsyncAcquirer::getPendingCount() ) << "Incorrect pending count.";
+    }
+
+    processAssetAsyncRequests();
+    ASSERT_EQ( 0U, AssetAsyncAcquirer::getPendingCount() ) << "Requests did not complete.";
+
+    // Only the requests that weren't cancelled completed.
+    // NOTE: The requests complete in the order their images finish decoding.
+    ASSERT_EQ( ASSET_ASYNC_ACQUIRE_MAX_LOADING - 1, results.mRequestIds.size() ) << "Incorrect completion count.";
+    for( U32 index = 0; index < (U32)results.mRequestIds.size(); ++index )
+    {
+        const U32 requestId = results.mRequestIds[index];
+        ASSERT_TRUE( requestId != requestIds[1] && requestId != requestIds[ASSET_ASYNC_ACQUIRE_MAX_LOADING] ) << "Cancelled request " << requestId << " completed.";
+        ASSERT_TRUE( results.mAssets[index] != NULL ) << "Request " << requestId << " did not acquire its asset.";
+    }
+
+    // The cancelled requests didn't keep any references.
+    for( U32 index = 0; index <= ASSET_ASYNC_ACQUIRE_MAX_LOADING; ++index )
+    {
+        ASSERT_FALSE( AssetDatabase.isAssetLoaded( assetIds[index] ) ) << "Asset '" << assetIds[index] << "' is still acquired.";
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( AssetAsyncAcquirerTests, cancelCommittingTest )
+{
+    ASSERT_EQ( 0U, AssetAsyncAcquirer::getPendingCount() ) << "Requests are pending before the test.";
+
+    // The asset cancels its request when it's added as the request acquires it.
+    AssetAsyncTestScope scope;
+    const StringTableEntry assetId = scope.addImageAsset( "asyncCancelCommitting", "AssetAsyncTestCancel" );
+    ASSERT_NE( StringTable->EmptyString, assetId ) << "Could not declare the test asset.";
+
+    AssetAsyncTestResults results;
+    const U32 requestId = scope.queue( assetId, 0, &results );
+    Con::setIntVariable( "$AssetAsyncTest::CancelRequestId", requestId );
+    Con::setBoolVariable( "$AssetAsyncTest::Cancelled", false );
+
+    processAssetAsyncRequests();
+    ASSERT_EQ( 0U, AssetAsyncAcquirer::getPendingCount() ) << "Request did not complete.";
+
+    // The request was cancelled while it was committed so it was never notified.
+    ASSERT_TRUE( Con::getBoolVariable( "$AssetAsyncTest::Cancelled" ) ) << "Could not cancel the committing request.";
+    ASSERT_EQ( 0, results.mRequestIds.size() ) << "Cancelled request completed.";
+
+    // The request released the asset it acquired.
+    ASSERT_FALSE( AssetDatabase.isAssetLoaded( assetId ) ) << "Asset is still acquired.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( AssetAsyncAcquirerTests, flushTest )
+{
+    ASSERT_EQ( 0U, AssetAsyncAcquirer::getPendingCount() ) << "Requests are pending before the test.";
+
+    AssetAsyncTestScope scope;
+    const StringTableEntry assetIdA = scope.addImageAsset( "asyncFlushA" );
+    const StringTableEntry assetIdB = scope.addImageAsset( "asyncFlushB" );
+    ASSERT_NE( StringTable->EmptyString, assetIdA ) << "Could not declare the test asset.";
+    ASSERT_NE( StringTable->EmptyString, assetIdB ) << "Could not declare the test asset.";
+
+    AssetAsyncTestResults results;
+    const U32 requestA = scope.queue( assetIdA, 0, &results );
+    const U32 requestB = scope.queue( assetIdB, 1, &results );
+    const U32 requestCancelled = scope.queue( assetIdA, 2, &results );
+    ASSERT_TRUE( AssetAsyncAcquirer::cancel( requestCancelled ) ) << "Could not cancel the request.";
+
+    // Complete the requests immediately.
+    AssetAsyncAcquirer::flush();
+    ASSERT_EQ( 0U, AssetAsyncAcquirer::getPendingCount() ) << "Requests did not complete.";
+
+    // Check they completed in order of priority.
+    ASSERT_EQ( 2, results.mRequestIds.size() ) << "Incorrect completion count.";
+    ASSERT_EQ( requestB, results.mRequestIds[0] ) << "Incorrect completion order.";
+    ASSERT_EQ( requestA, results.mRequestIds[1] ) << "Incorrect completion order.";
+    ASSERT_TRUE( results.mAssets[0] != NULL ) << "Request did not acquire its asset.";
+    ASSERT_TRUE( results.mAssets[1] != NULL ) << "Request did not acquire its asset.";
+
+    // Flushing without requests does nothing.
+    AssetAsyncAcquirer::flush();
+    ASSERT_EQ( 2, results.mRequestIds.size() ) << "Incorrect completion count.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( AssetAsyncAcquirerTests, ownershipTest )
+{
+    ASSERT_EQ( 0U, AssetAsyncAcquirer::getPendingCount() ) << "Requests are pending before the test.";
+
+    // Hold a reference so the private asset isn't removed when the requests release theirs.
+    AssetAsyncTestScope scope;
+    AssetPtr<ImageAsset> imageAsset( scope.addPrivateImageAsset( "asyncOwnership" ) );
+    ASSERT_FALSE( imageAsset.isNull() ) << "Could not add the test asset.";
+    const StringTableEntry assetId = imageAsset.getAssetId();
+    const S32 baseCount = imageAsset->getAcquiredReferenceCount();
+
+    SimObject* pNotifyObject = createNotifyObject();
+    ASSERT_TRUE( pNotifyObject != NULL ) << "Could not create the notify object.";
+    SimObjectPtr<SimObject> notifyObject( pNotifyObject );
+
+    // Keep the references the callback is given.
+    AssetAsyncTestResults results;
+    results.mReleaseAssets = false;
+
+    // The callback and the notify object each own a reference.
+    U32 requestId = scope.queue( assetId, 0, &results, pNotifyObject );
+    processAssetAsyncRequests();
+    ASSERT_EQ( 1, results.mRequestIds.size() ) << "The callback was not notified.";
+    ASSERT_EQ( 1, dAtoi( pNotifyObject->getDataField( StringTable->insert("notifyCount"), NULL ) ) ) << "The notify object was not notified.";
+    ASSERT_EQ( requestId, (U32)dAtoi( pNotifyObject->getDataField( StringTable->insert("requestId"), NULL ) ) ) << "The notify object was given the wrong request.";
+    ASSERT_STREQ( imageAsset->getIdString(), pNotifyObject->getDataField( StringTable->insert("asset"), NULL ) ) << "The notify object was given the wrong asset.";
+    ASSERT_EQ( baseCount + 2, imageAsset->getAcquiredReferenceCount() ) << "The callback and notify object don't each own a reference.";
+    AssetDatabase.releaseAsset( assetId );
+    AssetDatabase.releaseAsset( assetId );
+
+    // The callback alone owns the reference.
+    requestId = scope.queue( assetId, 0, &results );
+    processAssetAsyncRequests();
+    ASSERT_EQ( 2, results.mRequestIds.size() ) << "The callback was not notified.";
+    ASSERT_EQ( baseCount + 1, imageAsset->getAcquiredReferenceCount() ) << "The callback doesn't own a reference.";
+    AssetDatabase.releaseAsset( assetId );
+
+    // The notify object alone owns the reference.
+    requestId = scope.queue( assetId, 0, NULL, pNotifyObject );
+    processAssetAsyncRequests();
+    ASSERT_EQ( 2, dAtoi( pNotifyObject->getDataField( StringTable->insert("notifyCount"), NULL ) ) ) << "The notify object was not notified.";
+    ASSERT_EQ( baseCount + 1, imageAsset->getAcquiredReferenceCount() ) << "The notify object doesn't own a reference.";
+    AssetDatabase.releaseAsset( assetId );
+
+    // The reference is released if the notify object is deleted.
+    requestId = scope.queue( assetId, 0, NULL, pNotifyObject );
+    pNotifyObject->deleteObject();
+    ASSERT_TRUE( notifyObject.isNull() ) << "The notify object was not deleted.";
+    processAssetAsyncRequests();
+    ASSERT_EQ( 0U, AssetAsyncAcquirer::getPendingCount() ) << "Request did not complete.";
+    ASSERT_EQ( baseCount, imageAsset->getAcquiredReferenceCount() ) << "The reference was not released.";
+
+    // The reference is released if nobody is notified.
+    requestId = scope.queue( assetId, 0, NULL );
+    processAssetAsyncRequests();
+    ASSERT_EQ( 0U, AssetAsyncAcquirer::getPendingCount() ) << "Request did not complete.";
+    ASSERT_EQ( baseCount, imageAsset->getAcquiredReferenceCount() ) << "The reference was not released.";
+}
+
+#endif // TORQUE_SHIPPING
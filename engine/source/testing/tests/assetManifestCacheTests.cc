@@ -0,0 +1,175 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _ASSET_MANIFEST_CACHE_H_
+#include "assets/assetManifestCache.h"
+#endif
+
+#ifndef _TAML_READ_NODE_PARSER_H_
+#include "persistence/taml/tamlReadNodeParser.h"
+#endif
+
+#ifndef _TAML_ASSET_DECLARED_VISITOR_H_
+#include "assets/tamlAssetDeclaredVisitor.h"
+#endif
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define ASSET_MANIFEST_UNITTEST_FILES       20
+
+//-----------------------------------------------------------------------------
+
+static void writeTestAssetFile( const char* pFilename, const U32 index )
+{
+    char buffer[512];
+    dSprintf( buffer, sizeof(buffer),
+        "<ImageAsset AssetName=\"testImage%d\" AssetCategory=\"test\" AssetInternal=\"1\" ImageFile=\"@assetFile=testImage%d.png\">\n"
+        "    <ImageAsset.Cells>\n"
+        "        <Cell RegionName=\"@asset=TestModule:testImage%d\" />\n"
+        "    </ImageAsset.Cells>\n"
+        "</ImageAsset>\n",
+        index, index, index + 1 );
+
+    FileStream stream;
+    ASSERT_TRUE( stream.open( pFilename, FileStream::Write ) ) << "Could not write the test asset file.";
+    stream.writeStringBuffer( buffer );
+    stream.close();
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( AssetManifestCacheTests, readNodeParserTest )
+{
+    char fileName[1024];
+    dSprintf( fileName, sizeof(fileName), "%s/assetManifestTest.asset.taml", Platform::getTemporaryDirectory() );
+    writeTestAssetFile( fileName, 1 );
+
+    // Visit the file with the XML parser.
+    TamlAssetDeclaredVisitor xmlVisitor;
+    Taml taml;
+    ASSERT_TRUE( taml.parse( fileName, xmlVisitor ) ) << "Failed to parse the test asset file.";
+
+    // Visit the nodes read from the file.
+    TamlAssetDeclaredVisitor nodeVisitor;
+    TamlReadNode* pRootNode = TamlReadNodeParser::readNodes( fileName, Taml::XmlFormat );
+    ASSERT_TRUE( pRootNode != NULL ) << "Failed to read the test asset file.";
+    TamlReadNodeParser parser( Taml::XmlFormat );
+    ASSERT_TRUE( parser.accept( pRootNode, fileName, nodeVisitor ) ) << "Failed to visit the test asset file.";
+    delete pRootNode;
+
+    // Both find the same asset declaration.
+    AssetDefinition& xmlDefinition = xmlVisitor.getAssetDefinition();
+    AssetDefinition& nodeDefinition = nodeVisitor.getAssetDefinition();
+    ASSERT_EQ( StringTable->insert("testImage1"), nodeDefinition.mAssetName ) << "Incorrect asset name.";
+    ASSERT_EQ( xmlDefinition.mAssetType, nodeDefinition.mAssetType ) << "Incorrect asset type.";
+    ASSERT_EQ( xmlDefinition.mAssetCategory, nodeDefinition.mAssetCategory ) << "Incorrect asset category.";
+    ASSERT_EQ( xmlDefinition.mAssetInternal, nodeDefinition.mAssetInternal ) << "Incorrect asset internal flag.";
+    ASSERT_EQ( xmlDefinition.mAssetBaseFilePath, nodeDefinition.mAssetBaseFilePath ) << "Incorrect asset file-path.";
+    ASSERT_EQ( 1, nodeVisitor.getAssetDependencies().size() ) << "Incorrect asset dependency count.";
+    ASSERT_EQ( xmlVisitor.getAssetDependencies()[0], nodeVisitor.getAssetDependencies()[0] ) << "Incorrect asset dependency.";
+    ASSERT_EQ( 1, nodeVisitor.getAssetLooseFiles().size() ) << "Incorrect asset loose file count.";
+    ASSERT_EQ( xmlVisitor.getAssetLooseFiles()[0], nodeVisitor.getAssetLooseFiles()[0] ) << "Incorrect asset loose file.";
+
+    Platform::fileDelete( fileName );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( AssetManifestCacheTests, persistTest )
+{
+    char cacheFileName[1024];
+    dSprintf( cacheFileName, sizeof(cacheFileName), "%s/%s", Platform::getTemporaryDirectory(), ASSET_MANIFEST_CACHE_FILENAME );
+
+    FileTime modifyTime;
+    dMemset( &modifyTime, 0, sizeof(modifyTime) );
+
+    // Fill a cache.
+    AssetManifestCache manifestCache;
+    char buffer[1024];
+    for ( U32 index = 0; index < ASSET_MANIFEST_UNITTEST_FILES; ++index )
+    {
+        dSprintf( buffer, sizeof(buffer), "%s/testImage%d.asset.taml", Platform::getTemporaryDirectory(), index );
+        AssetManifestCache::Entry* pEntry = manifestCache.insert( StringTable->insert( buffer ), modifyTime, 100 + index );
+
+        dSprintf( buffer, sizeof(buffer), "testImage%d", index );
+        pEntry->mAssetDefinition.mAssetName = StringTable->insert( buffer );
+        pEntry->mAssetDefinition.mAssetType = StringTable->insert( "ImageAsset" );
+        pEntry->mAssetDefinition.mAssetAutoUnload = (index & 1) != 0;
+        pEntry->mAssetDependencies.push_back( StringTable->insert( "TestModule:testImage0" ) );
+        pEntry->mAssetLooseFiles.push_back( StringTable->insert( "testImage.png" ) );
+    }
+    ASSERT_TRUE( manifestCache.isDirty() ) << "The filled cache is not dirty.";
+    ASSERT_TRUE( manifestCache.write( cacheFileName ) ) << "Failed to write the cache.";
+    ASSERT_FALSE( manifestCache.isDirty() ) << "The written cache is dirty.";
+
+    // Read it back.
+    AssetManifestCache readCache;
+    ASSERT_TRUE( readCache.read( cacheFileName ) ) << "Failed to read the cache.";
+    ASSERT_EQ( (U32)ASSET_MANIFEST_UNITTEST_FILES, readCache.size() ) << "Incorrect entry count.";
+
+    for ( U32 index = 0; index < ASSET_MANIFEST_UNITTEST_FILES; ++index )
+    {
+        dSprintf( buffer, sizeof(buffer), "%s/testImage%d.asset.taml", Platform::getTemporaryDirectory(), index );
+        StringTableEntry filePath = StringTable->insert( buffer );
+
+        // A file that changed size is not found.
+        if ( index == 0 )
+        {
+            ASSERT_TRUE( readCache.find( filePath, modifyTime, 1 ) == NULL ) << "Found a changed file.";
+            continue;
+        }
+
+        AssetManifestCache::Entry* pEntry = readCache.find( filePath, modifyTime, 100 + index );
+        ASSERT_TRUE( pEntry != NULL ) << "Failed to find entry " << index;
+
+        dSprintf( buffer, sizeof(buffer), "testImage%d", index );
+        ASSERT_EQ( StringTable->insert( buffer ), pEntry->mAssetDefinition.mAssetName ) << "Incorrect asset name.";
+        ASSERT_EQ( filePath, pEntry->mAssetDefinition.mAssetBaseFilePath ) << "Incorrect asset file-path.";
+        ASSERT_EQ( (index & 1) != 0, pEntry->mAssetDefinition.mAssetAutoUnload ) << "Incorrect asset auto-unload flag.";
+        ASSERT_EQ( 1, pEntry->mAssetDependencies.size() ) << "Incorrect asset dependency count.";
+        ASSERT_EQ( 1, pEntry->mAssetLooseFiles.size() ) << "Incorrect asset loose file count.";
+    }
+
+    // The changed file is forgotten.
+    ASSERT_EQ( 1, readCache.removeUnused() ) << "Incorrect unused entry count.";
+    ASSERT_TRUE( readCache.isDirty() ) << "The cache is not dirty after removing an entry.";
+
+    Platform::fileDelete( cacheFileName );
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,125 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _BATCH_RENDER_H_
+#include "2d/core/BatchRender.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define BATCHRENDER_UNITTEST_FLUSH_QUADS    8192
+#define BATCHRENDER_UNITTEST_VERTEX_BYTES   (sizeof(Vector2) * 2 + 4)
+
+//-----------------------------------------------------------------------------
+
+static void submitBatchRenderTestQuads( BatchRender* pBatchRenderer, TextureHandle& texture, const bool colored )
+{
+    const ColorF color = colored ? ColorF( 1.0f, 0.5f, 0.25f, 1.0f ) : ColorF( -1.0f, -1.0f, -1.0f );
+
+    for ( U32 n = 0; n < BATCHRENDER_UNITTEST_FLUSH_QUADS; ++n )
+    {
+        const F32 x = (F32)n;
+        pBatchRenderer->SubmitQuad(
+            Vector2( x, 0.0f ), Vector2( x + 1.0f, 0.0f ), Vector2( x + 1.0f, 1.0f ), Vector2( x, 1.0f ),
+            Vector2( 0.0f, 0.0f ), Vector2( 1.0f, 0.0f ), Vector2( 1.0f, 1.0f ), Vector2( 0.0f, 1.0f ),
+            texture,
+            color );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( BatchRenderTests, streamingWrapTest )
+{
+    // The batch renderer buffers are too big for the stack.
+    BatchRender* pBatchRenderer = new BatchRender();
+    DebugStats debugStats;
+    pBatchRenderer->setDebugStats( &debugStats );
+    pBatchRenderer->setStreamingMode( true );
+
+    TextureHandle texture;
+
+    // Without vertex buffer objects the vertices are drawn from the client-side arrays.
+    if ( !dglDoesSupportVertexBufferObject() )
+    {
+        submitBatchRenderTestQuads( pBatchRenderer, texture, false );
+        pBatchRenderer->flush();
+        ASSERT_EQ( 0U, pBatchRenderer->getStreamBufferOffset() ) << "Vertices were streamed without vertex buffer objects.";
+        ASSERT_EQ( 0U, debugStats.batchBufferOrphans ) << "A buffer was orphaned without vertex buffer objects.";
+
+        delete pBatchRenderer;
+        return;
+    }
+
+    const U32 flushBytes = BATCHRENDER_UNITTEST_FLUSH_QUADS * 4 * BATCHRENDER_UNITTEST_VERTEX_BYTES;
+    const U32 flushesPerBuffer = BATCHRENDER_STREAMBUFFERSIZE / flushBytes;
+    ASSERT_TRUE( flushesPerBuffer > 1 && BATCHRENDER_STREAMBUFFERSIZE % flushBytes != 0 ) << "The flushes do not wrap the buffer part way through.";
+
+    // Each flush is uploaded after the previous one until the buffer is full.
+    for ( U32 flush = 1; flush <= flushesPerBuffer; ++flush )
+    {
+        submitBatchRenderTestQuads( pBatchRenderer, texture, (flush & 1) != 0 );
+        pBatchRenderer->flush();
+        ASSERT_EQ( flush * flushBytes, pBatchRenderer->getStreamBufferOffset() ) << "Incorrect stream buffer offset after flush " << flush;
+        ASSERT_EQ( flush * flushBytes, debugStats.batchBytesUploaded ) << "Incorrect bytes uploaded after flush " << flush;
+    }
+    ASSERT_EQ( 0U, debugStats.batchBufferOrphans ) << "The buffer was orphaned before it was full.";
+
+    // The next flush would overrun the buffer so it's orphaned and the upload starts again at the beginning.
+    submitBatchRenderTestQuads( pBatchRenderer, texture, false );
+    pBatchRenderer->flush();
+    ASSERT_EQ( 1U, debugStats.batchBufferOrphans ) << "The full buffer was not orphaned.";
+    ASSERT_EQ( flushBytes, pBatchRenderer->getStreamBufferOffset() ) << "Incorrect stream buffer offset after wrapping.";
+
+    // Strict order flushes carry on after the restarted upload.
+    pBatchRenderer->setStrictOrderMode( true );
+    submitBatchRenderTestQuads( pBatchRenderer, texture, true );
+    pBatchRenderer->flush();
+    ASSERT_EQ( 1U, debugStats.batchBufferOrphans ) << "The buffer was orphaned after wrapping.";
+    ASSERT_EQ( 2 * flushBytes, pBatchRenderer->getStreamBufferOffset() ) << "Incorrect stream buffer offset after wrapping.";
+    ASSERT_EQ( (flushesPerBuffer + 2) * flushBytes, debugStats.batchBytesUploaded ) << "Incorrect bytes uploaded after wrapping.";
+
+    // A new buffer starts at the beginning without being counted as orphaned.
+    pBatchRenderer->setStreamingMode( false );
+    ASSERT_EQ( 0U, pBatchRenderer->getStreamBufferOffset() ) << "The stream buffer was not released.";
+    pBatchRenderer->setStreamingMode( true );
+    submitBatchRenderTestQuads( pBatchRenderer, texture, false );
+    pBatchRenderer->flush();
+    ASSERT_EQ( flushBytes, pBatchRenderer->getStreamBufferOffset() ) << "Incorrect stream buffer offset for a new buffer.";
+    ASSERT_EQ( 1U, debugStats.batchBufferOrphans ) << "A new buffer was counted as orphaned.";
+
+    delete pBatchRenderer;
+}
+
+#endif // TORQUE_SHIPPING
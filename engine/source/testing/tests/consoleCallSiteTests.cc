@@ -0,0 +1,203 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+#ifndef _COMPILER_H_
+#include "console/compiler.h"
+#endif
+
+#ifndef _CONSOLE_NAMESPACE_H
+#include "console/consoleNamespace.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define CONSOLE_UNITTEST_BENCHMARK_CALLS    200000
+
+//-----------------------------------------------------------------------------
+
+static void defineCallSiteTestScript( void )
+{
+    Con::evaluate(
+        "function callSiteTestFunction() { return 1; }"
+        "function CallSiteTestBase::value(%this) { return 10; }"
+        "function CallSiteTestDerived::value(%this) { return 100 + Parent::value(%this); }"
+        "package CallSiteTestPackage"
+        "{"
+        "   function callSiteTestFunction() { return 2; }"
+        "   function CallSiteTestBase::value(%this) { return 20; }"
+        "};"
+        "function callSiteTestCall(%object) { return callSiteTestFunction() + %object.value(); }"
+        "function callSiteTestBenchmark(%object, %count)"
+        "{"
+        "   %matched = 0;"
+        "   for (%i = 0; %i < %count; %i++)"
+        "      if (callSiteTestFunction() + %object.value() == 111)"
+        "         %matched++;"
+        "   return %matched;"
+        "}"
+        );
+}
+
+//-----------------------------------------------------------------------------
+
+static void defineCallSiteSequenceScript( void )
+{
+    Con::evaluate(
+        "function callSiteSequenceFunction() { return 1; }"
+        "function CallSiteSequenceBase::value(%this) { return 10; }"
+        "function CallSiteSequenceDerived::value(%this) { return 100 + Parent::value(%this); }"
+        "package CallSiteSequencePackage"
+        "{"
+        "   function callSiteSequenceFunction() { return 4 + Parent::callSiteSequenceFunction(); }"
+        "   function CallSiteSequenceDerived::value(%this) { return 1000 + Parent::value(%this); }"
+        "};"
+        "function callSiteSequenceCall(%object) { return callSiteSequenceFunction() + %object.value(); }"
+        );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ConsoleCallSiteTests, resolveTest )
+{
+    defineCallSiteTestScript();
+
+    // NOTE: The result of an evaluation is only valid until the next one.
+    char baseId[32];
+    char derivedId[32];
+    dStrcpy( baseId, Con::evaluate( "return new ScriptObject() { class = \"CallSiteTestBase\"; };" ) );
+    dStrcpy( derivedId, Con::evaluate( "return new ScriptObject() { class = \"CallSiteTestDerived\"; superclass = \"CallSiteTestBase\"; };" ) );
+
+    // The same call sites should follow the object being called.
+    ASSERT_EQ( 11, dAtoi( Con::executef( 2, "callSiteTestCall", baseId ) ) ) << "Incorrect base call.";
+    ASSERT_EQ( 111, dAtoi( Con::executef( 2, "callSiteTestCall", derivedId ) ) ) << "Incorrect derived call.";
+    ASSERT_EQ( 11, dAtoi( Con::executef( 2, "callSiteTestCall", baseId ) ) ) << "Incorrect base call after a derived call.";
+
+    // Activating the package should be seen by call sites that have already been resolved.
+    Con::evaluate( "activatePackage(CallSiteTestPackage);" );
+    ASSERT_EQ( 22, dAtoi( Con::executef( 2, "callSiteTestCall", baseId ) ) ) << "Incorrect base call with the package active.";
+    ASSERT_EQ( 122, dAtoi( Con::executef( 2, "callSiteTestCall", derivedId ) ) ) << "Incorrect derived call with the package active.";
+
+    Con::evaluate( "deactivatePackage(CallSiteTestPackage);" );
+    ASSERT_EQ( 11, dAtoi( Con::executef( 2, "callSiteTestCall", baseId ) ) ) << "Incorrect base call after deactivating the package.";
+
+    // Redefining a function should also be seen.
+    Con::evaluate( "function callSiteTestFunction() { return 3; }" );
+    ASSERT_EQ( 113, dAtoi( Con::executef( 2, "callSiteTestCall", derivedId ) ) ) << "Incorrect call after redefining a function.";
+
+    Con::evaluatef( "%s.delete(); %s.delete();", baseId, derivedId );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ConsoleCallSiteTests, sequenceTest )
+{
+    defineCallSiteSequenceScript();
+
+    CodeBlock::smCallSiteCaching = true;
+
+    char objectId[32];
+    dStrcpy( objectId, Con::evaluate( "return new ScriptObject() { class = \"CallSiteSequenceDerived\"; superclass = \"CallSiteSequenceBase\"; };" ) );
+
+    // Resolve the function, method and parent call sites.
+    ASSERT_EQ( 111, dAtoi( Con::executef( 2, "callSiteSequenceCall", objectId ) ) ) << "Incorrect initial call.";
+    ASSERT_EQ( 111, dAtoi( Con::executef( 2, "callSiteSequenceCall", objectId ) ) ) << "Incorrect cached call.";
+
+    // Redefining the parent method should move the sequence on and re-resolve the parent call site.
+    U32 cacheSequence = Namespace::mCacheSequence;
+    Con::evaluate( "function CallSiteSequenceBase::value(%this) { return 20; }" );
+    ASSERT_NE( cacheSequence, Namespace::mCacheSequence ) << "Redefining a function should change the cache sequence.";
+    ASSERT_EQ( 121, dAtoi( Con::executef( 2, "callSiteSequenceCall", objectId ) ) ) << "Incorrect call after redefining the parent method.";
+
+    // Activating the package should re-resolve every call site and its parent calls should reach the definitions it replaced.
+    cacheSequence = Namespace::mCacheSequence;
+    Con::evaluate( "activatePackage(CallSiteSequencePackage);" );
+    ASSERT_NE( cacheSequence, Namespace::mCacheSequence ) << "Activating a package should change the cache sequence.";
+    ASSERT_EQ( 1125, dAtoi( Con::executef( 2, "callSiteSequenceCall", objectId ) ) ) << "Incorrect call with the package active.";
+    ASSERT_EQ( 1125, dAtoi( Con::executef( 2, "callSiteSequenceCall", objectId ) ) ) << "Incorrect cached call with the package active.";
+
+    // Deactivating the package should restore the original resolution.
+    cacheSequence = Namespace::mCacheSequence;
+    Con::evaluate( "deactivatePackage(CallSiteSequencePackage);" );
+    ASSERT_NE( cacheSequence, Namespace::mCacheSequence ) << "Deactivating a package should change the cache sequence.";
+    ASSERT_EQ( 121, dAtoi( Con::executef( 2, "callSiteSequenceCall", objectId ) ) ) << "Incorrect call after deactivating the package.";
+
+    // A parent call made directly on the base namespace should still dispatch.
+    ASSERT_EQ( 20, dAtoi( Con::evaluatef( "return CallSiteSequenceBase::value(%s);", objectId ) ) ) << "Incorrect direct namespace call.";
+
+    Con::evaluatef( "%s.delete();", objectId );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ConsoleCallSiteTests, callBenchmark )
+{
+    defineCallSiteTestScript();
+
+    const char* pObject = Con::evaluate( "return new ScriptObject() { class = \"CallSiteTestDerived\"; superclass = \"CallSiteTestBase\"; };" );
+    char objectId[32];
+    dStrcpy( objectId, pObject );
+
+    char callCount[32];
+    dSprintf( callCount, sizeof(callCount), "%d", CONSOLE_UNITTEST_BENCHMARK_CALLS );
+
+    // Count the calls that return the expected value rather than summing them as script variables are only floats.
+    const S32 expectedTotal = CONSOLE_UNITTEST_BENCHMARK_CALLS;
+
+    // Call without the call site caches.
+    CodeBlock::smCallSiteCaching = false;
+    U32 startTime = Platform::getRealMilliseconds();
+    const S32 uncachedTotal = dAtoi( Con::executef( 3, "callSiteTestBenchmark", objectId, callCount ) );
+    const U32 uncachedTime = Platform::getRealMilliseconds() - startTime;
+
+    // Call with the call site caches.
+    CodeBlock::smCallSiteCaching = true;
+    startTime = Platform::getRealMilliseconds();
+    const S32 cachedTotal = dAtoi( Con::executef( 3, "callSiteTestBenchmark", objectId, callCount ) );
+    const U32 cachedTime = Platform::getRealMilliseconds() - startTime;
+
+    Con::evaluatef( "%s.delete();", objectId );
+
+    ASSERT_EQ( expectedTotal, uncachedTotal ) << "Incorrect uncached total.";
+    ASSERT_EQ( expectedTotal, cachedTotal ) << "Incorrect cached total.";
+
+    Con::printf( "ConsoleCallSite: %d function, method and parent calls - uncached %dms, cached %dms.",
+        CONSOLE_UNITTEST_BENCHMARK_CALLS * 3, uncachedTime, cachedTime );
+}
+
+#endif // TORQUE_SHIPPING
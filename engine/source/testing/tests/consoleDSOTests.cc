@@ -0,0 +1,320 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+#ifndef _COMPILER_H_
+#include "console/compiler.h"
+#endif
+
+#ifndef _STRINGTABLE_H_
+#include "string/stringTable.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+#ifndef _PLATFORM_FILEIO_H_
+#include "platform/platformFileIO.h"
+#endif
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+#ifndef _JOB_SYSTEM_H_
+#include "platform/threads/jobSystem.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define CONSOLE_UNITTEST_BENCHMARK_LOADS    5
+#define CONSOLE_UNITTEST_PARALLEL_COMPILES  32
+
+#define CONSOLE_UNITTEST_DSO_SCRIPT \
+    "function dsoTestValue(%value) { return %value * 2.5 + strlen(\"abc\"); }" \
+    "$dsoTestResult = dsoTestValue(4) @ \"-\" @ 'tagged';"
+
+#define CONSOLE_UNITTEST_DSO_LATER_SCRIPT \
+    "function dsoTestLater(%value) { return %value @ \"-later-\" @ %value * 1.5; }" \
+    "$dsoTestLoaded = \"loaded\" @ 2.5;"
+
+//-----------------------------------------------------------------------------
+
+static bool compileTestDSO( const char* pScriptFileName, const char* pDSOFileName, const char* pScript )
+{
+    CodeBlock* pCodeBlock = new CodeBlock();
+    const bool compiled = pCodeBlock->compile( pDSOFileName, StringTable->insert( pScriptFileName ), pScript );
+    delete pCodeBlock;
+    return compiled;
+}
+
+//-----------------------------------------------------------------------------
+
+static CodeBlock* loadTestDSO( const char* pScriptFileName, const char* pDSOFileName, const bool mapped )
+{
+    CodeBlock* pCodeBlock = new CodeBlock();
+    StringTableEntry scriptFileName = StringTable->insert( pScriptFileName );
+
+    if ( mapped )
+    {
+        if ( pCodeBlock->readMapped( scriptFileName, pDSOFileName ) )
+            return pCodeBlock;
+    }
+    else
+    {
+        FileStream stream;
+        U32 version;
+        if ( stream.open( pDSOFileName, FileStream::Read ) && stream.read( &version ) && version == DSO_VERSION && pCodeBlock->read( scriptFileName, stream ) )
+            return pCodeBlock;
+    }
+
+    delete pCodeBlock;
+    return NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ConsoleDSOTests, loadTest )
+{
+    char scriptFileName[1024];
+    char dsoFileName[1024];
+    dSprintf( scriptFileName, sizeof(scriptFileName), "%s/consoleDSOTest.cs", Platform::getTemporaryDirectory() );
+    dSprintf( dsoFileName, sizeof(dsoFileName), "%s.dso", scriptFileName );
+
+    // The DSO should execute the same whether it's read or mapped.
+    for ( U32 pass = 0; pass < 2; ++pass )
+    {
+        const bool mapped = pass == 1;
+        if ( mapped && !FileView::isMappingSupported() )
+            break;
+
+        ASSERT_TRUE( compileTestDSO( scriptFileName, dsoFileName, CONSOLE_UNITTEST_DSO_SCRIPT ) ) << "The script did not compile.";
+
+        CodeBlock* pCodeBlock = loadTestDSO( scriptFileName, dsoFileName, mapped );
+        ASSERT_TRUE( pCodeBlock != NULL ) << "The DSO did not load (mapped = " << mapped << ").";
+        ASSERT_TRUE( mapped == (pCodeBlock->mpFileView != NULL) ) << "The DSO was not loaded as expected.";
+
+        Con::setVariable( "$dsoTestResult", "" );
+        pCodeBlock->exec( 0, pCodeBlock->name, NULL, 0, NULL, false, NULL, 0 );
+        const char* pResult = Con::getVariable( "$dsoTestResult" );
+        ASSERT_EQ( 0, dStrncmp( pResult, "13-", 3 ) ) << "Incorrect result (mapped = " << mapped << ").";
+        ASSERT_EQ( 13.0f, dAtof( Con::executef( 2, "dsoTestValue", "4" ) ) ) << "Incorrect function result (mapped = " << mapped << ").";
+
+        // Replacing the DSO shouldn't affect the code already loaded from it.
+        ASSERT_TRUE( compileTestDSO( scriptFileName, dsoFileName, "function dsoTestOther() { return 1; }" ) ) << "The replacement script did not compile.";
+        ASSERT_EQ( 13.0f, dAtof( Con::executef( 2, "dsoTestValue", "4" ) ) ) << "Incorrect function result after replacing the DSO (mapped = " << mapped << ").";
+
+        // Redefining the function releases the code block.
+        Con::evaluate( "function dsoTestValue(%value) { return 0; }" );
+    }
+
+    Platform::fileDelete( dsoFileName );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ConsoleDSOTests, functionAfterExecTest )
+{
+    char scriptFileName[1024];
+    char dsoFileName[1024];
+    dSprintf( scriptFileName, sizeof(scriptFileName), "%s/consoleDSOLaterTest.cs", Platform::getTemporaryDirectory() );
+    dSprintf( dsoFileName, sizeof(dsoFileName), "%s.dso", scriptFileName );
+
+    // The functions of a DSO should still run from its image once its top-level code has finished.
+    for ( U32 pass = 0; pass < 2; ++pass )
+    {
+        const bool mapped = pass == 1;
+        if ( mapped && !FileView::isMappingSupported() )
+            break;
+
+        ASSERT_TRUE( compileTestDSO( scriptFileName, dsoFileName, CONSOLE_UNITTEST_DSO_LATER_SCRIPT ) ) << "The script did not compile.";
+
+        CodeBlock* pCodeBlock = loadTestDSO( scriptFileName, dsoFileName, mapped );
+        ASSERT_TRUE( pCodeBlock != NULL ) << "The DSO did not load (mapped = " << mapped << ").";
+
+        Con::setVariable( "$dsoTestLoaded", "" );
+        pCodeBlock->exec( 0, pCodeBlock->name, NULL, 0, NULL, false, NULL, 0 );
+        ASSERT_STREQ( "loaded2.5", Con::getVariable( "$dsoTestLoaded" ) ) << "Incorrect top-level result (mapped = " << mapped << ").";
+
+        // The top-level code has finished and released its global strings and floats.
+        ASSERT_TRUE( pCodeBlock->globalStrings == NULL ) << "The global strings should be released (mapped = " << mapped << ").";
+        ASSERT_TRUE( mapped == (pCodeBlock->mpFileView != NULL) ) << "The DSO image should still be held (mapped = " << mapped << ").";
+
+        for ( U32 call = 0; call < 3; ++call )
+        {
+            ASSERT_STREQ( "2-later-3", Con::executef( 2, "dsoTestLater", "2" ) ) << "Incorrect function result (mapped = " << mapped << ").";
+            Con::evaluate( "$dsoTestOther = \"other\" @ 1;" );
+        }
+
+        // Redefining the function releases the code block and its image.
+        Con::evaluate( "function dsoTestLater(%value) { return 0; }" );
+    }
+
+    Platform::fileDelete( dsoFileName );
+}
+
+//-----------------------------------------------------------------------------
+
+struct ParallelCompileContext
+{
+    StringTableEntry mScriptFileName;
+    U8* mpImages[CONSOLE_UNITTEST_PARALLEL_COMPILES];
+    U32 mImageSizes[CONSOLE_UNITTEST_PARALLEL_COMPILES];
+};
+
+static void parallelCompileJob( void* pContext, const U32 jobIndex )
+{
+    ParallelCompileContext* pCompileContext = (ParallelCompileContext*)pContext;
+
+    CodeBlock* pCodeBlock = new CodeBlock();
+    if ( !pCodeBlock->compileToImage( pCompileContext->mScriptFileName, CONSOLE_UNITTEST_DSO_SCRIPT, pCompileContext->mpImages[jobIndex], pCompileContext->mImageSizes[jobIndex] ) )
+        pCompileContext->mpImages[jobIndex] = NULL;
+    delete pCodeBlock;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ConsoleDSOTests, parallelCompileTest )
+{
+    ParallelCompileContext context;
+    context.mScriptFileName = StringTable->insert( "consoleDSOParallelTest.cs" );
+
+    // Compile the script on this thread.
+    U8* pExpectedImage = NULL;
+    U32 expectedImageSize = 0;
+    CodeBlock* pCodeBlock = new CodeBlock();
+    ASSERT_TRUE( pCodeBlock->compileToImage( context.mScriptFileName, CONSOLE_UNITTEST_DSO_SCRIPT, pExpectedImage, expectedImageSize ) ) << "The script did not compile.";
+    delete pCodeBlock;
+
+    // Compiling the script on the job workers at once should produce the same image.
+    JobSystem::parallelFor( parallelCompileJob, &context, CONSOLE_UNITTEST_PARALLEL_COMPILES );
+
+    for ( U32 index = 0; index < CONSOLE_UNITTEST_PARALLEL_COMPILES; ++index )
+    {
+        ASSERT_TRUE( context.mpImages[index] != NULL ) << "The script did not compile on job " << index;
+        ASSERT_EQ( expectedImageSize, context.mImageSizes[index] ) << "Incorrect image size on job " << index;
+        ASSERT_EQ( 0, dMemcmp( pExpectedImage, context.mpImages[index], expectedImageSize ) ) << "Incorrect image on job " << index;
+        delete [] context.mpImages[index];
+    }
+
+    // The image should load (the code block takes ownership of it).
+    pCodeBlock = new CodeBlock();
+    pCodeBlock->mpImage = pExpectedImage;
+    ASSERT_TRUE( pCodeBlock->loadImage( pExpectedImage, expectedImageSize ) ) << "The image did not load.";
+    delete pCodeBlock;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ConsoleDSOTests, startupBenchmark )
+{
+    // Find the scripts of the bundled modules.
+    char modulesPath[1024];
+    dSprintf( modulesPath, sizeof(modulesPath), "%s/modules", Platform::getMainDotCsDir() );
+
+    Vector<Platform::FileInfo> files;
+    Platform::dumpPath( modulesPath, files );
+
+    Vector<StringTableEntry> scriptFileNames;
+    Vector<StringTableEntry> dsoFileNames;
+    for ( S32 index = 0; index < files.size(); ++index )
+    {
+        const char* pExtension = dStrrchr( files[index].pFileName, '.' );
+        if ( pExtension == NULL || dStricmp( pExtension, ".cs" ) != 0 )
+            continue;
+
+        char scriptFileName[1024];
+        char dsoFileName[1024];
+        dSprintf( scriptFileName, sizeof(scriptFileName), "%s/%s", files[index].pFullPath, files[index].pFileName );
+        dSprintf( dsoFileName, sizeof(dsoFileName), "%s/consoleDSOBenchmark/%d.dso", Platform::getTemporaryDirectory(), scriptFileNames.size() );
+
+        // Compile the script.
+        FileStream stream;
+        if ( !stream.open( scriptFileName, FileStream::Read ) )
+            continue;
+
+        const U32 scriptSize = stream.getStreamSize();
+        char* pScript = new char[scriptSize + 1];
+        stream.read( scriptSize, pScript );
+        pScript[scriptSize] = 0;
+        stream.close();
+
+        const bool compiled = compileTestDSO( scriptFileName, dsoFileName, pScript );
+        delete [] pScript;
+
+        if ( compiled )
+        {
+            scriptFileNames.push_back( StringTable->insert( scriptFileName ) );
+            dsoFileNames.push_back( StringTable->insert( dsoFileName ) );
+        }
+    }
+
+    if ( scriptFileNames.size() == 0 )
+    {
+        Con::printf( "ConsoleDSO: No module scripts were found in '%s'.", modulesPath );
+        return;
+    }
+
+    // Load all the DSOs (without executing them) both ways.
+    U32 loadTimes[2] = { 0, 0 };
+    for ( U32 pass = 0; pass < 2; ++pass )
+    {
+        const bool mapped = pass == 1;
+        if ( mapped && !FileView::isMappingSupported() )
+            break;
+
+        const U32 startTime = Platform::getRealMilliseconds();
+        for ( U32 load = 0; load < CONSOLE_UNITTEST_BENCHMARK_LOADS; ++load )
+        {
+            for ( S32 index = 0; index < scriptFileNames.size(); ++index )
+            {
+                CodeBlock* pCodeBlock = loadTestDSO( scriptFileNames[index], dsoFileNames[index], mapped );
+                ASSERT_TRUE( pCodeBlock != NULL ) << "The DSO for '" << scriptFileNames[index] << "' did not load (mapped = " << mapped << ").";
+                delete pCodeBlock;
+            }
+        }
+        loadTimes[pass] = Platform::getRealMilliseconds() - startTime;
+    }
+
+    for ( S32 index = 0; index < dsoFileNames.size(); ++index )
+        Platform::fileDelete( dsoFileNames[index] );
+
+    Con::printf( "ConsoleDSO: %d loads of %d module DSOs - read %dms, mapped %dms.",
+        CONSOLE_UNITTEST_BENCHMARK_LOADS, scriptFileNames.size(), loadTimes[0], loadTimes[1] );
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,293 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+#ifndef _STRINGTABLE_H_
+#include "string/stringTable.h"
+#endif
+
+#ifndef _SIM_FIELD_DICTIONARY_H_
+#include "sim/simFieldDictionary.h"
+#endif
+
+#ifndef _SCRIPT_OBJECT_H_
+#include "sim/scriptObject.h"
+#endif
+
+#ifndef _TAML_H_
+#include "persistence/taml/taml.h"
+#endif
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+#ifndef _MEMSTREAM_H_
+#include "io/memstream.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define CONSOLE_UNITTEST_BENCHMARK_ITERATIONS   200000
+#define CONSOLE_UNITTEST_WRITE_BUFFER_SIZE      16384
+
+//-----------------------------------------------------------------------------
+
+static U32 readTypedFieldTestFile( const char* pFileName, char* pBuffer, const U32 bufferSize )
+{
+    FileStream stream;
+    if ( !stream.open( pFileName, FileStream::Read ) )
+        return 0;
+
+    const U32 size = stream.getStreamSize();
+    if ( size > bufferSize || !stream.read( size, pBuffer ) )
+        return 0;
+
+    return size;
+}
+
+//-----------------------------------------------------------------------------
+
+static const S32 typedFieldTestInts[] = { 0, -42, 2147483647, -2147483647 - 1 };
+static const F64 typedFieldTestFloats[] = { 1.5, 1e10, -0.0, 0.0, 1.0 / 3.0, -2.5e-20, 123456789.0, 0.1 };
+static const U32 typedFieldTestIntCount = sizeof(typedFieldTestInts) / sizeof(S32);
+static const U32 typedFieldTestFloatCount = sizeof(typedFieldTestFloats) / sizeof(F64);
+
+//-----------------------------------------------------------------------------
+
+static void createTypedFieldTestObjects( ScriptObject*& pTypedObject, ScriptObject*& pTextObject )
+{
+    pTypedObject = new ScriptObject();
+    pTextObject = new ScriptObject();
+    pTypedObject->registerObject();
+    pTextObject->registerObject();
+
+    StringTableEntry intSlot = StringTable->insert( "typedFieldTestInt" );
+    StringTableEntry floatSlot = StringTable->insert( "typedFieldTestFloat" );
+
+    // Set one object from numbers and the other from the text the string stack formats them as.
+    char index[16];
+    char text[32];
+    for ( U32 valueIndex = 0; valueIndex < typedFieldTestIntCount; ++valueIndex )
+    {
+        dSprintf( index, sizeof(index), "%d", valueIndex );
+        dSprintf( text, sizeof(text), "%d", typedFieldTestInts[valueIndex] );
+        pTypedObject->setDataFieldInt( intSlot, index, typedFieldTestInts[valueIndex] );
+        pTextObject->setDataField( intSlot, index, text );
+    }
+    for ( U32 valueIndex = 0; valueIndex < typedFieldTestFloatCount; ++valueIndex )
+    {
+        dSprintf( index, sizeof(index), "%d", valueIndex );
+        dSprintf( text, sizeof(text), "%.9g", typedFieldTestFloats[valueIndex] );
+        pTypedObject->setDataFieldFloat( floatSlot, index, typedFieldTestFloats[valueIndex] );
+        pTextObject->setDataField( floatSlot, index, text );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ConsoleTypedFieldTests, dictionaryTest )
+{
+    SimFieldDictionary dictionary;
+    StringTableEntry intSlot = StringTable->insert( "typedFieldTestInt" );
+    StringTableEntry floatSlot = StringTable->insert( "typedFieldTestFloat" );
+    StringTableEntry textSlot = StringTable->insert( "typedFieldTestText" );
+
+    // Numbers should read back as the text they would have been formatted as.
+    dictionary.setFieldIntValue( intSlot, -42 );
+    dictionary.setFieldFloatValue( floatSlot, 0.25 );
+    dictionary.setFieldValue( textSlot, "7.5" );
+
+    ASSERT_STREQ( "-42", dictionary.getFieldValue( intSlot ) ) << "Incorrect integer text.";
+    ASSERT_STREQ( "0.25", dictionary.getFieldValue( floatSlot ) ) << "Incorrect float text.";
+    ASSERT_EQ( -42, dictionary.getFieldIntValue( intSlot ) ) << "Incorrect integer value.";
+    ASSERT_EQ( -42.0f, dictionary.getFieldFloatValue( intSlot ) ) << "Incorrect integer value read as a float.";
+    ASSERT_EQ( 0.25f, dictionary.getFieldFloatValue( floatSlot ) ) << "Incorrect float value.";
+    ASSERT_EQ( 0, dictionary.getFieldIntValue( floatSlot ) ) << "Incorrect float value read as an integer.";
+    ASSERT_EQ( 7, dictionary.getFieldIntValue( textSlot ) ) << "Incorrect text read as an integer.";
+    ASSERT_EQ( 7.5f, dictionary.getFieldFloatValue( textSlot ) ) << "Incorrect text read as a float.";
+
+    // Changing the type of a field should replace its value.
+    dictionary.setFieldValue( intSlot, "text" );
+    ASSERT_STREQ( "text", dictionary.getFieldValue( intSlot ) ) << "Incorrect text after setting an integer field to text.";
+    dictionary.setFieldFloatValue( textSlot, 1.0 / 3.0 );
+    ASSERT_STREQ( "0.333333333", dictionary.getFieldValue( textSlot ) ) << "Incorrect text after setting a text field to a float.";
+
+    // Setting an empty value should remove the field.
+    dictionary.setFieldValue( floatSlot, "" );
+    ASSERT_TRUE( dictionary.getFieldValue( floatSlot ) == NULL ) << "The field was not removed.";
+    ASSERT_EQ( 0, dictionary.getFieldIntValue( floatSlot ) ) << "Incorrect value of a removed field.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ConsoleTypedFieldTests, scriptTest )
+{
+    const char* pObject = Con::evaluate(
+        "$typedFieldTestObject = new ScriptObject();"
+        "$typedFieldTestObject.count = 0;"
+        "for ($typedFieldTestIndex = 0; $typedFieldTestIndex < 10; $typedFieldTestIndex++)"
+        "{"
+        "   $typedFieldTestObject.count++;"
+        "   $typedFieldTestObject.total += $typedFieldTestIndex * 0.5;"
+        "   $typedFieldTestObject.cell[$typedFieldTestIndex % 2] = $typedFieldTestIndex * 3;"
+        "}"
+        "$typedFieldTestObject.literal = 1.50;"
+        "$typedFieldTestObject.negative = -$typedFieldTestObject.count;"
+        "$typedFieldTestObject.third = 1 / 3;"
+        "return $typedFieldTestObject;"
+        );
+    char objectId[32];
+    dStrcpy( objectId, pObject );
+
+    // The fields should hold exactly the text they held when the numbers were formatted as strings.
+    ASSERT_STREQ( "10", Con::evaluatef( "return %s.count;", objectId ) ) << "Incorrect incremented field.";
+    ASSERT_STREQ( "22.5", Con::evaluatef( "return %s.total;", objectId ) ) << "Incorrect accumulated field.";
+    ASSERT_STREQ( "24", Con::evaluatef( "return %s.cell[0];", objectId ) ) << "Incorrect array field.";
+    ASSERT_STREQ( "27", Con::evaluatef( "return %s.cell1;", objectId ) ) << "Incorrect array field.";
+    ASSERT_STREQ( "1.5", Con::evaluatef( "return %s.literal;", objectId ) ) << "Literals should keep the text they compile to.";
+    ASSERT_STREQ( "-10", Con::evaluatef( "return %s.negative;", objectId ) ) << "Incorrect negated field.";
+    ASSERT_STREQ( "0.333333333", Con::evaluatef( "return %s.third;", objectId ) ) << "Incorrect divided field.";
+    ASSERT_STREQ( "12", Con::evaluatef( "return %s.count + 2;", objectId ) ) << "Incorrect field arithmetic.";
+
+    Con::evaluatef( "%s.delete();", objectId );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ConsoleTypedFieldTests, writeTest )
+{
+    StringTableEntry intSlot = StringTable->insert( "typedFieldTestInt" );
+    StringTableEntry floatSlot = StringTable->insert( "typedFieldTestFloat" );
+    ScriptObject* pTypedObject;
+    ScriptObject* pTextObject;
+
+    // NOTE: Each check uses new objects so no typed field has been formatted as text before it.
+
+    // The typed fields should read back as the same text.
+    createTypedFieldTestObjects( pTypedObject, pTextObject );
+    ASSERT_STREQ( "1.5", pTypedObject->getDataField( floatSlot, "0" ) ) << "Incorrect text of 1.5.";
+    ASSERT_STREQ( "1e+10", pTypedObject->getDataField( floatSlot, "1" ) ) << "Incorrect text of 1e10.";
+    ASSERT_STREQ( "-0", pTypedObject->getDataField( floatSlot, "2" ) ) << "Incorrect text of negative zero.";
+    ASSERT_STREQ( "-2147483648", pTypedObject->getDataField( intSlot, "3" ) ) << "Incorrect text of the smallest integer.";
+    char index[16];
+    for ( U32 valueIndex = 0; valueIndex < typedFieldTestFloatCount; ++valueIndex )
+    {
+        dSprintf( index, sizeof(index), "%d", valueIndex );
+        ASSERT_STREQ( pTextObject->getDataField( floatSlot, index ), pTypedObject->getDataField( floatSlot, index ) ) << "Incorrect text of float " << valueIndex;
+    }
+    pTypedObject->deleteObject();
+    pTextObject->deleteObject();
+
+    // Writing the fields should produce the same output.
+    char typedBuffer[CONSOLE_UNITTEST_WRITE_BUFFER_SIZE];
+    char textBuffer[CONSOLE_UNITTEST_WRITE_BUFFER_SIZE];
+    createTypedFieldTestObjects( pTypedObject, pTextObject );
+    MemStream typedStream( sizeof(typedBuffer), typedBuffer );
+    MemStream textStream( sizeof(textBuffer), textBuffer );
+    pTypedObject->writeFields( typedStream, 0 );
+    pTextObject->writeFields( textStream, 0 );
+    pTypedObject->deleteObject();
+    pTextObject->deleteObject();
+    ASSERT_EQ( textStream.getPosition(), typedStream.getPosition() ) << "Incorrect size of the written fields.";
+    ASSERT_EQ( 0, dMemcmp( textBuffer, typedBuffer, textStream.getPosition() ) ) << "Incorrect written fields.";
+
+    // Writing the objects with Taml should produce the same files.
+    const Taml::TamlFormatMode formatModes[] = { Taml::XmlFormat, Taml::JSONFormat, Taml::BinaryFormat };
+    const U32 formatCount = sizeof(formatModes) / sizeof(Taml::TamlFormatMode);
+    char typedFileName[1024];
+    char textFileName[1024];
+    dSprintf( typedFileName, sizeof(typedFileName), "%s/typedFieldTestTyped.taml", Platform::getTemporaryDirectory() );
+    dSprintf( textFileName, sizeof(textFileName), "%s/typedFieldTestText.taml", Platform::getTemporaryDirectory() );
+    for ( U32 formatIndex = 0; formatIndex < formatCount; ++formatIndex )
+    {
+        Taml taml;
+        taml.setAutoFormat( false );
+        taml.setFormatMode( formatModes[formatIndex] );
+        taml.setBinaryCompression( false );
+        createTypedFieldTestObjects( pTypedObject, pTextObject );
+        const bool written = taml.write( pTypedObject, typedFileName ) && taml.write( pTextObject, textFileName );
+        pTypedObject->deleteObject();
+        pTextObject->deleteObject();
+        ASSERT_TRUE( written ) << "The files were not written (format " << formatIndex << ").";
+
+        const U32 typedSize = readTypedFieldTestFile( typedFileName, typedBuffer, sizeof(typedBuffer) );
+        const U32 textSize = readTypedFieldTestFile( textFileName, textBuffer, sizeof(textBuffer) );
+        ASSERT_TRUE( textSize > 0 ) << "The file was not read (format " << formatIndex << ").";
+        ASSERT_EQ( textSize, typedSize ) << "Incorrect file size (format " << formatIndex << ").";
+        ASSERT_EQ( 0, dMemcmp( textBuffer, typedBuffer, textSize ) ) << "Incorrect file (format " << formatIndex << ").";
+    }
+
+    Platform::fileDelete( typedFileName );
+    Platform::fileDelete( textFileName );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ConsoleTypedFieldTests, fieldBenchmark )
+{
+    Con::evaluate(
+        "function typedFieldTestBenchmark(%object, %count)"
+        "{"
+        "   for (%i = 0; %i < %count; %i++)"
+        "   {"
+        "      %object.position = %object.position + %object.velocity * 0.016;"
+        "      %object.frames++;"
+        "   }"
+        "   return %object.frames;"
+        "}"
+        );
+
+    const char* pObject = Con::evaluate( "return new ScriptObject() { position = 0; velocity = 2.5; frames = 0; };" );
+    char objectId[32];
+    dStrcpy( objectId, pObject );
+
+    char iterationCount[32];
+    dSprintf( iterationCount, sizeof(iterationCount), "%d", CONSOLE_UNITTEST_BENCHMARK_ITERATIONS );
+
+    const U32 startTime = Platform::getRealMilliseconds();
+    const S32 frames = dAtoi( Con::executef( 3, "typedFieldTestBenchmark", objectId, iterationCount ) );
+    const U32 elapsedTime = Platform::getRealMilliseconds() - startTime;
+
+    Con::evaluatef( "%s.delete();", objectId );
+
+    ASSERT_EQ( CONSOLE_UNITTEST_BENCHMARK_ITERATIONS, frames ) << "Incorrect frame count.";
+
+    Con::printf( "ConsoleTypedField: %d iterations of 3 field reads and 2 field writes - %dms.",
+        CONSOLE_UNITTEST_BENCHMARK_ITERATIONS, elapsedTime );
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,227 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _FRAME_ARENA_H_
+#include "memory/frameArena.h"
+#endif
+
+#ifndef _JOB_SYSTEM_H_
+#include "platform/threads/jobSystem.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_THREAD_H_
+#include "platform/threads/thread.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define FRAMEARENA_UNITTEST_BLOCK_SIZE      1024
+#define FRAMEARENA_UNITTEST_JOBS            256
+#define FRAMEARENA_UNITTEST_JOB_ALLOCS      64
+
+//-----------------------------------------------------------------------------
+
+TEST( FrameArenaTests, allocTest )
+{
+    FrameArena arena( FRAMEARENA_UNITTEST_BLOCK_SIZE );
+
+    // Allocations should be aligned and not overlap.
+    U8* pPrevious = NULL;
+    for ( U32 n = 0; n < 100; ++n )
+    {
+        const U32 alignment = 1 << (n % 6);
+        U8* pAllocation = (U8*)arena.alloc( 13, alignment );
+        ASSERT_TRUE( pAllocation != NULL ) << "Allocation failed.";
+        ASSERT_EQ( (size_t)0, (size_t)pAllocation & (alignment - 1) ) << "Allocation is misaligned.";
+        dMemset( pAllocation, n, 13 );
+
+        if ( pPrevious != NULL )
+        {
+            ASSERT_EQ( (U8)(n - 1), pPrevious[12] ) << "Allocations overlap.";
+        }
+
+        pPrevious = pAllocation;
+    }
+
+    // An allocation bigger than a block should still succeed.
+    U8* pLarge = (U8*)arena.alloc( FRAMEARENA_UNITTEST_BLOCK_SIZE * 4 );
+    ASSERT_TRUE( pLarge != NULL ) << "Large allocation failed.";
+    dMemset( pLarge, 0xFF, FRAMEARENA_UNITTEST_BLOCK_SIZE * 4 );
+
+    FrameArena::Stats stats;
+    arena.getStats( stats );
+    ASSERT_EQ( (U32)(100 * 13 + FRAMEARENA_UNITTEST_BLOCK_SIZE * 4), stats.mFrameBytes ) << "Unexpected frame bytes.";
+    ASSERT_EQ( (U32)101, stats.mFrameAllocations ) << "Unexpected frame allocations.";
+    ASSERT_EQ( (U32)1, stats.mLaneCount ) << "Unexpected lane count.";
+
+    // Resetting should keep the blocks and reuse them.
+    const U32 reservedBytes = stats.mReservedBytes;
+    const U32 blockCount = stats.mBlockCount;
+    for ( U32 frame = 0; frame < 10; ++frame )
+    {
+        arena.reset();
+        for ( U32 n = 0; n < 100; ++n )
+            arena.alloc( 13, 1 << (n % 6) );
+        arena.alloc( FRAMEARENA_UNITTEST_BLOCK_SIZE * 4 );
+    }
+
+    arena.getStats( stats );
+    ASSERT_EQ( reservedBytes, stats.mReservedBytes ) << "A steady frame reserved more memory.";
+    ASSERT_EQ( blockCount, stats.mBlockCount ) << "A steady frame allocated more blocks.";
+    ASSERT_EQ( (U32)10, stats.mResetCount ) << "Unexpected reset count.";
+    ASSERT_EQ( (U32)(100 * 13 + FRAMEARENA_UNITTEST_BLOCK_SIZE * 4), stats.mPeakFrameBytes ) << "Unexpected peak frame bytes.";
+
+    // Purging should release the blocks.
+    arena.purge();
+    arena.getStats( stats );
+    ASSERT_EQ( (U32)0, stats.mReservedBytes ) << "Purging didn't release the blocks.";
+    ASSERT_EQ( (U32)0, stats.mFrameAllocations ) << "Purging didn't release the allocations.";
+}
+
+//-----------------------------------------------------------------------------
+
+struct FrameArenaTestRecord
+{
+    FrameArenaTestRecord() : mJobIndex( 0xFFFFFFFF ), mValue( 0 ) {}
+
+    U32 mJobIndex;
+    U32 mValue;
+};
+
+//-----------------------------------------------------------------------------
+
+static void frameArenaJob( void* pContext, const U32 jobIndex )
+{
+    FrameArena* pArena = (FrameArena*)pContext;
+
+    FrameArenaTestRecord* records[FRAMEARENA_UNITTEST_JOB_ALLOCS];
+    for ( U32 n = 0; n < FRAMEARENA_UNITTEST_JOB_ALLOCS; ++n )
+    {
+        FrameArenaTestRecord* pRecord = pArena->create<FrameArenaTestRecord>();
+        pRecord->mJobIndex = jobIndex;
+        pRecord->mValue = n;
+        records[n] = pRecord;
+    }
+
+    // Check no other thread wrote over the records.
+    for ( U32 n = 0; n < FRAMEARENA_UNITTEST_JOB_ALLOCS; ++n )
+    {
+        AssertFatal( records[n]->mJobIndex == jobIndex && records[n]->mValue == n, "frameArenaJob() - Record was overwritten." );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( FrameArenaTests, threadTest )
+{
+    // Use the running job system; each worker and the main thread can own a lane.
+    const U32 maxLaneCount = JobSystem::getWorkerCount() + 1;
+
+    FrameArena arena( FRAMEARENA_UNITTEST_BLOCK_SIZE );
+
+    for ( U32 frame = 0; frame < 4; ++frame )
+    {
+        JobSystem::parallelFor( frameArenaJob, &arena, FRAMEARENA_UNITTEST_JOBS );
+
+        FrameArena::Stats stats;
+        arena.getStats( stats );
+        ASSERT_EQ( (U32)(FRAMEARENA_UNITTEST_JOBS * FRAMEARENA_UNITTEST_JOB_ALLOCS), stats.mFrameAllocations ) << "Unexpected frame allocations.";
+        ASSERT_EQ( (U32)(FRAMEARENA_UNITTEST_JOBS * FRAMEARENA_UNITTEST_JOB_ALLOCS * sizeof(FrameArenaTestRecord)), stats.mFrameBytes ) << "Unexpected frame bytes.";
+        ASSERT_TRUE( stats.mLaneCount >= 1 && stats.mLaneCount <= maxLaneCount ) << "Unexpected lane count.";
+
+        arena.reset();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static void frameArenaThread( void* pContext )
+{
+    frameArenaJob( pContext, 0 );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( FrameArenaTests, laneReuseTest )
+{
+    FrameArena arena( FRAMEARENA_UNITTEST_BLOCK_SIZE );
+
+    // Allocate from more short-lived threads than there are lanes, one per frame.
+    FrameArena::Stats stats;
+    U32 reservedBytes = 0;
+    for ( U32 frame = 0; frame < (U32)FrameArena::MaxLanes + 8; ++frame )
+    {
+        Thread* pThread = new Thread( frameArenaThread, &arena, false );
+        pThread->start();
+        pThread->join();
+        delete pThread;
+
+        // A lane is released by the first reset after a frame its thread didn't allocate in
+        // so each thread should reuse the lane (and blocks) of the thread two frames before it.
+        arena.getStats( stats );
+        ASSERT_EQ( frame == 0 ? (U32)1 : (U32)2, stats.mLaneCount ) << "An exited thread's lane wasn't reused.";
+        if ( frame == 1 )
+        {
+            reservedBytes = stats.mReservedBytes;
+        }
+        else if ( frame > 1 )
+        {
+            ASSERT_EQ( reservedBytes, stats.mReservedBytes ) << "An exited thread's blocks weren't reused.";
+        }
+
+        arena.reset();
+    }
+
+    // A thread that allocates every frame should keep its lane while new threads come and go.
+    for ( U32 frame = 0; frame < 4; ++frame )
+    {
+        U32* pValue = arena.create<U32>();
+        *pValue = frame;
+
+        Thread* pThread = new Thread( frameArenaThread, &arena, false );
+        pThread->start();
+        pThread->join();
+        delete pThread;
+
+        ASSERT_EQ( frame, *pValue ) << "An allocation was overwritten by another thread.";
+        arena.getStats( stats );
+        ASSERT_EQ( (U32)3, stats.mLaneCount ) << "Unexpected lane count with threads allocating alongside this one.";
+        ASSERT_EQ( (U32)(FRAMEARENA_UNITTEST_JOB_ALLOCS + 1), stats.mFrameAllocations ) << "Unexpected frame allocations.";
+
+        arena.reset();
+    }
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,359 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _NETCONNECTION_H_
+#include "network/netConnection.h"
+#endif
+
+#ifndef _BITSTREAM_H_
+#include "io/bitStream.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+extern U32 gGhostUpdates;
+
+//-----------------------------------------------------------------------------
+
+#define NETGHOST_UNITTEST_OBJECTS           1000
+#define NETGHOST_UNITTEST_CONNECTIONS       16
+#define NETGHOST_UNITTEST_PACKETS           200
+#define NETGHOST_UNITTEST_PACKET_SIZE       1024
+#define NETGHOST_UNITTEST_PACKET_LATENCY    4
+#define NETGHOST_UNITTEST_DROP_INTERVAL     10
+#define NETGHOST_UNITTEST_SETTLE_PACKETS    10000
+#define NETGHOST_UNITTEST_POSITION_BITS     20
+
+//-----------------------------------------------------------------------------
+
+class GhostTestObject : public NetObject
+{
+    typedef NetObject Parent;
+
+public:
+    enum
+    {
+        PositionMask = BIT(0),
+        StateMask = BIT(1),
+    };
+
+    U32 mX;
+    U32 mY;
+    U32 mState;
+
+    static bool smDeltaCompress;
+
+    GhostTestObject()
+    {
+        mNetFlags.set( Ghostable );
+        mX = mY = mState = 0;
+    }
+
+    void move( const S32 dx, const S32 dy )
+    {
+        mX += dx;
+        mY += dy;
+        setMaskBits( PositionMask );
+    }
+
+    void setState( const U32 state )
+    {
+        mState = state;
+        setMaskBits( StateMask );
+    }
+
+    U32 packUpdate( NetConnection* pConnection, U32 mask, BitStream* pStream )
+    {
+        if ( pStream->writeFlag( mask & PositionMask ) )
+        {
+            if ( smDeltaCompress )
+            {
+                pConnection->packDeltaInt( pStream, 0, mX, NETGHOST_UNITTEST_POSITION_BITS );
+                pConnection->packDeltaInt( pStream, 1, mY, NETGHOST_UNITTEST_POSITION_BITS );
+            }
+            else
+            {
+                pStream->writeInt( mX, NETGHOST_UNITTEST_POSITION_BITS );
+                pStream->writeInt( mY, NETGHOST_UNITTEST_POSITION_BITS );
+            }
+        }
+
+        if ( pStream->writeFlag( mask & StateMask ) )
+            pStream->writeInt( mState, 8 );
+
+        return 0;
+    }
+
+    void unpackUpdate( NetConnection* pConnection, BitStream* pStream )
+    {
+        if ( pStream->readFlag() )
+        {
+            if ( smDeltaCompress )
+            {
+                mX = pConnection->unpackDeltaInt( pStream, 0, NETGHOST_UNITTEST_POSITION_BITS );
+                mY = pConnection->unpackDeltaInt( pStream, 1, NETGHOST_UNITTEST_POSITION_BITS );
+            }
+            else
+            {
+                mX = pStream->readInt( NETGHOST_UNITTEST_POSITION_BITS );
+                mY = pStream->readInt( NETGHOST_UNITTEST_POSITION_BITS );
+            }
+        }
+
+        if ( pStream->readFlag() )
+            mState = pStream->readInt( 8 );
+    }
+
+    DECLARE_CONOBJECT( GhostTestObject );
+};
+
+bool GhostTestObject::smDeltaCompress = true;
+
+IMPLEMENT_CO_NETOBJECT_V1( GhostTestObject );
+
+//-----------------------------------------------------------------------------
+
+class GhostTestScope : public NetObject
+{
+public:
+    Vector<GhostTestObject*> mObjects;
+
+    void onCameraScopeQuery( NetConnection* pConnection, CameraScopeQuery* )
+    {
+        for ( U32 n = 0; n < (U32)mObjects.size(); ++n )
+            pConnection->objectInScope( mObjects[n] );
+    }
+};
+
+//-----------------------------------------------------------------------------
+
+/// A connection that exchanges ghost packets directly with its peer (rather than through the
+/// network interface) so the ghosting of many connections can be measured on its own.
+class GhostTestConnection : public NetConnection
+{
+    struct SentPacket
+    {
+        PacketNotify* mpNotify;
+        bool mDelivered;
+    };
+
+    Vector<SentPacket> mSentPackets;
+
+public:
+    GhostTestConnection* mpPeer;
+    U32 mDeliveredBits;
+
+    GhostTestConnection()
+    {
+        mpPeer = NULL;
+        mDeliveredBits = 0;
+    }
+
+    void startGhosting( GhostTestScope* pScope )
+    {
+        setGhostFrom( true );
+        setScopeObject( pScope );
+        mScoping = true;
+        mGhosting = true;
+    }
+
+    void startReceiving( void )
+    {
+        setGhostTo( true );
+    }
+
+    U32 getPendingGhostCount( void ) const { return mGhostZeroUpdateIndex; }
+
+    U32 getSentPacketCount( void ) const { return mSentPackets.size(); }
+
+    void sendPacket( const bool deliver )
+    {
+        U8 buffer[MaxPacketDataSize];
+        BitStream writeStream( buffer, NETGHOST_UNITTEST_PACKET_SIZE, MaxPacketDataSize );
+
+        SentPacket packet;
+        packet.mpNotify = allocNotify();
+        packet.mDelivered = deliver;
+        ghostWritePacket( &writeStream, packet.mpNotify );
+        mSentPackets.push_back( packet );
+
+        if ( deliver )
+        {
+            mDeliveredBits += writeStream.getCurPos();
+
+            BitStream readStream( buffer, (writeStream.getCurPos() + 7) >> 3 );
+            mpPeer->ghostReadPacket( &readStream );
+        }
+    }
+
+    void notifyPacket( void )
+    {
+        SentPacket packet = mSentPackets.first();
+        mSentPackets.pop_front();
+
+        if ( packet.mDelivered )
+            ghostPacketReceived( packet.mpNotify );
+        else
+            ghostPacketDropped( packet.mpNotify );
+
+        delete packet.mpNotify;
+    }
+};
+
+//-----------------------------------------------------------------------------
+
+static void runGhostBenchmark( const bool deltaCompress, U32& writeTime, F32& updateBits )
+{
+    GhostTestObject::smDeltaCompress = deltaCompress;
+
+    // Create the objects.
+    GhostTestScope* pScope = new GhostTestScope();
+    pScope->registerObject();
+    for ( U32 n = 0; n < NETGHOST_UNITTEST_OBJECTS; ++n )
+    {
+        GhostTestObject* pObject = new GhostTestObject();
+        pObject->mX = (n % 100) * 1000;
+        pObject->mY = (n / 100) * 1000;
+        pObject->registerObject();
+        pScope->mObjects.push_back( pObject );
+    }
+
+    // Create the connections.
+    GhostTestConnection* servers[NETGHOST_UNITTEST_CONNECTIONS];
+    GhostTestConnection* clients[NETGHOST_UNITTEST_CONNECTIONS];
+    for ( U32 c = 0; c < NETGHOST_UNITTEST_CONNECTIONS; ++c )
+    {
+        servers[c] = new GhostTestConnection();
+        servers[c]->registerObject();
+        servers[c]->startGhosting( pScope );
+
+        clients[c] = new GhostTestConnection();
+        clients[c]->registerObject();
+        clients[c]->startReceiving();
+
+        servers[c]->mpPeer = clients[c];
+    }
+
+    // Move some of the objects each packet, dropping some packets and acknowledging the others late.
+    const U32 startUpdates = gGhostUpdates;
+    writeTime = 0;
+    for ( U32 packet = 0; packet < NETGHOST_UNITTEST_PACKETS; ++packet )
+    {
+        for ( U32 n = packet % 4; n < NETGHOST_UNITTEST_OBJECTS; n += 4 )
+            pScope->mObjects[n]->move( (S32)(n % 7) - 3, (S32)(n % 5) - 2 );
+
+        if ( packet % 50 == 0 )
+            pScope->mObjects[packet % NETGHOST_UNITTEST_OBJECTS]->setState( packet & 0xFF );
+
+        NetObject::collapseDirtyList();
+
+        const U32 startTime = Platform::getRealMilliseconds();
+        for ( U32 c = 0; c < NETGHOST_UNITTEST_CONNECTIONS; ++c )
+        {
+            servers[c]->sendPacket( (packet + c) % NETGHOST_UNITTEST_DROP_INTERVAL != 0 );
+            if ( servers[c]->getSentPacketCount() > NETGHOST_UNITTEST_PACKET_LATENCY )
+                servers[c]->notifyPacket();
+        }
+        writeTime += Platform::getRealMilliseconds() - startTime;
+
+        ASSERT_EQ( 0, NetConnection::getErrorBuffer()[0] ) << "Ghost read error: " << NetConnection::getErrorBuffer();
+    }
+
+    // The packets are full so compare the size of the updates in them.
+    U32 deliveredBits = 0;
+    for ( U32 c = 0; c < NETGHOST_UNITTEST_CONNECTIONS; ++c )
+        deliveredBits += servers[c]->mDeliveredBits;
+    updateBits = F32(deliveredBits) / F32(getMax( gGhostUpdates - startUpdates, 1U ));
+
+    // Let the connections settle.
+    for ( U32 c = 0; c < NETGHOST_UNITTEST_CONNECTIONS; ++c )
+    {
+        while ( servers[c]->getSentPacketCount() > 0 )
+            servers[c]->notifyPacket();
+
+        for ( U32 packet = 0; packet < NETGHOST_UNITTEST_SETTLE_PACKETS && servers[c]->getPendingGhostCount() > 0; ++packet )
+        {
+            servers[c]->sendPacket( true );
+            servers[c]->notifyPacket();
+        }
+
+        ASSERT_EQ( 0U, servers[c]->getPendingGhostCount() ) << "Connection " << c << " did not settle.";
+    }
+
+    // Check the ghosts match the objects.
+    for ( U32 c = 0; c < NETGHOST_UNITTEST_CONNECTIONS; ++c )
+    {
+        for ( U32 n = 0; n < NETGHOST_UNITTEST_OBJECTS; ++n )
+        {
+            GhostTestObject* pObject = pScope->mObjects[n];
+            const S32 ghostIndex = servers[c]->getGhostIndex( pObject );
+            ASSERT_NE( -1, ghostIndex ) << "Object " << n << " was not ghosted on connection " << c;
+
+            GhostTestObject* pGhost = dynamic_cast<GhostTestObject*>( clients[c]->resolveGhost( ghostIndex ) );
+            ASSERT_TRUE( pGhost != NULL ) << "Object " << n << " has no ghost on connection " << c;
+            ASSERT_EQ( pObject->mX, pGhost->mX ) << "Incorrect ghost position for object " << n << " on connection " << c;
+            ASSERT_EQ( pObject->mY, pGhost->mY ) << "Incorrect ghost position for object " << n << " on connection " << c;
+            ASSERT_EQ( pObject->mState, pGhost->mState ) << "Incorrect ghost state for object " << n << " on connection " << c;
+        }
+    }
+
+    for ( U32 c = 0; c < NETGHOST_UNITTEST_CONNECTIONS; ++c )
+    {
+        servers[c]->deleteObject();
+        clients[c]->deleteObject();
+    }
+
+    for ( U32 n = 0; n < NETGHOST_UNITTEST_OBJECTS; ++n )
+        pScope->mObjects[n]->deleteObject();
+    pScope->deleteObject();
+
+    GhostTestObject::smDeltaCompress = true;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( NetGhostTests, ghostBenchmark )
+{
+    U32 fullWriteTime, deltaWriteTime;
+    F32 fullUpdateBits, deltaUpdateBits;
+    runGhostBenchmark( false, fullWriteTime, fullUpdateBits );
+    runGhostBenchmark( true, deltaWriteTime, deltaUpdateBits );
+
+    ASSERT_LT( deltaUpdateBits, fullUpdateBits ) << "Delta compression did not reduce the update size.";
+
+    Con::printf( "NetGhost: %d connections, %d ghosts, %d packets - full updates %dms (%.1f bits/update), delta updates %dms (%.1f bits/update).",
+        NETGHOST_UNITTEST_CONNECTIONS, NETGHOST_UNITTEST_OBJECTS, NETGHOST_UNITTEST_PACKETS, fullWriteTime, fullUpdateBits, deltaWriteTime, deltaUpdateBits );
+}
+
+#endif // TORQUE_SHIPPING
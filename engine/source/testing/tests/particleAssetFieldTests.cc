@@ -0,0 +1,234 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _PARTICLE_ASSET_H_
+#include "2d/assets/ParticleAsset.h"
+#endif
+
+#ifndef _TAML_H_
+#include "persistence/taml/taml.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define PARTICLE_UNITTEST_FIELD_SAMPLES             1000
+#define PARTICLE_UNITTEST_FIELD_BENCHMARK_LOOKUPS   2000000
+
+//-----------------------------------------------------------------------------
+
+TEST( ParticleAssetFieldTests, bakedAccuracyTest )
+{
+    // Create a field with data-keys that fall on the baked samples.
+    ParticleAssetField alignedField;
+    alignedField.initialize( 1.0f, -100.0f, 100.0f, 0.0f );
+    alignedField.addDataKey( 0.25f, 50.0f );
+    alignedField.addDataKey( 0.5f, -20.0f );
+    alignedField.addDataKey( 0.75f, 80.0f );
+    alignedField.addDataKey( 1.0f, 10.0f );
+
+    ASSERT_TRUE( alignedField.getBaked() ) << "Field with multiple data-keys was not baked.";
+
+    // Create an exactly evaluated copy.
+    ParticleAssetField alignedExactField;
+    alignedField.copyTo( alignedExactField );
+    alignedExactField.setExactEvaluation( true );
+
+    ASSERT_FALSE( alignedExactField.getBaked() ) << "Exactly evaluated field was baked.";
+
+    // The baked values are exact when the data-keys fall on the samples.
+    for ( U32 n = 0; n <= PARTICLE_UNITTEST_FIELD_SAMPLES; ++n )
+    {
+        const F32 time = (F32)n / PARTICLE_UNITTEST_FIELD_SAMPLES;
+        ASSERT_NEAR( alignedExactField.getFieldValue( time ), alignedField.getFieldValue( time ), 1.0e-3f ) << "Baked value differs at time " << time;
+    }
+
+    // Create a field with data-keys between the samples, a longer time, repeats and a value scale.
+    ParticleAssetField field;
+    field.initialize( 1000.0f, 0.0f, 500.0f, 100.0f );
+    field.addDataKey( 123.4f, 300.0f );
+    field.addDataKey( 321.0f, 20.0f );
+    field.addDataKey( 777.7f, 450.0f );
+    field.setRepeatTime( 3.0f );
+    field.setValueScale( 2.0f );
+
+    ParticleAssetField exactField;
+    field.copyTo( exactField );
+    exactField.setExactEvaluation( true );
+
+    // The baked values can only be out by the steepest slope over a single sample.
+    const F32 tolerance = (450.0f - 20.0f) / (777.7f - 321.0f) * (1000.0f / PARTICLE_ASSET_FIELD_BAKE_RESOLUTION) * 2.0f;
+    for ( U32 n = 0; n <= PARTICLE_UNITTEST_FIELD_SAMPLES; ++n )
+    {
+        const F32 time = (F32)n * 1000.0f / PARTICLE_UNITTEST_FIELD_SAMPLES;
+        ASSERT_NEAR( exactField.getFieldValue( time ), field.getFieldValue( time ), tolerance ) << "Baked value differs at time " << time;
+    }
+
+    // Check the values at the data-keys.
+    ASSERT_NEAR( 200.0f, field.getFieldValue( 0.0f ), 1.0e-3f ) << "Incorrect first data-key value.";
+    ASSERT_NEAR( 40.0f, exactField.getFieldValue( 321.0f / 3.0f ), 1.0e-2f ) << "Incorrect repeated data-key value.";
+    ASSERT_NEAR( 40.0f, field.getFieldValue( 321.0f / 3.0f ), tolerance ) << "Incorrect repeated data-key value.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ParticleAssetFieldTests, rebakeTest )
+{
+    ParticleAssetField field;
+    field.initialize( 1.0f, 0.0f, 10.0f, 1.0f );
+
+    // A single data-key isn't baked.
+    ASSERT_FALSE( field.getBaked() ) << "Field with a single data-key was baked.";
+    ASSERT_EQ( 1.0f, field.getFieldValue( 0.5f ) ) << "Incorrect single data-key value.";
+
+    // Adding a data-key bakes the field.
+    field.addDataKey( 1.0f, 5.0f );
+    ASSERT_TRUE( field.getBaked() ) << "Field with multiple data-keys was not baked.";
+    ASSERT_NEAR( 3.0f, field.getFieldValue( 0.5f ), 1.0e-4f ) << "Incorrect baked value.";
+
+    // Changing a data-key re-bakes the field.
+    field.setDataKeyValue( 1, 9.0f );
+    ASSERT_NEAR( 5.0f, field.getFieldValue( 0.5f ), 1.0e-4f ) << "Field was not re-baked after a data-key changed.";
+
+    // Removing a data-key discards the baked values.
+    field.removeDataKey( 1 );
+    ASSERT_FALSE( field.getBaked() ) << "Field with a single data-key was baked.";
+    ASSERT_EQ( 1.0f, field.getFieldValue( 0.5f ) ) << "Incorrect single data-key value.";
+
+    // Exact evaluation isn't baked.
+    field.addDataKey( 1.0f, 5.0f );
+    field.setExactEvaluation( true );
+    ASSERT_FALSE( field.getBaked() ) << "Exactly evaluated field was baked.";
+    ASSERT_NEAR( 3.0f, field.getFieldValue( 0.5f ), 1.0e-4f ) << "Incorrect exact value.";
+
+    field.setExactEvaluation( false );
+    ASSERT_TRUE( field.getBaked() ) << "Field was not baked when exact evaluation was turned off.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ParticleAssetFieldTests, tamlReadTest )
+{
+    // Give a particle asset field some data-keys.
+    ParticleAsset* pAsset = new ParticleAsset();
+    pAsset->registerObject();
+    ParticleAssetField* pField = pAsset->getParticleFields().findField( "SizeXScale" );
+    ASSERT_TRUE( pField != NULL ) << "The particle asset field was not found.";
+    pField->addDataKey( 250.0f, 20.0f );
+    pField->addDataKey( 500.0f, 80.0f );
+    pField->addDataKey( 1000.0f, 5.0f );
+
+    char fileName[1024];
+    dSprintf( fileName, sizeof(fileName), "%s/particleAssetFieldTest.taml", Platform::getTemporaryDirectory() );
+
+    // Write and read the asset.
+    Taml taml;
+    taml.setFormatMode( Taml::XmlFormat );
+    ASSERT_TRUE( taml.write( pAsset, fileName ) ) << "The particle asset was not written.";
+    ParticleAsset* pReadAsset = dynamic_cast<ParticleAsset*>( taml.read( fileName ) );
+    ASSERT_TRUE( pReadAsset != NULL ) << "The particle asset was not read.";
+
+    ParticleAssetField* pReadField = pReadAsset->getParticleFields().findField( "SizeXScale" );
+    ASSERT_TRUE( pReadField != NULL ) << "The read particle asset field was not found.";
+    ASSERT_EQ( pField->getDataKeyCount(), pReadField->getDataKeyCount() ) << "Incorrect data-key count.";
+    ASSERT_TRUE( pReadField->getBaked() ) << "The read field was not baked.";
+
+    // The read field must evaluate the data-keys that were read and not the default ones.
+    for ( U32 n = 0; n <= PARTICLE_UNITTEST_FIELD_SAMPLES; ++n )
+    {
+        const F32 time = (F32)n * 1000.0f / PARTICLE_UNITTEST_FIELD_SAMPLES;
+        ASSERT_NEAR( pField->getFieldValue( time ), pReadField->getFieldValue( time ), 1.0e-3f ) << "Read value differs at time " << time;
+    }
+
+    ASSERT_NEAR( 80.0f, pReadField->getFieldValue( 500.0f ), 1.0e-3f ) << "Incorrect read data-key value.";
+
+    pReadAsset->deleteObject();
+    pAsset->deleteObject();
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ParticleAssetFieldTests, lookupBenchmark )
+{
+    // Create a typical color-over-life style field.
+    ParticleAssetField field;
+    field.initialize( 1.0f, 0.0f, 1.0f, 0.0f );
+    field.addDataKey( 0.1f, 1.0f );
+    field.addDataKey( 0.2f, 0.8f );
+    field.addDataKey( 0.4f, 0.9f );
+    field.addDataKey( 0.6f, 0.5f );
+    field.addDataKey( 0.8f, 0.6f );
+    field.addDataKey( 0.9f, 0.2f );
+    field.addDataKey( 1.0f, 0.0f );
+
+    ParticleAssetField exactField;
+    field.copyTo( exactField );
+    exactField.setExactEvaluation( true );
+
+    // Generate deterministic pseudo-random particle lives.
+    U32 seed = 12345;
+    Vector<F32> lives;
+    lives.setSize( 4096 );
+    for ( U32 n = 0; n < (U32)lives.size(); ++n )
+    {
+        seed = seed * 1664525 + 1013904223;
+        lives[n] = (seed >> 8) / F32(1 << 24);
+    }
+    const U32 lifeMask = lives.size() - 1;
+
+    // Exact lookups.
+    F32 exactSum = 0.0f;
+    U32 startTime = Platform::getRealMilliseconds();
+    for ( U32 n = 0; n < PARTICLE_UNITTEST_FIELD_BENCHMARK_LOOKUPS; ++n )
+        exactSum += exactField.getFieldValue( lives[n & lifeMask] );
+    const U32 exactTime = Platform::getRealMilliseconds() - startTime;
+
+    // Baked lookups.
+    F32 bakedSum = 0.0f;
+    startTime = Platform::getRealMilliseconds();
+    for ( U32 n = 0; n < PARTICLE_UNITTEST_FIELD_BENCHMARK_LOOKUPS; ++n )
+        bakedSum += field.getFieldValue( lives[n & lifeMask] );
+    const U32 bakedTime = Platform::getRealMilliseconds() - startTime;
+
+    // The sums should be close.
+    ASSERT_NEAR( exactSum / PARTICLE_UNITTEST_FIELD_BENCHMARK_LOOKUPS, bakedSum / PARTICLE_UNITTEST_FIELD_BENCHMARK_LOOKUPS, 1.0e-2f ) << "Baked and exact values differ.";
+
+    Con::printf( "ParticleAssetField: %d lookups of %d data-keys - exact %dms, baked %dms.",
+        PARTICLE_UNITTEST_FIELD_BENCHMARK_LOOKUPS, field.getDataKeyCount(), exactTime, bakedTime );
+}
+
+#endif // TORQUE_SHIPPING
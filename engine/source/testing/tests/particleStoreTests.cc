@@ -0,0 +1,375 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _PARTICLE_STORE_H_
+#include "2d/core/ParticleStore.h"
+#endif
+
+#ifndef _MMATHFN_H_
+#include "math/mMathFn.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define PARTICLE_UNITTEST_STORE_PARTICLECOUNT       103
+#define PARTICLE_UNITTEST_BENCHMARK_PARTICLECOUNT   50000
+#define PARTICLE_UNITTEST_BENCHMARK_TICKS           100
+#define PARTICLE_UNITTEST_TOLERANCE                 1.0e-4f
+#define PARTICLE_UNITTEST_ELAPSEDTIME               (1.0f / 60.0f)
+
+//-----------------------------------------------------------------------------
+
+// Deterministic pseudo-random value in the range [minValue, maxValue].
+static F32 particleTestRandom( U32& seed, const F32 minValue, const F32 maxValue )
+{
+    seed = seed * 1664525 + 1013904223;
+    return minValue + ((seed >> 8) / F32(1 << 24)) * (maxValue - minValue);
+}
+
+//-----------------------------------------------------------------------------
+
+// Fill the store with particles.  The particles are left without frame providers.
+static void fillParticleStore( ParticleStore& particles, const U32 particleCount, U32 seed )
+{
+    for ( U32 n = 0; n < particleCount; ++n )
+    {
+        const U32 index = particles.create();
+
+        particles.getStream( ParticleStore::AGE )[index] = 0.0f;
+        particles.getStream( ParticleStore::LIFETIME )[index] = particleTestRandom( seed, 1.0f, 5.0f );
+        particles.getStream( ParticleStore::POSITION_X )[index] = particleTestRandom( seed, -50.0f, 50.0f );
+        particles.getStream( ParticleStore::POSITION_Y )[index] = particleTestRandom( seed, -50.0f, 50.0f );
+        particles.getStream( ParticleStore::VELOCITY_X )[index] = particleTestRandom( seed, -10.0f, 10.0f );
+        particles.getStream( ParticleStore::VELOCITY_Y )[index] = particleTestRandom( seed, -10.0f, 10.0f );
+        particles.getStream( ParticleStore::RENDER_SIZE_X )[index] = particleTestRandom( seed, 0.5f, 4.0f );
+        particles.getStream( ParticleStore::RENDER_SIZE_Y )[index] = particleTestRandom( seed, 0.5f, 4.0f );
+        particles.getStream( ParticleStore::RENDER_SPEED )[index] = particleTestRandom( seed, 0.0f, 2.0f );
+        particles.getStream( ParticleStore::RENDER_FIXED_FORCE )[index] = particleTestRandom( seed, -5.0f, 5.0f );
+        particles.getStream( ParticleStore::ORIENTATION )[index] = particleTestRandom( seed, -360.0f, 360.0f );
+        particles.getStream( ParticleStore::RENDER_SPIN )[index] = (n % 5) == 0 ? 0.0f : particleTestRandom( seed, -720.0f, 720.0f );
+        particles.getStream( ParticleStore::POST_TICK_X )[index] = particles.getStream( ParticleStore::POSITION_X )[index];
+        particles.getStream( ParticleStore::POST_TICK_Y )[index] = particles.getStream( ParticleStore::POSITION_Y )[index];
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ParticleStoreTests, integrationTest )
+{
+    ParticleStore particles;
+    fillParticleStore( particles, PARTICLE_UNITTEST_STORE_PARTICLECOUNT, 12345 );
+
+    const Vector2 fixedForceDirection( 0.3f, -0.8f );
+    const Vector2 localAABB[4] = { Vector2(-0.5f, -0.5f), Vector2(0.5f, -0.5f), Vector2(0.5f, 0.5f), Vector2(-0.5f, 0.5f) };
+    const F32 elapsedTime = PARTICLE_UNITTEST_ELAPSEDTIME;
+
+    // Integrate from an unaligned start index so both the SIMD and scalar paths are used.
+    const U32 startIndex = 5;
+
+    // Take a copy of the particles before integration.
+    const U32 particleCount = particles.size();
+    Vector<F32> expected[ParticleStore::STREAM_COUNT];
+    for ( U32 stream = 0; stream < ParticleStore::STREAM_COUNT; ++stream )
+    {
+        expected[stream].setSize( particleCount );
+        dMemcpy( expected[stream].address(), particles.getStream( (ParticleStore::Stream)stream ), particleCount * sizeof(F32) );
+    }
+
+    // Integrate.
+    particles.beginTick( startIndex );
+    particles.integrateMotion( startIndex, fixedForceDirection, elapsedTime );
+    particles.integrateSpin( startIndex, elapsedTime );
+    particles.updateRotation( startIndex );
+    particles.calculateOOBB( startIndex, localAABB, false );
+    particles.endTick( startIndex );
+
+    // Check against a scalar integration of each particle.
+    for ( U32 index = startIndex; index < particleCount; ++index )
+    {
+        Vector2 velocity( expected[ParticleStore::VELOCITY_X][index], expected[ParticleStore::VELOCITY_Y][index] );
+        Vector2 position( expected[ParticleStore::POSITION_X][index], expected[ParticleStore::POSITION_Y][index] );
+        velocity += fixedForceDirection * expected[ParticleStore::RENDER_FIXED_FORCE][index] * elapsedTime;
+        position += velocity * expected[ParticleStore::RENDER_SPEED][index] * elapsedTime;
+
+        F32 orientation = expected[ParticleStore::ORIENTATION][index];
+        const F32 spin = expected[ParticleStore::RENDER_SPIN][index];
+        if ( mNotZero( spin ) )
+            orientation = mFmod( orientation + spin * elapsedTime, 360.0f );
+
+        ASSERT_NEAR( velocity.x, particles.getStream( ParticleStore::VELOCITY_X )[index], PARTICLE_UNITTEST_TOLERANCE ) << "Incorrect velocity.";
+        ASSERT_NEAR( velocity.y, particles.getStream( ParticleStore::VELOCITY_Y )[index], PARTICLE_UNITTEST_TOLERANCE ) << "Incorrect velocity.";
+        ASSERT_NEAR( position.x, particles.getStream( ParticleStore::POSITION_X )[index], PARTICLE_UNITTEST_TOLERANCE ) << "Incorrect position.";
+        ASSERT_NEAR( position.y, particles.getStream( ParticleStore::POSITION_Y )[index], PARTICLE_UNITTEST_TOLERANCE ) << "Incorrect position.";
+        ASSERT_NEAR( orientation, particles.getStream( ParticleStore::ORIENTATION )[index], PARTICLE_UNITTEST_TOLERANCE ) << "Incorrect orientation.";
+
+        ASSERT_EQ( expected[ParticleStore::POST_TICK_X][index], particles.getStream( ParticleStore::PRE_TICK_X )[index] ) << "Incorrect pre-tick position.";
+        ASSERT_EQ( expected[ParticleStore::POST_TICK_Y][index], particles.getStream( ParticleStore::PRE_TICK_Y )[index] ) << "Incorrect pre-tick position.";
+        ASSERT_EQ( particles.getStream( ParticleStore::POSITION_X )[index], particles.getStream( ParticleStore::POST_TICK_X )[index] ) << "Incorrect post-tick position.";
+        ASSERT_EQ( particles.getStream( ParticleStore::POSITION_Y )[index], particles.getStream( ParticleStore::POST_TICK_Y )[index] ) << "Incorrect post-tick position.";
+
+        // Check the OOBB.
+        const F32 angle = mDegToRad( orientation );
+        const F32 sinAngle = mSin( angle );
+        const F32 cosAngle = mCos( angle );
+        const F32 sizeX = expected[ParticleStore::RENDER_SIZE_X][index];
+        const F32 sizeY = expected[ParticleStore::RENDER_SIZE_Y][index];
+        const ParticleStore::Stream oobbStreams[4] = { ParticleStore::OOBB0_X, ParticleStore::OOBB1_X, ParticleStore::OOBB2_X, ParticleStore::OOBB3_X };
+        for ( U32 vertex = 0; vertex < 4; ++vertex )
+        {
+            const F32 localX = localAABB[vertex].x * sizeX;
+            const F32 localY = localAABB[vertex].y * sizeY;
+            const F32 worldX = cosAngle * localX - sinAngle * localY + position.x;
+            const F32 worldY = sinAngle * localX + cosAngle * localY + position.y;
+
+            ASSERT_NEAR( worldX, particles.getStream( oobbStreams[vertex] )[index], PARTICLE_UNITTEST_TOLERANCE ) << "Incorrect OOBB.";
+            ASSERT_NEAR( worldY, particles.getStream( (ParticleStore::Stream)(oobbStreams[vertex] + 1) )[index], PARTICLE_UNITTEST_TOLERANCE ) << "Incorrect OOBB.";
+        }
+    }
+
+    // Check the particles before the start index were untouched.
+    for ( U32 index = 0; index < startIndex; ++index )
+    {
+        ASSERT_EQ( expected[ParticleStore::POSITION_X][index], particles.getStream( ParticleStore::POSITION_X )[index] ) << "Particle before the start index was integrated.";
+        ASSERT_EQ( expected[ParticleStore::VELOCITY_Y][index], particles.getStream( ParticleStore::VELOCITY_Y )[index] ) << "Particle before the start index was integrated.";
+        ASSERT_EQ( expected[ParticleStore::ORIENTATION][index], particles.getStream( ParticleStore::ORIENTATION )[index] ) << "Particle before the start index was integrated.";
+    }
+
+    // Check the interpolated position.
+    particles.interpolateTick( 0.25f );
+    for ( U32 index = 0; index < particleCount; ++index )
+    {
+        const F32 expectedX = 0.25f * particles.getStream( ParticleStore::PRE_TICK_X )[index] + 0.75f * particles.getStream( ParticleStore::POST_TICK_X )[index];
+        ASSERT_NEAR( expectedX, particles.getStream( ParticleStore::RENDER_TICK_X )[index], PARTICLE_UNITTEST_TOLERANCE ) << "Incorrect interpolated position.";
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ParticleStoreTests, expiryTest )
+{
+    ParticleStore particles;
+
+    // Create particles identified by their position with every third expired and every seventh without a lifetime.
+    for ( U32 n = 0; n < PARTICLE_UNITTEST_STORE_PARTICLECOUNT; ++n )
+    {
+        const U32 index = particles.create();
+        particles.getStream( ParticleStore::POSITION_X )[index] = (F32)n;
+        particles.getStream( ParticleStore::LIFETIME )[index] = (n % 7) == 0 ? 0.0f : 1.0f;
+        particles.getStream( ParticleStore::AGE )[index] = (n % 3) == 0 ? 0.5f : 0.0f;
+    }
+    particles.advanceAge( 0.75f );
+
+    // Single particles only expire without a lifetime.
+    U32 expectedCount = 0;
+    for ( U32 n = 0; n < PARTICLE_UNITTEST_STORE_PARTICLECOUNT; ++n )
+    {
+        if ( (n % 7) != 0 )
+            expectedCount++;
+    }
+    particles.removeExpired( true );
+    ASSERT_EQ( expectedCount, particles.size() ) << "Incorrect single-particle expiry.";
+
+    // Remove the particles that have outlived their lifetime.
+    const U32 removedCount = particles.removeExpired( false );
+    expectedCount = 0;
+    for ( U32 n = 0; n < PARTICLE_UNITTEST_STORE_PARTICLECOUNT; ++n )
+    {
+        if ( (n % 7) != 0 && (n % 3) != 0 )
+            expectedCount++;
+    }
+    ASSERT_EQ( expectedCount, particles.size() ) << "Incorrect particle expiry.";
+    ASSERT_EQ( PARTICLE_UNITTEST_STORE_PARTICLECOUNT - ((PARTICLE_UNITTEST_STORE_PARTICLECOUNT + 6) / 7) - expectedCount, removedCount ) << "Incorrect removed count.";
+
+    // Check the remaining particles kept their order.
+    U32 index = 0;
+    for ( U32 n = 0; n < PARTICLE_UNITTEST_STORE_PARTICLECOUNT; ++n )
+    {
+        if ( (n % 7) == 0 || (n % 3) == 0 )
+            continue;
+
+        ASSERT_EQ( (F32)n, particles.getStream( ParticleStore::POSITION_X )[index] ) << "Particle order was not preserved.";
+        ASSERT_EQ( 0.75f, particles.getStream( ParticleStore::AGE )[index] ) << "Particle age was not compacted.";
+        index++;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+// The linked-list particle node layout the store replaced.
+struct ParticleTestLegacyNode
+{
+    ParticleTestLegacyNode* mPreviousNode;
+    ParticleTestLegacyNode* mNextNode;
+
+    F32                     mParticleLifetime;
+    F32                     mParticleAge;
+    Vector2                 mPosition;
+    Vector2                 mVelocity;
+    bool                    mSuppressMovement;
+    Vector2                 mPreTickPosition;
+    Vector2                 mPostTickPosition;
+    Vector2                 mRenderTickPosition;
+    Vector2                 mSize;
+    F32                     mSpeed;
+    F32                     mSpin;
+    F32                     mFixedForce;
+    F32                     mRandomMotion;
+    Vector2                 mRenderSize;
+    F32                     mRenderSpeed;
+    F32                     mRenderSpin;
+    F32                     mRenderFixedForce;
+    F32                     mRenderRandomMotion;
+    F32                     mOrientationAngle;
+    F32                     mTransformSin;
+    F32                     mTransformCos;
+    F32                     mColor[4];
+    Vector2                 mRenderOOBB[4];
+    U8                      mFrameProvider[96];
+};
+
+//-----------------------------------------------------------------------------
+
+TEST( ParticleStoreTests, integrationBenchmark )
+{
+    const U32 particleCount = PARTICLE_UNITTEST_BENCHMARK_PARTICLECOUNT;
+    const Vector2 fixedForceDirection( 0.0f, -1.0f );
+    const Vector2 localAABB[4] = { Vector2(-0.5f, -0.5f), Vector2(0.5f, -0.5f), Vector2(0.5f, 0.5f), Vector2(-0.5f, 0.5f) };
+    const F32 elapsedTime = PARTICLE_UNITTEST_ELAPSEDTIME;
+
+    // Build the store.
+    ParticleStore particles;
+    fillParticleStore( particles, particleCount, 54321 );
+
+    // Build the linked-list with the same particles, linked in a scattered order as a long-running pool would be.
+    ParticleTestLegacyNode* pPool = new ParticleTestLegacyNode[particleCount];
+    Vector<U32> poolOrder;
+    poolOrder.setSize( particleCount );
+    for ( U32 n = 0; n < particleCount; ++n )
+        poolOrder[n] = n;
+    U32 seed = 98765;
+    for ( U32 n = particleCount - 1; n > 0; --n )
+    {
+        seed = seed * 1664525 + 1013904223;
+        const U32 swapIndex = (seed >> 8) % (n + 1);
+        const U32 temp = poolOrder[n];
+        poolOrder[n] = poolOrder[swapIndex];
+        poolOrder[swapIndex] = temp;
+    }
+
+    ParticleTestLegacyNode nodeHead;
+    nodeHead.mNextNode = nodeHead.mPreviousNode = &nodeHead;
+    for ( U32 n = 0; n < particleCount; ++n )
+    {
+        ParticleTestLegacyNode* pNode = pPool + poolOrder[n];
+        pNode->mPosition.Set( particles.getStream( ParticleStore::POSITION_X )[n], particles.getStream( ParticleStore::POSITION_Y )[n] );
+        pNode->mVelocity.Set( particles.getStream( ParticleStore::VELOCITY_X )[n], particles.getStream( ParticleStore::VELOCITY_Y )[n] );
+        pNode->mRenderSize.Set( particles.getStream( ParticleStore::RENDER_SIZE_X )[n], particles.getStream( ParticleStore::RENDER_SIZE_Y )[n] );
+        pNode->mRenderSpeed = particles.getStream( ParticleStore::RENDER_SPEED )[n];
+        pNode->mRenderFixedForce = particles.getStream( ParticleStore::RENDER_FIXED_FORCE )[n];
+        pNode->mRenderSpin = particles.getStream( ParticleStore::RENDER_SPIN )[n];
+        pNode->mOrientationAngle = particles.getStream( ParticleStore::ORIENTATION )[n];
+        pNode->mPostTickPosition = pNode->mPosition;
+        pNode->mSuppressMovement = false;
+
+        pNode->mNextNode = &nodeHead;
+        pNode->mPreviousNode = nodeHead.mPreviousNode;
+        nodeHead.mPreviousNode->mNextNode = pNode;
+        nodeHead.mPreviousNode = pNode;
+    }
+
+    // Integrate the linked-list one particle at a time.
+    U32 startTime = Platform::getRealMilliseconds();
+    for ( U32 tick = 0; tick < PARTICLE_UNITTEST_BENCHMARK_TICKS; ++tick )
+    {
+        for ( ParticleTestLegacyNode* pNode = nodeHead.mNextNode; pNode != &nodeHead; pNode = pNode->mNextNode )
+        {
+            pNode->mRenderTickPosition = pNode->mPreTickPosition = pNode->mPostTickPosition;
+
+            if ( mNotZero( pNode->mRenderFixedForce ) )
+                pNode->mVelocity += fixedForceDirection * pNode->mRenderFixedForce * elapsedTime;
+
+            if ( !pNode->mSuppressMovement )
+                pNode->mPosition += pNode->mVelocity * pNode->mRenderSpeed * elapsedTime;
+
+            if ( mNotZero( pNode->mRenderSpin ) )
+                pNode->mOrientationAngle = mFmod( pNode->mOrientationAngle + pNode->mRenderSpin * elapsedTime, 360.0f );
+
+            const F32 angle = mDegToRad( pNode->mOrientationAngle );
+            pNode->mTransformSin = mSin( angle );
+            pNode->mTransformCos = mCos( angle );
+
+            for ( U32 vertex = 0; vertex < 4; ++vertex )
+            {
+                const Vector2 local = localAABB[vertex] * pNode->mRenderSize;
+                pNode->mRenderOOBB[vertex].Set( pNode->mTransformCos * local.x - pNode->mTransformSin * local.y + pNode->mPosition.x,
+                                                pNode->mTransformSin * local.x + pNode->mTransformCos * local.y + pNode->mPosition.y );
+            }
+
+            pNode->mPostTickPosition = pNode->mPosition;
+        }
+    }
+    const U32 legacyTime = Platform::getRealMilliseconds() - startTime;
+
+    // Integrate the store a stream at a time.
+    startTime = Platform::getRealMilliseconds();
+    for ( U32 tick = 0; tick < PARTICLE_UNITTEST_BENCHMARK_TICKS; ++tick )
+    {
+        particles.beginTick( 0 );
+        particles.integrateMotion( 0, fixedForceDirection, elapsedTime );
+        particles.integrateSpin( 0, elapsedTime );
+        particles.updateRotation( 0 );
+        particles.calculateOOBB( 0, localAABB, false );
+        particles.endTick( 0 );
+    }
+    const U32 storeTime = Platform::getRealMilliseconds() - startTime;
+
+    // Check both integrated the same motion.
+    for ( U32 n = 0; n < particleCount; n += 997 )
+    {
+        const ParticleTestLegacyNode* pNode = pPool + poolOrder[n];
+        ASSERT_NEAR( pNode->mPosition.x, particles.getStream( ParticleStore::POSITION_X )[n], 1.0e-2f ) << "Store and linked-list integration differ.";
+        ASSERT_NEAR( pNode->mPosition.y, particles.getStream( ParticleStore::POSITION_Y )[n], 1.0e-2f ) << "Store and linked-list integration differ.";
+    }
+
+    delete [] pPool;
+
+    Con::printf( "ParticleStore: %d particles x %d ticks - linked-list %dms, structure-of-arrays %dms.",
+        particleCount, PARTICLE_UNITTEST_BENCHMARK_TICKS, legacyTime, storeTime );
+}
+
+#endif // TORQUE_SHIPPING
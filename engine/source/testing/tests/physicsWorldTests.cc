@@ -0,0 +1,119 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef BOX2D_H
+#include "Box2D/Box2D.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define PHYSICS_UNITTEST_BODY_COUNT     20
+#define PHYSICS_UNITTEST_STEP_COUNT     600
+
+//-----------------------------------------------------------------------------
+
+static S32 countAwakeBodies( b2World& world )
+{
+    S32 awakeCount = 0;
+    for ( b2Body* pBody = world.GetBodyList(); pBody != NULL; pBody = pBody->GetNext() )
+    {
+        if ( pBody->IsAwake() )
+            awakeCount++;
+    }
+    return awakeCount;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( PhysicsWorldTests, awakeBodyCountTest )
+{
+    b2World world( b2Vec2( 0.0f, -10.0f ) );
+
+    // Create the ground.
+    b2BodyDef groundDef;
+    b2Body* pGround = world.CreateBody( &groundDef );
+    b2PolygonShape groundShape;
+    groundShape.SetAsBox( 50.0f, 1.0f );
+    pGround->CreateFixture( &groundShape, 0.0f );
+
+    ASSERT_EQ( countAwakeBodies( world ), world.GetAwakeBodyCount() ) << "Incorrect awake count after creating the ground.";
+
+    // Create a pile of boxes, some of which start asleep.
+    b2Body* bodies[PHYSICS_UNITTEST_BODY_COUNT];
+    b2PolygonShape boxShape;
+    boxShape.SetAsBox( 0.5f, 0.5f );
+    for ( U32 n = 0; n < PHYSICS_UNITTEST_BODY_COUNT; ++n )
+    {
+        b2BodyDef bodyDef;
+        bodyDef.type = b2_dynamicBody;
+        bodyDef.position.Set( (F32)(n % 5) * 2.0f - 4.0f, 2.0f + (F32)(n / 5) * 1.5f );
+        bodyDef.awake = (n % 3) != 0;
+        bodies[n] = world.CreateBody( &bodyDef );
+        bodies[n]->CreateFixture( &boxShape, 1.0f );
+    }
+
+    ASSERT_EQ( countAwakeBodies( world ), world.GetAwakeBodyCount() ) << "Incorrect awake count after creating the bodies.";
+
+    // Step until the bodies have fallen asleep checking the count as they do.
+    for ( U32 step = 0; step < PHYSICS_UNITTEST_STEP_COUNT; ++step )
+    {
+        world.Step( 1.0f / 60.0f, 8, 3 );
+        ASSERT_EQ( countAwakeBodies( world ), world.GetAwakeBodyCount() ) << "Incorrect awake count at step " << step;
+    }
+
+    // All the bodies (including the ground they rest on) should be asleep.
+    ASSERT_EQ( 0, world.GetAwakeBodyCount() ) << "The bodies did not fall asleep.";
+
+    // Wake and sleep some bodies explicitly.
+    bodies[0]->SetAwake( true );
+    bodies[0]->SetAwake( true );
+    bodies[1]->SetAwake( true );
+    bodies[2]->SetAwake( false );
+    ASSERT_EQ( countAwakeBodies( world ), world.GetAwakeBodyCount() ) << "Incorrect awake count after setting awake.";
+
+    // Destroy awake and asleep bodies.
+    world.DestroyBody( bodies[0] );
+    world.DestroyBody( bodies[3] );
+    ASSERT_EQ( countAwakeBodies( world ), world.GetAwakeBodyCount() ) << "Incorrect awake count after destroying bodies.";
+
+    // Disturb the pile.
+    bodies[4]->ApplyLinearImpulse( b2Vec2( 0.0f, 20.0f ), bodies[4]->GetWorldCenter(), true );
+    for ( U32 step = 0; step < 60; ++step )
+    {
+        world.Step( 1.0f / 60.0f, 8, 3 );
+        ASSERT_EQ( countAwakeBodies( world ), world.GetAwakeBodyCount() ) << "Incorrect awake count at step " << step;
+    }
+}
+
+#endif // TORQUE_SHIPPING
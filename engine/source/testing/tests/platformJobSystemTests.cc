@@ -0,0 +1,122 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _JOB_SYSTEM_H_
+#include "platform/threads/jobSystem.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define PLATFORM_UNITTEST_JOBSYSTEM_JOBCOUNT     4096
+
+//-----------------------------------------------------------------------------
+
+static void jobSystemTestIncrement( void* pContext, const U32 jobIndex )
+{
+    U32* pCounters = static_cast<U32*>( pContext );
+    pCounters[jobIndex]++;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( PlatformJobSystemTests, parallelForTest )
+{
+    U32 counters[PLATFORM_UNITTEST_JOBSYSTEM_JOBCOUNT];
+    dMemset( counters, 0, sizeof(counters) );
+
+    // Execute the jobs.
+    JobSystem::parallelFor( jobSystemTestIncrement, counters, PLATFORM_UNITTEST_JOBSYSTEM_JOBCOUNT );
+
+    // Check each job was executed exactly once.
+    for( U32 index = 0; index < PLATFORM_UNITTEST_JOBSYSTEM_JOBCOUNT; ++index )
+    {
+        ASSERT_EQ( 1, counters[index] ) << "Job was not executed exactly once.";
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( PlatformJobSystemTests, submitAndWaitTest )
+{
+    U32 counters[PLATFORM_UNITTEST_JOBSYSTEM_JOBCOUNT];
+    dMemset( counters, 0, sizeof(counters) );
+
+    JobSystem::JobGroup group;
+
+    // Submit the jobs.
+    for( U32 index = 0; index < PLATFORM_UNITTEST_JOBSYSTEM_JOBCOUNT; ++index )
+    {
+        JobSystem::submit( jobSystemTestIncrement, counters, index, &group );
+    }
+
+    // Wait for the jobs.
+    JobSystem::wait( &group );
+
+    // Check.
+    ASSERT_TRUE( group.isComplete() ) << "Job group did not complete.";
+
+    // Check each job was executed exactly once.
+    for( U32 index = 0; index < PLATFORM_UNITTEST_JOBSYSTEM_JOBCOUNT; ++index )
+    {
+        ASSERT_EQ( 1, counters[index] ) << "Job was not executed exactly once.";
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( PlatformJobSystemTests, drainTest )
+{
+    U32 counters[PLATFORM_UNITTEST_JOBSYSTEM_JOBCOUNT];
+    dMemset( counters, 0, sizeof(counters) );
+
+    // Submit the jobs without a group.
+    for( U32 index = 0; index < PLATFORM_UNITTEST_JOBSYSTEM_JOBCOUNT; ++index )
+    {
+        JobSystem::submit( jobSystemTestIncrement, counters, index, NULL );
+    }
+
+    // Wait for all the jobs.
+    JobSystem::drain();
+
+    // Check.
+    ASSERT_EQ( 0, JobSystem::getPendingJobCount() ) << "Jobs are still pending after draining.";
+
+    // Check each job was executed exactly once.
+    for( U32 index = 0; index < PLATFORM_UNITTEST_JOBSYSTEM_JOBCOUNT; ++index )
+    {
+        ASSERT_EQ( 1, counters[index] ) << "Job was not executed exactly once.";
+    }
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,204 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+// The batched datagram path is only available on Linux.
+#ifdef TORQUE_OS_LINUX
+
+#ifndef _NETCONNECTION_H_
+#include "network/netConnection.h"
+#endif
+
+#ifndef _NETINTERFACE_H_
+#include "network/netInterface.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+#ifndef _EVENT_H_
+#include "platform/event.h"
+#endif
+
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+//-----------------------------------------------------------------------------
+
+#define PLATFORMNET_UNITTEST_PORT           28555
+#define PLATFORMNET_UNITTEST_BURSTS         200
+#define PLATFORMNET_UNITTEST_BURST_SIZE     128
+#define PLATFORMNET_UNITTEST_PACKET_SIZE    200
+
+//-----------------------------------------------------------------------------
+
+class NetTestInterface : public NetInterface
+{
+public:
+    U32 mPacketCount;
+    U32 mByteCount;
+
+    NetTestInterface() : mPacketCount( 0 ), mByteCount( 0 ) {}
+
+    virtual void processPacketReceiveEvent( PacketReceiveEvent* pEvent )
+    {
+        mPacketCount++;
+        mByteCount += pEvent->size - PacketReceiveEventHeaderSize;
+    }
+};
+
+//-----------------------------------------------------------------------------
+
+// Restores the engine port and closes the test socket however the test exits.
+class NetTestPortScope
+{
+public:
+    const S32 mPreviousPort;
+    int mTestSocket;
+
+    NetTestPortScope() : mPreviousPort( Net::getPort() ), mTestSocket( -1 ) {}
+
+    ~NetTestPortScope()
+    {
+        if ( mTestSocket != -1 )
+            close( mTestSocket );
+
+        if ( mPreviousPort != 0 )
+            Net::openPort( mPreviousPort );
+        else
+            Net::closePort();
+    }
+};
+
+//-----------------------------------------------------------------------------
+
+// Stands the engine net interface aside and restores it however the test exits.
+class NetTestInterfaceScope
+{
+public:
+    NetInterface* const mpPreviousInterface;
+
+    NetTestInterfaceScope() : mpPreviousInterface( GNet ) { GNet = NULL; }
+    ~NetTestInterfaceScope() { GNet = mpPreviousInterface; }
+};
+
+//-----------------------------------------------------------------------------
+
+TEST( PlatformNetTests, loopbackBenchmark )
+{
+    // Open the engine port.
+    NetTestPortScope portScope;
+    ASSERT_TRUE( Net::openPort( PLATFORMNET_UNITTEST_PORT ) ) << "Failed to open the port.";
+
+    // Open a plain socket on the loopback to talk to it.
+    const int testSocket = socket( AF_INET, SOCK_DGRAM, 0 );
+    ASSERT_NE( -1, testSocket ) << "Failed to create the test socket.";
+    portScope.mTestSocket = testSocket;
+
+    sockaddr_in testAddress;
+    dMemset( &testAddress, 0, sizeof(testAddress) );
+    testAddress.sin_family = AF_INET;
+    testAddress.sin_addr.s_addr = htonl( INADDR_LOOPBACK );
+    ASSERT_EQ( 0, bind( testSocket, (sockaddr*)&testAddress, sizeof(testAddress) ) ) << "Failed to bind the test socket.";
+    socklen_t testAddressSize = sizeof(testAddress);
+    getsockname( testSocket, (sockaddr*)&testAddress, &testAddressSize );
+
+    sockaddr_in portAddress = testAddress;
+    portAddress.sin_port = htons( PLATFORMNET_UNITTEST_PORT );
+
+    U8 packet[PLATFORMNET_UNITTEST_PACKET_SIZE];
+    for ( U32 n = 0; n < PLATFORMNET_UNITTEST_PACKET_SIZE; ++n )
+        packet[n] = (U8)n;
+
+    // Receive bursts of packets.
+    const U32 packetCount = PLATFORMNET_UNITTEST_BURSTS * PLATFORMNET_UNITTEST_BURST_SIZE;
+    U32 receiveTime = 0;
+    U32 receiveCount = 0;
+    U32 receiveBytes = 0;
+    {
+        // Count the received packets rather than processing them.
+        NetTestInterfaceScope interfaceScope;
+        NetTestInterface testInterface;
+
+        for ( U32 burst = 0; burst < PLATFORMNET_UNITTEST_BURSTS; ++burst )
+        {
+            for ( U32 n = 0; n < PLATFORMNET_UNITTEST_BURST_SIZE; ++n )
+                sendto( testSocket, packet, sizeof(packet), 0, (sockaddr*)&portAddress, sizeof(portAddress) );
+
+            const U32 startTime = Platform::getRealMilliseconds();
+            Net::process();
+            receiveTime += Platform::getRealMilliseconds() - startTime;
+        }
+
+        receiveCount = testInterface.mPacketCount;
+        receiveBytes = testInterface.mByteCount;
+    }
+
+    // Send bursts of packets.
+    NetAddress address;
+    address.type = NetAddress::IPAddress;
+    address.netNum[0] = 127;
+    address.netNum[1] = 0;
+    address.netNum[2] = 0;
+    address.netNum[3] = 1;
+    address.port = ntohs( testAddress.sin_port );
+
+    U32 sendTime = 0;
+    U32 sendCount = 0;
+    for ( U32 burst = 0; burst < PLATFORMNET_UNITTEST_BURSTS; ++burst )
+    {
+        const U32 startTime = Platform::getRealMilliseconds();
+        for ( U32 n = 0; n < PLATFORMNET_UNITTEST_BURST_SIZE; ++n )
+            Net::sendto( &address, packet, sizeof(packet) );
+        Net::flushPackets();
+        sendTime += Platform::getRealMilliseconds() - startTime;
+
+        U8 buffer[MaxPacketDataSize];
+        while ( recv( testSocket, buffer, sizeof(buffer), MSG_DONTWAIT ) == sizeof(packet) )
+            sendCount++;
+    }
+
+    ASSERT_EQ( packetCount, receiveCount ) << "Incorrect number of packets received.";
+    ASSERT_EQ( packetCount * PLATFORMNET_UNITTEST_PACKET_SIZE, receiveBytes ) << "Incorrect number of bytes received.";
+    ASSERT_EQ( packetCount, sendCount ) << "Incorrect number of packets sent.";
+
+    Con::printf( "PlatformNet: %d packets of %d bytes over the loopback - received %dms, sent %dms.",
+        packetCount, PLATFORMNET_UNITTEST_PACKET_SIZE, receiveTime, sendTime );
+}
+
+#endif // TORQUE_OS_LINUX
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,295 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifdef TORQUE_ENABLE_PROFILER
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PROFILER_H_
+#include "debug/profiler.h"
+#endif
+
+#ifndef _PROFILER_TRACE_H_
+#include "debug/profilerTrace.h"
+#endif
+
+#ifndef _JOB_SYSTEM_H_
+#include "platform/threads/jobSystem.h"
+#endif
+
+#ifndef _MEMSTREAM_H_
+#include "io/memstream.h"
+#endif
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_THREAD_H_
+#include "platform/threads/thread.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define PROFILER_UNITTEST_TRACE_EXPORT_SIZE     (16 * 1024 * 1024)
+#define PROFILER_UNITTEST_TRACE_JOBS            64
+
+//-----------------------------------------------------------------------------
+
+class ProfilerTraceExport
+{
+public:
+    ProfilerTraceExport()
+    {
+        mpBuffer = new char[PROFILER_UNITTEST_TRACE_EXPORT_SIZE];
+    }
+
+    ~ProfilerTraceExport()
+    {
+        delete [] mpBuffer;
+    }
+
+    U32 exportTrace( void )
+    {
+        MemStream stream( PROFILER_UNITTEST_TRACE_EXPORT_SIZE - 1, mpBuffer );
+        const U32 exportCount = ProfilerTrace::exportChromeTrace( stream );
+        mpBuffer[stream.getPosition()] = 0;
+        return exportCount;
+    }
+
+    U32 count( const char* pText ) const
+    {
+        U32 textCount = 0;
+        const U32 textLength = dStrlen( pText );
+        for ( const char* pFind = dStrstr( mpBuffer, pText ); pFind != NULL; pFind = dStrstr( pFind + textLength, pText ) )
+            textCount++;
+        return textCount;
+    }
+
+    const char* getText( void ) const { return mpBuffer; }
+
+private:
+    char* mpBuffer;
+};
+
+//-----------------------------------------------------------------------------
+
+static void profilerTraceJob( void* pContext, const U32 jobIndex )
+{
+    PROFILE_SCOPE(ProfilerTraceTest_Job);
+
+    for ( U32 n = 0; n < 10; ++n )
+    {
+        PROFILE_START(ProfilerTraceTest_JobStep);
+        PROFILE_END();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static void profilerTraceThread( void* pData )
+{
+    ProfilerTrace::beginEvent( "ProfilerTraceTest_Thread" );
+    ProfilerTrace::endEvent();
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ProfilerTraceTests, timelineTest )
+{
+    ProfilerTrace::reset();
+    ProfilerTrace::enable( true );
+
+    // Record markers on the main thread and the job workers.
+    {
+        PROFILE_SCOPE(ProfilerTraceTest_Frame);
+        JobSystem::parallelFor( profilerTraceJob, NULL, PROFILER_UNITTEST_TRACE_JOBS );
+    }
+
+    ProfilerTrace::enable( false );
+
+    ProfilerTraceExport traceExport;
+    const U32 exportCount = traceExport.exportTrace();
+
+    // Check the events.
+    const U32 expectedCount = (1 + PROFILER_UNITTEST_TRACE_JOBS * 11) * 2;
+    ASSERT_EQ( expectedCount, exportCount ) << "Unexpected number of exported events.";
+    ASSERT_EQ( expectedCount / 2, traceExport.count( "\"ph\":\"B\"" ) ) << "Unexpected number of begin events.";
+    ASSERT_EQ( expectedCount / 2, traceExport.count( "\"ph\":\"E\"" ) ) << "Unexpected number of end events.";
+    ASSERT_EQ( 1, traceExport.count( "\"name\":\"ProfilerTraceTest_Frame\"" ) ) << "Unexpected number of frame markers.";
+    ASSERT_EQ( (U32)PROFILER_UNITTEST_TRACE_JOBS, traceExport.count( "\"name\":\"ProfilerTraceTest_Job\"" ) ) << "Unexpected number of job markers.";
+    ASSERT_EQ( 1, traceExport.count( "\"name\":\"Main Thread\"" ) ) << "The main thread wasn't named.";
+    ASSERT_EQ( ProfilerTrace::getThreadCount(), traceExport.count( "\"name\":\"thread_name\"" ) ) << "Unexpected number of threads.";
+
+    // Check the document.
+    ASSERT_EQ( 0, dStrncmp( traceExport.getText(), "{\"traceEvents\":[", 16 ) ) << "Invalid trace document.";
+
+    // Discarding the events should leave an empty trace.
+    ProfilerTrace::reset();
+    ASSERT_EQ( 0, traceExport.exportTrace() ) << "Events remained after a reset.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ProfilerTraceTests, wrapTest )
+{
+    ProfilerTrace::reset();
+
+    // Open a marker that will be overwritten.
+    ProfilerTrace::beginEvent( "ProfilerTraceTest_Overwritten" );
+
+    // Fill the ring buffer.
+    const U32 markerCount = ProfilerTrace::ThreadBufferEvents / 2 + 100;
+    for ( U32 n = 0; n < markerCount; ++n )
+    {
+        ProfilerTrace::beginEvent( "ProfilerTraceTest_Marker" );
+        ProfilerTrace::endEvent();
+    }
+
+    // Close the overwritten marker and open one that is never closed.
+    ProfilerTrace::endEvent();
+    ProfilerTrace::beginEvent( "ProfilerTraceTest_Open" );
+
+    ProfilerTraceExport traceExport;
+    const U32 exportCount = traceExport.exportTrace();
+
+    // The unmatched end should be skipped and the open marker closed.
+    ASSERT_EQ( 0, traceExport.count( "ProfilerTraceTest_Overwritten" ) ) << "The overwritten marker was exported.";
+    ASSERT_EQ( 1, traceExport.count( "ProfilerTraceTest_Open" ) ) << "The open marker wasn't exported.";
+    ASSERT_EQ( traceExport.count( "\"ph\":\"B\"" ), traceExport.count( "\"ph\":\"E\"" ) ) << "Begin and end events are unbalanced.";
+    ASSERT_EQ( (U32)ProfilerTrace::ThreadBufferEvents, exportCount ) << "Unexpected number of exported events.";
+
+    ProfilerTrace::endEvent();
+    ProfilerTrace::reset();
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ProfilerTraceTests, repeatedWrapTest )
+{
+    ProfilerTrace::reset();
+
+    // Wrap the ring buffer several times ending with a distinct marker.
+    const U32 markerCount = ProfilerTrace::ThreadBufferEvents * 3 / 2 + 7;
+    for ( U32 n = 0; n < markerCount; ++n )
+    {
+        ProfilerTrace::beginEvent( n == markerCount - 1 ? "ProfilerTraceTest_Last" : "ProfilerTraceTest_Marker" );
+        ProfilerTrace::endEvent();
+    }
+
+    ProfilerTraceExport traceExport;
+    const U32 exportCount = traceExport.exportTrace();
+
+    // Only a full buffer of the most recent events should remain.
+    ASSERT_EQ( (U32)ProfilerTrace::ThreadBufferEvents, exportCount ) << "Unexpected number of exported events.";
+    ASSERT_EQ( 1, traceExport.count( "ProfilerTraceTest_Last" ) ) << "The most recent marker wasn't exported.";
+    ASSERT_EQ( (U32)ProfilerTrace::ThreadBufferEvents / 2, traceExport.count( "\"ph\":\"B\"" ) ) << "Unexpected number of begin events.";
+    ASSERT_EQ( (U32)ProfilerTrace::ThreadBufferEvents / 2, traceExport.count( "\"ph\":\"E\"" ) ) << "Unexpected number of end events.";
+
+    ProfilerTrace::reset();
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ProfilerTraceTests, dumpTest )
+{
+    ProfilerTrace::reset();
+
+    // Record nested markers.
+    ProfilerTrace::beginEvent( "ProfilerTraceTest_Outer" );
+    ProfilerTrace::beginEvent( "ProfilerTraceTest_Inner" );
+    ProfilerTrace::endEvent();
+    ProfilerTrace::endEvent();
+
+    char fileName[1024];
+    dSprintf( fileName, sizeof(fileName), "%s/profilerTraceTest.json", Platform::getTemporaryDirectory() );
+    ASSERT_TRUE( ProfilerTrace::dumpChromeTrace( fileName ) ) << "The trace wasn't written.";
+
+    // Read the trace back.
+    FileStream stream;
+    ASSERT_TRUE( stream.open( fileName, FileStream::Read ) ) << "The trace couldn't be read.";
+    const U32 size = stream.getStreamSize();
+    char* pText = new char[size + 1];
+    stream.read( size, pText );
+    pText[size] = 0;
+    stream.close();
+
+    // Check the document and the order of the markers.
+    const char* pTrailer = "\n],\"displayTimeUnit\":\"ms\"}\n";
+    const U32 trailerLength = dStrlen( pTrailer );
+    const char* pOuter = dStrstr( (const char*)pText, "\"name\":\"ProfilerTraceTest_Outer\",\"ph\":\"B\"" );
+    const char* pInner = dStrstr( (const char*)pText, "\"name\":\"ProfilerTraceTest_Inner\",\"ph\":\"B\"" );
+    const bool validHeader = dStrncmp( pText, "{\"traceEvents\":[", 16 ) == 0;
+    const bool validTrailer = size >= trailerLength && dStrcmp( pText + size - trailerLength, pTrailer ) == 0;
+    const bool ordered = pOuter != NULL && pInner != NULL && pOuter < pInner;
+    delete [] pText;
+
+    ASSERT_TRUE( validHeader ) << "Invalid trace header.";
+    ASSERT_TRUE( validTrailer ) << "Invalid trace trailer.";
+    ASSERT_TRUE( ordered ) << "The markers weren't exported in order.";
+
+    ProfilerTrace::reset();
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ProfilerTraceTests, threadReuseTest )
+{
+    ProfilerTrace::reset();
+
+    // Record events on more short-lived threads than there are buffers.
+    U32 threadCount = 0;
+    for ( U32 n = 0; n < (U32)ProfilerTrace::MaxThreads + 8; ++n )
+    {
+        Thread* pThread = new Thread( profilerTraceThread, NULL, false );
+        pThread->start();
+        pThread->join();
+        delete pThread;
+
+        // Each thread should reuse the buffer of the thread that exited before it.
+        if ( n == 0 )
+            threadCount = ProfilerTrace::getThreadCount();
+        else
+            ASSERT_EQ( threadCount, ProfilerTrace::getThreadCount() ) << "An exited thread's buffer wasn't reused.";
+    }
+
+    // Only the events of the last thread should remain in the reused buffer.
+    ProfilerTraceExport traceExport;
+    traceExport.exportTrace();
+    ASSERT_EQ( 1, traceExport.count( "ProfilerTraceTest_Thread" ) ) << "Unexpected number of thread markers.";
+
+    ProfilerTrace::reset();
+}
+
+#endif // TORQUE_ENABLE_PROFILER
+
+#endif // TORQUE_SHIPPING
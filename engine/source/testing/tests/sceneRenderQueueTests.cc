@@ -0,0 +1,369 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _SCENE_RENDER_QUEUE_H_
+#include "2d/scene/SceneRenderQueue.h"
+#endif
+
+#ifndef _SCENE_RENDER_OBJECT_H_
+#include "2d/scene/SceneRenderObject.h"
+#endif
+
+#ifndef _MRANDOM_H_
+#include "math/mRandom.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define SCENERENDERQUEUE_UNITTEST_SMALL_COUNT       24
+#define SCENERENDERQUEUE_UNITTEST_LARGE_COUNT       256
+#define SCENERENDERQUEUE_UNITTEST_DISPLACED_COUNT   24
+#define SCENERENDERQUEUE_UNITTEST_SEED              1234
+
+//-----------------------------------------------------------------------------
+
+class SceneRenderQueueTestObject : public SceneRenderObject
+{
+public:
+    SceneRenderQueueTestObject() : mBatchIsolated( false ) {}
+
+    virtual bool isBatchRendered( void ) { return true; }
+    virtual bool getBatchIsolated( void ) { return mBatchIsolated; }
+    virtual bool validRender( void ) const { return true; }
+    virtual bool shouldRender( void ) const { return true; }
+    virtual void scenePrepareRender(const SceneRenderState* pSceneRenderState, SceneRenderQueue* pSceneRenderQueue ) {}
+    virtual void sceneRender( const SceneRenderState* pSceneRenderState, const SceneRenderRequest* pSceneRenderRequest, BatchRender* pBatchRenderer ) {}
+    virtual void sceneRenderFallback( const SceneRenderState* pSceneRenderState, const SceneRenderRequest* pSceneRenderRequest, BatchRender* pBatchRenderer ) {}
+
+    bool mBatchIsolated;
+};
+
+//-----------------------------------------------------------------------------
+// The comparisons the render queue used to sort with.
+//-----------------------------------------------------------------------------
+
+static S32 QSORT_CALLBACK sceneRenderQueueTestNewestSort(const void* a, const void* b)
+{
+    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
+    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
+
+    return pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
+}
+
+static S32 QSORT_CALLBACK sceneRenderQueueTestOldestSort(const void* a, const void* b)
+{
+    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
+    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
+
+    return pSceneRenderRequestB->mSerialId - pSceneRenderRequestA->mSerialId;
+}
+
+static S32 QSORT_CALLBACK sceneRenderQueueTestDepthSort(const void* a, const void* b)
+{
+    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
+    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
+
+    const F32 depthA = pSceneRenderRequestA->mDepth;
+    const F32 depthB = pSceneRenderRequestB->mDepth;
+
+    return depthA < depthB ? 1 : depthA > depthB ? -1 : pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
+}
+
+static S32 QSORT_CALLBACK sceneRenderQueueTestInverseDepthSort(const void* a, const void* b)
+{
+    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
+    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
+
+    const F32 depthA = pSceneRenderRequestA->mDepth;
+    const F32 depthB = pSceneRenderRequestB->mDepth;
+
+    return depthA < depthB ? -1 : depthA > depthB ? 1 : pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
+}
+
+static S32 QSORT_CALLBACK sceneRenderQueueTestBatchSort(const void* a, const void* b)
+{
+    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
+    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
+
+    const bool renderIsolatedA = pSceneRenderRequestA->mpSceneRenderObject->getBatchIsolated();
+    const bool renderIsolatedB = pSceneRenderRequestB->mpSceneRenderObject->getBatchIsolated();
+
+    if ( renderIsolatedA != renderIsolatedB )
+        return renderIsolatedA ? -1 : 1;
+
+    return pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
+}
+
+static S32 QSORT_CALLBACK sceneRenderQueueTestGroupSort(const void* a, const void* b)
+{
+    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
+    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
+
+    StringTableEntry renderGroupA = pSceneRenderRequestA->mRenderGroup;
+    StringTableEntry renderGroupB = pSceneRenderRequestB->mRenderGroup;
+
+    return renderGroupA == renderGroupB ? pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId : renderGroupA < renderGroupB ? -1 : 1;
+}
+
+static S32 QSORT_CALLBACK sceneRenderQueueTestXSort(const void* a, const void* b)
+{
+    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
+    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
+
+    const F32 x1 = pSceneRenderRequestA->mWorldPosition.x + pSceneRenderRequestA->mSortPoint.x;
+    const F32 x2 = pSceneRenderRequestB->mWorldPosition.x + pSceneRenderRequestB->mSortPoint.x;
+
+    return x1 < x2 ? -1 : x1 > x2 ? 1 : pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
+}
+
+static S32 QSORT_CALLBACK sceneRenderQueueTestYSort(const void* a, const void* b)
+{
+    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
+    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
+
+    const F32 y1 = pSceneRenderRequestA->mWorldPosition.y + pSceneRenderRequestA->mSortPoint.y;
+    const F32 y2 = pSceneRenderRequestB->mWorldPosition.y + pSceneRenderRequestB->mSortPoint.y;
+
+    return y1 < y2 ? -1 : y1 > y2 ? 1 : pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
+}
+
+static S32 QSORT_CALLBACK sceneRenderQueueTestInverseXSort(const void* a, const void* b)
+{
+    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
+    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
+
+    const F32 x1 = pSceneRenderRequestA->mWorldPosition.x + pSceneRenderRequestA->mSortPoint.x;
+    const F32 x2 = pSceneRenderRequestB->mWorldPosition.x + pSceneRenderRequestB->mSortPoint.x;
+
+    return x1 < x2 ? 1 : x1 > x2 ? -1 : pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
+}
+
+static S32 QSORT_CALLBACK sceneRenderQueueTestInverseYSort(const void* a, const void* b)
+{
+    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
+    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
+
+    const F32 y1 = pSceneRenderRequestA->mWorldPosition.y + pSceneRenderRequestA->mSortPoint.y;
+    const F32 y2 = pSceneRenderRequestB->mWorldPosition.y + pSceneRenderRequestB->mSortPoint.y;
+
+    return y1 < y2 ? 1 : y1 > y2 ? -1 : pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
+}
+
+//-----------------------------------------------------------------------------
+
+static void fillSceneRenderQueueTestQueue( SceneRenderQueue& renderQueue, SceneRenderQueueTestObject* pObjects, const U32 requestCount, RandomLCG& random )
+{
+    // Few distinct values so many keys are equal, including negative values and both signs of zero.
+    static const F32 values[] = { -3.5f, -1.0f, -0.0f, 0.0f, 0.25f, 2.0f, 1.0e6f };
+    const S32 valueCount = sizeof(values) / sizeof(F32);
+
+    StringTableEntry renderGroups[] =
+    {
+        StringTable->EmptyString,
+        StringTable->insert( "SceneRenderQueueTestGroupA" ),
+        StringTable->insert( "SceneRenderQueueTestGroupB" ),
+        StringTable->insert( "SceneRenderQueueTestGroupC" )
+    };
+    const S32 renderGroupCount = sizeof(renderGroups) / sizeof(StringTableEntry);
+
+    // Unique serial Ids, both negative and positive, in a random order.
+    Vector<S32> serialIds;
+    for ( U32 index = 0; index < requestCount; ++index )
+        serialIds.push_back( (S32)index * 3 - (S32)requestCount );
+    for ( U32 index = requestCount - 1; index > 0; --index )
+    {
+        const U32 swapIndex = (U32)random.randRangeI( 0, (S32)index );
+        const S32 serialId = serialIds[index];
+        serialIds[index] = serialIds[swapIndex];
+        serialIds[swapIndex] = serialId;
+    }
+
+    for ( U32 index = 0; index < requestCount; ++index )
+    {
+        pObjects[index].mBatchIsolated = random.randRangeI( 0, 3 ) == 0;
+
+        renderQueue.createRenderRequest()->set(
+            &pObjects[index],
+            Vector2( values[random.randRangeI( 0, valueCount-1 )], values[random.randRangeI( 0, valueCount-1 )] ),
+            values[random.randRangeI( 0, valueCount-1 )],
+            Vector2( values[random.randRangeI( 0, valueCount-1 )], values[random.randRangeI( 0, valueCount-1 )] ),
+            serialIds[index],
+            renderGroups[random.randRangeI( 0, renderGroupCount-1 )] );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static bool checkSceneRenderQueueTestSort( SceneRenderQueue& renderQueue, const SceneRenderQueue::RenderSort sortMode, S32 (QSORT_CALLBACK *referenceSort)(const void*, const void*) )
+{
+    SceneRenderQueue::typeRenderRequestVector& renderRequests = renderQueue.getRenderRequests();
+
+    // Sort a copy of the render requests with the reference comparison.
+    // NOTE: No requests compare as equal so the (unstable) reference sort has a single result.
+    SceneRenderQueue::typeRenderRequestVector expectedRenderRequests = renderRequests;
+    if ( referenceSort != NULL )
+        dQsort( expectedRenderRequests.address(), expectedRenderRequests.size(), sizeof(SceneRenderRequest*), referenceSort );
+
+    renderQueue.setSortMode( sortMode );
+    renderQueue.sort();
+
+    for ( S32 index = 0; index < renderRequests.size(); ++index )
+    {
+        if ( renderRequests[index] != expectedRenderRequests[index] )
+            return false;
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+static void testSceneRenderQueueSort( const SceneRenderQueue::RenderSort sortMode, S32 (QSORT_CALLBACK *referenceSort)(const void*, const void*) )
+{
+    RandomLCG random( SCENERENDERQUEUE_UNITTEST_SEED );
+    SceneRenderQueueTestObject objects[SCENERENDERQUEUE_UNITTEST_LARGE_COUNT];
+
+    // A small queue is always insertion sorted.
+    {
+        SceneRenderQueue renderQueue;
+        fillSceneRenderQueueTestQueue( renderQueue, objects, SCENERENDERQUEUE_UNITTEST_SMALL_COUNT, random );
+        ASSERT_TRUE( checkSceneRenderQueueTestSort( renderQueue, sortMode, referenceSort ) ) << "Incorrect order for a small queue.";
+    }
+
+    // A large disordered queue is radix sorted.
+    SceneRenderQueue renderQueue;
+    fillSceneRenderQueueTestQueue( renderQueue, objects, SCENERENDERQUEUE_UNITTEST_LARGE_COUNT, random );
+    ASSERT_TRUE( checkSceneRenderQueueTestSort( renderQueue, sortMode, referenceSort ) ) << "Incorrect order for a large queue.";
+
+    // Sorting again should not change the order.
+    ASSERT_TRUE( checkSceneRenderQueueTestSort( renderQueue, sortMode, referenceSort ) ) << "Incorrect order for a sorted queue.";
+
+    SceneRenderQueue::typeRenderRequestVector& renderRequests = renderQueue.getRenderRequests();
+    const S32 requestCount = renderRequests.size();
+
+    // A nearly sorted queue is insertion sorted.
+    SceneRenderRequest* pSwapRenderRequest = renderRequests[requestCount / 2];
+    renderRequests[requestCount / 2] = renderRequests[requestCount / 2 + 1];
+    renderRequests[requestCount / 2 + 1] = pSwapRenderRequest;
+    ASSERT_TRUE( checkSceneRenderQueueTestSort( renderQueue, sortMode, referenceSort ) ) << "Incorrect order for a nearly sorted queue.";
+
+    // Moving the first requests to the end leaves a single out-of-order request but needs
+    // more moves than the insertion sort allows so it falls back to the radix sort part way through.
+    SceneRenderQueue::typeRenderRequestVector displacedRenderRequests;
+    for ( S32 index = SCENERENDERQUEUE_UNITTEST_DISPLACED_COUNT; index < requestCount; ++index )
+        displacedRenderRequests.push_back( renderRequests[index] );
+    for ( S32 index = 0; index < SCENERENDERQUEUE_UNITTEST_DISPLACED_COUNT; ++index )
+        displacedRenderRequests.push_back( renderRequests[index] );
+    renderRequests = displacedRenderRequests;
+    ASSERT_TRUE( checkSceneRenderQueueTestSort( renderQueue, sortMode, referenceSort ) ) << "Incorrect order after the insertion sort fell back.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneRenderQueueTests, offSortTest )
+{
+    testSceneRenderQueueSort( SceneRenderQueue::RENDER_SORT_OFF, NULL );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneRenderQueueTests, newestSortTest )
+{
+    testSceneRenderQueueSort( SceneRenderQueue::RENDER_SORT_NEWEST, sceneRenderQueueTestNewestSort );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneRenderQueueTests, oldestSortTest )
+{
+    testSceneRenderQueueSort( SceneRenderQueue::RENDER_SORT_OLDEST, sceneRenderQueueTestOldestSort );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneRenderQueueTests, batchSortTest )
+{
+    testSceneRenderQueueSort( SceneRenderQueue::RENDER_SORT_BATCH, sceneRenderQueueTestBatchSort );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneRenderQueueTests, groupSortTest )
+{
+    testSceneRenderQueueSort( SceneRenderQueue::RENDER_SORT_GROUP, sceneRenderQueueTestGroupSort );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneRenderQueueTests, xAxisSortTest )
+{
+    testSceneRenderQueueSort( SceneRenderQueue::RENDER_SORT_XAXIS, sceneRenderQueueTestXSort );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneRenderQueueTests, yAxisSortTest )
+{
+    testSceneRenderQueueSort( SceneRenderQueue::RENDER_SORT_YAXIS, sceneRenderQueueTestYSort );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneRenderQueueTests, zAxisSortTest )
+{
+    testSceneRenderQueueSort( SceneRenderQueue::RENDER_SORT_ZAXIS, sceneRenderQueueTestDepthSort );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneRenderQueueTests, inverseXAxisSortTest )
+{
+    testSceneRenderQueueSort( SceneRenderQueue::RENDER_SORT_INVERSE_XAXIS, sceneRenderQueueTestInverseXSort );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneRenderQueueTests, inverseYAxisSortTest )
+{
+    testSceneRenderQueueSort( SceneRenderQueue::RENDER_SORT_INVERSE_YAXIS, sceneRenderQueueTestInverseYSort );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneRenderQueueTests, inverseZAxisSortTest )
+{
+    testSceneRenderQueueSort( SceneRenderQueue::RENDER_SORT_INVERSE_ZAXIS, sceneRenderQueueTestInverseDepthSort );
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,198 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+static void defineSceneTickTestScript( void )
+{
+    // Each object counts its ticks and performs its action (once) from inside its own tick callback.
+    Con::evaluate(
+        "function SceneTickTestObject::onUpdate(%this)"
+        "{"
+        "   %this.ticks++;"
+        "   %action = %this.action;"
+        "   %this.action = \"\";"
+        "   if (%action $= \"disable\")"
+        "      %this.setEnabled(false);"
+        "   else if (%action $= \"remove\")"
+        "      $sceneTickTestScene.remove(%this);"
+        "   else if (%action $= \"safeDelete\")"
+        "      %this.safeDelete();"
+        "   else if (%action $= \"deleteOther\")"
+        "      %this.other.delete();"
+        "   else if (%action $= \"add\")"
+        "   {"
+        "      $sceneTickTestAdded = new SceneObject() { class = \"SceneTickTestObject\"; UpdateCallback = true; };"
+        "      $sceneTickTestScene.add($sceneTickTestAdded);"
+        "   }"
+        "}"
+        "function sceneTickTestCreate()"
+        "{"
+        "   %object = new SceneObject() { class = \"SceneTickTestObject\"; UpdateCallback = true; };"
+        "   $sceneTickTestScene.add(%object);"
+        "   return %object;"
+        "}"
+        );
+}
+
+//-----------------------------------------------------------------------------
+
+static S32 getSceneTickTestTicks( const char* pObjectId )
+{
+    return dAtoi( Con::evaluatef( "return %s.ticks;", pObjectId ) );
+}
+
+//-----------------------------------------------------------------------------
+
+static void tickSceneTickTestScene( Scene* pScene )
+{
+    // Interpolate between ticks as the engine does.
+    pScene->processTick();
+    pScene->interpolateTick( 0.5f );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneTickTests, tickCallbackTest )
+{
+    defineSceneTickTestScript();
+
+    Scene* pScene = new Scene();
+    ASSERT_TRUE( pScene->registerObject() ) << "The scene was not registered.";
+    Con::setIntVariable( "$sceneTickTestScene", pScene->getId() );
+
+    // NOTE: Objects tick in the order they were added.
+    char disableId[32];
+    char removeId[32];
+    char safeDeleteId[32];
+    char deleteOtherId[32];
+    char victimId[32];
+    char addId[32];
+    char plainId[32];
+    dStrcpy( disableId, Con::executef( 1, "sceneTickTestCreate" ) );
+    dStrcpy( removeId, Con::executef( 1, "sceneTickTestCreate" ) );
+    dStrcpy( safeDeleteId, Con::executef( 1, "sceneTickTestCreate" ) );
+    dStrcpy( deleteOtherId, Con::executef( 1, "sceneTickTestCreate" ) );
+    dStrcpy( victimId, Con::executef( 1, "sceneTickTestCreate" ) );
+    dStrcpy( addId, Con::executef( 1, "sceneTickTestCreate" ) );
+    dStrcpy( plainId, Con::executef( 1, "sceneTickTestCreate" ) );
+    const U32 victimObjectId = dAtoi( victimId );
+
+    Con::evaluatef( "%s.action = \"disable\";", disableId );
+    Con::evaluatef( "%s.action = \"remove\";", removeId );
+    Con::evaluatef( "%s.action = \"safeDelete\";", safeDeleteId );
+    Con::evaluatef( "%s.action = \"deleteOther\"; %s.other = %s;", deleteOtherId, deleteOtherId, victimId );
+    Con::evaluatef( "%s.action = \"add\";", addId );
+
+    // Every object should tick except the one deleted by an object ticked before it.
+    tickSceneTickTestScene( pScene );
+    ASSERT_EQ( 1, getSceneTickTestTicks( disableId ) ) << "The disabled object did not tick.";
+    ASSERT_EQ( 1, getSceneTickTestTicks( removeId ) ) << "The removed object did not tick.";
+    ASSERT_EQ( 1, getSceneTickTestTicks( safeDeleteId ) ) << "The safely deleted object did not tick.";
+    ASSERT_EQ( 1, getSceneTickTestTicks( deleteOtherId ) ) << "The deleting object did not tick.";
+    ASSERT_EQ( 1, getSceneTickTestTicks( addId ) ) << "The adding object did not tick.";
+    ASSERT_EQ( 1, getSceneTickTestTicks( plainId ) ) << "The object after the changes did not tick.";
+    ASSERT_TRUE( Sim::findObject( victimObjectId ) == NULL ) << "The other object was not deleted.";
+
+    // An object added during a tick should only tick from the next tick.
+    char addedId[32];
+    dStrcpy( addedId, Con::getVariable( "$sceneTickTestAdded" ) );
+    ASSERT_TRUE( Sim::findObject( addedId ) != NULL ) << "The object was not added.";
+    ASSERT_EQ( 0, getSceneTickTestTicks( addedId ) ) << "The object added during the tick was ticked.";
+    ASSERT_EQ( 6U, pScene->getSceneObjectCount() ) << "Incorrect object count after the first tick.";
+
+    // The disabled and removed objects should no longer tick and the safely deleted object should be deleted.
+    tickSceneTickTestScene( pScene );
+    ASSERT_TRUE( Sim::findObject( safeDeleteId ) == NULL ) << "The safely deleted object was not deleted.";
+    ASSERT_EQ( 1, getSceneTickTestTicks( disableId ) ) << "The disabled object was ticked.";
+    ASSERT_EQ( 1, getSceneTickTestTicks( removeId ) ) << "The removed object was ticked.";
+    ASSERT_EQ( 2, getSceneTickTestTicks( deleteOtherId ) ) << "The deleting object did not tick.";
+    ASSERT_EQ( 2, getSceneTickTestTicks( addId ) ) << "The adding object did not tick.";
+    ASSERT_EQ( 2, getSceneTickTestTicks( plainId ) ) << "The object after the changes did not tick.";
+    ASSERT_EQ( 1, getSceneTickTestTicks( addedId ) ) << "The object added during the previous tick did not tick.";
+
+    // Enabling and adding the objects again should tick them again.
+    Con::evaluatef( "%s.setEnabled(true); $sceneTickTestScene.add(%s);", disableId, removeId );
+    tickSceneTickTestScene( pScene );
+    ASSERT_EQ( 2, getSceneTickTestTicks( disableId ) ) << "The enabled object did not tick.";
+    ASSERT_EQ( 2, getSceneTickTestTicks( removeId ) ) << "The added object did not tick.";
+    ASSERT_EQ( 3, getSceneTickTestTicks( plainId ) ) << "The object after the changes did not tick.";
+    ASSERT_EQ( 2, getSceneTickTestTicks( addedId ) ) << "The object added during the previous tick did not tick.";
+    ASSERT_EQ( 6U, pScene->getDebugStats().objectsEnabled ) << "Incorrect enabled object count.";
+
+    pScene->deleteObject();
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneTickTests, lastTickedTest )
+{
+    defineSceneTickTestScript();
+
+    Scene* pScene = new Scene();
+    ASSERT_TRUE( pScene->registerObject() ) << "The scene was not registered.";
+    Con::setIntVariable( "$sceneTickTestScene", pScene->getId() );
+
+    char firstId[32];
+    char lastId[32];
+    dStrcpy( firstId, Con::executef( 1, "sceneTickTestCreate" ) );
+    dStrcpy( lastId, Con::executef( 1, "sceneTickTestCreate" ) );
+
+    // Disabling and enabling the most recently ticked object outside of a tick should tick it again.
+    Con::evaluatef( "%s.setEnabled(false);", lastId );
+    tickSceneTickTestScene( pScene );
+    ASSERT_EQ( 1, getSceneTickTestTicks( firstId ) ) << "The first object did not tick.";
+    ASSERT_EQ( 0, getSceneTickTestTicks( lastId ) ) << "The disabled object was ticked.";
+    Con::evaluatef( "%s.setEnabled(true);", lastId );
+    tickSceneTickTestScene( pScene );
+    ASSERT_EQ( 2, getSceneTickTestTicks( firstId ) ) << "The first object did not tick.";
+    ASSERT_EQ( 1, getSceneTickTestTicks( lastId ) ) << "The enabled object did not tick.";
+
+    // Removing the most recently ticked object outside of a tick should leave the other object ticking.
+    Con::evaluatef( "$sceneTickTestScene.remove(%s);", lastId );
+    Con::evaluatef( "$sceneTickTestScene.remove(%s);", firstId );
+    Con::evaluatef( "$sceneTickTestScene.add(%s);", firstId );
+    tickSceneTickTestScene( pScene );
+    ASSERT_EQ( 3, getSceneTickTestTicks( firstId ) ) << "The added object did not tick.";
+    ASSERT_EQ( 1, getSceneTickTestTicks( lastId ) ) << "The removed object was ticked.";
+
+    Con::evaluatef( "%s.delete();", lastId );
+    pScene->deleteObject();
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,222 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
+#ifndef _SCENE_RENDER_STATE_H_
+#include "2d/scene/SceneRenderState.h"
+#endif
+
+#ifndef _SPRITE_H_
+#include "2d/sceneobject/Sprite.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define SCENEVISIBILITYCACHE_UNITTEST_LAYER_MASK    BIT(0)
+#define SCENEVISIBILITYCACHE_UNITTEST_GROUP_MASK    BIT(0)
+
+//-----------------------------------------------------------------------------
+
+static Sprite* createSceneVisibilityCacheTestSprite( Scene* pScene, const Vector2& position )
+{
+    // NOTE: Sprites without an image render nothing but still compile default render requests.
+    Sprite* pSprite = new Sprite();
+    pSprite->registerObject();
+    pScene->addToScene( pSprite );
+    pSprite->setPosition( position );
+    return pSprite;
+}
+
+//-----------------------------------------------------------------------------
+
+static bool renderSceneVisibilityCacheTestScene( Scene* pScene, const RectF& renderArea, const U32 layerMask, const U32 groupMask )
+{
+    DebugStats& debugStats = pScene->getDebugStats();
+    const U32 visibilityCacheHits = debugStats.visibilityCacheHits;
+
+    SceneRenderState sceneRenderState(
+        renderArea,
+        renderArea.centre(),
+        0.0f,
+        layerMask,
+        groupMask,
+        Vector2::getOne(),
+        &debugStats,
+        NULL );
+
+    pScene->sceneRender( &sceneRenderState );
+
+    return debugStats.visibilityCacheHits != visibilityCacheHits;
+}
+
+//-----------------------------------------------------------------------------
+
+static bool renderSceneVisibilityCacheTestScene( Scene* pScene )
+{
+    return renderSceneVisibilityCacheTestScene( pScene, RectF( -10.0f, -10.0f, 20.0f, 20.0f ), SCENEVISIBILITYCACHE_UNITTEST_LAYER_MASK, SCENEVISIBILITYCACHE_UNITTEST_GROUP_MASK );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneVisibilityCacheTests, cameraTest )
+{
+    Scene* pScene = new Scene();
+    ASSERT_TRUE( pScene->registerObject() ) << "The scene was not registered.";
+    pScene->setVisibilityCacheEnabled( true );
+
+    createSceneVisibilityCacheTestSprite( pScene, Vector2( 0.0f, 0.0f ) );
+    createSceneVisibilityCacheTestSprite( pScene, Vector2( 5.0f, 0.0f ) );
+
+    const DebugStats& debugStats = pScene->getDebugStats();
+    const RectF renderArea( -10.0f, -10.0f, 20.0f, 20.0f );
+    const RectF movedRenderArea( -9.0f, -10.0f, 20.0f, 20.0f );
+    const U32 layerMask = SCENEVISIBILITYCACHE_UNITTEST_LAYER_MASK;
+    const U32 groupMask = SCENEVISIBILITYCACHE_UNITTEST_GROUP_MASK;
+
+    // The first render fills the cache and a static camera then reuses it.
+    ASSERT_FALSE( renderSceneVisibilityCacheTestScene( pScene, renderArea, layerMask, groupMask ) ) << "The first render hit the cache.";
+    ASSERT_EQ( 1U, debugStats.visibilityCacheMisses ) << "Incorrect cache miss count.";
+    ASSERT_EQ( 2U, debugStats.renderPicked ) << "Incorrect picked count.";
+    ASSERT_EQ( 2U, debugStats.renderRequests ) << "Incorrect render request count.";
+    ASSERT_TRUE( renderSceneVisibilityCacheTestScene( pScene, renderArea, layerMask, groupMask ) ) << "A static camera missed the cache.";
+    ASSERT_EQ( 1U, debugStats.visibilityCacheMisses ) << "Incorrect cache miss count.";
+    ASSERT_EQ( 2U, debugStats.renderPicked ) << "Incorrect picked count.";
+    ASSERT_EQ( 2U, debugStats.renderRequests ) << "Incorrect render request count.";
+
+    // Moving the camera misses until it stops.
+    ASSERT_FALSE( renderSceneVisibilityCacheTestScene( pScene, movedRenderArea, layerMask, groupMask ) ) << "A moved camera hit the cache.";
+    ASSERT_TRUE( renderSceneVisibilityCacheTestScene( pScene, movedRenderArea, layerMask, groupMask ) ) << "A stopped camera missed the cache.";
+    ASSERT_FALSE( renderSceneVisibilityCacheTestScene( pScene, renderArea, layerMask, groupMask ) ) << "A moved camera hit the cache.";
+
+    // Changing the layer or group masks misses.
+    ASSERT_FALSE( renderSceneVisibilityCacheTestScene( pScene, renderArea, layerMask | BIT(1), groupMask ) ) << "A changed layer mask hit the cache.";
+    ASSERT_TRUE( renderSceneVisibilityCacheTestScene( pScene, renderArea, layerMask | BIT(1), groupMask ) ) << "An unchanged layer mask missed the cache.";
+    ASSERT_FALSE( renderSceneVisibilityCacheTestScene( pScene, renderArea, layerMask, groupMask ) ) << "A changed layer mask hit the cache.";
+    ASSERT_FALSE( renderSceneVisibilityCacheTestScene( pScene, renderArea, layerMask, groupMask | BIT(1) ) ) << "A changed group mask hit the cache.";
+    ASSERT_TRUE( renderSceneVisibilityCacheTestScene( pScene, renderArea, layerMask, groupMask | BIT(1) ) ) << "An unchanged group mask missed the cache.";
+    ASSERT_FALSE( renderSceneVisibilityCacheTestScene( pScene, renderArea, layerMask, groupMask ) ) << "A changed group mask hit the cache.";
+    ASSERT_EQ( 2U, debugStats.renderPicked ) << "Incorrect picked count.";
+    ASSERT_EQ( 2U, debugStats.renderRequests ) << "Incorrect render request count.";
+
+    // Disabling the cache stops it being used.
+    pScene->setVisibilityCacheEnabled( false );
+    const U32 visibilityCacheMisses = debugStats.visibilityCacheMisses;
+    ASSERT_FALSE( renderSceneVisibilityCacheTestScene( pScene, renderArea, layerMask, groupMask ) ) << "A disabled cache was hit.";
+    ASSERT_EQ( visibilityCacheMisses, debugStats.visibilityCacheMisses ) << "A disabled cache was missed.";
+    ASSERT_EQ( 2U, debugStats.renderPicked ) << "Incorrect picked count.";
+
+    pScene->deleteObject();
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneVisibilityCacheTests, invalidationTest )
+{
+    Scene* pScene = new Scene();
+    ASSERT_TRUE( pScene->registerObject() ) << "The scene was not registered.";
+    pScene->setVisibilityCacheEnabled( true );
+
+    Sprite* pMovedSprite = createSceneVisibilityCacheTestSprite( pScene, Vector2( 0.0f, 0.0f ) );
+    Sprite* pChangedSprite = createSceneVisibilityCacheTestSprite( pScene, Vector2( 5.0f, 0.0f ) );
+
+    const DebugStats& debugStats = pScene->getDebugStats();
+
+    ASSERT_FALSE( renderSceneVisibilityCacheTestScene( pScene ) ) << "The first render hit the cache.";
+    ASSERT_TRUE( renderSceneVisibilityCacheTestScene( pScene ) ) << "A static scene missed the cache.";
+    ASSERT_EQ( 2U, debugStats.renderPicked ) << "Incorrect picked count.";
+
+    // Moving a proxy out of and back into view misses.
+    pMovedSprite->setPosition( Vector2( 100.0f, 0.0f ) );
+    ASSERT_FALSE( renderSceneVisibilityCacheTestScene( pScene ) ) << "A moved object hit the cache.";
+    ASSERT_EQ( 1U, debugStats.renderPicked ) << "An object moved out of view was picked.";
+    ASSERT_TRUE( renderSceneVisibilityCacheTestScene( pScene ) ) << "A static scene missed the cache.";
+    ASSERT_EQ( 1U, debugStats.renderRequests ) << "An object moved out of view was rendered.";
+    pMovedSprite->setPosition( Vector2( 0.0f, 0.0f ) );
+    ASSERT_FALSE( renderSceneVisibilityCacheTestScene( pScene ) ) << "A moved object hit the cache.";
+    ASSERT_EQ( 2U, debugStats.renderPicked ) << "An object moved into view was not picked.";
+
+    // Disabling and enabling an object misses.
+    ASSERT_TRUE( renderSceneVisibilityCacheTestScene( pScene ) ) << "A static scene missed the cache.";
+    pChangedSprite->setEnabled( false );
+    ASSERT_FALSE( renderSceneVisibilityCacheTestScene( pScene ) ) << "A disabled object hit the cache.";
+    ASSERT_EQ( 1U, debugStats.renderPicked ) << "A disabled object was picked.";
+    ASSERT_TRUE( renderSceneVisibilityCacheTestScene( pScene ) ) << "A static scene missed the cache.";
+    pChangedSprite->setEnabled( true );
+    ASSERT_FALSE( renderSceneVisibilityCacheTestScene( pScene ) ) << "An enabled object hit the cache.";
+    ASSERT_EQ( 2U, debugStats.renderPicked ) << "An enabled object was not picked.";
+
+    // Hiding and showing an object misses.
+    ASSERT_TRUE( renderSceneVisibilityCacheTestScene( pScene ) ) << "A static scene missed the cache.";
+    pChangedSprite->setVisible( false );
+    ASSERT_FALSE( renderSceneVisibilityCacheTestScene( pScene ) ) << "A hidden object hit the cache.";
+    ASSERT_EQ( 1U, debugStats.renderPicked ) << "A hidden object was picked.";
+    ASSERT_TRUE( renderSceneVisibilityCacheTestScene( pScene ) ) << "A static scene missed the cache.";
+    pChangedSprite->setVisible( true );
+    ASSERT_FALSE( renderSceneVisibilityCacheTestScene( pScene ) ) << "A visible object hit the cache.";
+    ASSERT_EQ( 2U, debugStats.renderPicked ) << "A visible object was not picked.";
+
+    // Moving an object to a layer or group that is not rendered misses.
+    ASSERT_TRUE( renderSceneVisibilityCacheTestScene( pScene ) ) << "A static scene missed the cache.";
+    pChangedSprite->setSceneLayer( 1 );
+    ASSERT_FALSE( renderSceneVisibilityCacheTestScene( pScene ) ) << "An object changing layer hit the cache.";
+    ASSERT_EQ( 1U, debugStats.renderPicked ) << "An object on a hidden layer was picked.";
+    pChangedSprite->setSceneLayer( 0 );
+    ASSERT_FALSE( renderSceneVisibilityCacheTestScene( pScene ) ) << "An object changing layer hit the cache.";
+    ASSERT_TRUE( renderSceneVisibilityCacheTestScene( pScene ) ) << "A static scene missed the cache.";
+    pChangedSprite->setSceneGroup( 1 );
+    ASSERT_FALSE( renderSceneVisibilityCacheTestScene( pScene ) ) << "An object changing group hit the cache.";
+    ASSERT_EQ( 1U, debugStats.renderPicked ) << "An object in a hidden group was picked.";
+    pChangedSprite->setSceneGroup( 0 );
+    ASSERT_FALSE( renderSceneVisibilityCacheTestScene( pScene ) ) << "An object changing group hit the cache.";
+    ASSERT_EQ( 2U, debugStats.renderPicked ) << "Incorrect picked count.";
+
+    // Removing and deleting objects misses.
+    ASSERT_TRUE( renderSceneVisibilityCacheTestScene( pScene ) ) << "A static scene missed the cache.";
+    pScene->removeFromScene( pChangedSprite );
+    ASSERT_FALSE( renderSceneVisibilityCacheTestScene( pScene ) ) << "A removed object hit the cache.";
+    ASSERT_EQ( 1U, debugStats.renderPicked ) << "A removed object was picked.";
+    ASSERT_EQ( 1U, debugStats.renderRequests ) << "A removed object was rendered.";
+    ASSERT_TRUE( renderSceneVisibilityCacheTestScene( pScene ) ) << "A static scene missed the cache.";
+    pChangedSprite->deleteObject();
+    pMovedSprite->deleteObject();
+    ASSERT_FALSE( renderSceneVisibilityCacheTestScene( pScene ) ) << "A deleted object hit the cache.";
+    ASSERT_EQ( 0U, debugStats.renderPicked ) << "A deleted object was picked.";
+
+    pScene->deleteObject();
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,214 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _SIM_EVENT_QUEUE_H_
+#include "sim/simEventQueue.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define SIM_UNITTEST_EVENTQUEUE_EVENTCOUNT      100000
+#define SIM_UNITTEST_EVENTQUEUE_MAXDELAY        10000
+
+//-----------------------------------------------------------------------------
+
+class SimEventQueueTestEvent : public SimEvent
+{
+public:
+    SimEventQueueTestEvent( SimObject* pObject, const SimTime eventTime, const U32 sequence )
+    {
+        destObject = pObject;
+        startTime = 0;
+        time = eventTime;
+        sequenceCount = sequence;
+    }
+
+    virtual void process( SimObject* object ) {}
+};
+
+//-----------------------------------------------------------------------------
+
+// The queue never dereferences the destination objects so these only need to be unique.
+static U8 gSimEventQueueTestObjects[2];
+#define SIM_UNITTEST_EVENTQUEUE_OBJECT(index)   ((SimObject*)&gSimEventQueueTestObjects[index])
+
+//-----------------------------------------------------------------------------
+
+TEST( SimEventQueueTests, orderingTest )
+{
+    SimEventQueue queue;
+
+    // Post events with a mixture of times, many of which are the same.
+    U32 sequence = 1;
+    for( U32 index = 0; index < 1000; ++index )
+    {
+        queue.push( new SimEventQueueTestEvent( SIM_UNITTEST_EVENTQUEUE_OBJECT(0), (index * 7) % 13, sequence++ ) );
+    }
+
+    ASSERT_EQ( (U32)1000, queue.size() ) << "Queue size is incorrect.";
+
+    // Check events are dispatched by time then by the order they were posted.
+    SimEvent* pPrevious = NULL;
+    while( !queue.isEmpty() )
+    {
+        SimEvent* pEvent = queue.pop();
+
+        ASSERT_EQ( -1, pEvent->queueIndex ) << "Popped event is still indexed.";
+
+        if ( pPrevious != NULL )
+        {
+            ASSERT_LE( pPrevious->time, pEvent->time ) << "Events popped out of time order.";
+
+            if ( pPrevious->time == pEvent->time )
+            {
+                ASSERT_LT( pPrevious->sequenceCount, pEvent->sequenceCount ) << "Events with the same time popped out of post order.";
+            }
+
+            delete pPrevious;
+        }
+
+        pPrevious = pEvent;
+    }
+
+    delete pPrevious;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SimEventQueueTests, cancelTest )
+{
+    SimEventQueue queue;
+
+    // Post events for two objects.
+    for( U32 index = 0; index < 1000; ++index )
+    {
+        queue.push( new SimEventQueueTestEvent( SIM_UNITTEST_EVENTQUEUE_OBJECT(index & 1), 1000 - index, index + 1 ) );
+    }
+
+    // Cancel every third event by sequence.
+    for( U32 sequence = 3; sequence <= 1000; sequence += 3 )
+    {
+        SimEvent* pEvent = queue.find( sequence );
+        ASSERT_NE( (SimEvent*)NULL, pEvent ) << "Pending event not found.";
+
+        queue.remove( pEvent );
+        delete pEvent;
+
+        ASSERT_EQ( (SimEvent*)NULL, queue.find( sequence ) ) << "Cancelled event still found.";
+    }
+
+    // Delete all the events for the first object.
+    queue.deleteObjectEvents( SIM_UNITTEST_EVENTQUEUE_OBJECT(0) );
+
+    // Check only the remaining second object events are dispatched and in order.
+    U32 count = 0;
+    SimTime previousTime = 0;
+    while( !queue.isEmpty() )
+    {
+        SimEvent* pEvent = queue.pop();
+
+        ASSERT_EQ( SIM_UNITTEST_EVENTQUEUE_OBJECT(1), pEvent->destObject ) << "Deleted object event was dispatched.";
+        ASSERT_NE( (U32)0, pEvent->sequenceCount % 3 ) << "Cancelled event was dispatched.";
+        ASSERT_LE( previousTime, pEvent->time ) << "Events popped out of time order.";
+
+        previousTime = pEvent->time;
+        delete pEvent;
+        count++;
+    }
+
+    // Second object events are the odd indices (even sequences) that weren't cancelled.
+    ASSERT_EQ( (U32)334, count ) << "Incorrect number of events dispatched.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SimEventQueueTests, throughputBenchmark )
+{
+    SimEventQueue queue;
+
+    // Generate deterministic pseudo-random delays.
+    U32 seed = 12345;
+    Vector<SimTime> delays;
+    delays.setSize( SIM_UNITTEST_EVENTQUEUE_EVENTCOUNT );
+    for( U32 index = 0; index < SIM_UNITTEST_EVENTQUEUE_EVENTCOUNT; ++index )
+    {
+        seed = seed * 1664525 + 1013904223;
+        delays[index] = (seed >> 8) % SIM_UNITTEST_EVENTQUEUE_MAXDELAY;
+    }
+
+    // Post.
+    U32 startTime = Platform::getRealMilliseconds();
+    for( U32 index = 0; index < SIM_UNITTEST_EVENTQUEUE_EVENTCOUNT; ++index )
+    {
+        queue.push( new SimEventQueueTestEvent( SIM_UNITTEST_EVENTQUEUE_OBJECT(0), delays[index], index + 1 ) );
+    }
+    const U32 postTime = Platform::getRealMilliseconds() - startTime;
+
+    ASSERT_EQ( (U32)SIM_UNITTEST_EVENTQUEUE_EVENTCOUNT, queue.size() ) << "Queue size is incorrect.";
+
+    // Cancel every other event.
+    startTime = Platform::getRealMilliseconds();
+    for( U32 sequence = 2; sequence <= SIM_UNITTEST_EVENTQUEUE_EVENTCOUNT; sequence += 2 )
+    {
+        SimEvent* pEvent = queue.find( sequence );
+        queue.remove( pEvent );
+        delete pEvent;
+    }
+    const U32 cancelTime = Platform::getRealMilliseconds() - startTime;
+
+    ASSERT_EQ( (U32)SIM_UNITTEST_EVENTQUEUE_EVENTCOUNT / 2, queue.size() ) << "Queue size is incorrect.";
+
+    // Dispatch the remainder.
+    startTime = Platform::getRealMilliseconds();
+    SimTime previousTime = 0;
+    while( !queue.isEmpty() )
+    {
+        SimEvent* pEvent = queue.pop();
+        ASSERT_LE( previousTime, pEvent->time ) << "Events popped out of time order.";
+        previousTime = pEvent->time;
+        delete pEvent;
+    }
+    const U32 popTime = Platform::getRealMilliseconds() - startTime;
+
+    Con::printf( "SimEventQueue: %d events - post %dms, cancel %d in %dms, pop %d in %dms.",
+        SIM_UNITTEST_EVENTQUEUE_EVENTCOUNT, postTime,
+        SIM_UNITTEST_EVENTQUEUE_EVENTCOUNT / 2, cancelTime,
+        SIM_UNITTEST_EVENTQUEUE_EVENTCOUNT / 2, popTime );
+}
+
+#endif // TORQUE_SHIPPING
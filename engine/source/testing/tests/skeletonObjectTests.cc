@@ -0,0 +1,395 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _SKELETON_OBJECT_H_
+#include "2d/sceneobject/SkeletonObject.h"
+#endif
+
+#ifndef _SKELETON_ASSET_H_
+#include "2d/assets/SkeletonAsset.h"
+#endif
+
+#include "spine/extension.h"
+
+//-----------------------------------------------------------------------------
+
+#define SKELETON_UNITTEST_SKELETONS     300
+#define SKELETON_UNITTEST_BONES         16
+#define SKELETON_UNITTEST_FRAMES        60
+
+//-----------------------------------------------------------------------------
+
+class SkeletonObjectTestCrowd : public SkeletonObject
+{
+public:
+    void createTestSkeleton( spSkeletonData* pSkeletonData, Vector<spRegionAttachment*>& attachments )
+    {
+        mSkeleton = spSkeleton_create( pSkeletonData );
+
+        for ( S32 n = 0; n < mSkeleton->slotCount; ++n )
+            spSlot_setAttachment( mSkeleton->slots[n], SUPER(attachments[n]) );
+    }
+
+    inline spSkeleton* getTestSkeleton( void ) const { return mSkeleton; }
+    inline SpriteBatchItem* findTestSprite( const U32 batchId ) { return findSpriteId( batchId ); }
+
+    void getTestRenderOrder( Vector<SpriteBatchItem*>& sprites )
+    {
+        // The sprites render in the order they are stored when sorting is off.
+        for ( typeSpriteBatchSlots::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
+            sprites.push_back( *spriteItr );
+    }
+
+    void updateTestSprites( const F32 rootRotation )
+    {
+        mSkeleton->root->rotation = rootRotation;
+        spSkeleton_updateWorldTransform( mSkeleton );
+        updateSprites( StringTable->EmptyString );
+    }
+};
+
+//-----------------------------------------------------------------------------
+
+static spSkeletonData* createTestSkeletonData( Vector<spRegionAttachment*>& attachments )
+{
+    spSkeletonData* pSkeletonData = spSkeletonData_create();
+    pSkeletonData->boneCount = SKELETON_UNITTEST_BONES;
+    pSkeletonData->bones = MALLOC( spBoneData*, SKELETON_UNITTEST_BONES );
+    pSkeletonData->slotCount = SKELETON_UNITTEST_BONES;
+    pSkeletonData->slots = MALLOC( spSlotData*, SKELETON_UNITTEST_BONES );
+
+    // Create a chain of bones each with a slot showing a region.
+    char name[32];
+    for ( U32 n = 0; n < SKELETON_UNITTEST_BONES; ++n )
+    {
+        dSprintf( name, sizeof(name), "bone%d", n );
+        spBoneData* pBoneData = spBoneData_create( name, n == 0 ? NULL : pSkeletonData->bones[n-1] );
+        pBoneData->length = 1.0f;
+        pBoneData->x = n == 0 ? 0.0f : 1.0f;
+        pBoneData->rotation = 10.0f;
+        pSkeletonData->bones[n] = pBoneData;
+
+        dSprintf( name, sizeof(name), "slot%d", n );
+        pSkeletonData->slots[n] = spSlotData_create( name, pBoneData );
+
+        dSprintf( name, sizeof(name), "region%d", n );
+        spRegionAttachment* pAttachment = spRegionAttachment_create( name );
+        pAttachment->width = 1.0f;
+        pAttachment->height = 0.5f;
+        pAttachment->x = 0.5f;
+        spRegionAttachment_updateOffset( pAttachment );
+        attachments.push_back( pAttachment );
+    }
+
+    return pSkeletonData;
+}
+
+//-----------------------------------------------------------------------------
+
+static void destroyTestSkeletonData( spSkeletonData* pSkeletonData, Vector<spRegionAttachment*>& attachments )
+{
+    for ( S32 n = 0; n < attachments.size(); ++n )
+        spAttachment_dispose( SUPER(attachments[n]) );
+
+    attachments.clear();
+
+    spSkeletonData_dispose( pSkeletonData );
+}
+
+//-----------------------------------------------------------------------------
+
+static spAnimation* createTestAnimation( void )
+{
+    // Rotate every bone but the root back and forth over a second.
+    spAnimation* pAnimation = spAnimation_create( "wave", SKELETON_UNITTEST_BONES - 1 );
+    pAnimation->duration = 1.0f;
+    for ( U32 n = 1; n < SKELETON_UNITTEST_BONES; ++n )
+    {
+        spRotateTimeline* pTimeline = spRotateTimeline_create( 3 );
+        pTimeline->boneIndex = n;
+        spRotateTimeline_setFrame( pTimeline, 0, 0.0f, 0.0f );
+        spRotateTimeline_setFrame( pTimeline, 1, 0.5f, 30.0f );
+        spRotateTimeline_setFrame( pTimeline, 2, 1.0f, 0.0f );
+        pAnimation->timelines[n-1] = SUPER(SUPER(pTimeline));
+    }
+
+    return pAnimation;
+}
+
+//-----------------------------------------------------------------------------
+
+static void checkTestAnimationCache( spSkeleton* pCachedSkeleton, spSkeleton* pSkeleton, const char* pContext )
+{
+    for ( S32 i = 0; i < pSkeleton->boneCount; ++i )
+    {
+        const spBone* pCachedBone = pCachedSkeleton->bones[i];
+        const spBone* pBone = pSkeleton->bones[i];
+        ASSERT_NEAR( pBone->worldX, pCachedBone->worldX, 0.0001f ) << "Incorrect bone " << i << " position " << pContext;
+        ASSERT_NEAR( pBone->worldY, pCachedBone->worldY, 0.0001f ) << "Incorrect bone " << i << " position " << pContext;
+        ASSERT_NEAR( pBone->m00, pCachedBone->m00, 0.0001f ) << "Incorrect bone " << i << " transform " << pContext;
+        ASSERT_NEAR( pBone->m01, pCachedBone->m01, 0.0001f ) << "Incorrect bone " << i << " transform " << pContext;
+        ASSERT_NEAR( pBone->m10, pCachedBone->m10, 0.0001f ) << "Incorrect bone " << i << " transform " << pContext;
+        ASSERT_NEAR( pBone->m11, pCachedBone->m11, 0.0001f ) << "Incorrect bone " << i << " transform " << pContext;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SkeletonObjectTests, spriteReuseTest )
+{
+    Vector<spRegionAttachment*> attachments;
+    spSkeletonData* pSkeletonData = createTestSkeletonData( attachments );
+
+    SkeletonObjectTestCrowd* pSkeletonObject = new SkeletonObjectTestCrowd();
+    pSkeletonObject->createTestSkeleton( pSkeletonData, attachments );
+    spSkeleton* pSkeleton = pSkeletonObject->getTestSkeleton();
+
+    // A sprite is created for each slot.
+    pSkeletonObject->updateTestSprites( 0.0f );
+    ASSERT_EQ( (U32)SKELETON_UNITTEST_BONES, pSkeletonObject->getSpriteCount() ) << "Incorrect sprite count.";
+
+    // The sprites are created in slot order.
+    ASSERT_TRUE( pSkeletonObject->selectSpriteId( 1 ) ) << "Failed to select the first slot sprite.";
+    pSkeletonObject->setSpriteName( "slot0" );
+
+    // The sprites are kept as the skeleton animates.
+    for ( U32 frame = 1; frame < SKELETON_UNITTEST_FRAMES; ++frame )
+    {
+        pSkeletonObject->updateTestSprites( (F32)frame );
+        ASSERT_EQ( (U32)SKELETON_UNITTEST_BONES, pSkeletonObject->getSpriteCount() ) << "Incorrect sprite count at frame " << frame;
+    }
+    ASSERT_TRUE( pSkeletonObject->selectSpriteName( "slot0" ) ) << "The slot sprite was not kept.";
+    ASSERT_EQ( 1U, pSkeletonObject->getSpriteId() ) << "The slot sprite changed.";
+
+    // The sprite vertices follow the skeleton.
+    F32 vertices[8];
+    spRegionAttachment_computeWorldVertices( attachments[0], pSkeleton->x, pSkeleton->y, pSkeleton->slots[0]->bone, vertices );
+    SpriteBatchItem* pSprite = pSkeletonObject->findTestSprite( 1 );
+    pSprite->getLocalAABB();
+    const Vector2* pLocalOOBB = pSprite->getLocalOOBB();
+    ASSERT_FLOAT_EQ( vertices[VERTEX_X1], pLocalOOBB[0].x ) << "Incorrect sprite vertex.";
+    ASSERT_FLOAT_EQ( vertices[VERTEX_Y1], pLocalOOBB[0].y ) << "Incorrect sprite vertex.";
+    ASSERT_FLOAT_EQ( vertices[VERTEX_X3], pLocalOOBB[2].x ) << "Incorrect sprite vertex.";
+    ASSERT_FLOAT_EQ( vertices[VERTEX_Y3], pLocalOOBB[2].y ) << "Incorrect sprite vertex.";
+
+    // A slot without an attachment hides its sprite rather than removing it.
+    spSlot_setAttachment( pSkeleton->slots[0], NULL );
+    pSkeletonObject->updateTestSprites( 0.0f );
+    ASSERT_EQ( (U32)SKELETON_UNITTEST_BONES, pSkeletonObject->getSpriteCount() ) << "Incorrect sprite count after removing an attachment.";
+    ASSERT_TRUE( pSkeletonObject->selectSpriteId( 1 ) ) << "Failed to select the first slot sprite.";
+    ASSERT_FALSE( pSkeletonObject->getSpriteVisible() ) << "The slot sprite is visible without an attachment.";
+
+    // Restoring the attachment shows the same sprite.
+    spSlot_setAttachment( pSkeleton->slots[0], SUPER(attachments[0]) );
+    pSkeletonObject->updateTestSprites( 0.0f );
+    ASSERT_TRUE( pSkeletonObject->selectSpriteId( 1 ) ) << "Failed to select the first slot sprite.";
+    ASSERT_TRUE( pSkeletonObject->getSpriteVisible() ) << "The slot sprite is not visible after restoring the attachment.";
+
+    delete pSkeletonObject;
+    destroyTestSkeletonData( pSkeletonData, attachments );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SkeletonObjectTests, slotOrderTest )
+{
+    Vector<spRegionAttachment*> attachments;
+    spSkeletonData* pSkeletonData = createTestSkeletonData( attachments );
+
+    SkeletonObjectTestCrowd* pSkeletonObject = new SkeletonObjectTestCrowd();
+    pSkeletonObject->createTestSkeleton( pSkeletonData, attachments );
+    spSkeleton* pSkeleton = pSkeletonObject->getTestSkeleton();
+
+    // Start with the lowest slot showing nothing.
+    spSlot_setAttachment( pSkeleton->slots[0], NULL );
+    pSkeletonObject->updateTestSprites( 0.0f );
+
+    // Every slot still has a sprite but the empty slot's sprite is hidden.
+    ASSERT_EQ( (U32)SKELETON_UNITTEST_BONES, pSkeletonObject->getSpriteCount() ) << "Incorrect sprite count.";
+    ASSERT_FALSE( pSkeletonObject->findTestSprite( 1 )->getVisible() ) << "The empty slot sprite is visible.";
+    ASSERT_TRUE( pSkeletonObject->findTestSprite( 2 )->getVisible() ) << "The slot sprite is not visible.";
+
+    // The lowest slot gains its attachment later.
+    spSlot_setAttachment( pSkeleton->slots[0], SUPER(attachments[0]) );
+    pSkeletonObject->updateTestSprites( 0.0f );
+    ASSERT_EQ( (U32)SKELETON_UNITTEST_BONES, pSkeletonObject->getSpriteCount() ) << "Incorrect sprite count after adding an attachment.";
+    ASSERT_TRUE( pSkeletonObject->findTestSprite( 1 )->getVisible() ) << "The slot sprite is not visible after adding an attachment.";
+
+    // The sprites still render in slot order.
+    Vector<SpriteBatchItem*> renderOrder;
+    pSkeletonObject->getTestRenderOrder( renderOrder );
+    ASSERT_EQ( SKELETON_UNITTEST_BONES, renderOrder.size() ) << "Incorrect render order size.";
+    for ( U32 n = 0; n < SKELETON_UNITTEST_BONES; ++n )
+    {
+        ASSERT_EQ( pSkeletonObject->findTestSprite( n + 1 ), renderOrder[n] ) << "Slot " << n << " sprite renders out of order.";
+    }
+
+    delete pSkeletonObject;
+    destroyTestSkeletonData( pSkeletonData, attachments );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SkeletonObjectTests, crowdBenchmark )
+{
+    Vector<spRegionAttachment*> attachments;
+    spSkeletonData* pSkeletonData = createTestSkeletonData( attachments );
+
+    // Create the crowd.
+    Vector<SkeletonObjectTestCrowd*> crowd;
+    Vector<spSkeleton*> skeletons;
+    for ( U32 n = 0; n < SKELETON_UNITTEST_SKELETONS; ++n )
+    {
+        SkeletonObjectTestCrowd* pSkeletonObject = new SkeletonObjectTestCrowd();
+        pSkeletonObject->createTestSkeleton( pSkeletonData, attachments );
+        pSkeletonObject->getTestSkeleton()->x = (F32)n;
+        crowd.push_back( pSkeletonObject );
+        skeletons.push_back( pSkeletonObject->getTestSkeleton() );
+    }
+
+    // Animate the crowd updating the sprites.
+    U32 startTime = Platform::getRealMilliseconds();
+    for ( U32 frame = 0; frame < SKELETON_UNITTEST_FRAMES; ++frame )
+    {
+        for ( U32 n = 0; n < SKELETON_UNITTEST_SKELETONS; ++n )
+            crowd[n]->updateTestSprites( (F32)(frame + n) );
+    }
+    const U32 updateTime = Platform::getRealMilliseconds() - startTime;
+
+    for ( U32 n = 0; n < SKELETON_UNITTEST_SKELETONS; ++n )
+    {
+        ASSERT_EQ( (U32)SKELETON_UNITTEST_BONES, crowd[n]->getSpriteCount() ) << "Incorrect sprite count for skeleton " << n;
+    }
+
+    // Compute the world vertices one attachment at a time.
+    Vector<F32> attachmentVertices;
+    attachmentVertices.setSize( SKELETON_UNITTEST_SKELETONS * SKELETON_UNITTEST_BONES * 8 );
+    startTime = Platform::getRealMilliseconds();
+    for ( U32 frame = 0; frame < SKELETON_UNITTEST_FRAMES; ++frame )
+    {
+        F32* pVertices = attachmentVertices.address();
+        for ( U32 n = 0; n < SKELETON_UNITTEST_SKELETONS; ++n )
+        {
+            spSkeleton* pSkeleton = skeletons[n];
+            for ( S32 i = 0; i < pSkeleton->slotCount; ++i, pVertices += 8 )
+                spRegionAttachment_computeWorldVertices( (spRegionAttachment*)pSkeleton->slots[i]->attachment, pSkeleton->x, pSkeleton->y, pSkeleton->slots[i]->bone, pVertices );
+        }
+    }
+    const U32 attachmentTime = Platform::getRealMilliseconds() - startTime;
+
+    // Compute the world vertices for the whole crowd together.
+    Vector<F32> crowdVertices;
+    crowdVertices.setSize( SKELETON_UNITTEST_SKELETONS * SKELETON_UNITTEST_BONES * 8 );
+    startTime = Platform::getRealMilliseconds();
+    for ( U32 frame = 0; frame < SKELETON_UNITTEST_FRAMES; ++frame )
+    {
+        SkeletonObject::computeWorldVertices( skeletons.address(), SKELETON_UNITTEST_SKELETONS, crowdVertices.address() );
+    }
+    const U32 crowdTime = Platform::getRealMilliseconds() - startTime;
+
+    for ( S32 n = 0; n < crowdVertices.size(); ++n )
+    {
+        ASSERT_FLOAT_EQ( attachmentVertices[n], crowdVertices[n] ) << "Incorrect world vertex " << n;
+    }
+
+    for ( U32 n = 0; n < SKELETON_UNITTEST_SKELETONS; ++n )
+        delete crowd[n];
+
+    destroyTestSkeletonData( pSkeletonData, attachments );
+
+    Con::printf( "SkeletonObject: %d skeletons with %d slots - %d updates %dms, world vertices per attachment %dms, per crowd %dms.",
+        SKELETON_UNITTEST_SKELETONS, SKELETON_UNITTEST_BONES, SKELETON_UNITTEST_FRAMES, updateTime, attachmentTime, crowdTime );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SkeletonObjectTests, animationCacheTest )
+{
+    Vector<spRegionAttachment*> attachments;
+    spSkeletonData* pSkeletonData = createTestSkeletonData( attachments );
+    spAnimation* pAnimation = createTestAnimation();
+
+    // Sample the animation at the rate it's checked at.
+    SkeletonAnimationCache cache( pSkeletonData, pAnimation, NULL, 30.0f );
+    ASSERT_EQ( 31U, cache.getFrameCount() ) << "Incorrect frame count.";
+
+    spSkeleton* pSkeleton = spSkeleton_create( pSkeletonData );
+    spSkeleton* pCachedSkeleton = spSkeleton_create( pSkeletonData );
+
+    // The cached frames match evaluating the animation.
+    for ( U32 frame = 0; frame <= 30; ++frame )
+    {
+        const F32 time = (F32)frame / 30.0f;
+
+        spSkeleton_setToSetupPose( pSkeleton );
+        spAnimation_apply( pAnimation, pSkeleton, time, time, false, NULL, NULL );
+        spSkeleton_updateWorldTransform( pSkeleton );
+
+        cache.apply( pCachedSkeleton, time, false );
+        checkTestAnimationCache( pCachedSkeleton, pSkeleton, "when playing." );
+    }
+
+    // Looping wraps the time.
+    spSkeleton_setToSetupPose( pSkeleton );
+    spAnimation_apply( pAnimation, pSkeleton, 0.5f, 0.5f, false, NULL, NULL );
+    spSkeleton_updateWorldTransform( pSkeleton );
+    cache.apply( pCachedSkeleton, 2.5f, true );
+    checkTestAnimationCache( pCachedSkeleton, pSkeleton, "when looping." );
+
+    // Not looping clamps the time.
+    spSkeleton_setToSetupPose( pSkeleton );
+    spAnimation_apply( pAnimation, pSkeleton, 1.0f, 1.0f, false, NULL, NULL );
+    spSkeleton_updateWorldTransform( pSkeleton );
+    cache.apply( pCachedSkeleton, 2.5f, false );
+    checkTestAnimationCache( pCachedSkeleton, pSkeleton, "when finished." );
+
+    // The root offset and flip are applied to the cached frames.
+    spSkeleton_setBonesToSetupPose( pSkeleton );
+    pSkeleton->flipX = pCachedSkeleton->flipX = 1;
+    pSkeleton->root->x = pCachedSkeleton->root->x = 2.0f;
+    pSkeleton->root->y = pCachedSkeleton->root->y = -1.0f;
+    spAnimation_apply( pAnimation, pSkeleton, 0.2f, 0.2f, false, NULL, NULL );
+    spSkeleton_updateWorldTransform( pSkeleton );
+    cache.apply( pCachedSkeleton, 0.2f, false );
+    checkTestAnimationCache( pCachedSkeleton, pSkeleton, "with a root transform." );
+
+    ASSERT_EQ( 34U, cache.getLookupCount() ) << "Incorrect lookup count.";
+
+    spSkeleton_dispose( pCachedSkeleton );
+    spSkeleton_dispose( pSkeleton );
+    spAnimation_dispose( pAnimation );
+    destroyTestSkeletonData( pSkeletonData, attachments );
+}
+
+#endif // TORQUE_SHIPPING
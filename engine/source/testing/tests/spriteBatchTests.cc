@@ -0,0 +1,337 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _SPRITE_BATCH_H_
+#include "2d/core/SpriteBatch.h"
+#endif
+
+#ifndef _SCENE_RENDER_STATE_H_
+#include "2d/scene/SceneRenderState.h"
+#endif
+
+#ifndef _IMAGE_ASSET_H_
+#include "2d/assets/ImageAsset.h"
+#endif
+
+#ifndef _ASSET_MANAGER_H_
+#include "assets/assetManager.h"
+#endif
+
+#ifndef _GBITMAP_H_
+#include "graphics/gBitmap.h"
+#endif
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define SPRITEBATCH_UNITTEST_SLOT_OBJECTS   5000
+#define SPRITEBATCH_UNITTEST_SPRITES        100000
+#define SPRITEBATCH_UNITTEST_FRAMES         20
+#define SPRITEBATCH_UNITTEST_STATIC_SPRITES 12
+
+//-----------------------------------------------------------------------------
+
+struct SlotMapTestObject
+{
+    U32 mValue;
+};
+
+//-----------------------------------------------------------------------------
+
+class SpriteBatchTestBatch : public SpriteBatch
+{
+public:
+    void resetBatchTransform( void )
+    {
+        b2Transform transform;
+        transform.SetIdentity();
+        setBatchTransform( transform );
+    }
+};
+
+//-----------------------------------------------------------------------------
+
+static U32 prepareSpriteBatch( SpriteBatch& spriteBatch, SceneRenderQueue& renderQueue )
+{
+    const RectF renderArea( -1000.0f, -1000.0f, 2000.0f, 2000.0f );
+    SceneRenderState renderState( renderArea, Vector2::getZero(), 0.0f, MASK_ALL, MASK_ALL, Vector2::getOne(), NULL, NULL );
+
+    spriteBatch.prepareRender( NULL, &renderState, &renderQueue );
+    const U32 requestCount = (U32)renderQueue.getRenderRequests().size();
+    renderQueue.resetState();
+
+    return requestCount;
+}
+
+//-----------------------------------------------------------------------------
+
+static StringTableEntry createTestImageAsset( const char* pName, const U8 shade )
+{
+    // Write a small image.
+    GBitmap image( 8, 8, false, GBitmap::RGBA );
+    dMemset( image.getWritableBits(), shade, image.byteSize );
+
+    char fileName[1024];
+    dSprintf( fileName, sizeof(fileName), "%s/%s.png", Platform::getTemporaryDirectory(), pName );
+
+    FileStream stream;
+    if ( !stream.open( fileName, FileStream::Write ) || !image.writePNG( stream ) )
+        return StringTable->EmptyString;
+
+    stream.close();
+
+    // Add an image asset that uses it.
+    ImageAsset* pImageAsset = new ImageAsset();
+    pImageAsset->setImageFile( fileName );
+    return AssetDatabase.addPrivateAsset( pImageAsset );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SpriteBatchTests, slotMapTest )
+{
+    SlotMap<SlotMapTestObject> slotMap;
+
+    // Ids are allocated in order.
+    U32 ids[3];
+    for ( U32 n = 0; n < 3; ++n )
+    {
+        slotMap.insert( ids[n] )->mValue = n;
+        ASSERT_EQ( n + 1, ids[n] ) << "Incorrect Id for a new slot.";
+    }
+
+    // Removed Ids are not found.
+    SlotMapTestObject* pRemoved = slotMap.erase( ids[1] );
+    ASSERT_TRUE( pRemoved != NULL ) << "Failed to remove an object.";
+    ASSERT_TRUE( slotMap.find( ids[1] ) == NULL ) << "Found a removed object.";
+    ASSERT_TRUE( slotMap.erase( ids[1] ) == NULL ) << "Removed an object twice.";
+    ASSERT_EQ( 2U, slotMap.size() ) << "Incorrect size after removing an object.";
+
+    // A reused slot gets a new Id.
+    U32 reusedId;
+    SlotMapTestObject* pReused = slotMap.insert( reusedId );
+    ASSERT_EQ( pRemoved, pReused ) << "The removed object was not reused.";
+    ASSERT_NE( ids[1], reusedId ) << "A reused slot has the same Id.";
+    ASSERT_TRUE( slotMap.find( ids[1] ) == NULL ) << "An old Id found a reused slot.";
+    ASSERT_EQ( pReused, slotMap.find( reusedId ) ) << "Failed to find a reused slot.";
+
+    // Objects don't move as the slot map grows.
+    SlotMapTestObject* pFirst = slotMap.find( ids[0] );
+    for ( U32 n = 0; n < SPRITEBATCH_UNITTEST_SLOT_OBJECTS; ++n )
+    {
+        U32 id;
+        slotMap.insert( id )->mValue = id;
+    }
+    ASSERT_EQ( pFirst, slotMap.find( ids[0] ) ) << "An object moved.";
+    ASSERT_EQ( 0U, pFirst->mValue ) << "An object changed.";
+
+    // Remove every other object and check iteration sees the rest once.
+    U32 valueTotal = 0;
+    for ( SlotMap<SlotMapTestObject>::iterator itr = slotMap.begin(); itr != slotMap.end(); ++itr )
+        valueTotal += (*itr)->mValue;
+
+    for ( U32 id = 4; id < SPRITEBATCH_UNITTEST_SLOT_OBJECTS + 4; id += 2 )
+    {
+        ASSERT_TRUE( slotMap.erase( id ) != NULL ) << "Failed to remove object " << id;
+        valueTotal -= id;
+    }
+
+    U32 iteratedTotal = 0;
+    U32 iteratedCount = 0;
+    for ( SlotMap<SlotMapTestObject>::iterator itr = slotMap.begin(); itr != slotMap.end(); ++itr )
+    {
+        iteratedTotal += (*itr)->mValue;
+        iteratedCount++;
+    }
+    ASSERT_EQ( slotMap.size(), iteratedCount ) << "Incorrect iteration count.";
+    ASSERT_EQ( valueTotal, iteratedTotal ) << "Incorrect objects iterated.";
+
+    // Clearing restarts the Ids.
+    slotMap.clear();
+    ASSERT_EQ( 0U, slotMap.size() ) << "Incorrect size after clearing.";
+    ASSERT_TRUE( slotMap.find( ids[0] ) == NULL ) << "Found an object after clearing.";
+    U32 clearedId;
+    slotMap.insert( clearedId );
+    ASSERT_EQ( 1U, clearedId ) << "Incorrect Id after clearing.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SpriteBatchTests, staticBatchTest )
+{
+    const StringTableEntry imageA = createTestImageAsset( "spriteBatchTestA", 64 );
+    const StringTableEntry imageB = createTestImageAsset( "spriteBatchTestB", 192 );
+    ASSERT_NE( StringTable->EmptyString, imageA ) << "Failed to create the first image asset.";
+    ASSERT_NE( StringTable->EmptyString, imageB ) << "Failed to create the second image asset.";
+
+    SpriteBatchTestBatch spriteBatch;
+    spriteBatch.setBatchStatic( true );
+    spriteBatch.onAdd();
+    spriteBatch.resetBatchTransform();
+
+    // Add sprites alternating between the two images.
+    Vector<U32> batchIds;
+    for ( U32 n = 0; n < SPRITEBATCH_UNITTEST_STATIC_SPRITES; ++n )
+    {
+        const U32 batchId = spriteBatch.addSprite( SpriteBatchItem::LogicalPosition() );
+        ASSERT_NE( 0U, batchId ) << "Failed to add a sprite.";
+        spriteBatch.setSpriteLocalPosition( Vector2( (F32)n, 0.0f ) );
+        spriteBatch.setSpriteImage( (n & 1) ? imageB : imageA, 0U );
+        batchIds.push_back( batchId );
+    }
+
+    // The sprites are baked into a run per texture.
+    ASSERT_TRUE( spriteBatch.getStaticBatchDirty() ) << "The static batch is not dirty after adding sprites.";
+    spriteBatch.updateStaticBatch();
+    const BatchRender::StaticBatch* pStaticBatch = spriteBatch.getStaticBatch();
+    ASSERT_TRUE( pStaticBatch != NULL ) << "The static batch was not created.";
+    ASSERT_FALSE( spriteBatch.getStaticBatchDirty() ) << "The static batch is dirty after updating.";
+    ASSERT_EQ( (U32)SPRITEBATCH_UNITTEST_STATIC_SPRITES, pStaticBatch->getQuadCount() ) << "Incorrect quad count after adding.";
+    ASSERT_EQ( 2U, pStaticBatch->getRunCount() ) << "Incorrect run count after adding.";
+
+    // Moving a sprite rebuilds the batch without changing it.
+    ASSERT_TRUE( spriteBatch.selectSpriteId( batchIds[0] ) ) << "Failed to select a sprite.";
+    spriteBatch.setSpriteLocalPosition( Vector2( 0.0f, 5.0f ) );
+    ASSERT_TRUE( spriteBatch.getStaticBatchDirty() ) << "The static batch is not dirty after moving a sprite.";
+    spriteBatch.updateStaticBatch();
+    ASSERT_EQ( (U32)SPRITEBATCH_UNITTEST_STATIC_SPRITES, pStaticBatch->getQuadCount() ) << "Incorrect quad count after moving.";
+    ASSERT_EQ( 2U, pStaticBatch->getRunCount() ) << "Incorrect run count after moving.";
+
+    // Hidden sprites are left out of the batch.
+    for ( U32 n = 1; n < SPRITEBATCH_UNITTEST_STATIC_SPRITES; n += 2 )
+    {
+        ASSERT_TRUE( spriteBatch.selectSpriteId( batchIds[n] ) ) << "Failed to select a sprite.";
+        spriteBatch.setSpriteVisible( false );
+    }
+    spriteBatch.updateStaticBatch();
+    ASSERT_EQ( (U32)SPRITEBATCH_UNITTEST_STATIC_SPRITES / 2, pStaticBatch->getQuadCount() ) << "Incorrect quad count after hiding.";
+    ASSERT_EQ( 1U, pStaticBatch->getRunCount() ) << "Incorrect run count after hiding.";
+
+    // Removing a sprite removes its quad.
+    ASSERT_TRUE( spriteBatch.selectSpriteId( batchIds[0] ) ) << "Failed to select a sprite.";
+    ASSERT_TRUE( spriteBatch.removeSprite() ) << "Failed to remove a sprite.";
+    spriteBatch.updateStaticBatch();
+    ASSERT_EQ( (U32)SPRITEBATCH_UNITTEST_STATIC_SPRITES / 2 - 1, pStaticBatch->getQuadCount() ) << "Incorrect quad count after removing.";
+
+    // Refreshing an image the sprites use rebuilds the batch.
+    ASSERT_FALSE( spriteBatch.getStaticBatchDirty() ) << "The static batch is dirty after updating.";
+    ASSERT_TRUE( AssetDatabase.refreshAsset( imageA ) ) << "Failed to refresh the image asset.";
+    ASSERT_TRUE( spriteBatch.getStaticBatchDirty() ) << "The static batch is not dirty after refreshing an image.";
+
+    // Leaving static mode deletes the batch.
+    spriteBatch.setBatchStatic( false );
+    ASSERT_TRUE( spriteBatch.getStaticBatch() == NULL ) << "The static batch was not deleted.";
+
+    spriteBatch.clearSprites();
+    spriteBatch.onRemove();
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SpriteBatchTests, spriteBatchBenchmark )
+{
+    SpriteBatchTestBatch spriteBatch;
+    spriteBatch.setBatchCulling( false );
+    spriteBatch.onAdd();
+    spriteBatch.resetBatchTransform();
+
+    SceneRenderQueue renderQueue;
+
+    // Add the sprites.
+    Vector<U32> batchIds;
+    batchIds.reserve( SPRITEBATCH_UNITTEST_SPRITES );
+    U32 startTime = Platform::getRealMilliseconds();
+    for ( U32 n = 0; n < SPRITEBATCH_UNITTEST_SPRITES; ++n )
+    {
+        const U32 batchId = spriteBatch.addSprite( SpriteBatchItem::LogicalPosition() );
+        ASSERT_NE( 0U, batchId ) << "Failed to add a sprite.";
+        spriteBatch.setSpriteLocalPosition( Vector2( (F32)(n % 300), (F32)(n / 300) ) );
+        batchIds.push_back( batchId );
+    }
+    const U32 addTime = Platform::getRealMilliseconds() - startTime;
+
+    ASSERT_EQ( (U32)SPRITEBATCH_UNITTEST_SPRITES, spriteBatch.getSpriteCount() ) << "Incorrect sprite count after adding.";
+
+    // Prepare all the sprites for rendering.
+    startTime = Platform::getRealMilliseconds();
+    for ( U32 frame = 0; frame < SPRITEBATCH_UNITTEST_FRAMES; ++frame )
+    {
+        ASSERT_EQ( (U32)SPRITEBATCH_UNITTEST_SPRITES, prepareSpriteBatch( spriteBatch, renderQueue ) ) << "Incorrect render request count.";
+    }
+    const U32 prepareTime = Platform::getRealMilliseconds() - startTime;
+
+    // Remove every other sprite.
+    startTime = Platform::getRealMilliseconds();
+    for ( U32 n = 0; n < SPRITEBATCH_UNITTEST_SPRITES; n += 2 )
+    {
+        spriteBatch.selectSpriteId( batchIds[n] );
+        ASSERT_TRUE( spriteBatch.removeSprite() ) << "Failed to remove sprite " << batchIds[n];
+    }
+    const U32 removeTime = Platform::getRealMilliseconds() - startTime;
+
+    ASSERT_EQ( (U32)SPRITEBATCH_UNITTEST_SPRITES / 2, spriteBatch.getSpriteCount() ) << "Incorrect sprite count after removing.";
+    ASSERT_EQ( (U32)SPRITEBATCH_UNITTEST_SPRITES / 2, prepareSpriteBatch( spriteBatch, renderQueue ) ) << "Incorrect render request count after removing.";
+
+    // The remaining sprites keep their Ids.
+    for ( U32 n = 1; n < SPRITEBATCH_UNITTEST_SPRITES; n += 2 )
+    {
+        ASSERT_TRUE( spriteBatch.selectSpriteId( batchIds[n] ) ) << "Failed to find sprite " << batchIds[n];
+        ASSERT_EQ( batchIds[n], spriteBatch.getSpriteId() ) << "Incorrect sprite selected.";
+    }
+
+    // Refill the removed sprites.
+    for ( U32 n = 0; n < SPRITEBATCH_UNITTEST_SPRITES; n += 2 )
+    {
+        const U32 batchId = spriteBatch.addSprite( SpriteBatchItem::LogicalPosition() );
+        ASSERT_NE( batchIds[n], batchId ) << "A removed sprite Id was reused.";
+    }
+    ASSERT_EQ( (U32)SPRITEBATCH_UNITTEST_SPRITES, spriteBatch.getSpriteCount() ) << "Incorrect sprite count after refilling.";
+
+    // Clear the sprites.
+    startTime = Platform::getRealMilliseconds();
+    spriteBatch.clearSprites();
+    const U32 clearTime = Platform::getRealMilliseconds() - startTime;
+
+    ASSERT_EQ( 0U, spriteBatch.getSpriteCount() ) << "Incorrect sprite count after clearing.";
+
+    spriteBatch.onRemove();
+
+    Con::printf( "SpriteBatch: %d sprites - add %dms, %d prepares %dms, remove half %dms, clear %dms.",
+        SPRITEBATCH_UNITTEST_SPRITES, addTime, SPRITEBATCH_UNITTEST_FRAMES, prepareTime, removeTime, clearTime );
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,209 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _TAML_H_
+#include "persistence/taml/taml.h"
+#endif
+
+#ifndef _SIMBASE_H_
+#include "sim/simBase.h"
+#endif
+
+#ifndef _SCRIPT_OBJECT_H_
+#include "sim/scriptObject.h"
+#endif
+
+#ifndef _TAML_ASYNC_READER_H_
+#include "persistence/taml/tamlAsyncReader.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define TAML_UNITTEST_BENCHMARK_OBJECTS     2000
+#define TAML_UNITTEST_BENCHMARK_READS       5
+#define TAML_UNITTEST_ASYNC_OBJECTS         200
+#define TAML_UNITTEST_ASYNC_MAX_FRAMES      1000000
+
+//-----------------------------------------------------------------------------
+
+static SimGroup* createTestGroup( const U32 objectCount )
+{
+    SimGroup* pGroup = new SimGroup();
+    pGroup->registerObject();
+
+    for ( U32 index = 0; index < objectCount; ++index )
+    {
+        char buffer[64];
+        ScriptObject* pObject = new ScriptObject();
+        pObject->registerObject();
+
+        // Set static and dynamic fields.
+        dSprintf( buffer, sizeof(buffer), "tamlTest%d", index );
+        pObject->setDataField( StringTable->insert("internalName"), NULL, buffer );
+        dSprintf( buffer, sizeof(buffer), "%d %d", index, index * 2 );
+        pObject->setDataField( StringTable->insert("position"), NULL, buffer );
+        pObject->setDataField( StringTable->insert("label"), NULL, "A label that is a little longer than the other fields." );
+
+        pGroup->addObject( pObject );
+    }
+
+    return pGroup;
+}
+
+//-----------------------------------------------------------------------------
+
+static void checkTestGroup( SimObject* pSimObject, const U32 objectCount )
+{
+    SimGroup* pGroup = dynamic_cast<SimGroup*>( pSimObject );
+    ASSERT_TRUE( pGroup != NULL ) << "The group was not read.";
+    ASSERT_EQ( objectCount, (U32)pGroup->size() ) << "Incorrect object count.";
+
+    char buffer[64];
+    for ( U32 index = 0; index < objectCount; index += objectCount / 10 + 1 )
+    {
+        SimObject* pObject = pGroup->at( index );
+        dSprintf( buffer, sizeof(buffer), "tamlTest%d", index );
+        ASSERT_STREQ( buffer, pObject->getInternalName() ) << "Incorrect static field.";
+        dSprintf( buffer, sizeof(buffer), "%d %d", index, index * 2 );
+        ASSERT_STREQ( buffer, pObject->getDataField( StringTable->insert("position"), NULL ) ) << "Incorrect dynamic field.";
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( TamlReadTests, readBenchmark )
+{
+    const Taml::TamlFormatMode formatModes[] = { Taml::XmlFormat, Taml::JSONFormat, Taml::BinaryFormat, Taml::BinaryFormat };
+    const bool compressed[] = { false, false, false, true };
+    const char* formatNames[] = { "xml", "json", "binary", "compressed binary" };
+    const U32 formatCount = sizeof(formatModes) / sizeof(Taml::TamlFormatMode);
+
+    SimGroup* pGroup = createTestGroup( TAML_UNITTEST_BENCHMARK_OBJECTS );
+
+    char fileName[1024];
+    dSprintf( fileName, sizeof(fileName), "%s/tamlReadTest.taml", Platform::getTemporaryDirectory() );
+
+    U32 readTimes[formatCount];
+    for ( U32 formatIndex = 0; formatIndex < formatCount; ++formatIndex )
+    {
+        Taml taml;
+        taml.setAutoFormat( false );
+        taml.setFormatMode( formatModes[formatIndex] );
+        taml.setBinaryCompression( compressed[formatIndex] );
+        ASSERT_TRUE( taml.write( pGroup, fileName ) ) << "The " << formatNames[formatIndex] << " file was not written.";
+
+        // Read the file repeatedly checking the first read.
+        const U32 startTime = Platform::getRealMilliseconds();
+        for ( U32 read = 0; read < TAML_UNITTEST_BENCHMARK_READS; ++read )
+        {
+            SimObject* pSimObject = taml.read( fileName );
+
+            if ( read == 0 )
+                checkTestGroup( pSimObject, TAML_UNITTEST_BENCHMARK_OBJECTS );
+
+            if ( pSimObject != NULL )
+                pSimObject->deleteObject();
+        }
+        readTimes[formatIndex] = Platform::getRealMilliseconds() - startTime;
+    }
+
+    pGroup->deleteObject();
+    Platform::fileDelete( fileName );
+
+    for ( U32 formatIndex = 0; formatIndex < formatCount; ++formatIndex )
+    {
+        Con::printf( "TamlRead: %d reads of %d objects (%s) - %dms.",
+            TAML_UNITTEST_BENCHMARK_READS, TAML_UNITTEST_BENCHMARK_OBJECTS, formatNames[formatIndex], readTimes[formatIndex] );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( TamlReadTests, asyncReadTest )
+{
+    const Taml::TamlFormatMode formatModes[] = { Taml::XmlFormat, Taml::JSONFormat, Taml::BinaryFormat };
+    const U32 formatCount = sizeof(formatModes) / sizeof(Taml::TamlFormatMode);
+
+    Con::evaluate(
+        "function TamlAsyncReadTest::onAsyncReadProgress(%this, %readId, %progress) { $tamlAsyncReadProgressCount++; }"
+        "function TamlAsyncReadTest::onAsyncReadComplete(%this, %readId, %object) { $tamlAsyncReadId = %readId; $tamlAsyncReadObject = %object; }" );
+
+    // Commit a single element each frame.
+    const S32 budget = Con::getIntVariable( TAML_ASYNC_READ_BUDGET_VARIABLE, TAML_ASYNC_READ_DEFAULT_BUDGET );
+    Con::setIntVariable( TAML_ASYNC_READ_BUDGET_VARIABLE, 0 );
+
+    SimGroup* pGroup = createTestGroup( TAML_UNITTEST_ASYNC_OBJECTS );
+
+    char fileName[1024];
+    dSprintf( fileName, sizeof(fileName), "%s/tamlAsyncReadTest.taml", Platform::getTemporaryDirectory() );
+
+    for ( U32 formatIndex = 0; formatIndex < formatCount; ++formatIndex )
+    {
+        Taml* pTaml = new Taml();
+        pTaml->setDataField( StringTable->insert("class"), NULL, "TamlAsyncReadTest" );
+        pTaml->registerObject();
+        pTaml->setAutoFormat( false );
+        pTaml->setFormatMode( formatModes[formatIndex] );
+        ASSERT_TRUE( pTaml->write( pGroup, fileName ) ) << "The file was not written (format " << formatIndex << ").";
+
+        Con::setIntVariable( "$tamlAsyncReadProgressCount", 0 );
+        Con::setVariable( "$tamlAsyncReadObject", "" );
+
+        const U32 readId = pTaml->readAsync( fileName );
+        ASSERT_NE( 0U, readId ) << "The read was not started (format " << formatIndex << ").";
+
+        // Run frames until the read completes.
+        for ( U32 frame = 0; frame < TAML_UNITTEST_ASYNC_MAX_FRAMES && TamlAsyncReader::getPendingCount() > 0; ++frame )
+            TamlAsyncReader::process();
+
+        ASSERT_EQ( 0U, TamlAsyncReader::getPendingCount() ) << "The read did not complete (format " << formatIndex << ").";
+        ASSERT_EQ( (S32)readId, Con::getIntVariable( "$tamlAsyncReadId" ) ) << "Incorrect read Id (format " << formatIndex << ").";
+        ASSERT_LT( TAML_UNITTEST_ASYNC_OBJECTS, (U32)Con::getIntVariable( "$tamlAsyncReadProgressCount" ) ) << "The read was not spread over frames (format " << formatIndex << ").";
+
+        SimObject* pSimObject = Sim::findObject( Con::getVariable( "$tamlAsyncReadObject" ) );
+        checkTestGroup( pSimObject, TAML_UNITTEST_ASYNC_OBJECTS );
+
+        if ( pSimObject != NULL )
+            pSimObject->deleteObject();
+
+        pTaml->deleteObject();
+    }
+
+    pGroup->deleteObject();
+    Platform::fileDelete( fileName );
+
+    Con::setIntVariable( TAML_ASYNC_READ_BUDGET_VARIABLE, budget );
+}
+
+#endif // TORQUE_SHIPPING
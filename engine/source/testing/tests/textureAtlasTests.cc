@@ -0,0 +1,382 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _TEXTURE_ATLAS_H_
+#include "graphics/TextureAtlas.h"
+#endif
+
+#ifndef _GBITMAP_H_
+#include "graphics/gBitmap.h"
+#endif
+
+#ifndef _IMAGE_ASSET_H_
+#include "2d/assets/ImageAsset.h"
+#endif
+
+#ifndef _ASSET_MANAGER_H_
+#include "assets/assetManager.h"
+#endif
+
+#ifndef _ASSET_PTR_H_
+#include "assets/assetPtr.h"
+#endif
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define TEXTURE_ATLAS_UNITTEST_PAGE_SIZE        512
+#define TEXTURE_ATLAS_UNITTEST_PADDING          2
+#define TEXTURE_ATLAS_UNITTEST_IMAGE_COUNT      96
+#define TEXTURE_ATLAS_UNITTEST_SPRITE_COUNT     2000
+
+//-----------------------------------------------------------------------------
+
+static U32 nextTestRandom( U32& seed )
+{
+    seed = seed * 1664525 + 1013904223;
+    return seed >> 8;
+}
+
+//-----------------------------------------------------------------------------
+
+// Enables packing and restores it however the test exits.
+class TextureAtlasTestScope
+{
+public:
+    const bool mPreviousEnabled;
+
+    TextureAtlasTestScope() : mPreviousEnabled( TextureAtlas::getEnabled() ) { Con::setBoolVariable( TEXTURE_ATLAS_ENABLED_VARIABLE, true ); }
+    ~TextureAtlasTestScope() { Con::setBoolVariable( TEXTURE_ATLAS_ENABLED_VARIABLE, mPreviousEnabled ); }
+};
+
+//-----------------------------------------------------------------------------
+
+static bool writeTestImage( const char* pFileName, const U32 size, const U8 shade )
+{
+    // Write a square image of a single shade.
+    GBitmap image( size, size, false, GBitmap::RGB );
+    dMemset( image.getWritableBits(), shade, image.byteSize );
+
+    FileStream stream;
+    if ( !stream.open( pFileName, FileStream::Write ) || !image.writePNG( stream ) )
+        return false;
+
+    stream.close();
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+static bool checkPageImage( TextureHandle& texture, const RectI& imageArea, const U8 shade )
+{
+    // Check the image area of the page holds the image.
+    const GBitmap* pPage = texture.getBitmap();
+    for ( S32 y = imageArea.point.y; y < imageArea.point.y + imageArea.extent.y; ++y )
+    {
+        for ( S32 x = imageArea.point.x; x < imageArea.point.x + imageArea.extent.x; ++x )
+        {
+            const U8* pPixel = pPage->getAddress( x, y );
+            if ( pPixel[0] != shade || pPixel[1] != shade || pPixel[2] != shade || pPixel[3] != 0xFF )
+                return false;
+        }
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+static void checkFrameAreas( ImageAsset* pImageAsset, const RectI& imageArea )
+{
+    // The frames must be moved onto the image area of the page.
+    TextureObject* pTextureObject = (TextureObject*)pImageAsset->getImageTexture();
+    const F32 texelWidthScale = 1.0f / (F32)pTextureObject->getTextureWidth();
+    const F32 texelHeightScale = 1.0f / (F32)pTextureObject->getTextureHeight();
+
+    for ( U32 frame = 0; frame < pImageAsset->getFrameCount(); ++frame )
+    {
+        const ImageAsset::FrameArea& frameArea = pImageAsset->getImageFrameArea( frame );
+        const ImageAsset::FrameArea::PixelArea& pixelArea = frameArea.mPixelArea;
+        const ImageAsset::FrameArea::TexelArea& texelArea = frameArea.mTexelArea;
+        const F32 pageX = (F32)(imageArea.point.x + pixelArea.mPixelOffset.x);
+        const F32 pageY = (F32)(imageArea.point.y + pixelArea.mPixelOffset.y);
+
+        ASSERT_FLOAT_EQ( pageX * texelWidthScale, texelArea.mTexelLower.x ) << "Incorrect lower texel for frame " << frame;
+        ASSERT_FLOAT_EQ( pageY * texelHeightScale, texelArea.mTexelLower.y ) << "Incorrect lower texel for frame " << frame;
+        ASSERT_FLOAT_EQ( (pageX + pixelArea.mPixelWidth) * texelWidthScale, texelArea.mTexelUpper.x ) << "Incorrect upper texel for frame " << frame;
+        ASSERT_FLOAT_EQ( (pageY + pixelArea.mPixelHeight) * texelHeightScale, texelArea.mTexelUpper.y ) << "Incorrect upper texel for frame " << frame;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( TextureAtlasTests, packerTest )
+{
+    RectanglePacker packer;
+    packer.reset( TEXTURE_ATLAS_UNITTEST_PAGE_SIZE, TEXTURE_ATLAS_UNITTEST_PAGE_SIZE );
+
+    // Pack rectangles until the packer is full.
+    Vector<RectI> packed;
+    U32 usedArea = 0;
+    U32 seed = 1;
+    for ( U32 attempt = 0; attempt < 1000; ++attempt )
+    {
+        const U32 width = 4 + nextTestRandom( seed ) % 60;
+        const U32 height = 4 + nextTestRandom( seed ) % 60;
+
+        Point2I position;
+        if ( !packer.insert( width, height, position ) )
+            continue;
+
+        packed.push_back( RectI( position, Point2I( width, height ) ) );
+        usedArea += width * height;
+    }
+
+    ASSERT_GT( packed.size(), 50 ) << "Too few rectangles were packed.";
+    ASSERT_EQ( usedArea, packer.getUsedArea() ) << "Incorrect used area.";
+    ASSERT_GT( packer.getOccupancy(), 0.5f ) << "The packer is wasting too much space.";
+
+    // The rectangles must be in bounds and not overlap.
+    for ( S32 i = 0; i < packed.size(); ++i )
+    {
+        const RectI& rect = packed[i];
+        ASSERT_TRUE( rect.point.x >= 0 && rect.point.y >= 0 ) << "Rectangle " << i << " is off the page.";
+        ASSERT_TRUE( rect.point.x + rect.extent.x <= TEXTURE_ATLAS_UNITTEST_PAGE_SIZE && rect.point.y + rect.extent.y <= TEXTURE_ATLAS_UNITTEST_PAGE_SIZE ) << "Rectangle " << i << " is off the page.";
+
+        for ( S32 j = i + 1; j < packed.size(); ++j )
+        {
+            const RectI& other = packed[j];
+            const bool separate =
+                rect.point.x + rect.extent.x <= other.point.x || other.point.x + other.extent.x <= rect.point.x ||
+                rect.point.y + rect.extent.y <= other.point.y || other.point.y + other.extent.y <= rect.point.y;
+            ASSERT_TRUE( separate ) << "Rectangles " << i << " and " << j << " overlap.";
+        }
+    }
+
+    // Resetting empties the packer.
+    packer.reset( 64, 64 );
+    Point2I position;
+    ASSERT_EQ( 0U, packer.getUsedArea() ) << "The packer was not reset.";
+    ASSERT_TRUE( packer.insert( 64, 64, position ) ) << "A full page rectangle was not packed.";
+    ASSERT_TRUE( position.x == 0 && position.y == 0 ) << "A full page rectangle was not packed at the origin.";
+    ASSERT_FALSE( packer.insert( 1, 1, position ) ) << "A rectangle was packed into a full page.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( TextureAtlasTests, extrusionTest )
+{
+    // Create an RGB image with a distinct color per pixel.
+    const U32 imageWidth = 3;
+    const U32 imageHeight = 2;
+    GBitmap image( imageWidth, imageHeight, false, GBitmap::RGB );
+    for ( U32 y = 0; y < imageHeight; ++y )
+    {
+        for ( U32 x = 0; x < imageWidth; ++x )
+        {
+            U8* pPixel = image.getAddress( x, y );
+            pPixel[0] = (U8)(x * 10);
+            pPixel[1] = (U8)(y * 10);
+            pPixel[2] = 200;
+        }
+    }
+
+    // Copy it into a clear page.
+    GBitmap page( 16, 16, false, GBitmap::RGBA );
+    dMemset( page.getWritableBits(), 0, page.byteSize );
+    const Point2I position( 5, 4 );
+    TextureAtlas::copyImage( &image, &page, position, TEXTURE_ATLAS_UNITTEST_PADDING );
+
+    // The padded area holds the nearest image pixel and everything else is untouched.
+    const S32 padding = TEXTURE_ATLAS_UNITTEST_PADDING;
+    for ( S32 y = 0; y < 16; ++y )
+    {
+        for ( S32 x = 0; x < 16; ++x )
+        {
+            const U8* pPixel = page.getAddress( x, y );
+            const S32 localX = x - position.x - padding;
+            const S32 localY = y - position.y - padding;
+
+            if ( localX < -padding || localX >= (S32)imageWidth + padding || localY < -padding || localY >= (S32)imageHeight + padding )
+            {
+                ASSERT_TRUE( pPixel[0] == 0 && pPixel[1] == 0 && pPixel[2] == 0 && pPixel[3] == 0 ) << "Pixel " << x << "," << y << " outside the padded image was written.";
+                continue;
+            }
+
+            const S32 sourceX = mClamp( localX, 0, imageWidth - 1 );
+            const S32 sourceY = mClamp( localY, 0, imageHeight - 1 );
+            ASSERT_EQ( sourceX * 10, pPixel[0] ) << "Incorrect red at " << x << "," << y;
+            ASSERT_EQ( sourceY * 10, pPixel[1] ) << "Incorrect green at " << x << "," << y;
+            ASSERT_EQ( 200, pPixel[2] ) << "Incorrect blue at " << x << "," << y;
+            ASSERT_EQ( 255, pPixel[3] ) << "Incorrect alpha at " << x << "," << y;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( TextureAtlasTests, textureChangeBenchmarkTest )
+{
+    // Pack a set of small images into pages the way the atlas does.
+    Vector<RectanglePacker*> pages;
+    Vector<U32> imagePages;
+    U32 seed = 7;
+    for ( U32 image = 0; image < TEXTURE_ATLAS_UNITTEST_IMAGE_COUNT; ++image )
+    {
+        const U32 paddedWidth = 16 + nextTestRandom( seed ) % 49 + TEXTURE_ATLAS_UNITTEST_PADDING * 2;
+        const U32 paddedHeight = 16 + nextTestRandom( seed ) % 49 + TEXTURE_ATLAS_UNITTEST_PADDING * 2;
+
+        Point2I position;
+        U32 pageIndex = 0;
+        while ( pageIndex < (U32)pages.size() && !pages[pageIndex]->insert( paddedWidth, paddedHeight, position ) )
+            ++pageIndex;
+
+        if ( pageIndex == (U32)pages.size() )
+        {
+            RectanglePacker* pPacker = new RectanglePacker();
+            pPacker->reset( TEXTURE_ATLAS_UNITTEST_PAGE_SIZE, TEXTURE_ATLAS_UNITTEST_PAGE_SIZE );
+            ASSERT_TRUE( pPacker->insert( paddedWidth, paddedHeight, position ) ) << "An image did not fit an empty page.";
+            pages.push_back( pPacker );
+        }
+
+        imagePages.push_back( pageIndex );
+    }
+
+    // Draw sprites in a scene order that ignores their images, counting the texture changes
+    // that would flush the batch with a texture per image and with the atlas pages.
+    U32 imageTextureChanges = 0;
+    U32 atlasTextureChanges = 0;
+    U32 lastImage = U32_MAX;
+    U32 lastPage = U32_MAX;
+    for ( U32 sprite = 0; sprite < TEXTURE_ATLAS_UNITTEST_SPRITE_COUNT; ++sprite )
+    {
+        const U32 image = nextTestRandom( seed ) % TEXTURE_ATLAS_UNITTEST_IMAGE_COUNT;
+        const U32 page = imagePages[image];
+
+        if ( image != lastImage )
+            imageTextureChanges++;
+        if ( page != lastPage )
+            atlasTextureChanges++;
+
+        lastImage = image;
+        lastPage = page;
+    }
+
+    // The images fit a single page so the atlas only binds it once.
+    ASSERT_EQ( 1, pages.size() ) << "The images were packed into too many pages.";
+    ASSERT_GT( imageTextureChanges, (U32)(TEXTURE_ATLAS_UNITTEST_SPRITE_COUNT * 9 / 10) ) << "Expected nearly every sprite to change texture.";
+    ASSERT_EQ( 1U, atlasTextureChanges ) << "The atlas did not remove the texture changes.";
+
+    for ( U32 index = 0; index < (U32)pages.size(); ++index )
+        delete pages[index];
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( TextureAtlasTests, imageAssetTest )
+{
+    TextureAtlasTestScope atlasScope;
+
+    char fileA[1024];
+    char fileB[1024];
+    dSprintf( fileA, sizeof(fileA), "%s/textureAtlasTestA.png", Platform::getTemporaryDirectory() );
+    dSprintf( fileB, sizeof(fileB), "%s/textureAtlasTestB.png", Platform::getTemporaryDirectory() );
+    ASSERT_TRUE( writeTestImage( fileA, 16, 40 ) ) << "Failed to write the first image.";
+    ASSERT_TRUE( writeTestImage( fileB, 8, 120 ) ) << "Failed to write the second image.";
+
+    // Pack both images.
+    TextureHandle textureA;
+    TextureHandle textureB;
+    RectI areaA;
+    RectI areaB;
+    GBitmap* pUnpackedBitmap;
+    const U32 entryA = TextureAtlas::acquire( fileA, GL_NEAREST, textureA, areaA, pUnpackedBitmap );
+    ASSERT_NE( 0U, entryA ) << "The first image was not packed.";
+    ASSERT_TRUE( pUnpackedBitmap == NULL ) << "A packed image was handed back.";
+    const U32 entryB = TextureAtlas::acquire( fileB, GL_NEAREST, textureB, areaB, pUnpackedBitmap );
+    ASSERT_NE( 0U, entryB ) << "The second image was not packed.";
+
+    // The images share a page without overlapping and the page holds them.
+    ASSERT_TRUE( (TextureObject*)textureA == (TextureObject*)textureB ) << "The images were packed into different pages.";
+    ASSERT_TRUE( areaA.extent.x == 16 && areaA.extent.y == 16 ) << "Incorrect first image area.";
+    ASSERT_TRUE( areaB.extent.x == 8 && areaB.extent.y == 8 ) << "Incorrect second image area.";
+    ASSERT_FALSE( areaA.overlaps( areaB ) ) << "The images overlap.";
+    ASSERT_TRUE( checkPageImage( textureA, areaA, 40 ) ) << "The page does not hold the first image.";
+    ASSERT_TRUE( checkPageImage( textureB, areaB, 120 ) ) << "The page does not hold the second image.";
+
+    // Packing an image again shares it.
+    TextureHandle sharedTexture;
+    RectI sharedArea;
+    ASSERT_EQ( entryA, TextureAtlas::acquire( fileA, GL_NEAREST, sharedTexture, sharedArea, pUnpackedBitmap ) ) << "A packed image was not shared.";
+    ASSERT_TRUE( sharedArea == areaA ) << "A shared image moved.";
+    TextureAtlas::release( entryA );
+    TextureAtlas::release( entryB );
+
+    // An image asset of the packed image uses the page with its cells moved onto the image.
+    ImageAsset* pImageAsset = new ImageAsset();
+    pImageAsset->setImageFile( fileA );
+    pImageAsset->setFilterMode( ImageAsset::FILTER_NEAREST );
+    pImageAsset->setCellCountX( 2 );
+    pImageAsset->setCellCountY( 2 );
+    pImageAsset->setCellWidth( 8 );
+    pImageAsset->setCellHeight( 8 );
+    const StringTableEntry assetId = AssetDatabase.addPrivateAsset( pImageAsset );
+    AssetPtr<ImageAsset> imageAsset( assetId );
+    ASSERT_TRUE( imageAsset->getAtlasPacked() ) << "The image asset was not packed.";
+    ASSERT_TRUE( (TextureObject*)imageAsset->getImageTexture() == (TextureObject*)textureA ) << "The image asset is not using the page.";
+    ASSERT_TRUE( imageAsset->getImageTextureOffset() == areaA.point ) << "The image asset is not using the packed image.";
+    ASSERT_EQ( 16, imageAsset->getImageWidth() ) << "Incorrect image asset width.";
+    ASSERT_EQ( 4U, imageAsset->getFrameCount() ) << "Incorrect image asset frame count.";
+    checkFrameAreas( imageAsset, areaA );
+
+    // Refreshing after the file changes copies the image into the page again.
+    ASSERT_TRUE( writeTestImage( fileA, 16, 80 ) ) << "Failed to rewrite the first image.";
+    ASSERT_TRUE( AssetDatabase.refreshAsset( assetId ) ) << "Failed to refresh the image asset.";
+    ASSERT_TRUE( imageAsset->getImageTextureOffset() == areaA.point ) << "The refreshed image moved.";
+    ASSERT_TRUE( checkPageImage( textureA, areaA, 80 ) ) << "The page holds a stale image after refreshing.";
+    checkFrameAreas( imageAsset, areaA );
+
+    // Refreshing after the image changes size packs it again.
+    ASSERT_TRUE( writeTestImage( fileA, 24, 160 ) ) << "Failed to resize the first image.";
+    ASSERT_TRUE( AssetDatabase.refreshAsset( assetId ) ) << "Failed to refresh the image asset.";
+    ASSERT_TRUE( imageAsset->getAtlasPacked() ) << "The resized image asset was not packed.";
+    ASSERT_EQ( 24, imageAsset->getImageWidth() ) << "Incorrect resized image asset width.";
+    const RectI resizedArea( imageAsset->getImageTextureOffset(), Point2I( 24, 24 ) );
+    ASSERT_TRUE( checkPageImage( imageAsset->getImageTexture(), resizedArea, 160 ) ) << "The page does not hold the resized image.";
+    checkFrameAreas( imageAsset, resizedArea );
+
+    imageAsset.clear();
+    TextureAtlas::release( entryA );
+}
+
+#endif // TORQUE_SHIPPING
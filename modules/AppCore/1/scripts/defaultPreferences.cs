@@ -54,6 +54,10 @@ $pref::T2D::ParticlePlayerTimeScale = 1.0;
 $pref::T2D::warnFileDeprecated = 1;
 $pref::T2D::warnSceneOccupancy = 1;
 $pref::T2D::imageAssetGlobalFilterMode = Bilinear;
+$pref::T2D::imageAssetAtlas = 0;
+$pref::T2D::imageAssetAtlasPageSize = 1024;
+$pref::T2D::imageAssetAtlasMaxImageSize = 256;
+$pref::T2D::imageAssetAtlasPadding = 2;
 $pref::T2D::TAMLSchema="";
 $pref::T2D::JSONStrict = 1;
 